@@ -361,6 +361,13 @@ public:
      */
     const String& getSavedPropertyValue(const String& propertyName);
 
+    /** retrieves saved value as parsed by \a interpolator, the parsed value is
+     * cached until the property value is saved again or purged. Returns 0 if
+     * the interpolator does not support parsed values.
+     */
+    const InterpolatorValue* getParsedSavedPropertyValue(
+        const String& propertyName, Interpolator* interpolator);
+
     /*!
     \brief
         Internal method, adds reference to created auto connection
@@ -443,6 +450,13 @@ private:
      */
     PropertyValueMap d_savedPropertyValues;
 
+    //! Interpolator::getSerial of the creating interpolator and the value.
+    typedef std::pair<uint, InterpolatorValue*> ParsedPropertyValue;
+    typedef std::map<String, ParsedPropertyValue, std::less<String>
+        CEGUI_MAP_ALLOC(String, ParsedPropertyValue)> ParsedPropertyValueMap;
+    //! saved values as parsed by the interpolator last used with them
+    ParsedPropertyValueMap d_parsedPropertyValues;
+
     typedef std::vector<Event::Connection
         CEGUI_VECTOR_ALLOC(Event::Connection)> ConnectionTracker;
     //! tracks auto event connections we make.
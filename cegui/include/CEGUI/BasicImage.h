@@ -56,6 +56,14 @@ public:
     void setAutoScaled(const AutoScaledMode autoscaled);
     void setNativeResolution(const Sizef& native_res);
 
+    //! Return the Texture used by this image.
+    Texture* getTexture() const
+    { return d_texture; }
+
+    //! Return the pixel area on the texture that is used by this image.
+    const Rectf& getArea() const
+    { return d_area; }
+
     // Implement CEGUI::Image interface
     const String& getName() const;
     const Sizef& getRenderedSize() const;
@@ -45,6 +45,7 @@
 #include "CEGUI/ColourRect.h"
 #include "CEGUI/CoordConverter.h"
 #include "CEGUI/DataContainer.h"
+#include "CEGUI/DecodedImageCache.h"
 #include "CEGUI/DefaultLogger.h"
 #include "CEGUI/DefaultRenderedStringParser.h"
 #include "CEGUI/DefaultResourceProvider.h"
@@ -107,6 +108,7 @@
 #include "CEGUI/SystemKeys.h"
 #include "CEGUI/Texture.h"
 #include "CEGUI/TextureTarget.h"
+#include "CEGUI/TextureTargetPool.h"
 #include "CEGUI/TextUtils.h"
 #include "CEGUI/TplInterpolators.h"
 #include "CEGUI/TplWindowFactory.h"
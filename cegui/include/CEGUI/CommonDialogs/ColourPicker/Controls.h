@@ -160,6 +160,16 @@ protected:
     static const float LAB_B_MAX;
     static const float LAB_B_DIFF;
 
+    //! Flags for the images held in the colour picker controls texture.
+    enum TextureImage
+    {
+        TextureImage_Picking = 1,
+        TextureImage_ColourSlider = 1 << 1,
+        TextureImage_AlphaSlider = 1 << 2,
+        TextureImage_All = TextureImage_Picking | TextureImage_ColourSlider |
+                           TextureImage_AlphaSlider
+    };
+
     void initColourPickerControlsImageSet();
     void deinitColourPickerControlsTexture();
     void refreshColourPickerControlsTextures();
@@ -170,6 +180,28 @@ protected:
 
     void reloadColourPickerControlsTexture();
 
+    /*!
+    \brief
+        Mark the given TextureImage flags as needing to be regenerated.  The
+        work is done once per frame, from updateSelf, however many times the
+        images were invalidated in between.
+    */
+    void invalidateColourPickerControlsTextures(uint images);
+
+    /*!
+    \brief
+        Regenerate the invalidated images and blit the rows of the texture
+        holding them.
+    */
+    void updateColourPickerControlsTextures();
+
+    //! compute the hue and radius values for every pixel of the HSV wheel.
+    void initHueWheel();
+
+    // overridden from Window
+    void updateSelf(float elapsed);
+    bool isUpdateRequired() const;
+
     Lab_Colour getColourSliderPositionColourLAB(float value);
     Lab_Colour getColourPickingPositionColourLAB(float xAbs, float yAbs);
 
@@ -299,6 +331,15 @@ protected:
 
     RGB_Colour* d_colourPickingTexture;
 
+    //! TextureImage flags for images needing regeneration.
+    uint d_invalidTextureImages;
+
+    typedef std::vector<float CEGUI_VECTOR_ALLOC(float)> FloatList;
+    //! Hue for each pixel of the picking image in the HSV S and V modes.
+    FloatList d_hueWheelHues;
+    //! Radius for each pixel of the picking image in the HSV S and V modes.
+    FloatList d_hueWheelRadii;
+
     bool d_ignoreEvents;
     RegexMatcher& d_regexMatcher;
 };
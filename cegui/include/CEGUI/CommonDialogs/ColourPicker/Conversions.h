@@ -64,6 +64,28 @@ public:
     //! Function for converting a HSV to an RGB_Colour
     static RGB_Colour toRGB(const HSV_Colour& colour);
 
+    /*!
+    \brief
+        Convert \a count Lab_Colour values to RGB_Colour values.
+
+        This gives the same results as converting each colour individually,
+        but works on blocks of colours in a way compilers can vectorise, which
+        makes it considerably faster for generating images.
+    */
+    static void toRGB(const Lab_Colour* colours, RGB_Colour* result,
+                      size_t count);
+
+    /*!
+    \brief
+        Convert \a count HSV_Colour values to RGB_Colour values.
+
+        This gives the same results as converting each colour individually,
+        but works on blocks of colours in a way compilers can vectorise, which
+        makes it considerably faster for generating images.
+    */
+    static void toRGB(const HSV_Colour* colours, RGB_Colour* result,
+                      size_t count);
+
     //! Conversion from RGB_Colour to CEGUI::Colour
     static CEGUI::Colour toCeguiColour(const RGB_Colour& colourRGB);
 
@@ -114,6 +114,8 @@ public:
   void loadRawDataContainer(const String& filename,
         RawDataContainer& output,
         const String& resourceGroup);
+  void prefetchRawData(const String& filename,
+        const String& resourceGroup);
   size_t getResourceGroupFileNames(std::vector<String>& out_vec,
          const String& file_pattern,
          const String& resource_group);
@@ -44,6 +44,13 @@ class CEGUIEXPORT RawDataContainer :
     public AllocatedObject<RawDataContainer>
 {
 public:
+    /*!
+    \brief
+        Function used to free data that was not allocated with
+        CEGUI_NEW_ARRAY_PT, such as memory mapped file content.
+    */
+    typedef void (*Deleter)(uint8* data, size_t size);
+
 	/*************************************************************************
 		Construction and Destruction
 	*************************************************************************/
@@ -53,7 +60,8 @@ public:
 	*/
     RawDataContainer()
       : mData(0),
-        mSize(0)
+        mSize(0),
+        mDeleter(0)
     {
     }
 
@@ -74,9 +82,22 @@ public:
 		Set a pointer to the external data.
 
 	\param data
-        Pointer to the uint8 data buffer.
+        Pointer to the uint8 data buffer.  Unless a Deleter is set afterwards,
+        the buffer must have been allocated with CEGUI_NEW_ARRAY_PT, since
+        release will free it that way.
 	*/
-    void setData(uint8* data) { mData = data; }
+    void setData(uint8* data) { mData = data; mDeleter = 0; }
+
+    /*!
+    \brief
+        Set the function that release uses to free the data, in place of
+        CEGUI_DELETE_ARRAY_PT.  This is reset by setData, so must be set after
+        it.
+    */
+    void setDeleter(Deleter deleter) { mDeleter = deleter; }
+
+    //! Return the function that release uses to free the data, if any.
+    Deleter getDeleter() const { return mDeleter; }
 
 	/*!
 	\brief
@@ -108,7 +129,7 @@ public:
 
 	/*!
 	\brief
-		Release supplied data.
+		Release supplied data, via the Deleter if one was set.
 	*/
     void release(void);
 
@@ -118,6 +139,7 @@ private:
 	*************************************************************************/
     uint8* mData;
     size_t mSize;
+    Deleter mDeleter;
 };
 
 } // End of  CEGUI namespace section
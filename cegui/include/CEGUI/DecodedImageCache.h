@@ -0,0 +1,171 @@
+/***********************************************************************
+    filename:   DecodedImageCache.h
+    created:    Sun Oct 18 2026
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2012 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIDecodedImageCache_h_
+#define _CEGUIDecodedImageCache_h_
+
+#include "CEGUI/Base.h"
+#include "CEGUI/String.h"
+#include "CEGUI/Texture.h"
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    On-disk cache of the pixels produced by ImageCodecs, so that an image file
+    that has been decoded once can later be loaded without decoding it again.
+
+    Each cache file is keyed by a hash of the encoded file content and holds
+    the decoded pixel rows in the order and orientation in which the codec
+    passed them to Texture::loadFromMemory, behind a small header.  Loading
+    from the cache memory-maps the file and passes the pixel rows straight to
+    Texture::loadFromMemory, without copying them.
+
+    The cache is disabled until a cache directory is set.  When it is
+    disabled, load always fails and loadAndStore only loads the Texture.
+
+    Optionally, the alpha can be premultiplied into the colour channels of
+    PF_RGBA images when they are stored.  This changes the pixels given to
+    every Texture loaded via the cache, cold or warm, so it should only be
+    enabled when rendering is set up to blend premultiplied alpha.  Cache
+    files stored with the other setting are treated as a miss and replaced.
+*/
+class CEGUIEXPORT DecodedImageCache :
+    public AllocatedObject<DecodedImageCache>
+{
+public:
+    //! Extension of the cache files written to the cache directory.
+    static const String FILE_EXTENSION;
+
+    //! Constructor.  The cache is initially disabled.
+    DecodedImageCache();
+
+    //! Destructor.
+    ~DecodedImageCache();
+
+    /*!
+    \brief
+        Set the directory where cache files are read and written.  The
+        directory must already exist.  An empty string disables the cache.
+    */
+    void setCacheDirectory(const String& directory);
+
+    //! Return the directory where cache files are read and written.
+    const String& getCacheDirectory() const;
+
+    //! Return whether a cache directory has been set.
+    bool isEnabled() const;
+
+    /*!
+    \brief
+        Set whether the alpha of PF_RGBA images is premultiplied into the
+        colour channels when they are stored, and so for every Texture loaded
+        via the cache.  This has no effect while the cache is disabled.
+        Defaults to false.
+    */
+    void setPremultipliedAlpha(bool setting);
+
+    //! Return whether the alpha of PF_RGBA images is premultiplied.
+    bool isPremultipliedAlpha() const;
+
+    /*!
+    \brief
+        Load the Texture \a result from the cache file for the encoded image
+        \a data, if there is a valid one.
+
+    \return
+        true if \a result was loaded from the cache.  false if the cache is
+        disabled or holds no valid file for \a data, in which case \a result
+        is left unchanged.
+    */
+    bool load(const RawDataContainer& data, Texture& result);
+
+    /*!
+    \brief
+        Load the Texture \a result from pixels decoded from the encoded image
+        \a data, and store those pixels in the cache when it is enabled.
+
+        Failure to write the cache file is logged, but does not affect the
+        loading of \a result.
+
+    \param data
+        RawDataContainer holding the encoded image the pixels came from.
+
+    \param pixels
+        Pointer to the decoded pixels, as would be passed to
+        Texture::loadFromMemory.
+
+    \param size
+        Size of the decoded image, in pixels.
+
+    \param format
+        Format of the decoded pixels.  Only PF_RGB and PF_RGBA are stored; for
+        other formats \a result is loaded but nothing is stored.
+
+    \param result
+        Texture to be loaded.
+    */
+    void loadAndStore(const RawDataContainer& data, const void* pixels,
+                      const Sizef& size, Texture::PixelFormat format,
+                      Texture& result);
+
+    //! Return the name of the cache file used for the encoded image \a data.
+    String getCacheFilename(const RawDataContainer& data) const;
+
+    //! Return the number of Textures loaded from the cache.
+    uint64 getHitCount() const;
+
+    //! Return the number of failed attempts to load a Texture from the cache.
+    uint64 getMissCount() const;
+
+    //! Reset the hit and miss counts.
+    void resetStatistics();
+
+    //! Return the 64 bit FNV-1a hash of the content of \a data.
+    static uint64 computeKey(const RawDataContainer& data);
+
+private:
+    //! return the name of the cache file used for \a key.
+    String getCacheFilename(uint64 key) const;
+    //! write a cache file holding \a pixels.  Return whether it succeeded.
+    bool writeCacheFile(const String& filename, uint64 key,
+                        size_t encoded_size, const void* pixels, uint32 width, uint32 height,
+                        Texture::PixelFormat format) const;
+
+    //! directory where cache files are read and written.
+    String d_directory;
+    //! whether the alpha of PF_RGBA images is premultiplied.
+    bool d_premultiplied;
+    //! number of Textures loaded from the cache.
+    uint64 d_hits;
+    //! number of failed attempts to load a Texture from the cache.
+    uint64 d_misses;
+};
+
+} // End of  CEGUI namespace section
+
+#endif  // end of guard _CEGUIDecodedImageCache_h_
@@ -31,6 +31,8 @@
 #define _CEGUIDefaultLogger_h_
 
 #include "CEGUI/Logger.h"
+#include <ctime>
+#include <string>
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -56,12 +58,41 @@ public:
     // overridden from Logger
     void logEvent(const String& message, LoggingLevel level = Standard);
     void setLogFilename(const String& filename, bool append = false);
+    bool isEventLogged(LoggingLevel level) const;
+
+    /*!
+    \brief
+        Set the size of the buffer used to batch writes to the log file.
+
+        By default (a size of 0) each event is written and flushed to the file
+        as it is logged, so that nothing is lost should the application crash.
+        With a non-zero size, events are collected and written in one go when
+        more than \a size bytes are waiting, when an Errors level event is
+        logged, when flush is called and when the logger is destroyed.
+
+    \param size
+        Number of bytes of log text that may be held before being written.
+    */
+    void setWriteBufferSize(size_t size);
+
+    //! Return the size of the buffer used to batch writes to the log file.
+    size_t getWriteBufferSize() const;
+
+    //! Write any buffered events to the log file.
+    void flush();
 
 protected:
+    /*!
+    \brief
+        Append the date, time and level prefix for an event to d_line.
+
+    \return
+        false if the local time could not be determined.
+    */
+    bool appendEventPrefix(LoggingLevel level);
+
     //! Stream used to implement the logger
     std::ofstream d_ostream;
-    //! Used to build log entry strings. 
-    std::ostringstream d_workstream;
 
     typedef std::pair<String, LoggingLevel> CacheItem;
     typedef std::vector<CacheItem
@@ -70,6 +101,16 @@ protected:
     Cache d_cache;
     //! true while log entries are beign cached (prior to logfile creation)
     bool d_caching;
+    //! Used to build log entry strings, reused between events.
+    std::string d_line;
+    //! time at which d_timestamp was formatted.
+    std::time_t d_timestampTime;
+    //! formatted date and time, reused while the second does not change.
+    char d_timestamp[32];
+    //! log text waiting to be written when batching writes.
+    std::string d_writeBuffer;
+    //! size d_writeBuffer may reach before it is written, 0 to write through.
+    size_t d_writeBufferSize;
 };
 
 }
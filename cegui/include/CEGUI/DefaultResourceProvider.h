@@ -49,7 +49,7 @@ public:
 	/*************************************************************************
 		Construction and Destruction
 	*************************************************************************/
-	DefaultResourceProvider() {}
+	DefaultResourceProvider();
 	~DefaultResourceProvider(void) {}
 
     /*!
@@ -99,8 +99,51 @@ public:
     */
     void clearResourceGroupDirectory(const String& resourceGroup);
 
+    /*!
+    \brief
+        Set whether files loaded via loadRawDataContainer should be memory
+        mapped rather than read into a heap allocated buffer.
+
+        When enabled, the RawDataContainer returned references the mapped
+        pages of the file directly, so that consumers such as the XML parser,
+        ImageCodec and FreeTypeFont read the file contents without an
+        intermediate copy, and pages are only brought into memory as they
+        are touched.  The mapping is private: writes to the data are never
+        propagated back to the file.
+
+        Each mapping is owned by the RawDataContainer it was loaded into,
+        which unmaps it when released (for example via
+        unloadRawDataContainer) or destroyed, so the data remains valid even
+        after the provider itself has been destroyed.  Where a file can not
+        be mapped (for example if it is empty) it is read in the usual way.
+
+    \param enabled
+        - true if files should be memory mapped.
+        - false if files should be read into memory (the default).
+    */
+    void setMemoryMappingEnabled(bool enabled);
+
+    /*!
+    \brief
+        Return whether files loaded via loadRawDataContainer are memory
+        mapped rather than read into a heap allocated buffer.
+    */
+    bool isMemoryMappingEnabled() const;
+
+    /*!
+    \brief
+        Return the number of memory mapped files currently held by
+        RawDataContainer objects loaded via any DefaultResourceProvider.
+
+        Mapped files are owned by the RawDataContainer they were loaded into,
+        and are unmapped when it is released or destroyed, even if that
+        happens after the provider has been destroyed.
+    */
+    static size_t getMappedFileCount();
+
     void loadRawDataContainer(const String& filename, RawDataContainer& output, const String& resourceGroup);
     void unloadRawDataContainer(RawDataContainer& data);
+    void prefetchRawData(const String& filename, const String& resourceGroup);
     size_t getResourceGroupFileNames(std::vector<String>& out_vec,
                                      const String& file_pattern,
                                      const String& resource_group);
@@ -114,8 +157,26 @@ protected:
     */
     String getFinalFilename(const String& filename, const String& resourceGroup) const;
 
+    /*!
+    \brief
+        Attempt to memory map the file \a final_filename into \a output.
+
+    \return
+        - true if the file was mapped.
+        - false if the file could not be mapped and should be read instead.
+    */
+    bool mapFile(const String& final_filename, RawDataContainer& output);
+
+    //! unmap a region previously mapped via mapFile.  RawDataContainer::Deleter.
+    static void unmapFile(uint8* data, size_t size);
+
     typedef std::map<String, String, StringFastLessCompare> ResourceGroupMap;
     ResourceGroupMap    d_resourceGroups;
+
+    //! number of mapped regions handed out and not yet unmapped.
+    static size_t d_mappedFileCount;
+    //! whether loadRawDataContainer should memory map files.
+    bool d_memoryMappingEnabled;
 };
 
 } // End of  CEGUI namespace section
@@ -451,6 +451,47 @@ public:
         setArea(area.d_min, area.getSize());
     }
 
+    /*!
+    \brief
+        Begin a batched area update on this Element.
+
+        Until the matching call to endAreaUpdate, changes to the area of this
+        Element or any of its descendants do not fire EventMoved / EventSized
+        or the associated recursive screen area notifications.  Instead, the
+        changes are recorded and, when the outermost transaction ends, each
+        affected element receives a single notification, processed from the
+        top of the hierarchy downwards.
+
+        Calls may be nested; each call must be matched by a call to
+        endAreaUpdate.
+
+    \note
+        While a transaction is open, cached screen rects of descendants of a
+        changed element may be stale.
+
+    \see Element::endAreaUpdate
+    */
+    void beginAreaUpdate();
+
+    /*!
+    \brief
+        End a batched area update started with beginAreaUpdate.  When the
+        outermost transaction ends, deferred area change notifications are
+        dispatched.
+
+    \exception InvalidRequestException
+        thrown if there is no transaction open on this Element.
+    */
+    virtual void endAreaUpdate();
+
+    /*!
+    \brief
+        Return whether area change notifications for this Element are
+        currently being deferred by a transaction on it or one of its
+        ancestors.
+    */
+    bool isAreaUpdateDeferred() const;
+
     /*!
     \brief
         Return the element's area.
@@ -1183,6 +1224,10 @@ protected:
 
     //! helper to fire events based on changes to area rect
     void fireAreaChangeEvents(const bool moved, const bool sized);
+    //! fire any deferred area change events for this Element and its children.
+    void flushDeferredAreaChanges();
+    //! set d_areaUpdateDeferred for this Element and its children.
+    void setAreaUpdateDeferred(bool deferred);
     void notifyChildrenOfSizeChange(const bool non_client,
                                     const bool client);
 
@@ -1329,6 +1374,15 @@ protected:
     //! inner area rect in screen pixels
     CachedRectf d_unclippedInnerRect;
 
+    //! number of open area update transactions on this element.
+    uint d_areaUpdateDepth;
+    //! true if a transaction is open on this element or one of its ancestors.
+    bool d_areaUpdateDeferred;
+    //! true if a move notification was deferred by an area update transaction.
+    bool d_deferredMove;
+    //! true if a size notification was deferred by an area update transaction.
+    bool d_deferredSize;
+
 private:
     /*************************************************************************
         May not copy or assign Element objects
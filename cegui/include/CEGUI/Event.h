@@ -200,6 +200,12 @@ public:
     */
     void operator()(EventArgs& args);
 
+    //! Return the number of subscribers currently connected to the Event.
+    size_t getConnectionCount() const
+    {
+        return d_slots.size();
+    }
+
 
 protected:
     friend void CEGUI::BoundSlot::disconnect();
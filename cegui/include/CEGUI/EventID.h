@@ -0,0 +1,112 @@
+/***********************************************************************
+ *    filename:   EventID.h
+ *    created:    18/10/2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2013 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIEventID_h_
+#define _CEGUIEventID_h_
+
+#include "CEGUI/Base.h"
+#include "CEGUI/String.h"
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    Interned identifier of a namespaced event.
+
+    Constructing an EventID looks the event up in a process wide table (adding
+    it if needed) and precomputes the global "Namespace/Name" form of the
+    event name.  Every EventID for the same name and namespace shares the same
+    value, which is a small integer suitable for indexing; so firing an event
+    via an EventID needs no String building and allows constant time lookup
+    of global subscriptions.
+
+    EventID objects are intended to be created once (typically as statics next
+    to the event name constants) and reused for every firing of the event.
+*/
+class CEGUIEXPORT EventID
+{
+public:
+    /*!
+    \brief
+        Constructs an EventID for the event \a name within \a eventNamespace.
+    */
+    EventID(const String& name, const String& eventNamespace);
+
+    //! Return the name of the event (without namespace).
+    const String& getName() const
+    { return d_entry->d_name; }
+
+    //! Return the namespace of the event.
+    const String& getNamespace() const
+    { return d_entry->d_namespace; }
+
+    //! Return the global "Namespace/Name" form of the event name.
+    const String& getGlobalName() const
+    { return d_entry->d_globalName; }
+
+    //! Return the interned value, this is in the range [0, getCount()).
+    uint getValue() const
+    { return d_entry->d_value; }
+
+    bool operator==(const EventID& rhs) const
+    { return d_entry == rhs.d_entry; }
+
+    bool operator!=(const EventID& rhs) const
+    { return d_entry != rhs.d_entry; }
+
+    //! Return the number of distinct EventIDs interned so far.
+    static uint getCount();
+
+    /*!
+    \brief
+        Find the interned value for the given global "Namespace/Name" event
+        name, without interning it.
+
+    \return
+        - true if the name was interned and \a value was set.
+        - false if no EventID exists for that name.
+    */
+    static bool findValue(const String& globalName, uint& value);
+
+    //! internal storage of the interned event details.
+    struct Entry
+    {
+        String d_name;
+        String d_namespace;
+        String d_globalName;
+        uint d_value;
+    };
+
+private:
+    //! the shared interned entry, entries are never removed.
+    const Entry* d_entry;
+};
+
+} // End of  CEGUI namespace section
+
+#endif  // end of guard _CEGUIEventID_h_
+
@@ -273,6 +273,24 @@ public:
     virtual void fireEvent(const String& name, EventArgs& args,
                            const String& eventNamespace = "");
 
+    /*!
+    \brief
+        Fires the event identified by \a id passing the given EventArgs
+        object.
+
+        This is equivalent to calling
+        fireEvent(id.getName(), args, id.getNamespace()), but avoids building
+        and looking up the global event name on each call.
+
+    \param id
+        Interned EventID identifying the event and its global namespace.
+
+    \param args
+        The EventArgs (or derived) object that is to be bassed to each
+        subscriber of the Event.
+    */
+    virtual void fireEvent(const EventID& id, EventArgs& args);
+
 
     /*!
     \brief
@@ -337,6 +355,8 @@ protected:
     EventMap    d_events;
 
     bool    d_muted;    //!< true if events for this EventSet have been muted.
+    //! incremented each time an Event is added to or removed from d_events.
+    uint    d_eventsGeneration;
 
 public:
     /*************************************************************************
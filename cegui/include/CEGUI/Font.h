@@ -36,6 +36,9 @@
 #include "CEGUI/FontGlyph.h"
 
 #include <map>
+#include <list>
+#include <deque>
+#include <vector>
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -73,6 +76,12 @@ public:
      * FontEventArgs::font set to the Font whose rendered size has changed.
      */
     static const String EventRenderSizeChanged;
+    /** Event fired when glyph pages whose rasterisation was deferred have been
+     * rasterised, and text drawn using placeholder glyphs should be redrawn.
+     * Handlers are passed a const FontEventArgs reference with
+     * FontEventArgs::font set to the Font whose glyphs were rasterised.
+     */
+    static const String EventGlyphsRasterised;
 
     //! Destructor.
     virtual ~Font();
@@ -125,6 +134,7 @@ public:
 
     \param space_extra
         Number of additional pixels of spacing to be added to space characters.
+        Nothing is added for a space the font has no glyph for.
 
     \param x_scale
         Scaling factor to be applied to each glyph's x axis, where 1.0f is
@@ -408,7 +418,152 @@ public:
     */
     const FontGlyph* getGlyphData(utf32 codepoint) const;
 
+    /*!
+    \brief
+        Set whether rasterisation of glyph pages is deferred.
+
+        When deferred rasterisation is enabled, requesting a glyph from a page
+        that has not been rasterised queues the page instead of rasterising it
+        immediately.  Until the page is rasterised the glyph has no image and
+        is drawn as empty space (though its advance is correct).  Queued pages
+        are rasterised by rasteriseDeferredGlyphs, which is normally called
+        from System::injectTimePulse via FontManager, spreading the cost over
+        a number of frames.
+
+        Disabling deferred rasterisation rasterises any queued pages.
+    */
+    void setDeferredRasterisationEnabled(bool setting);
+
+    //! Return whether rasterisation of glyph pages is deferred.
+    bool isDeferredRasterisationEnabled() const;
+
+    /*!
+    \brief
+        Rasterise, immediately, all glyphs in the given codepoint range that
+        are not yet rasterised.  This can be used at load time to avoid
+        rendering with placeholder glyphs (or to avoid a stall the first time
+        a glyph page is used when rasterisation is not deferred).
+
+    \param start_codepoint
+        The lowest codepoint to rasterise.
+
+    \param end_codepoint
+        The highest codepoint to rasterise.
+    */
+    void prewarmGlyphs(utf32 start_codepoint, utf32 end_codepoint);
+
+    //! Return the number of glyph pages queued for deferred rasterisation.
+    size_t getDeferredGlyphPageCount() const;
+
+    /*!
+    \brief
+        Rasterise glyph pages queued for deferred rasterisation.
+
+    \param time_budget
+        Time, in seconds, that may be spent rasterising.  The budget is
+        checked after each glyph, and at least one glyph is rasterised if any
+        pages are queued, so some progress is always made.
+
+    \return
+        true if any glyphs were rasterised (in which case
+        EventGlyphsRasterised has been fired), false if none were queued.
+    */
+    bool rasteriseDeferredGlyphs(float time_budget);
+
+    /*!
+    \brief
+        Return the kerning adjustment to apply between two glyphs.
+
+    \param left
+        utf32 codepoint of the glyph on the left.
+
+    \param right
+        utf32 codepoint of the glyph on the right.
+
+    \param x_scale
+        Scaling factor to be applied to the kerning, where 1.0f is considered
+        to be 'normal'.
+
+    \return
+        Number of pixels that the pen position should be moved by horizontally
+        between rendering the glyph for \a left and the glyph for \a right.
+        The base implementation returns 0.
+    */
+    virtual float getKerning(utf32 left, utf32 right, float x_scale = 1.0f) const;
+
+    /*!
+    \brief
+        Set the maximum memory, in bytes, used by the layout cache.
+
+        The horizontal layout of strings (glyph positions including kerning,
+        advance and extent) is cached so that repeatedly measuring and drawing
+        the same text does not need to look up every glyph again.  When the
+        cache is full, the least recently used layouts are discarded.  Text
+        whose layout alone would exceed the size is not cached.  A size of
+        zero disables the cache.
+    */
+    void setTextLayoutCacheSize(size_t size);
+
+    //! Return the maximum memory, in bytes, used by the layout cache.
+    size_t getTextLayoutCacheSize() const;
+
+    //! Return the memory, in bytes, currently used by the layout cache.
+    size_t getTextLayoutCacheUsage() const;
+
+    //! Return the number of lookups that were satisfied from the layout cache.
+    uint getTextLayoutCacheHits() const;
+
+    //! Return the number of lookups that required a layout to be built.
+    uint getTextLayoutCacheMisses() const;
+
+    //! Reset the layout cache hit and miss counters to zero.
+    void resetTextLayoutCacheStatistics();
+
+    //! Discard all cached text layouts.
+    void invalidateTextLayoutCache();
+
 protected:
+    //! Horizontal layout of a string of text.
+    struct TextLayout
+    {
+        //! hash of the text and d_xScale.
+        uint64 d_hash;
+        //! length of the text that was laid out.
+        size_t d_length;
+        //! the x scale the layout was created for.
+        float d_xScale;
+        //! glyph for each character, or 0 for characters with no glyph.
+        std::vector<const FontGlyph*
+            CEGUI_VECTOR_ALLOC(const FontGlyph*)> d_glyphs;
+        /*!
+            pen offset for each character, relative to the start of the text,
+            plus a final entry holding the advance of the whole text.
+        */
+        std::vector<float
+            CEGUI_VECTOR_ALLOC(float)> d_offsets;
+        //! rendered extent of the text.
+        float d_extent;
+    };
+
+    /*!
+    \brief
+        Return the layout of \a text at \a x_scale, from the layout cache
+        where possible.
+
+        The returned reference is only valid until the next call to this
+        function.
+    */
+    const TextLayout& getTextLayout(const String& text, float x_scale) const;
+
+    //! fill in the glyph, offset and extent data of \a layout for \a text.
+    void layoutText(TextLayout& layout, const String& text) const;
+
+    //! remove the least recently used layout from the layout cache.
+    void evictTextLayout() const;
+
+    //! return the memory, in bytes, used by a cached layout of \a length.
+    static size_t getTextLayoutCost(size_t length);
+
     //! Constructor.
     Font(const String& name, const String& type_name, const String& filename,
          const String& resource_group, const AutoScaledMode auto_scaled,
@@ -442,6 +597,12 @@ protected:
     //! event trigger function for when the font rendering size changes.
     virtual void onRenderSizeChanged(FontEventArgs& args);
 
+    //! event trigger function for when deferred glyph pages are rasterised.
+    virtual void onGlyphsRasterised(FontEventArgs& args);
+
+    //! rasterise the glyphs of glyph page \a page.
+    void rasteriseGlyphPage(uint page) const;
+
     /*!
     \brief
         Set the maximal glyph index. This reserves the respective
@@ -452,6 +613,26 @@ protected:
     //! finds FontGlyph in map and returns it, or 0 if none.
     virtual const FontGlyph* findFontGlyph(const utf32 codepoint) const;
 
+    /*!
+    \brief
+        Return the FontGlyph for \a codepoint via the glyph page index.
+
+        The page index is a two level table mapping codepoints directly to
+        the FontGlyph objects held in d_cp_map, so that the common case of
+        looking up a glyph does not involve a search of the map.  Pages are
+        populated from d_cp_map the first time a codepoint within them is
+        requested.  Glyphs not yet marked valid are passed to findFontGlyph so
+        that subclasses may initialise them.
+    */
+    const FontGlyph* findIndexedFontGlyph(const utf32 codepoint) const;
+
+    /*!
+    \brief
+        Discard the glyph page index.  This must be called whenever entries
+        are added to or removed from d_cp_map.
+    */
+    void invalidateGlyphPageIndex();
+
     //! Name of this font.
     String d_name;
     //! Type name string for this font (not used internally)
@@ -497,11 +678,50 @@ protected:
     */
     uint* d_glyphPageLoaded;
 
+    //! whether glyph pages are queued rather than rasterised on first use.
+    bool d_deferredRasterisation;
+    //! type of queue holding glyph pages awaiting deferred rasterisation.
+    typedef std::deque<uint
+        CEGUI_VECTOR_ALLOC(uint)> GlyphPageQueue;
+    //! glyph pages awaiting deferred rasterisation.
+    mutable GlyphPageQueue d_deferredPages;
+    //! number of codepoints of the first queued page already rasterised.
+    uint d_deferredPageProgress;
+
     //! Definition of CodepointMap type.
     typedef std::map<utf32, FontGlyph, std::less<utf32>
         CEGUI_MAP_ALLOC(utf32, FontGlyph)> CodepointMap;
     //! Contains mappings from code points to Image objects
     mutable CodepointMap d_cp_map;
+
+    //! type of the entries in a page of the glyph page index.
+    typedef const FontGlyph* GlyphPageEntry;
+    //! type of the glyph page index; each page holds GLYPHS_PER_PAGE entries.
+    typedef std::vector<GlyphPageEntry*
+        CEGUI_VECTOR_ALLOC(GlyphPageEntry*)> GlyphPageIndex;
+    //! direct lookup table of pages of glyphs from d_cp_map.
+    mutable GlyphPageIndex d_glyphPageIndex;
+
+    //! type of list holding cached layouts, most recently used first.
+    typedef std::list<TextLayout
+        CEGUI_VECTOR_ALLOC(TextLayout)> TextLayoutList;
+    //! type of map indexing the cached layouts by their hash.
+    typedef std::multimap<uint64, TextLayoutList::iterator, std::less<uint64>
+        CEGUI_MULTIMAP_ALLOC(uint64, TextLayoutList::iterator)> TextLayoutIndex;
+    //! cached text layouts.
+    mutable TextLayoutList d_layoutCache;
+    //! hash index into d_layoutCache.
+    mutable TextLayoutIndex d_layoutIndex;
+    //! maximum memory, in bytes, used by d_layoutCache.
+    size_t d_layoutCacheSize;
+    //! memory, in bytes, currently used by d_layoutCache.
+    mutable size_t d_layoutCacheUsage;
+    //! layout used when the cache is disabled.
+    mutable TextLayout d_uncachedLayout;
+    //! number of layout cache hits.
+    mutable uint d_layoutCacheHits;
+    //! number of layout cache misses.
+    mutable uint d_layoutCacheMisses;
 };
 
 
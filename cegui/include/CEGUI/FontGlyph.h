@@ -28,7 +28,7 @@
 #ifndef _CEGUIFontGlyph_h_
 #define _CEGUIFontGlyph_h_
 
-#include "CEGUI/Image.h"
+#include "CEGUI/BasicImage.h"
 
 // Start of CEGUI namespace section
 namespace CEGUI
@@ -47,6 +47,7 @@ public:
     //! Constructor.
     FontGlyph(float advance = 0.0f, Image* image = 0, bool valid = false) :
         d_image(image),
+        d_basicImage(dynamic_cast<BasicImage*>(image)),
         d_advance(advance),
         d_valid(valid)
     {}
@@ -55,6 +56,18 @@ public:
     Image* getImage() const
     { return d_image; }
 
+    /*!
+    \brief
+        Return the image rendered for this glyph as a BasicImage, or 0 if the
+        glyph image is not a BasicImage.
+
+        This allows the texture and texture area of the glyph to be accessed
+        directly, so that runs of glyphs can be rendered in bulk without going
+        through Image::render for each glyph.
+    */
+    const BasicImage* getBasicImage() const
+    { return d_basicImage; }
+
     //! Return the scaled pixel size of the glyph.
     Sizef getSize(float x_scale, float y_scale) const
     { return Sizef(getWidth(x_scale), getHeight(y_scale)); }
@@ -73,10 +86,12 @@ public:
 
         The rendered advance value is the total number of pixels from the
         current pen position that will be occupied by this glyph when rendered.
+        If the glyph has no image yet, the advance value is returned.
     */
     float getRenderedAdvance(float x_scale) const
-    { return (d_image->getRenderedSize().d_width +
-              d_image->getRenderedOffset().d_x) * x_scale; }
+    { return d_image ? (d_image->getRenderedSize().d_width +
+                        d_image->getRenderedOffset().d_x) * x_scale :
+                       d_advance * x_scale; }
 
     /*!
     \brief
@@ -96,7 +111,10 @@ public:
 
     //! Set the CEGUI::Image object rendered for this glyph.
     void setImage(Image* image)
-    { d_image = image; }
+    {
+        d_image = image;
+        d_basicImage = dynamic_cast<BasicImage*>(image);
+    }
 
     //! mark the FontGlyph as valid
     void setValid(bool valid)
@@ -109,6 +127,8 @@ public:
 private:
     //! The image which will be rendered for this glyph.
     Image* d_image;
+    //! d_image as a BasicImage, or 0 if it's some other type of Image.
+    const BasicImage* d_basicImage;
     //! Amount to advance the pen after rendering this glyph
     float d_advance;
     //! says whether this glyph info is actually valid
@@ -173,6 +173,33 @@ public:
     */
     void notifyDisplaySizeChanged(const Sizef& size);
 
+    /*!
+    \brief
+        Rasterise glyph pages queued for deferred rasterisation by the Font
+        objects, spending no more than the time set via
+        setDeferredRasterisationBudget (though at least one glyph is always
+        rasterised if any pages are queued).  This is called by
+        System::injectTimePulse.
+
+    \return
+        true if any glyph pages were rasterised, false otherwise.
+    */
+    bool rasteriseDeferredGlyphs();
+
+    /*!
+    \brief
+        Set the time, in seconds, that each call to rasteriseDeferredGlyphs
+        may spend rasterising glyphs.
+    */
+    void setDeferredRasterisationBudget(float seconds);
+
+    /*!
+    \brief
+        Return the time, in seconds, that each call to rasteriseDeferredGlyphs
+        may spend rasterising glyphs.
+    */
+    float getDeferredRasterisationBudget() const;
+
     /*!
     \brief
         Writes a full XML font file for the specified Font to the given
@@ -200,6 +227,10 @@ public:
     using NamedXMLResourceManager<Font, Font_xmlHandler>::createFromContainer;
     using NamedXMLResourceManager<Font, Font_xmlHandler>::createFromFile;
     using NamedXMLResourceManager<Font, Font_xmlHandler>::createFromString;
+
+protected:
+    //! time, in seconds, that rasteriseDeferredGlyphs may spend.
+    float d_deferredRasterisationBudget;
 };
 
 } // End of  CEGUI namespace section
@@ -47,6 +47,7 @@ class Clipboard;
 class Colour;
 class ColourRect;
 class CoordConverter;
+class DecodedImageCache;
 class DefaultLogger;
 class DefaultRenderedStringParser;
 class DefaultResourceProvider;
@@ -56,6 +57,7 @@ class ElementEventArgs;
 class Event;
 class EventAction;
 class EventArgs;
+class EventID;
 class EventSet;
 class Exception;
 class FactoryModule;
@@ -64,6 +66,7 @@ class FontGlyph;
 class FontManager;
 class FormattedRenderedString;
 class GeometryBuffer;
+class GlyphAtlas;
 class GlobalEventSet;
 class GUIContext;
 class Image;
@@ -71,6 +74,7 @@ class ImageCodec;
 class ImageManager;
 class ImagerySection;
 class Interpolator;
+class InterpolatorValue;
 class JustifiedRenderedString;
 class KeyFrame;
 class LeftAlignedRenderedString;
@@ -117,6 +121,7 @@ class System;
 class SystemKeys;
 class Texture;
 class TextureTarget;
+class TextureTargetPool;
 class TextUtils;
 class UBox;
 class UDim;
@@ -115,6 +115,27 @@ public:
     //! return whether the freetype font is rendered anti-aliased.
     void setAntiAliased(const bool anti_alaised);
 
+    /*!
+    \brief
+        Set the name of the GlyphAtlas that glyph imagery for this font is to
+        be rendered into.  Fonts using the same atlas name share the atlas
+        textures.  An empty name (the default) gives the font its own atlas.
+    */
+    void setGlyphAtlasName(const String& name);
+
+    //! return the name of the GlyphAtlas requested for this font.
+    const String& getGlyphAtlasName() const;
+
+    /*!
+    \brief
+        Return the GlyphAtlas currently holding the glyph imagery for this
+        font, or 0 if no glyphs have been rasterised yet.
+    */
+    const GlyphAtlas* getGlyphAtlas() const;
+
+    // overrides of functions in Font base class.
+    float getKerning(utf32 left, utf32 right, float x_scale = 1.0f) const;
+
 protected:
     /*!
     \brief
@@ -133,18 +154,6 @@ protected:
     */
     void drawGlyphToBuffer(argb_t* buffer, uint buf_width) const;
 
-    /*!
-    \brief
-        Return the required texture size required to store imagery for the
-        glyphs from s to e
-    \param s
-        The first glyph in set
-    \param e
-        The last glyph in set
-    */
-    uint getTextureSize(CodepointMap::const_iterator s,
-                        CodepointMap::const_iterator e) const;
-
     //! Register all properties of this class.
     void addFreeTypeFontProperties();
     //! Free all allocated font data.
@@ -171,11 +180,10 @@ protected:
     FT_Face d_fontFace;
     //! Font file data
     RawDataContainer d_fontData;
-    //! Type definition for TextureVector.
-    typedef std::vector<Texture*
-        CEGUI_VECTOR_ALLOC(Texture*)> TextureVector;
-    //! Textures that hold the glyph imagery for this font.
-    mutable TextureVector d_glyphTextures;
+    //! Name of the GlyphAtlas to use (empty for a private atlas).
+    String d_glyphAtlasName;
+    //! GlyphAtlas that holds the glyph imagery for this font.
+    mutable GlyphAtlas* d_glyphAtlas;
     typedef std::vector<BasicImage*
         CEGUI_VECTOR_ALLOC(BasicImage*)> ImageVector;
     //! collection of images defined for this font.
@@ -185,6 +185,85 @@ public:
     //! Tell the context to reconsider which window it thinks the mouse is in.
     void updateWindowContainingMouse();
 
+    /*!
+    \brief
+        Set whether hit testing (finding the window under the mouse) uses the
+        hit test bounds kept by each Window to skip whole window subtrees that
+        can not contain the mouse position.
+
+        This greatly reduces the cost of mouse input for large window
+        hierarchies, but relies on Window::isHit never reporting a hit outside
+        of Window::getHitTestRect.  It is disabled by default.
+    */
+    void setHitTestIndexEnabled(bool setting);
+
+    //! Return whether hit testing uses the window hit test bounds.
+    bool isHitTestIndexEnabled() const;
+
+    /*!
+    \brief
+        Set whether invalidating a Window only invalidates the area it covers
+        on the imagery caching RenderingWindow surface it is drawn to, rather
+        than the whole surface.
+
+        The caching surface will then only clear and redraw that damaged area
+        next time it is drawn, provided the underlying TextureTarget supports
+        partial clearing.  This relies on no custom geometry being added to
+        the surfaces outside of the usual Window rendering.  It is disabled by
+        default.
+
+    \see
+        RenderingSurface::getLastRedrawnArea
+    */
+    void setPartialRedrawEnabled(bool setting);
+
+    //! Return whether Window invalidation only invalidates the area it covers.
+    bool isPartialRedrawEnabled() const;
+
+    /*!
+    \brief
+        Set the number of consecutive redraws after which children of the root
+        window are cached automatically.
+
+        Each time the GUIContext redraws its content, it checks which children
+        of the root window changed.  A child that has child windows of its own
+        and stays unchanged for \a redraws consecutive redraws gets an
+        automatic RenderingSurface, so that it is drawn from a texture while
+        other parts of the GUI change.  The surface is released again when the
+        child changes in \a redraws consecutive redraws.  Targets for these
+        surfaces come from the System's TextureTargetPool, which also counts
+        the cache hits.
+
+    \param redraws
+        Number of consecutive redraws, or 0 to disable automatic caching (the
+        default).  Surfaces that were enabled automatically are kept when
+        disabling.
+
+    \see
+        Window::updateAutoCaching, TextureTargetPool::getCacheHitCount
+    */
+    void setAutoCachingThreshold(uint redraws);
+
+    //! Return the number of redraws used for automatic caching, 0 if disabled.
+    uint getAutoCachingThreshold() const;
+
+    /*!
+    \brief
+        Set whether time pulses skip window subtrees that do not need time
+        based updates, as reported by Window::isSubtreeUpdateRequired.
+
+        This is disabled by default, since windows are then only updated
+        when Window::isUpdateRequired says so.  Window subclasses that override
+        updateSelf (including those implemented in a scripting language) but
+        not isUpdateRequired would stop being updated when they are otherwise
+        idle.  A global subscription to the Window/Updated event always causes
+        every window to be updated.
+    */
+    void setIdleUpdateSkippingEnabled(bool setting);
+
+    //! Return whether time pulses skip window subtrees that need no updates.
+    bool isIdleUpdateSkippingEnabled() const;
+
     Window* getInputCaptureWindow() const;
     void setInputCaptureWindow(Window* window);
 
@@ -338,6 +417,14 @@ protected:
 
     mutable Window* d_windowContainingMouse;
     mutable bool    d_windowContainingMouseIsUpToDate;
+    //! whether hit testing skips subtrees using window hit test bounds.
+    bool d_hitTestIndexEnabled;
+    //! whether window invalidation is restricted to the area they cover.
+    bool d_partialRedrawEnabled;
+    //! redraws used by the automatic caching heuristic, 0 when disabled.
+    uint d_autoCachingThreshold;
+    //! whether time pulses skip window subtrees that need no updates.
+    bool d_idleUpdateSkippingEnabled;
     Window* d_modalWindow;
     Window* d_captureWindow;
 
@@ -30,11 +30,13 @@
 
 #include "CEGUI/EventSet.h"
 #include "CEGUI/Singleton.h"
+#include <vector>
 
 
 #if defined(_MSC_VER)
 #	pragma warning(push)
 #	pragma warning(disable : 4275)
+#	pragma warning(disable : 4251)
 #endif
 
 // Start of CEGUI namespace section
@@ -95,6 +97,52 @@ public:
 		Nothing.
 	*/
 	virtual void	fireEvent(const String& name, EventArgs& args, const String& eventNamespace = "");
+
+    /*!
+    \brief
+        Fires the global event identified by \a id passing the given EventArgs
+        object.
+
+        The Event is found via an index of the interned EventID values, so no
+        String is built or compared.  When nothing at all has been subscribed
+        globally this returns immediately.
+    */
+    virtual void fireEvent(const EventID& id, EventArgs& args);
+
+    /*!
+    \brief
+        Return whether an Event exists (i.e. was subscribed) for the global
+        event identified by \a id.
+    */
+    bool isEventPresent(const EventID& id);
+
+    /*!
+    \brief
+        Return whether the global event identified by \a id currently has any
+        subscribers connected to it.
+    */
+    bool isEventSubscribed(const EventID& id);
+
+    using EventSet::isEventPresent;
+
+protected:
+    //! rebuild the id index and namespace counts if the events have changed.
+    void updateEventIndex();
+
+    typedef std::vector<Event*
+        CEGUI_VECTOR_ALLOC(Event*)> EventIndex;
+    //! Events of this set, indexed by EventID::getValue().
+    EventIndex d_eventIndex;
+
+    typedef std::map<String, uint, StringFastLessCompare
+        CEGUI_MAP_ALLOC(String, uint)> NamespaceEventCountMap;
+    //! number of Events in the set for each event namespace.
+    NamespaceEventCountMap d_namespaceEventCounts;
+
+    //! EventSet::d_eventsGeneration value the index was built for.
+    uint d_indexedEventsGeneration;
+    //! EventID::getCount value the index was built for.
+    uint d_indexedEventIDCount;
 };
 
 } // End of  CEGUI namespace section
@@ -0,0 +1,269 @@
+/***********************************************************************
+    filename:   GlyphAtlas.h
+    created:    18/10/2026
+
+    purpose:    Defines a skyline packed texture atlas for glyphs
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2013 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIGlyphAtlas_h_
+#define _CEGUIGlyphAtlas_h_
+
+#include "CEGUI/Colour.h"
+#include "CEGUI/String.h"
+#include "CEGUI/Rect.h"
+#include <vector>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    Texture atlas used to hold dynamically rendered glyph imagery.
+
+    Images are packed into the atlas textures using the skyline bottom-left
+    heuristic.  Atlas textures are never resized once created, so geometry
+    already built using an Image on an atlas texture remains valid.  When
+    the current texture is full a further texture is added; the first
+    texture is small, and each one added is twice the size of the previous
+    one (up to Renderer::getMaxTextureSize).
+
+    Images added are held in a staging area until flush is called, at which
+    point they are uploaded to the atlas textures and the staging area is
+    freed.  No CPU side copy of the textures themselves is kept.
+
+    Atlases are reference counted and obtained by name via acquire; fonts
+    that acquire an atlas using the same name will share the textures (and
+    so may be batched together when rendered).  The space of an image that
+    is no longer needed is returned to the atlas via freeImage, and reused
+    for later images it can hold; once every image on a texture has been
+    freed, the whole texture is packed afresh.
+*/
+class CEGUIEXPORT GlyphAtlas : public AllocatedObject<GlyphAtlas>
+{
+public:
+    /*!
+    \brief
+        Return a reference to the GlyphAtlas named \a name, creating it if it
+        does not already exist.  Each call to acquire must be balanced with a
+        call to release.
+    */
+    static GlyphAtlas& acquire(const String& name);
+
+    /*!
+    \brief
+        Release a reference to \a atlas that was obtained via acquire.  When
+        the last reference is released the atlas and its textures are
+        destroyed.
+    */
+    static void release(GlyphAtlas& atlas);
+
+    //! Return whether a GlyphAtlas named \a name currently exists.
+    static bool isAtlasPresent(const String& name);
+
+    //! Return the name of the atlas.
+    const String& getName() const;
+
+    /*!
+    \brief
+        Add an image to the atlas.
+
+    \param pixels
+        Pointer to \a width x \a height tightly packed 32bit RGBA pixels.
+
+    \param width
+        Width of the image in pixels.
+
+    \param height
+        Height of the image in pixels.
+
+    \param texture
+        Receives a pointer to the Texture holding the image.  This is also
+        set, to the current atlas texture, for empty images and on failure.
+
+    \param area
+        Receives the pixel area of the image on \a texture.  This will be
+        empty for empty images and on failure.
+
+    \return
+        - true if the image was added to the atlas (or is empty).
+        - false if the image is too large to fit into a texture of the
+          maximum size supported by the Renderer.
+
+    \note
+        The image will not be visible on the texture until flush is called.
+    */
+    bool addImage(const argb_t* pixels, uint width, uint height,
+                  Texture*& texture, Rectf& area);
+
+    /*!
+    \brief
+        Return the space used by an image, previously added via addImage, to
+        the atlas so that it may be reused.
+
+    \param texture
+        The Texture holding the image, as returned by addImage.
+
+    \param area
+        The area of the image on \a texture, as returned by addImage.
+
+    \exception InvalidRequestException
+        thrown if \a texture is not a texture of this atlas.
+    */
+    void freeImage(const Texture& texture, const Rectf& area);
+
+    //! Upload any imagery added since the last call to the atlas textures.
+    void flush();
+
+    //! Return the number of textures currently used by the atlas.
+    size_t getTextureCount() const;
+
+    //! Return the atlas texture at index \a index.
+    Texture& getTexture(size_t index) const;
+
+    //! Return the number of non-empty images added to the atlas.
+    size_t getImageCount() const;
+
+    //! Return the total pixel area occupied by images (including padding).
+    size_t getUsedArea() const;
+
+    //! Return the total pixel area of all atlas textures.
+    size_t getTotalArea() const;
+
+    //! Return the fraction of atlas texture space occupied by images.
+    float getOccupancy() const;
+
+    //! Return the number of outstanding references to the atlas.
+    uint getReferenceCount() const;
+
+private:
+    //! A horizontal segment of the skyline.
+    struct SkylineNode
+    {
+        uint d_x;
+        uint d_y;
+        uint d_width;
+    };
+
+    typedef std::vector<SkylineNode
+        CEGUI_VECTOR_ALLOC(SkylineNode)> Skyline;
+
+    //! A padded region of a page left by a freed image.
+    struct FreeRegion
+    {
+        uint d_x;
+        uint d_y;
+        uint d_width;
+        uint d_height;
+    };
+
+    typedef std::vector<FreeRegion
+        CEGUI_VECTOR_ALLOC(FreeRegion)> FreeRegionList;
+
+    //! An image awaiting upload to an atlas texture.
+    struct PendingImage
+    {
+        uint d_x;
+        uint d_y;
+        uint d_width;
+        uint d_height;
+        //! offset of the image pixels within Page::d_pendingPixels.
+        size_t d_offset;
+    };
+
+    typedef std::vector<PendingImage
+        CEGUI_VECTOR_ALLOC(PendingImage)> PendingImageList;
+    typedef std::vector<argb_t
+        CEGUI_VECTOR_ALLOC(argb_t)> PixelBuffer;
+
+    //! A single atlas texture and its packing state.
+    struct Page
+    {
+        Texture* d_texture;
+        //! width and height of the texture.
+        uint d_size;
+        Skyline d_skyline;
+        //! regions of freed images available for reuse.
+        FreeRegionList d_freeRegions;
+        //! number of images currently held by the page.
+        size_t d_imageCount;
+        //! whether the texture content has never been uploaded.
+        bool d_reload;
+        //! images added since the last flush.
+        PendingImageList d_pendingImages;
+        //! pixels of the images in d_pendingImages.
+        PixelBuffer d_pendingPixels;
+    };
+
+    typedef std::vector<Page
+        CEGUI_VECTOR_ALLOC(Page)> PageList;
+
+    GlyphAtlas(const String& name);
+    ~GlyphAtlas();
+
+    //! add a new, empty, page and return it.
+    Page& addPage();
+    //! return \a page to its empty state.
+    void resetPage(Page& page);
+    //! find the smallest free region holding a \a width x \a height image.
+    bool findFreeRegion(uint width, uint height,
+                        size_t& page, size_t& region) const;
+    //! stage \a pixels for upload to the given area of \a page.
+    void stageImage(Page& page, uint x, uint y, uint width, uint height,
+                    const argb_t* pixels, uint pixels_width,
+                    uint pixels_height);
+    //! find where a \a width x \a height region fits on \a page.
+    bool findPosition(const Page& page, uint width, uint height,
+                      uint& x, uint& y, size_t& node) const;
+    //! update the skyline of \a page to reflect a newly placed region.
+    void placeRegion(Page& page, size_t node, uint x, uint y,
+                     uint width, uint height);
+    //! upload the modified parts of \a page to its texture.
+    void flushPage(Page& page);
+
+    //! name of the atlas.
+    const String d_name;
+    //! number of outstanding references obtained via acquire.
+    uint d_refCount;
+    //! textures used by the atlas.
+    PageList d_pages;
+    //! maximum texture size supported by the renderer.
+    uint d_maxTextureSize;
+    //! number of images currently held.
+    size_t d_imageCount;
+    //! pixel area occupied by images.
+    size_t d_usedArea;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUIGlyphAtlas_h_
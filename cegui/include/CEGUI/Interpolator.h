@@ -37,6 +37,22 @@
 namespace CEGUI
 {
 
+/*!
+\brief
+    Opaque, interpolator specific storage of a parsed property value.
+
+    Interpolators that support the typed animation path create these via
+    Interpolator::createValue so that key frame and saved property values are
+    parsed from their String form once, rather than on every animation step.
+*/
+class CEGUIEXPORT InterpolatorValue :
+    public AllocatedObject<InterpolatorValue>
+{
+public:
+    //! destructor
+    virtual ~InterpolatorValue() {}
+};
+
 /*!
 \brief
     Defines a 'interpolator' class
@@ -55,9 +71,22 @@ class CEGUIEXPORT Interpolator :
     public AllocatedObject<Interpolator>
 {
 public:
+    //! constructor
+    Interpolator();
+
     //! destructor
     virtual ~Interpolator() {};
 
+    /*!
+    \brief
+        Return a number identifying this interpolator object.
+
+        Unlike the address of the object, this is never reused by an
+        interpolator created later, so it is safe to use as the key for
+        values cached from createValue.  It is never 0.
+    */
+    uint getSerial() const;
+
     //! returns type string of this interpolator
     virtual const String& getType() const = 0;
 
@@ -87,6 +116,51 @@ public:
             const String& value1,
             const String& value2,
             float position) = 0;
+
+    /*!
+    \brief
+        Parse the given string into a value usable with applyAbsolute and
+        applyRelative.
+
+    \return
+        Pointer to a newly created InterpolatorValue that the caller takes
+        ownership of (to be deleted via CEGUI_DELETE_AO), or 0 if this
+        interpolator does not support the typed path; in which case the String
+        based interpolate functions will be used instead.
+    */
+    virtual InterpolatorValue* createValue(const String& value) const;
+
+    /*!
+    \brief
+        Interpolate between two previously parsed values and set the result
+        directly on \a property of \a target (AM_Absolute).
+
+        Only ever called with values created by this interpolator's
+        createValue function.
+    */
+    virtual void applyAbsolute(PropertySet& target, const String& property,
+                               const InterpolatorValue& value1,
+                               const InterpolatorValue& value2,
+                               float position);
+
+    /*!
+    \brief
+        Interpolate between two previously parsed values relative to the
+        parsed \a base value and set the result directly on \a property of
+        \a target (AM_Relative).
+
+        Only ever called with values created by this interpolator's
+        createValue function.
+    */
+    virtual void applyRelative(PropertySet& target, const String& property,
+                               const InterpolatorValue& base,
+                               const InterpolatorValue& value1,
+                               const InterpolatorValue& value2,
+                               float position);
+
+private:
+    //! value returned by getSerial.
+    uint d_serial;
 };
 
 } // End of  CEGUI namespace section
@@ -153,6 +153,21 @@ public:
     */
     const String& getValueForAnimation(AnimationInstance* instance) const;
 
+    /*!
+    \brief
+        internal method, retrieves the value to be used for the animation as
+        parsed by \a interpolator.
+
+        The parsed form of the key value is created once and cached, so
+        stepping an animation does not need to parse strings each time.
+
+    \return
+        The parsed value, or 0 if \a interpolator does not support parsed
+        values (in which case getValueForAnimation should be used).
+    */
+    const InterpolatorValue* getParsedValueForAnimation(
+        AnimationInstance* instance, Interpolator* interpolator) const;
+
     /*!
     \brief
         Sets the progression method of this key frame
@@ -199,6 +214,9 @@ public:
     */
     void notifyPositionChanged(float newPosition);
 
+    //! internal method, discards the cached parsed value (if any).
+    void invalidateParsedValue();
+
     /*!
 	\brief
 		Writes an xml representation of this KeyFrame to \a out_stream.
@@ -220,6 +238,11 @@ private:
     String d_sourceProperty;
     //! progression method used towards this key frame
     Progression d_progression;
+
+    //! serial of the interpolator that d_parsedValue was created by, or 0.
+    mutable uint d_parsedValueSerial;
+    //! parsed form of d_value, or 0 if not available.
+    mutable InterpolatorValue* d_parsedValue;
 };
 
 } // End of  CEGUI namespace section
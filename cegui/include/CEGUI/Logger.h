@@ -110,6 +110,30 @@ public:
 	LoggingLevel	getLoggingLevel(void) const		{return d_level;}
 
 
+    /*!
+    \brief
+        Return whether an event of the given level would currently be added
+        to the log.
+
+        Call sites that have to do work to build a message can check this
+        first (or use the CEGUI_LOGEVENT macro) so that the work is skipped
+        for events that would be discarded anyway.
+
+        This base implementation returns true for every level, so that
+        loggers which do their own filtering in logEvent still receive every
+        event.  Loggers that filter on the logging level should override this
+        to say so, as DefaultLogger does.
+
+    \param level
+        LoggingLevel of the event.
+
+    \return
+        - true if an event at \a level would be logged.
+        - false if an event at \a level would be discarded.
+    */
+    virtual bool isEventLogged(LoggingLevel /*level*/) const   {return true;}
+
+
 	/*!
 	\brief
 		Add an event to the log.
@@ -156,12 +180,25 @@ private:
 
 };
 
+/*************************************************************************
+	This macro adds an event to the log, but only evaluates the expression
+	giving the message when the event will actually be logged.  Use it where
+	building the message is not free (string concatenation etc).
+*************************************************************************/
+#define CEGUI_LOGEVENT( message, level ) \
+    do \
+    { \
+        CEGUI::Logger& cegui_logger = CEGUI::Logger::getSingleton(); \
+        if (cegui_logger.isEventLogged(level)) \
+            cegui_logger.logEvent((message), (level)); \
+    } while (false)
+
 /*************************************************************************
 	This macro is used for 'Insane' level logging so that those items are
 	excluded from non-debug builds
 *************************************************************************/
 #if defined(DEBUG) || defined (_DEBUG)
-#	define CEGUI_LOGINSANE( message ) CEGUI::Logger::getSingleton().logEvent((message), CEGUI::Insane);
+#	define CEGUI_LOGINSANE( message ) CEGUI_LOGEVENT((message), CEGUI::Insane);
 #else
 #	define CEGUI_LOGINSANE( message ) (void)0
 #endif
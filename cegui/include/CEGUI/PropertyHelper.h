@@ -57,6 +57,97 @@
 namespace CEGUI
 {
 
+/*!
+\brief
+    Helper used by the PropertyHelper specialisations to read values directly
+    from the buffer of a String, without making copies of it.
+
+    Matching follows the rules of sscanf: whitespace in a pattern matches any
+    amount of whitespace (including none), other pattern characters must
+    match exactly, and leading whitespace before a number is skipped.
+    Numbers always use '.' as the decimal separator, whatever the current C
+    locale.  Once a match fails, all further operations are ignored, so
+    values read before the failure are kept and later ones are left
+    untouched.
+
+\par
+    Usage:
+
+    PropertyParser(str).match("{").read(scale).match(",").read(offset);
+*/
+class CEGUIEXPORT PropertyParser
+{
+public:
+    explicit PropertyParser(const String& str);
+
+    //! match the given pattern at the current position.
+    PropertyParser& match(const char* pattern);
+    //! read a decimal number, as for the "%g" and "%d" scanf conversions.
+    PropertyParser& read(float& val);
+    PropertyParser& read(double& val);
+    PropertyParser& read(int& val);
+    PropertyParser& read(uint& val);
+    PropertyParser& read(unsigned long& val);
+    PropertyParser& read(uint64& val);
+    //! read up to eight hexadecimal digits, as for the "%8X" scanf conversion.
+    PropertyParser& readHex(uint32& val);
+
+    //! return whether all operations so far have succeeded.
+    bool good() const { return !d_failed; }
+
+private:
+    void skipWhitespace();
+    bool readUnsigned(uint64& val, bool& negative);
+    bool readReal(double& val, bool is_float);
+
+    //! current read position.
+    const String::value_type* d_pos;
+    //! end of the String's buffer.
+    const String::value_type* d_end;
+    //! true once a match or read has failed.
+    bool d_failed;
+};
+
+/*!
+\brief
+    Helper used by the PropertyHelper specialisations to build value strings
+    in a fixed size buffer.
+
+    Floating point values are written with the fewest significant digits
+    that read back as the same value, using '.' as the decimal separator
+    whatever the current C locale.  Notation follows "%g", except that the
+    precision used to choose between fixed and scientific notation is raised
+    to the number of digits needed.
+*/
+class CEGUIEXPORT PropertyFormatter
+{
+public:
+    PropertyFormatter() : d_length(0) {}
+
+    PropertyFormatter& operator<<(const char* text);
+    PropertyFormatter& operator<<(float val);
+    PropertyFormatter& operator<<(double val);
+    PropertyFormatter& operator<<(int val);
+    PropertyFormatter& operator<<(uint val);
+    PropertyFormatter& operator<<(unsigned long val);
+    PropertyFormatter& operator<<(uint64 val);
+    //! append eight upper case hexadecimal digits, as for "%.8X".
+    PropertyFormatter& appendHex(uint32 val);
+
+    //! return the formatted value.
+    String str() const { return String(d_buffer, d_length); }
+
+private:
+    void append(char c);
+    void appendUnsigned(uint64 val);
+    void appendReal(double val, bool is_float);
+
+    //! formatted characters; the longest property value needs under 200.
+    char d_buffer[256];
+    //! number of characters in d_buffer.
+    size_t d_length;
+};
+
 
 /*!
 \brief
@@ -195,17 +286,14 @@ public:
     static inline return_type fromString(const String& str)
     {
         float val = 0;
-        sscanf(str.c_str(), " %g", &val);
-        
+        PropertyParser(str).read(val);
+
         return val;
     }
 
     static inline string_return_type toString(pass_type val)
     {
-        char buff[64];
-        snprintf(buff, sizeof(buff), "%g", val);
-
-        return String(buff);
+        return (PropertyFormatter() << val).str();
     }
 };
 template<>
@@ -227,17 +315,14 @@ public:
     static inline return_type fromString(const String& str)
     {
         double val = 0;
-        sscanf(str.c_str(), " %lg", &val);
-        
+        PropertyParser(str).read(val);
+
         return val;
     }
 
     static inline string_return_type toString(pass_type val)
     {
-        char buff[64];
-        snprintf(buff, sizeof(buff), "%g", val);
-
-        return String(buff);
+        return (PropertyFormatter() << val).str();
     }
 };
 
@@ -260,17 +345,14 @@ public:
     static inline return_type fromString(const String& str)
     {
         int val = 0;
-        sscanf(str.c_str(), " %d", &val);
+        PropertyParser(str).read(val);
 
         return val;
     }
 
     static inline string_return_type toString(pass_type val)
     {
-        char buff[64];
-        snprintf(buff, sizeof(buff), "%d", val);
-
-        return String(buff);
+        return (PropertyFormatter() << val).str();
     }
 };
 
@@ -293,17 +375,14 @@ public:
     static return_type fromString(const String& str)
     {
         uint val = 0;
-        sscanf(str.c_str(), " %u", &val);
+        PropertyParser(str).read(val);
 
         return val;
     }
 
     static string_return_type toString(pass_type val)
     {
-        char buff[64];
-        snprintf(buff, sizeof(buff), "%u", val);
-
-        return String(buff);
+        return (PropertyFormatter() << val).str();
     }
 };
 
@@ -326,17 +405,14 @@ public:
     static return_type fromString(const String& str)
     {
         uint64 val = 0;
-        sscanf(str.c_str(), " %llu", &val);
+        PropertyParser(str).read(val);
 
         return val;
     }
 
     static string_return_type toString(pass_type val)
     {
-        char buff[64];
-        snprintf(buff, sizeof(buff), "%llu", val);
-
-        return String(buff);
+        return (PropertyFormatter() << val).str();
     }
 };
 
@@ -390,17 +466,14 @@ public:
     static return_type fromString(const String& str)
     {
         unsigned long val = 0;
-        sscanf(str.c_str(), " %lu", &val);
+        PropertyParser(str).read(val);
 
         return val;
     }
 
     static string_return_type toString(pass_type val)
     {
-        char buff[64];
-        snprintf(buff, sizeof(buff), "%lu", val);
-
-        return String(buff);
+        return (PropertyFormatter() << val).str();
     }
 };
 
@@ -509,17 +582,16 @@ public:
     static return_type fromString(const String& str)
     {
         Sizef val(0, 0);
-        sscanf(str.c_str(), " w:%g h:%g", &val.d_width, &val.d_height);
+        PropertyParser(str).match(" w:").read(val.d_width)
+                           .match(" h:").read(val.d_height);
 
         return val;
     }
 
     static string_return_type toString(pass_type val)
     {
-        char buff[128];
-        snprintf(buff, sizeof(buff), "w:%g h:%g", val.d_width, val.d_height);
-
-        return String(buff);
+        return (PropertyFormatter() << "w:" << val.d_width
+                                    << " h:" << val.d_height).str();
     }
 };
 
@@ -541,18 +613,17 @@ public:
 
     static return_type fromString(const String& str)
     {
-        Vector2f val(0, 0) ;
-        sscanf(str.c_str(), " x:%g y:%g", &val.d_x, &val.d_y);
+        Vector2f val(0, 0);
+        PropertyParser(str).match(" x:").read(val.d_x)
+                           .match(" y:").read(val.d_y);
 
         return val;
     }
 
     static string_return_type toString(pass_type val)
     {
-        char buff[128];
-        snprintf(buff, sizeof(buff), "x:%g y:%g", val.d_x, val.d_y);
-
-        return String(buff);
+        return (PropertyFormatter() << "x:" << val.d_x
+                                    << " y:" << val.d_y).str();
     }
 };
 
@@ -575,17 +646,18 @@ public:
     static return_type fromString(const String& str)
     {
         Vector3f val(0, 0, 0);
-        sscanf(str.c_str(), " x:%g y:%g z:%g", &val.d_x, &val.d_y, &val.d_z);
+        PropertyParser(str).match(" x:").read(val.d_x)
+                           .match(" y:").read(val.d_y)
+                           .match(" z:").read(val.d_z);
 
         return val;
     }
 
     static string_return_type toString(pass_type val)
     {
-        char buff[128];
-        snprintf(buff, sizeof(buff), "x:%g y:%g z:%g", val.d_x, val.d_y, val.d_z);
-
-        return String(buff);
+        return (PropertyFormatter() << "x:" << val.d_x
+                                    << " y:" << val.d_y
+                                    << " z:" << val.d_z).str();
     }
 };
 
@@ -607,27 +679,32 @@ public:
 
     static return_type fromString(const String& str)
     {
-        if (strchr(str.c_str(), 'w') || strchr(str.c_str(), 'W'))
+        if (str.find('w') != String::npos || str.find('W') != String::npos)
         {
             Quaternion val(1, 0, 0, 0);
-            sscanf(str.c_str(), " w:%g x:%g y:%g z:%g", &val.d_w, &val.d_x, &val.d_y, &val.d_z);
+            PropertyParser(str).match(" w:").read(val.d_w)
+                               .match(" x:").read(val.d_x)
+                               .match(" y:").read(val.d_y)
+                               .match(" z:").read(val.d_z);
 
             return val;
         }
         else
         {
-            float x, y, z;
-            sscanf(str.c_str(), " x:%g y:%g z:%g", &x, &y, &z);
+            float x = 0, y = 0, z = 0;
+            PropertyParser(str).match(" x:").read(x)
+                               .match(" y:").read(y)
+                               .match(" z:").read(z);
             return Quaternion::eulerAnglesDegrees(x, y, z);
         }
     }
 
     static string_return_type toString(pass_type val)
     {
-        char buff[128];
-        snprintf(buff, sizeof(buff), "w:%g x:%g y:%g z:%g", val.d_w, val.d_x, val.d_y, val.d_z);
-
-        return String(buff);
+        return (PropertyFormatter() << "w:" << val.d_w
+                                    << " x:" << val.d_x
+                                    << " y:" << val.d_y
+                                    << " z:" << val.d_z).str();
     }
 };
 
@@ -650,18 +727,20 @@ public:
     static return_type fromString(const String& str)
     {
         Rectf val(0, 0, 0, 0);
-        sscanf(str.c_str(), " l:%g t:%g r:%g b:%g", &val.d_min.d_x, &val.d_min.d_y, &val.d_max.d_x, &val.d_max.d_y);
+        PropertyParser(str).match(" l:").read(val.d_min.d_x)
+                           .match(" t:").read(val.d_min.d_y)
+                           .match(" r:").read(val.d_max.d_x)
+                           .match(" b:").read(val.d_max.d_y);
 
         return val;
     }
 
     static string_return_type toString(pass_type val)
     {
-        char buff[256];
-        snprintf(buff, sizeof(buff), "l:%g t:%g r:%g b:%g",
-                 val.d_min.d_x, val.d_min.d_y, val.d_max.d_x, val.d_max.d_y);
-
-        return String(buff);
+        return (PropertyFormatter() << "l:" << val.d_min.d_x
+                                    << " t:" << val.d_min.d_y
+                                    << " r:" << val.d_max.d_x
+                                    << " b:" << val.d_max.d_y).str();
     }
 };
 
@@ -705,17 +784,14 @@ public:
     static return_type fromString(const String& str)
     {
         argb_t val = 0xFF000000;
-        sscanf(str.c_str(), " %8X", &val);
+        PropertyParser(str).readHex(val);
 
         return Colour(val);
     }
 
     static string_return_type toString(pass_type val)
     {
-        char buff[16];
-        sprintf(buff, "%.8X", val.getARGB());
-
-        return String(buff);
+        return PropertyFormatter().appendHex(val.getARGB()).str();
     }
 };
 
@@ -740,12 +816,15 @@ public:
         if (str.length() == 8)
         {
             argb_t all = 0xFF000000;
-            sscanf(str.c_str(), "%8X", &all);
+            PropertyParser(str).readHex(all);
             return ColourRect(all);
         }
 
         argb_t topLeft = 0xFF000000, topRight = 0xFF000000, bottomLeft = 0xFF000000, bottomRight = 0xFF000000;
-        sscanf(str.c_str(), "tl:%8X tr:%8X bl:%8X br:%8X", &topLeft, &topRight, &bottomLeft, &bottomRight);
+        PropertyParser(str).match("tl:").readHex(topLeft)
+                           .match(" tr:").readHex(topRight)
+                           .match(" bl:").readHex(bottomLeft)
+                           .match(" br:").readHex(bottomRight);
 
         return ColourRect(topLeft, topRight, bottomLeft, bottomRight);
     }
@@ -778,17 +857,16 @@ public:
     static return_type fromString(const String& str)
     {
         UDim ud;
-        sscanf(str.c_str(), " { %g , %g }", &ud.d_scale, &ud.d_offset);
+        PropertyParser(str).match(" {").read(ud.d_scale)
+                           .match(" ,").read(ud.d_offset);
 
         return ud;
     }
 
     static string_return_type toString(pass_type val)
     {
-        char buff[128];
-        snprintf(buff, sizeof(buff), "{%g,%g}", val.d_scale, val.d_offset);
-
-        return String(buff);
+        return (PropertyFormatter() << "{" << val.d_scale
+                                    << "," << val.d_offset << "}").str();
     }
 };
 
@@ -811,20 +889,19 @@ public:
     static return_type fromString(const String& str)
     {
         UVector2 uv;
-        sscanf(str.c_str(), " { { %g , %g } , { %g , %g } }",
-               &uv.d_x.d_scale, &uv.d_x.d_offset,
-               &uv.d_y.d_scale, &uv.d_y.d_offset);
+        PropertyParser(str).match(" { {").read(uv.d_x.d_scale)
+                           .match(" ,").read(uv.d_x.d_offset)
+                           .match(" } , {").read(uv.d_y.d_scale)
+                           .match(" ,").read(uv.d_y.d_offset);
 
         return uv;
     }
 
     static string_return_type toString(pass_type val)
     {
-        char buff[256];
-        snprintf(buff, sizeof(buff), "{{%g,%g},{%g,%g}}",
-                 val.d_x.d_scale, val.d_x.d_offset, val.d_y.d_scale, val.d_y.d_offset);
-
-        return String(buff);
+        return (PropertyFormatter()
+            << "{{" << val.d_x.d_scale << "," << val.d_x.d_offset
+            << "},{" << val.d_y.d_scale << "," << val.d_y.d_offset << "}}").str();
     }
 };
 
@@ -847,20 +924,19 @@ public:
     static return_type fromString(const String& str)
     {
         USize uv;
-        sscanf(str.c_str(), " { { %g , %g } , { %g , %g } }",
-               &uv.d_width.d_scale, &uv.d_width.d_offset,
-               &uv.d_height.d_scale, &uv.d_height.d_offset);
+        PropertyParser(str).match(" { {").read(uv.d_width.d_scale)
+                           .match(" ,").read(uv.d_width.d_offset)
+                           .match(" } , {").read(uv.d_height.d_scale)
+                           .match(" ,").read(uv.d_height.d_offset);
 
         return uv;
     }
 
     static string_return_type toString(pass_type val)
     {
-        char buff[256];
-        snprintf(buff, sizeof(buff), "{{%g,%g},{%g,%g}}",
-                 val.d_width.d_scale, val.d_width.d_offset, val.d_height.d_scale, val.d_height.d_offset);
-
-        return String(buff);
+        return (PropertyFormatter()
+            << "{{" << val.d_width.d_scale << "," << val.d_width.d_offset
+            << "},{" << val.d_height.d_scale << "," << val.d_height.d_offset << "}}").str();
     }
 };
 
@@ -883,6 +959,8 @@ public:
     static return_type fromString(const String& str)
     {
         URect ur;
+        // PropertyParser is no faster for this one, so sscanf (and with it
+        // the C locale) still applies.
         sscanf(
             str.c_str(),
             " { { %g , %g } , { %g , %g } , { %g , %g } , { %g , %g } }",
@@ -897,14 +975,12 @@ public:
 
     static string_return_type toString(pass_type val)
     {
-        char buff[512];
-        snprintf(buff, sizeof(buff), "{{%g,%g},{%g,%g},{%g,%g},{%g,%g}}",
-                 val.d_min.d_x.d_scale, val.d_min.d_x.d_offset,
-                 val.d_min.d_y.d_scale, val.d_min.d_y.d_offset,
-                 val.d_max.d_x.d_scale, val.d_max.d_x.d_offset,
-                 val.d_max.d_y.d_scale, val.d_max.d_y.d_offset);
-
-        return String(buff);
+        return (PropertyFormatter()
+            << "{{" << val.d_min.d_x.d_scale << "," << val.d_min.d_x.d_offset
+            << "},{" << val.d_min.d_y.d_scale << "," << val.d_min.d_y.d_offset
+            << "},{" << val.d_max.d_x.d_scale << "," << val.d_max.d_x.d_offset
+            << "},{" << val.d_max.d_y.d_scale << "," << val.d_max.d_y.d_offset
+            << "}}").str();
     }
 };
 
@@ -927,28 +1003,26 @@ public:
     static return_type fromString(const String& str)
     {
         UBox ret;
-        sscanf(
-            str.c_str(),
-            " { top: { %g , %g } , left: { %g , %g } , bottom: { %g , %g } , right: { %g , %g } }",
-            &ret.d_top.d_scale, &ret.d_top.d_offset,
-            &ret.d_left.d_scale, &ret.d_left.d_offset,
-            &ret.d_bottom.d_scale, &ret.d_bottom.d_offset,
-            &ret.d_right.d_scale, &ret.d_right.d_offset
-        );
+        PropertyParser(str).match(" { top: {").read(ret.d_top.d_scale)
+                           .match(" ,").read(ret.d_top.d_offset)
+                           .match(" } , left: {").read(ret.d_left.d_scale)
+                           .match(" ,").read(ret.d_left.d_offset)
+                           .match(" } , bottom: {").read(ret.d_bottom.d_scale)
+                           .match(" ,").read(ret.d_bottom.d_offset)
+                           .match(" } , right: {").read(ret.d_right.d_scale)
+                           .match(" ,").read(ret.d_right.d_offset);
 
         return ret;
     }
 
     static string_return_type toString(pass_type val)
     {
-        char buff[512];
-        snprintf(buff, sizeof(buff), "{top:{%g,%g},left:{%g,%g},bottom:{%g,%g},right:{%g,%g}}",
-                 val.d_top.d_scale, val.d_top.d_offset,
-                 val.d_left.d_scale, val.d_left.d_offset,
-                 val.d_bottom.d_scale, val.d_bottom.d_offset,
-                 val.d_right.d_scale, val.d_right.d_offset);
-
-        return String(buff);
+        return (PropertyFormatter()
+            << "{top:{" << val.d_top.d_scale << "," << val.d_top.d_offset
+            << "},left:{" << val.d_left.d_scale << "," << val.d_left.d_offset
+            << "},bottom:{" << val.d_bottom.d_scale << "," << val.d_bottom.d_offset
+            << "},right:{" << val.d_right.d_scale << "," << val.d_right.d_offset
+            << "}}").str();
     }
 };
 
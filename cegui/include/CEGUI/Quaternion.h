@@ -297,6 +297,22 @@ public:
                                                const String& value1,
                                                const String& value2,
                                                float position);
+
+    //! \copydoc Interpolator::createValue
+    virtual InterpolatorValue* createValue(const String& value) const;
+
+    //! \copydoc Interpolator::applyAbsolute
+    virtual void applyAbsolute(PropertySet& target, const String& property,
+                               const InterpolatorValue& value1,
+                               const InterpolatorValue& value2,
+                               float position);
+
+    //! \copydoc Interpolator::applyRelative
+    virtual void applyRelative(PropertySet& target, const String& property,
+                               const InterpolatorValue& base,
+                               const InterpolatorValue& value1,
+                               const InterpolatorValue& value2,
+                               float position);
 };
 
 } // End of  CEGUI namespace section
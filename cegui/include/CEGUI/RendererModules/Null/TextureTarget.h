@@ -52,6 +52,8 @@ public:
     bool isImageryCache() const;
     // implement CEGUI::TextureTarget interface.
     void clear();
+    bool isPartialClearSupported() const;
+    void clearArea(const Rectf& area);
     Texture& getTexture() const;
     void declareRenderSize(const Sizef& sz);
     bool isRenderingInverted() const;
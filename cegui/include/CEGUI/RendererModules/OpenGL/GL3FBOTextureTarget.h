@@ -56,6 +56,8 @@ public:
     void deactivate();
     // implementation of TextureTarget interface
     void clear();
+    bool isPartialClearSupported() const;
+    void clearArea(const Rectf& area);
     void declareRenderSize(const Sizef& sz);
     // specialise functions from OpenGL3TextureTarget
     void grabTexture();
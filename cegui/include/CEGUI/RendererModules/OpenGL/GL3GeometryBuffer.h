@@ -46,7 +46,17 @@ public:
 
     void initialiseOpenGLBuffers();
     void deinitialiseOpenGLBuffers();
-    void updateOpenGLBuffers();
+    /*!
+    \brief
+        Upload any vertices added since the last update to the OpenGL vbo.
+
+        Only the part of the vertex data that is not yet on the GPU is
+        transferred; the vbo is grown geometrically when it is too small, in
+        which case the full vertex data is uploaded once.  This is called
+        automatically by draw, so there is normally no need to call it
+        directly.
+    */
+    void updateOpenGLBuffers() const;
 
     // implementation/overrides of members from GeometryBuffer
     void draw() const;
@@ -71,7 +81,9 @@ protected:
     //! Pointer to the OpenGL state changer wrapper that was created inside the Renderer
     OpenGL3StateChangeWrapper* d_glStateChanger;
     //! Size of the buffer that is currently in use
-    GLuint d_bufferSize;
+    mutable GLuint d_bufferSize;
+    //! Number of vertices from d_vertices that have been uploaded to the vbo
+    mutable GLuint d_uploadedVertexCount;
 };
 
 }
@@ -54,6 +54,8 @@ public:
     void deactivate();
     // implementation of TextureTarget interface
     void clear();
+    bool isPartialClearSupported() const;
+    void clearArea(const Rectf& area);
     void declareRenderSize(const Sizef& sz);
     // specialise functions from OpenGLTextureTarget
     void grabTexture();
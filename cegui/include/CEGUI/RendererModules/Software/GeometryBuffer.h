@@ -0,0 +1,138 @@
+/***********************************************************************
+    filename:   CEGUISoftwareGeometryBuffer.h
+    created:    Sun Oct 18 2026
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2012 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUISoftwareGeometryBuffer_h_
+#define _CEGUISoftwareGeometryBuffer_h_
+
+#include "../../GeometryBuffer.h"
+#include "CEGUI/RendererModules/Software/Renderer.h"
+#include "../../Rect.h"
+#include "../../Colour.h"
+#include "../../Vertex.h"
+#include "../../Quaternion.h"
+
+#include <utility>
+#include <vector>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    Implementation of CEGUI::GeometryBuffer for the software renderer.
+
+    Triangles are transformed and projected the same way as the OpenGL
+    renderer does, then scan converted into the surface of the active
+    render target using a top-left fill rule, so that triangles sharing an
+    edge never fill a pixel twice.
+*/
+class SOFTWARE_GUIRENDERER_API SoftwareGeometryBuffer : public GeometryBuffer
+{
+public:
+    //! Constructor
+    SoftwareGeometryBuffer(SoftwareRenderer& owner);
+    //! Destructor
+    virtual ~SoftwareGeometryBuffer();
+
+    // implement CEGUI::GeometryBuffer interface.
+    void draw() const;
+    void setTranslation(const Vector3f& v);
+    void setRotation(const Quaternion& r);
+    void setPivot(const Vector3f& p);
+    void setClippingRegion(const Rectf& region);
+    void appendVertex(const Vertex& vertex);
+    void appendGeometry(const Vertex* const vbuff, uint vertex_count);
+    void setActiveTexture(Texture* texture);
+    void reset();
+    Texture* getActiveTexture() const;
+    uint getVertexCount() const;
+    uint getBatchCount() const;
+    void setRenderEffect(RenderEffect* effect);
+    RenderEffect* getRenderEffect();
+    void setClippingActive(const bool active);
+    bool isClippingActive() const;
+
+protected:
+    //! perform batch management operations prior to adding new geometry.
+    void performBatchManagement();
+
+    //! vertex data as stored for rasterisation; colour is in the 0-255 range.
+    struct SoftwareVertex
+    {
+        float position[3];
+        float tex[2];
+        float colour[4];
+    };
+
+    //! batch of triangles sharing a texture and clipping state.
+    struct BatchInfo
+    {
+        SoftwareTexture* texture;
+        uint vertexCount;
+        bool clip;
+    };
+
+    //! SoftwareRenderer that owns the GeometryBuffer.
+    SoftwareRenderer& d_owner;
+    //! Texture that is set as active
+    SoftwareTexture* d_activeTexture;
+    //! rectangular clip region
+    Rectf d_clipRect;
+    //! whether clipping will be active for the current batch
+    bool d_clippingActive;
+    //! translation vector
+    Vector3f d_translation;
+    //! rotation quaternion
+    Quaternion d_rotation;
+    //! pivot point for rotation
+    Vector3f d_pivot;
+    //! RenderEffect that will be used by the GeometryBuffer
+    RenderEffect* d_effect;
+    //! type of container that tracks BatchInfos.
+    typedef std::vector<BatchInfo> BatchList;
+    //! list of texture batches added to the geometry buffer
+    BatchList d_batches;
+    //! type of container used to queue the geometry
+    typedef std::vector<SoftwareVertex> VertexList;
+    //! container where added geometry is stored.
+    VertexList d_vertices;
+    //! screen space positions of d_vertices, reused between draws.
+    mutable std::vector<Vector2f> d_screenPositions;
+};
+
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUISoftwareGeometryBuffer_h_
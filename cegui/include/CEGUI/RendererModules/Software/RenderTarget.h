@@ -0,0 +1,79 @@
+/***********************************************************************
+    filename:   CEGUISoftwareRenderTarget.h
+    created:    Sun Oct 18 2026
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2012 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUISoftwareRenderTarget_h_
+#define _CEGUISoftwareRenderTarget_h_
+
+#include "../../RenderTarget.h"
+#include "CEGUI/RendererModules/Software/Renderer.h"
+#include "../../Rect.h"
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//! Intermediate RenderTarget rendering into a SoftwareTexture.
+template<typename T = RenderTarget>
+class SOFTWARE_GUIRENDERER_API SoftwareRenderTarget : public T
+{
+public:
+    //! Constructor
+    SoftwareRenderTarget(SoftwareRenderer& owner, SoftwareTexture* surface);
+
+    //! Destructor
+    virtual ~SoftwareRenderTarget();
+
+    // implement parts of CEGUI::RenderTarget interface
+    void draw(const GeometryBuffer& buffer);
+    void draw(const RenderQueue& queue);
+    void setArea(const Rectf& area);
+    const Rectf& getArea() const;
+    void activate();
+    void deactivate();
+    void unprojectPoint(const GeometryBuffer& buff,
+                        const Vector2f& p_in, Vector2f& p_out) const;
+    bool isImageryCache() const;
+
+protected:
+    //! SoftwareRenderer object that owns this RenderTarget
+    SoftwareRenderer& d_owner;
+    //! holds defined area for the RenderTarget
+    Rectf d_area;
+    //! texture holding the pixels rendered to.
+    SoftwareTexture* d_surface;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUISoftwareRenderTarget_h_
@@ -0,0 +1,256 @@
+/***********************************************************************
+    filename:   CEGUISoftwareRenderer.h
+    created:    Sun Oct 18 2026
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2012 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUISoftwareRenderer_h_
+#define _CEGUISoftwareRenderer_h_
+
+#include "../../Renderer.h"
+#include "../../Size.h"
+#include "../../Vector.h"
+#include "../../Rect.h"
+
+#include <vector>
+#include <map>
+
+#if (defined( __WIN32__ ) || defined( _WIN32 )) && !defined(CEGUI_STATIC)
+#   ifdef CEGUISOFTWARERENDERER_EXPORTS
+#       define SOFTWARE_GUIRENDERER_API __declspec(dllexport)
+#   else
+#       define SOFTWARE_GUIRENDERER_API __declspec(dllimport)
+#   endif
+#else
+#   define SOFTWARE_GUIRENDERER_API
+#endif
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+class SoftwareGeometryBuffer;
+class SoftwareTexture;
+
+/*!
+\brief
+    CEGUI::Renderer implementation that rasterises all geometry on the CPU into
+    an in-memory 32 bit ARGB frame.
+
+    This allows the full rendering path - geometry generation, clipping,
+    texturing, blending and rendering to texture for RenderingWindow objects -
+    to be exercised and measured on machines without a GPU, and the resulting
+    frames to be inspected or saved for comparison against reference images.
+
+    The display surface is cleared to transparent black by beginRendering.
+    Textures are sampled with bilinear filtering and clamped at the edges,
+    except where imagery maps one texel to one pixel, which is copied
+    directly.  Blending follows the same rules as the OpenGL renderer.
+*/
+class SOFTWARE_GUIRENDERER_API SoftwareRenderer : public Renderer
+{
+public:
+    /*!
+    \brief
+        Convenience function that creates all the necessary objects
+        then initialises the CEGUI system with them.
+
+        This will create and initialise the following objects for you:
+        - CEGUI::SoftwareRenderer
+        - CEGUI::DefaultResourceProvider
+        - CEGUI::System
+
+    \param display_size
+        Size of the display surface that will be rendered to.
+
+    \param abi
+        This must be set to CEGUI_VERSION_ABI
+
+    \return
+        Reference to the CEGUI::SoftwareRenderer object that was created.
+    */
+    static SoftwareRenderer& bootstrapSystem(const Sizef& display_size,
+                                             const int abi = CEGUI_VERSION_ABI);
+
+    /*!
+    \brief
+        Convenience function to cleanup the CEGUI system and related objects
+        that were created by calling the bootstrapSystem function.
+
+        This function will destroy the following objects for you:
+        - CEGUI::System
+        - CEGUI::DefaultResourceProvider
+        - CEGUI::SoftwareRenderer
+
+    \note
+        If you did not initialise CEGUI by calling the bootstrapSystem function,
+        you should \e not call this, but rather delete any objects you created
+        manually.
+    */
+    static void destroySystem();
+
+    /*!
+    \brief
+        Create a SoftwareRenderer object rendering to a display surface of the
+        given size.
+    */
+    static SoftwareRenderer& create(const Sizef& display_size,
+                                    const int abi = CEGUI_VERSION_ABI);
+
+    //! destroy a SoftwareRenderer object.
+    static void destroy(SoftwareRenderer& renderer);
+
+    /*!
+    \brief
+        Return the texture holding the pixels of the display surface, which
+        receives everything rendered to the default RenderTarget.
+    */
+    SoftwareTexture& getDisplayTexture() const;
+
+    /*!
+    \brief
+        Write the current content of the display surface to a PNG file.
+
+    \exception FileIOException
+        thrown if the file could not be written.
+    */
+    void saveDisplayToPNG(const String& filename) const;
+
+    /*!
+    \brief
+        Return the number of pixels that have been filled since the last call
+        to beginRendering, across all render targets.  Every pixel covered by
+        a triangle is counted, whether or not it changed the target.
+    */
+    size_t getFilledPixelCount() const;
+
+    /*!
+    \brief
+        Return the number of triangles that have been rasterised since the
+        last call to beginRendering, across all render targets.
+    */
+    size_t getRasterisedTriangleCount() const;
+
+    /*!
+    \brief
+        Return the number of filled pixels since the last call to
+        beginRendering, as a multiple of the display surface area.
+    */
+    float getOverdraw() const;
+
+    //! Set the surface and area that GeometryBuffers will be rendered to.
+    void setActiveRenderSurface(SoftwareTexture* surface, const Rectf& area);
+    //! Return the surface that GeometryBuffers will be rendered to.
+    SoftwareTexture* getActiveRenderSurface() const;
+    //! Return the area of the active surface that is being rendered to.
+    const Rectf& getActiveRenderArea() const;
+    //! add to the fill statistics reported for the current frame.
+    void addFillStatistics(size_t triangles, size_t pixels);
+
+    // implement CEGUI::Renderer interface
+    RenderTarget& getDefaultRenderTarget();
+    GeometryBuffer& createGeometryBuffer();
+    void destroyGeometryBuffer(const GeometryBuffer& buffer);
+    void destroyAllGeometryBuffers();
+    TextureTarget* createTextureTarget();
+    void destroyTextureTarget(TextureTarget* target);
+    void destroyAllTextureTargets();
+    Texture& createTexture(const String& name);
+    Texture& createTexture(const String& name,
+                           const String& filename,
+                           const String& resourceGroup);
+    Texture& createTexture(const String& name, const Sizef& size);
+    void destroyTexture(Texture& texture);
+    void destroyTexture(const String& name);
+    void destroyAllTextures();
+    Texture& getTexture(const String& name) const;
+    bool isTextureDefined(const String& name) const;
+    void beginRendering();
+    void endRendering();
+    void setDisplaySize(const Sizef& sz);
+    const Sizef& getDisplaySize() const;
+    const Vector2f& getDisplayDPI() const;
+    uint getMaxTextureSize() const;
+    const String& getIdentifierString() const;
+
+protected:
+    //! constructor.
+    SoftwareRenderer(const Sizef& display_size);
+    //! destructor.
+    virtual ~SoftwareRenderer();
+
+    //! helper to throw exception if name is already used.
+    void throwIfNameExists(const String& name) const;
+    //! helper to safely log the creation of a named texture
+    static void logTextureCreation(const String& name);
+    //! helper to safely log the destruction of a named texture
+    static void logTextureDestruction(const String& name);
+
+    //! String holding the renderer identification text.
+    static String d_rendererID;
+    //! What the renderer considers to be the current display size.
+    Sizef d_displaySize;
+    //! What the renderer considers to be the current display DPI resolution.
+    Vector2f d_displayDPI;
+    //! Texture holding the pixels of the display surface.
+    SoftwareTexture* d_displayTexture;
+    //! The default RenderTarget
+    RenderTarget* d_defaultTarget;
+    //! container type used to hold TextureTargets we create.
+    typedef std::vector<TextureTarget*> TextureTargetList;
+    //! Container used to track texture targets.
+    TextureTargetList d_textureTargets;
+    //! container type used to hold GeometryBuffers we create.
+    typedef std::vector<SoftwareGeometryBuffer*> GeometryBufferList;
+    //! Container used to track geometry buffers.
+    GeometryBufferList d_geometryBuffers;
+    //! container type used to hold Textures we create.
+    typedef std::map<String, SoftwareTexture*, StringFastLessCompare
+                     CEGUI_MAP_ALLOC(String, SoftwareTexture*)> TextureMap;
+    //! Container used to track textures.
+    TextureMap d_textures;
+    //! What the renderer thinks the max texture size is.
+    uint d_maxTextureSize;
+    //! surface currently being rendered to.
+    SoftwareTexture* d_activeSurface;
+    //! area of the surface currently being rendered to.
+    Rectf d_activeArea;
+    //! number of pixels filled since beginRendering.
+    size_t d_filledPixels;
+    //! number of triangles rasterised since beginRendering.
+    size_t d_rasterisedTriangles;
+};
+
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUISoftwareRenderer_h_
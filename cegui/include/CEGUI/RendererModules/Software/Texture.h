@@ -0,0 +1,140 @@
+/***********************************************************************
+    filename:   CEGUISoftwareTexture.h
+    created:    Sun Oct 18 2026
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2012 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUISoftwareTexture_h_
+#define _CEGUISoftwareTexture_h_
+
+#include "../../Texture.h"
+#include "../../Colour.h"
+#include "CEGUI/RendererModules/Software/Renderer.h"
+
+#include <vector>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    Implementation of the CEGUI::Texture class for the software renderer.
+    Pixels are held in memory as 32 bit ARGB values, in rows from top to
+    bottom.
+*/
+class SOFTWARE_GUIRENDERER_API SoftwareTexture : public Texture
+{
+public:
+    /*!
+    \brief
+        Set the size of the texture.  The existing content is discarded and
+        the texture cleared to transparent black.
+    */
+    void setTextureSize(const Sizef& sz);
+
+    //! Return the width of the texture in pixels.
+    uint getPixelWidth() const;
+    //! Return the height of the texture in pixels.
+    uint getPixelHeight() const;
+    //! Return a pointer to the ARGB pixel data, or 0 if the texture is empty.
+    argb_t* getPixelData();
+    //! Return a pointer to the ARGB pixel data, or 0 if the texture is empty.
+    const argb_t* getPixelData() const;
+
+    /*!
+    \brief
+        Fill the given area of the texture with the ARGB colour \a colour.
+        The area is clipped to the texture.
+    */
+    void fill(const Rectf& area, argb_t colour);
+
+    /*!
+    \brief
+        Write the content of the texture to an RGBA PNG file.
+
+    \exception FileIOException
+        thrown if the file could not be written.
+    */
+    void saveToPNG(const String& filename) const;
+
+    // implement CEGUI::Texture interface
+    const String& getName() const;
+    const Sizef& getSize() const;
+    const Sizef& getOriginalDataSize() const;
+    const Vector2f& getTexelScaling() const;
+    void loadFromFile(const String& filename, const String& resourceGroup);
+    void loadFromMemory(const void* buffer, const Sizef& buffer_size,
+                        PixelFormat pixel_format);
+    void blitFromMemory(const void* sourceData, const Rectf& area);
+    void blitToMemory(void* targetData);
+    bool isPixelFormatSupported(const PixelFormat fmt) const;
+
+protected:
+    // the renderer creates and destroys textures, including the display.
+    friend class SoftwareRenderer;
+
+    //! standard constructor
+    SoftwareTexture(const String& name);
+    //! construct texture via an image file.
+    SoftwareTexture(const String& name, const String& filename,
+                    const String& resourceGroup);
+    //! construct texture with a specified initial size.
+    SoftwareTexture(const String& name, const Sizef& sz);
+
+    //! destructor.
+    virtual ~SoftwareTexture();
+    //! updates cached scale value used to map pixels to texture co-ords.
+    void updateCachedScaleValues();
+
+    //! type of container used to hold the pixels.
+    typedef std::vector<argb_t> PixelList;
+    //! The pixels of the texture.
+    PixelList d_pixels;
+    //! Size of the texture in whole pixels.
+    uint d_pixelWidth;
+    //! Size of the texture in whole pixels.
+    uint d_pixelHeight;
+    //! pixel format of data passed to blitFromMemory and blitToMemory.
+    PixelFormat d_format;
+    //! Size of the texture.
+    Sizef d_size;
+    //! original pixel of size data loaded into texture
+    Sizef d_dataSize;
+    //! cached pixel to texel mapping scale values.
+    Vector2f d_texelScaling;
+    //! Name this texture was created with.
+    const String d_name;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUISoftwareTexture_h_
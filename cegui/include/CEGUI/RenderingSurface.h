@@ -31,6 +31,7 @@
 #include "CEGUI/EventSet.h"
 #include "CEGUI/EventArgs.h"
 #include "CEGUI/RenderQueue.h"
+#include "CEGUI/Rect.h"
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -255,6 +256,50 @@ public:
     */
     bool isInvalidated() const;
 
+    /*!
+    \brief
+        Marks an area of the RenderingSurface as invalid, causing the geometry
+        within that area to be rerendered to the RenderTarget next time draw is
+        called.
+
+        Surfaces that physically cache their rendered output and whose
+        TextureTarget supports partial clearing will accumulate the invalidated
+        areas and, on the next draw, only clear and rerender the content that
+        lies within them.  All other surface types treat this exactly as a call
+        to invalidate.
+
+    \param area
+        Rect describing the area that is invalid, in pixels and relative to the
+        top-left corner of the surface.
+    */
+    virtual void invalidateArea(const Rectf& area);
+
+    /*!
+    \brief
+        Return whether this RenderingSurface is invalidated only for the area
+        returned by getInvalidatedArea, as opposed to being fully invalidated
+        or not invalidated at all.
+    */
+    bool isPartiallyInvalidated() const;
+
+    /*!
+    \brief
+        Return the accumulated area that will be rerendered on the next draw
+        when isPartiallyInvalidated returns true.
+    */
+    const Rectf& getInvalidatedArea() const;
+
+    /*!
+    \brief
+        Return the area, in square pixels, of cached imagery that was rerendered
+        by this surface and any RenderingWindow surfaces beneath it during the
+        most recent call to draw.
+
+        This is intended as a statistic to help judge how much work each frame
+        is spending on redrawing imagery caches.
+    */
+    float getLastRedrawnArea() const;
+
     /*!
     \brief
         Return whether this RenderingSurface is actually an instance of the
@@ -359,6 +404,17 @@ protected:
     RenderTarget* d_target;
     //! holds invalidated state of target (as far as we are concerned)
     bool d_invalidated;
+    //! whether invalidation is restricted to d_invalidatedArea.
+    bool d_partiallyInvalidated;
+    //! area accumulated via invalidateArea since the last draw.
+    Rectf d_invalidatedArea;
+    //! area redrawn so far by RenderingWindows beneath us, for this draw.
+    float d_redrawnArea;
+    //! area redrawn during the last draw (including RenderingWindows).
+    float d_lastRedrawnArea;
+
+    // RenderingWindow reports its redrawn area to its owner.
+    friend class RenderingWindow;
 };
 
 } // End of  CEGUI namespace section
@@ -117,6 +117,11 @@ public:
     \param size
         Size object that describes the desired size of the RenderingWindow, in
         pixels.
+
+    \note
+        When the TextureTarget was acquired from the System's
+        TextureTargetPool, the pool is asked to resize it, which may replace
+        it with another target from the pool.
     */
     void setSize(const Sizef& size);
 
@@ -188,7 +193,8 @@ public:
     \brief
         Return the TextureTarget object that is the target for content rendered
         to this RenderingWindows.  This is the same object passed into the
-        constructor.
+        constructor, unless it has been replaced by the TextureTargetPool when
+        resizing.
 
     \return
         The TextureTarget object that receives the rendered output resulting
@@ -282,6 +288,7 @@ public:
     // overrides from base
     void draw();
     void invalidate();
+    void invalidateArea(const Rectf& area);
     bool isRenderingWindow() const;
 
 protected:
@@ -295,8 +302,10 @@ protected:
 
     //! holds ref to renderer
     Renderer& d_renderer;
+    //! pool that records how often our cached content is used.
+    TextureTargetPool& d_targetPool;
     //! TextureTarget to draw to. Like d_target in base, but avoiding downcasts.
-    TextureTarget& d_textarget;
+    TextureTarget* d_textarget;
     //! RenderingSurface that owns this object, we render back to this object.
     RenderingSurface* d_owner;
     //! GeometryBuffer that holds geometry for drawing this window.
@@ -311,6 +320,10 @@ protected:
     Quaternion d_rotation;
     //! Pivot point used for the rotation.
     Vector3f d_pivot;
+    //! clipping region for our geometry on the owner surface.
+    Rectf d_clippingRegion;
+    //! true if d_geometry clipping is restricted to the owner invalidated area.
+    bool d_geometryClippedToDamage;
 };
 
 } // End of  CEGUI namespace section
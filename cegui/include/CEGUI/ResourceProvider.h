@@ -108,6 +108,24 @@ public:
     */
     virtual void unloadRawDataContainer(RawDataContainer&)  { }
 
+    /*!
+    \brief
+        Hint that the given file is about to be loaded via
+        loadRawDataContainer.  Implementations may use this to start reading
+        the data in the background, so that a set of files can be fetched
+        concurrently while earlier ones are being processed.  The default
+        implementation does nothing.
+
+    \param filename
+        String containing a filename of the resource that will be loaded.
+
+    \param resourceGroup
+        Optional String that may be used by implementations to identify the
+        group from which the resource will be loaded.
+    */
+    virtual void prefetchRawData(const String& /*filename*/,
+                                 const String& /*resourceGroup*/)  { }
+
     /*!
     \brief
         Return the current default resource group identifier.
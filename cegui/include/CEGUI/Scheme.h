@@ -195,6 +195,14 @@ public:
     */
     void loadFalagardMappings();
 
+    /*!
+    \brief
+        Hint to the ResourceProvider that all data files directly referenced
+        by the scheme are about to be loaded, so that they may be read in
+        the background while earlier resources are being processed.
+    */
+    void prefetchResources() const;
+
     /*!
     \brief
         Unload all XML based imagesets created by the scheme.
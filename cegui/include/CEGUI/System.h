@@ -218,6 +218,21 @@ public:
     */
     Clipboard* getClipboard() const         {return d_clipboard;}
 
+    /*!
+    \brief
+        Return the pool of TextureTargets used to back the RenderingWindow
+        surfaces that Windows allocate for themselves.
+    */
+    TextureTargetPool& getTextureTargetPool() const;
+
+    /*!
+    \brief
+        Return the cache of decoded images used by the ImageCodec to avoid
+        decoding the same image files again.  The cache is disabled until a
+        cache directory is set on it.
+    */
+    DecodedImageCache& getDecodedImageCache() const;
+
     GUIContext& getDefaultGUIContext() const;
 
     /*!
@@ -612,6 +627,10 @@ protected:
 		Implementation Data
 	*************************************************************************/
 	Renderer*	d_renderer;			//!< Holds the pointer to the Renderer object given to us in the constructor
+    //! pool of TextureTargets for automatically allocated RenderingWindows.
+    TextureTargetPool* d_textureTargetPool;
+    //! cache of decoded images used by the ImageCodec.
+    DecodedImageCache* d_decodedImageCache;
     ResourceProvider* d_resourceProvider;      //!< Holds the pointer to the ResourceProvider object given to us by the renderer or the System constructor.
 	bool d_ourResourceProvider;
 
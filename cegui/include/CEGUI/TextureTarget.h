@@ -47,6 +47,31 @@ public:
     */
     virtual void clear() = 0;
 
+    /*!
+    \brief
+        Return whether the TextureTarget is able to clear a part of its surface
+        via clearArea, leaving the rest of the content intact.
+
+    \return
+        - true if clearArea clears only the requested area.
+        - false if partial clearing is not supported (the default).
+    */
+    virtual bool isPartialClearSupported() const;
+
+    /*!
+    \brief
+        Clear an area of the surface of the underlying texture.
+
+    \param area
+        Rect describing the area to be cleared, in pixels and relative to the
+        top-left corner of the TextureTarget.
+
+    \note
+        The default implementation clears the entire surface, implementations
+        that override this should also override isPartialClearSupported.
+    */
+    virtual void clearArea(const Rectf& area);
+
     /*!
     \brief
         Return a pointer to the CEGUI::Texture that the TextureTarget is using.
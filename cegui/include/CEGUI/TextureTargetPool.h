@@ -0,0 +1,207 @@
+/***********************************************************************
+    filename:   TextureTargetPool.h
+    created:    Sun Oct 18 2026
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2012 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUITextureTargetPool_h_
+#define _CEGUITextureTargetPool_h_
+
+#include "CEGUI/Base.h"
+#include "CEGUI/Size.h"
+#include <vector>
+#include <map>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    Pool of TextureTarget objects created via a Renderer, used to back the
+    RenderingWindow surfaces that Windows allocate for themselves.
+
+    Targets are sized in steps of SIZE_GRANULARITY pixels, so a surface that is
+    resized within its current step keeps its texture, and a surface that
+    grows or shrinks beyond it can be given a suitable idle target rather than
+    having its texture reallocated.  Released targets are kept for reuse while
+    the texture memory held by idle targets stays within the idle budget.
+
+    The pool also keeps counts of how often RenderingWindow surfaces were
+    drawn from their cached content, and how often that content had to be
+    redrawn.
+*/
+class CEGUIEXPORT TextureTargetPool :
+    public AllocatedObject<TextureTargetPool>
+{
+public:
+    //! Granularity, in pixels, to which the size of pooled targets is rounded.
+    static const float SIZE_GRANULARITY;
+    //! Default value for the idle budget, in bytes.
+    static const size_t DEFAULT_IDLE_BUDGET;
+
+    /*!
+    \brief
+        Constructor.
+
+    \param renderer
+        Renderer that will be used to create and destroy the TextureTargets
+        managed by the pool.
+    */
+    TextureTargetPool(Renderer& renderer);
+
+    //! Destructor.  Destroys all idle targets.
+    ~TextureTargetPool();
+
+    /*!
+    \brief
+        Return a TextureTarget able to hold content of the given size, reusing
+        an idle target where one is suitable.
+
+        The returned target has been cleared.  Its texture may be larger than
+        requested, so the content occupies only the top-left area of it.
+
+    \return
+        Pointer to a TextureTarget, or 0 if the Renderer does not support
+        TextureTargets.
+    */
+    TextureTarget* acquire(const Sizef& size);
+
+    /*!
+    \brief
+        Return a TextureTarget previously obtained from acquire to the pool.
+        The target is kept for reuse or destroyed, according to the idle
+        budget.
+    */
+    void release(TextureTarget* target);
+
+    /*!
+    \brief
+        Make a TextureTarget obtained from acquire able to hold content of the
+        given size.
+
+        The target is left alone if the size is within its current capacity
+        and does not waste too much of it.  Otherwise, a suitable idle target is
+        used in its place, or the target is declared at a new capacity when
+        there is none.
+
+    \return
+        Pointer to the TextureTarget to use from now on.  When this differs
+        from \a target, the old target has been released and the new one has
+        been cleared.
+    */
+    TextureTarget* resize(TextureTarget* target, const Sizef& size);
+
+    //! Return whether the TextureTarget was obtained from acquire and is in use.
+    bool isAcquired(const TextureTarget& target) const;
+
+    //! Destroy all idle targets held by the pool.
+    void destroyIdleTargets();
+
+    //! Set the maximum number of bytes of texture held by idle targets.
+    void setIdleBudget(size_t bytes);
+
+    //! Return the maximum number of bytes of texture held by idle targets.
+    size_t getIdleBudget() const;
+
+    //! Return the (estimated) bytes of texture held by targets in use.
+    size_t getTextureBytesInUse() const;
+
+    //! Return the (estimated) bytes of texture held by idle targets.
+    size_t getIdleTextureBytes() const;
+
+    //! Return the number of targets currently in use.
+    size_t getAcquiredTargetCount() const;
+
+    //! Return the number of idle targets held by the pool.
+    size_t getIdleTargetCount() const;
+
+    //! Record that a RenderingWindow was drawn from its cached content.
+    void notifyCacheHit();
+
+    //! Record that a RenderingWindow had to redraw its cached content.
+    void notifyCacheMiss();
+
+    //! Return the number of cached content draws recorded.
+    uint64 getCacheHitCount() const;
+
+    //! Return the number of cached content redraws recorded.
+    uint64 getCacheMissCount() const;
+
+    //! Reset the cache hit and miss counts.
+    void resetCacheStatistics();
+
+private:
+    //! return size rounded up to the granularity of pooled targets.
+    static Sizef getCapacityFor(const Sizef& size);
+    //! return the number of bytes of texture for a target of the given size.
+    static size_t getByteSize(const Sizef& capacity);
+    //! return whether a target of given capacity is suitable for size.
+    static bool isSuitable(const Sizef& capacity, const Sizef& size);
+    //! take the best suited idle target, or return 0 when there is none.
+    TextureTarget* takeIdleTarget(const Sizef& size, Sizef& capacity);
+    //! destroy the oldest idle targets until the idle budget is met.
+    void trimIdleTargets();
+
+    //! a target together with the size it has been declared at.
+    struct Entry
+    {
+        TextureTarget* target;
+        Sizef capacity;
+    };
+
+    typedef std::vector<Entry
+        CEGUI_VECTOR_ALLOC(Entry)> EntryList;
+    typedef std::map<const TextureTarget*, Sizef,
+        std::less<const TextureTarget*>
+        CEGUI_MAP_ALLOC(const TextureTarget*, Sizef)> CapacityMap;
+
+    //! Renderer used to create and destroy targets.
+    Renderer& d_renderer;
+    //! idle targets, oldest first.
+    EntryList d_idleTargets;
+    //! capacity of targets currently in use.
+    CapacityMap d_acquiredTargets;
+    //! maximum bytes of texture held by idle targets.
+    size_t d_idleBudget;
+    //! bytes of texture held by idle targets.
+    size_t d_idleBytes;
+    //! bytes of texture held by targets in use.
+    size_t d_acquiredBytes;
+    //! number of draws of cached content.
+    uint64 d_cacheHits;
+    //! number of redraws of cached content.
+    uint64 d_cacheMisses;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUITextureTargetPool_h_
@@ -33,11 +33,35 @@
 #include "CEGUI/Base.h"
 #include "CEGUI/Interpolator.h"
 #include "CEGUI/PropertyHelper.h"
+#include "CEGUI/PropertySet.h"
 
 // Start of CEGUI namespace section
 namespace CEGUI
 {
 
+/*!
+\brief
+    InterpolatorValue holding a parsed value of type T, as created by the
+    template interpolators.
+*/
+template<typename T>
+class TplInterpolatorValue : public InterpolatorValue
+{
+public:
+    TplInterpolatorValue(const T& value):
+        d_value(value)
+    {}
+
+    //! cast helper used by interpolators to get at the stored value.
+    static const T& get(const InterpolatorValue& value)
+    {
+        return static_cast<const TplInterpolatorValue<T>&>(value).d_value;
+    }
+
+    //! the parsed value.
+    const T d_value;
+};
+
 class CEGUIEXPORT TplInterpolatorBase : public Interpolator
 {
 public:
@@ -121,6 +145,42 @@ public:
 
         return Helper::toString(result);
     }
+
+    //! \copydoc Interpolator::createValue
+    virtual InterpolatorValue* createValue(const String& value) const
+    {
+        return CEGUI_NEW_AO TplInterpolatorValue<T>(Helper::fromString(value));
+    }
+
+    //! \copydoc Interpolator::applyAbsolute
+    virtual void applyAbsolute(PropertySet& target, const String& property,
+                               const InterpolatorValue& value1,
+                               const InterpolatorValue& value2,
+                               float position)
+    {
+        const T& val1 = TplInterpolatorValue<T>::get(value1);
+        const T& val2 = TplInterpolatorValue<T>::get(value2);
+
+        const T result = static_cast<const T>(val1 * (1.0f - position) + val2 * (position));
+
+        target.setProperty<T>(property, result);
+    }
+
+    //! \copydoc Interpolator::applyRelative
+    virtual void applyRelative(PropertySet& target, const String& property,
+                               const InterpolatorValue& base,
+                               const InterpolatorValue& value1,
+                               const InterpolatorValue& value2,
+                               float position)
+    {
+        const T& bas = TplInterpolatorValue<T>::get(base);
+        const T& val1 = TplInterpolatorValue<T>::get(value1);
+        const T& val2 = TplInterpolatorValue<T>::get(value2);
+
+        const T result = static_cast<const T>(bas + (val1 * (1.0f - position) + val2 * (position)));
+
+        target.setProperty<T>(property, result);
+    }
 };
 
 /*!
@@ -186,6 +246,33 @@ public:
         // there is nothing we can do, we have no idea what operators T has overloaded
         return Helper::toString(bas);
     }
+
+    //! \copydoc Interpolator::createValue
+    virtual InterpolatorValue* createValue(const String& value) const
+    {
+        return CEGUI_NEW_AO TplInterpolatorValue<T>(Helper::fromString(value));
+    }
+
+    //! \copydoc Interpolator::applyAbsolute
+    virtual void applyAbsolute(PropertySet& target, const String& property,
+                               const InterpolatorValue& value1,
+                               const InterpolatorValue& value2,
+                               float position)
+    {
+        target.setProperty<T>(property, TplInterpolatorValue<T>::get(
+            position < 0.5 ? value1 : value2));
+    }
+
+    //! \copydoc Interpolator::applyRelative
+    virtual void applyRelative(PropertySet& target, const String& property,
+                               const InterpolatorValue& /*base*/,
+                               const InterpolatorValue& value1,
+                               const InterpolatorValue& value2,
+                               float position)
+    {
+        target.setProperty<T>(property, TplInterpolatorValue<T>::get(
+            position < 0.5 ? value1 : value2));
+    }
 };
 
 /*!
@@ -223,6 +310,19 @@ public:
         
         return Helper::toString(result);
     }
+
+    //! \copydoc Interpolator::applyRelative
+    virtual void applyRelative(PropertySet& target, const String& property,
+                               const InterpolatorValue& base,
+                               const InterpolatorValue& value1,
+                               const InterpolatorValue& value2,
+                               float position)
+    {
+        const T result = TplInterpolatorValue<T>::get(base) +
+            TplInterpolatorValue<T>::get(position < 0.5 ? value1 : value2);
+
+        target.setProperty<T>(property, result);
+    }
 };
 
 } // End of  CEGUI namespace section
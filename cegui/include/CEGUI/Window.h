@@ -1595,8 +1595,14 @@ public:
     \param position
         The characted index position where the string \a text should be
         inserted.
+
+    \note
+        This is virtual so that widgets which keep state derived from the text
+        (such as MultiLineEditbox) can update it for just the inserted text.
+        Overrides must still modify the text and then call onTextChanged, so
+        that EventTextChanged is fired once for the change.
     */
-    void insertText(const String& text, const String::size_type position);
+    virtual void insertText(const String& text, const String::size_type position);
 
     /*!
     \brief
@@ -1606,8 +1612,12 @@ public:
     \param text
         String object holding the text that is to be appended to the Window
         object's current text string.
+
+    \note
+        This is virtual for the same reason as insertText, and overrides have
+        the same obligations.
     */
-    void appendText(const String& text);
+    virtual void appendText(const String& text);
 
     /*!
     \brief
@@ -2068,6 +2078,30 @@ public:
     */
     virtual void destroy(void);
 
+    /*!
+    \brief
+        Internal method called by WindowManager when this window is to be
+        kept for reuse rather than destroyed.
+
+        The window is detached from its parent, any child windows that are
+        not auto-windows are removed (and destroyed if they are destroyed by
+        their parent), event subscriptions made since the window was handed
+        out are disconnected and user data is cleared.  User strings and
+        property values are restored by WindowManager afterwards.
+
+        This is virtual so that widgets holding additional state (such as list
+        content) can reset it.  If you override this you MUST call this base
+        class version.
+
+    \note
+        You never have to call this method yourself, WindowManager calls this
+        when a window of a type that has pooling enabled is destroyed.
+    */
+    virtual void prepareForRecycling(void);
+
+    //! record a subscription so prepareForRecycling can disconnect it.
+    void recordSubscription(const Event::Connection& connection);
+
     /*!
     \brief
         Set the custom Tooltip object for this Window.  This value may be 0 to
@@ -2283,6 +2317,33 @@ public:
         Nothing.
     */
     virtual void update(float elapsed);
+
+    /*!
+    \brief
+        Return whether this window or any of its descendants needs the time
+        based processing done by update.  When the GUIContext has idle update
+        skipping enabled, subtrees for which this returns false are skipped by
+        update, so that large, mostly idle hierarchies cost little per frame.
+
+    \see
+        Window::isUpdateRequired
+    */
+    bool isSubtreeUpdateRequired() const;
+
+    /*!
+    \brief
+        Inform the window that whether it needs time based updates may have
+        changed, so that the cached state of this window and its ancestors will
+        be refreshed before the next update.
+    */
+    void notifyUpdateRequirementChanged() const;
+
+    // overridden from EventSet so we know when EventUpdated gets subscribed.
+    using EventSet::subscribeEvent;
+    Event::Connection subscribeEvent(const String& name,
+                                     Event::Subscriber subscriber);
+    Event::Connection subscribeEvent(const String& name, Event::Group group,
+                                     Event::Subscriber subscriber);
     
     /*!
     \brief
@@ -2436,6 +2497,9 @@ public:
     */
     virtual void notifyScreenAreaChanged(bool recursive = true);
 
+    // overridden from Element
+    void endAreaUpdate();
+
     /*!
     \brief
         Changes the widget's falagard type, thus changing its look'n'feel and optionally its
@@ -2490,6 +2554,16 @@ public:
     */
     void invalidateRenderingSurface();
 
+    /*!
+    \brief
+        Invalidate only the area covered by this window's geometry on the
+        rendering surface it is drawn to, so that a caching surface is able to
+        redraw just that area next render.  Used instead of
+        invalidateRenderingSurface when partial redraws are enabled for the
+        GUIContext.
+    */
+    void invalidateRenderingSurfaceArea();
+
     /*!
     \brief
         Sets whether \e automatic use of an imagery caching RenderingSurface
@@ -2533,6 +2607,33 @@ public:
     */
     void setUsingAutoRenderingSurface(bool setting);
 
+    /*!
+    \brief
+        Update the automatic caching state of this Window after its GUIContext
+        has redrawn its content.  This is called by the GUIContext for each
+        child of its root window while automatic caching is enabled, and is not
+        normally called directly.
+
+        A Window with child windows that stays unchanged for \a threshold
+        consecutive redraws has an automatic RenderingSurface enabled.  When an
+        automatically enabled surface then changes in \a threshold consecutive
+        redraws, or the Window is hidden, the surface is released again.
+
+    \param threshold
+        Number of consecutive redraws used by the heuristic, must not be 0.
+
+    \see
+        GUIContext::setAutoCachingThreshold
+    */
+    void updateAutoCaching(uint threshold);
+
+    /*!
+    \brief
+        Return whether the automatic RenderingSurface of this Window was enabled
+        by the automatic caching heuristic, rather than by the client.
+    */
+    bool isAutoCached() const;
+
     //! Return the parsed RenderedString object for this window.
     const RenderedString& getRenderedString() const;
     //! Return a pointer to any custom RenderedStringParser set, or 0 if none.
@@ -3257,6 +3358,25 @@ protected:
     */
     virtual void updateSelf(float elapsed);
 
+    /*!
+    \brief
+        Return whether this Window itself, ignoring any children, needs the
+        time based processing done by update and updateSelf.
+
+        The default returns true while mouse auto-repeat is in progress, while
+        EventUpdated has subscribers, when the window has a RenderingWindow
+        surface or when the assigned WindowRenderer requires updates.
+        Subclasses that override updateSelf should also override this to
+        return true while they have work pending, and call
+        notifyUpdateRequirementChanged when that may have become true;
+        otherwise they will not be updated while idle update skipping is
+        enabled on their GUIContext.
+
+    \see
+        GUIContext::setIdleUpdateSkippingEnabled
+    */
+    virtual bool isUpdateRequired() const;
+
     /*!
     \brief
         Perform the actual rendering for this Window.
@@ -3358,6 +3478,9 @@ protected:
     //! Helper to intialise the needed clipping for geometry and render surface.
     void initialiseClippers(const RenderingContext& ctx);
 
+    //! Return the clip region for our geometry on the given context's surface.
+    Rectf getGeometryClipRect(const RenderingContext& ctx) const;
+
     //! \copydoc Element::setArea_impl
     virtual void setArea_impl(const UVector2& pos, const USize& size, bool topLeftSizing = false, bool fireEvents = true);
     
@@ -3456,6 +3579,9 @@ protected:
     //! transfer RenderingSurfaces to be owned by our target RenderingSurface.
     void transferChildSurfaces();
 
+    //! flag a change for us and the ancestors drawing to the same surface.
+    void markContentChanged();
+
     //! helper function for calculating clipping rectangles.
     Rectf getParentElementClipIntersection(const Rectf& unclipped_area) const;
 
@@ -3487,13 +3613,43 @@ protected:
     //! handler function for when font render size changes.
     virtual bool handleFontRenderSizeChange(const EventArgs& args);
 
+    //! handler function for when deferred glyphs of a font are rasterised.
+    virtual bool handleFontGlyphsRasterised(const EventArgs& args);
+
     // mark the rect caches defined on Window invalid (does not affect Element)
     void markCachedWindowRectsInvalid();
     void layoutLookNFeelChildWidgets();
 
+    /*!
+    \brief
+        return the child Window hit by \a position according to
+        \a hittestfunc.  When \a use_hit_test_bounds is true, children whose
+        hit test bounds do not contain \a position are skipped along with
+        their descendants (see isInHitTestBounds).
+    */
     Window* getChildAtPosition(const Vector2f& position,
                                bool (Window::*hittestfunc)(const Vector2f&, bool) const,
-                               bool allow_disabled = false) const;
+                               bool allow_disabled = false,
+                               bool use_hit_test_bounds = false) const;
+
+    /*!
+    \brief
+        Return whether \a position lies within the bounds of the hit test
+        areas of this window and all of its descendants, and so may hit this
+        window or one of them.
+
+        The bounds are built from the cached getHitTestRect values and kept
+        per window, forming a bounding volume hierarchy over the window tree
+        that allows hit testing to skip whole subtrees.  This relies on isHit
+        never reporting a hit outside of getHitTestRect.
+    */
+    bool isInHitTestBounds(const Vector2f& position) const;
+
+    //! recalculate the hit test bounds for this window (and descendants).
+    void updateHitTestBounds() const;
+
+    //! mark the hit test bounds of this window and its ancestors invalid.
+    void invalidateHitTestBounds() const;
 
     bool isHitTargetWindow(const Vector2f& position, bool allow_disabled) const;
 
@@ -3553,6 +3709,9 @@ protected:
     //! definition of type used to track properties banned from writing XML.
     typedef std::set<String, StringFastLessCompare
         CEGUI_SET_ALLOC(String)> BannedXMLPropertySet;
+    //! definition of type used to track event subscriptions made by clients.
+    typedef std::vector<Event::Connection
+        CEGUI_VECTOR_ALLOC(Event::Connection)> ConnectionList;
 
     //! type of Window (also the name of the WindowFactory that created us)
     const String d_type;
@@ -3592,6 +3751,15 @@ protected:
     mutable bool d_needsRedraw;
     //! holds setting for automatic creation of of surface (RenderingWindow)
     bool d_autoRenderingWindow;
+    //! true if d_autoRenderingWindow was set by the automatic caching heuristic.
+    bool d_autoCached;
+    //! true if imagery drawn to our target surface by us or our descendants
+    //! changed since the last automatic caching update.
+    bool d_contentChanged;
+    //! number of consecutive automatic caching updates without changes.
+    uint d_unchangedRedrawCount;
+    //! number of consecutive automatic caching updates with changes.
+    uint d_changedRedrawCount;
 
     //! Holds pointer to the Window objects current mouse cursor image.
     const Image* d_mouseCursor;
@@ -3691,6 +3859,25 @@ protected:
     mutable bool d_innerRectClipperValid;
     mutable bool d_hitTestRectValid;
 
+    //! union of the hit test areas of this window and all descendants.
+    mutable Rectf d_hitTestBounds;
+    //! true if descendants are hit tested in a rotated space, so no bounds.
+    mutable bool d_hitTestBoundsUnbounded;
+    //! true if d_hitTestBounds and d_hitTestBoundsUnbounded are up to date.
+    mutable bool d_hitTestBoundsValid;
+    //! true if this window or a descendant needs time based updates.
+    mutable bool d_subtreeUpdateRequired;
+    //! true if d_subtreeUpdateRequired is up to date.
+    mutable bool d_updateRequirementValid;
+    //! true if anything has subscribed to EventUpdated for this window.
+    bool d_updateEventSubscribed;
+    //! true if event subscriptions are recorded so they can be undone.
+    bool d_recordSubscriptions;
+    //! subscriptions made while d_recordSubscriptions was set.
+    ConnectionList d_recordedSubscriptions;
+    //! true if d_geometry clipping is restricted to a surface invalidated area.
+    bool d_geometryClippedToDamage;
+
     //! The mode to use for calling Window::update
     WindowUpdateMode d_updateMode;
 
@@ -3717,6 +3904,8 @@ private:
 
     //! connection for event listener for font render size changes.
     Event::ScopedConnection d_fontRenderSizeChangeConnection;
+    //! connection for event listener for deferred glyph rasterisation.
+    Event::ScopedConnection d_fontGlyphsRasterisedConnection;
 };
 
 } // End of  CEGUI namespace section
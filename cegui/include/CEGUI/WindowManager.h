@@ -158,6 +158,11 @@ public:
 	\brief
 		Destroy the specified Window object.
 
+        Any child windows of \a window that have the DestroyedByParent
+        property set are destroyed along with it, so an entire subtree can be
+        torn down with a single call.  The cost of this is linear in the
+        number of windows destroyed.
+
 	\param window
 		Pointer to the Window object to be destroyed.
 
@@ -391,6 +396,69 @@ public:
     */
     bool isLocked() const;
 
+    /*!
+    \brief
+        Set the maximum number of destroyed windows of the given type that are
+        kept for reuse.
+
+        Pooling is opt-in and disabled for all types by default.  When enabled
+        for a type, destroyWindow resets windows of that type (and the
+        Look'N'Feel the type maps to) and parks them instead of destroying
+        them, and createWindow hands out a parked window when one is
+        available.  This avoids running the window factory and Look'N'Feel
+        initialisation, which includes creation of child widgets, every time.
+
+        A recycled window is reset by:
+        - detaching it from its parent.
+        - removing child windows that are not auto-windows.
+        - disconnecting event subscriptions made on the window itself after
+          it was created.
+        - clearing user data and user strings.
+        - restoring the window's own property values to those of a newly
+          created window of the type.
+
+        State held elsewhere is not reset, for example subscriptions made on
+        auto-window children or widget specific content not exposed via
+        properties.  Only enable pooling for types where this is acceptable.
+
+    \param type
+        String holding the window type, as passed to createWindow.
+
+    \param limit
+        Maximum number of windows to keep for \a type.  Zero disables pooling
+        for the type.  Parked windows over the new limit are destroyed.
+    */
+    void setWindowPoolLimit(const String& type, size_t limit);
+
+    //! Return the maximum number of windows of \a type kept for reuse.
+    size_t getWindowPoolLimit(const String& type) const;
+
+    //! Return the number of windows of \a type currently parked for reuse.
+    size_t getPooledWindowCount(const String& type) const;
+
+    //! Destroy all parked windows of \a type.  The limit is not changed.
+    void clearWindowPool(const String& type);
+
+    //! Destroy all parked windows of all types.  Limits are not changed.
+    void clearAllWindowPools();
+
+    /*!
+    \brief
+        Return the number of createWindow calls for pooled types that were
+        satisfied by reusing a parked window.
+    */
+    uint getWindowPoolHitCount() const;
+
+    /*!
+    \brief
+        Return the number of createWindow calls for pooled types that had to
+        create a new window because none was parked.
+    */
+    uint getWindowPoolMissCount() const;
+
+    //! Reset the window pool hit and miss counts to zero.
+    void resetWindowPoolStatistics();
+
 private:
     /*************************************************************************
         Implementation Methods
@@ -404,16 +472,88 @@ private:
     //! function to set up RenderEffect on a window
     void initialiseRenderEffect(Window* wnd, const String& effect) const;
 
+    //! return the d_registryIndex slot referencing \a window, or npos.
+    size_t findRegistrySlot(const Window* window) const;
+    //! add \a window to d_windowRegistry and d_registryIndex.
+    void addToRegistry(Window* window);
+    //! remove the window referenced by d_registryIndex slot \a slot.
+    void removeFromRegistry(size_t slot);
+    //! rebuild d_registryIndex with \a table_size slots (a power of two).
+    void rehashRegistry(size_t table_size);
+    //! return the d_registryIndex start slot for \a window.
+    size_t getRegistryHash(const Window* window) const;
+
     /*************************************************************************
 		Implementation Data
 	*************************************************************************/
     typedef std::vector<Window*
         CEGUI_VECTOR_ALLOC(Window*)> WindowVector; //!< Type to use for a collection of Window pointers.
 
+    typedef std::vector<size_t
+        CEGUI_VECTOR_ALLOC(size_t)> RegistryIndexTable;
+
     //! collection of created windows.
 	WindowVector d_windowRegistry;
+    /*!
+        Open addressed hash table mapping Window pointers to their position in
+        d_windowRegistry.  Each slot holds an index into d_windowRegistry, or
+        npos when unused.  This keeps isAlive and destroyWindow constant time.
+    */
+    RegistryIndexTable d_registryIndex;
     WindowVector d_deathrow; //!< Collection of 'destroyed' windows.
 
+    //! property name and value pair.
+    typedef std::pair<String, String> PropertyValue;
+    typedef std::vector<PropertyValue
+        CEGUI_VECTOR_ALLOC(PropertyValue)> PropertyValueList;
+    //! user string dictionary, as held by Window.
+    typedef std::map<String, String, StringFastLessCompare
+        CEGUI_MAP_ALLOC(String, String)> UserStringMap;
+
+    //! windows kept for reuse for a single window type.
+    struct WindowPool
+    {
+        WindowPool() : d_limit(0), d_initialValuesValid(false) {}
+
+        //! maximum number of windows kept.
+        size_t d_limit;
+        //! the parked windows.
+        WindowVector d_windows;
+        //! Look'N'Feel windows of the type had when created.
+        String d_lookName;
+        //! property values of a newly created window of the type.
+        PropertyValueList d_initialValues;
+        /*!
+            user strings of a newly created window of the type.  These include
+            the ones backing property definitions of the look, which are thus
+            never missing when the properties are reset.
+        */
+        UserStringMap d_initialUserStrings;
+        //! whether the initial state above has been captured.
+        bool d_initialValuesValid;
+    };
+
+    typedef std::map<String, WindowPool, StringFastLessCompare
+        CEGUI_MAP_ALLOC(String, WindowPool)> WindowPoolMap;
+
+    //! return the pool for \a type if pooling is enabled for it, else 0.
+    WindowPool* getWindowPool(const String& type);
+    //! reuse a window parked in \a pool, giving it the name \a name.
+    Window* takePooledWindow(WindowPool& pool, const String& name);
+    //! record state of a newly created window used to reset pooled windows.
+    void captureInitialState(WindowPool& pool, Window& window) const;
+    //! reset \a window and park it, returns false if it can not be pooled.
+    bool parkWindow(Window* window);
+    //! destroy the windows in \a windows, which must have been parked.
+    void destroyPooledWindows(WindowVector& windows);
+
+    //! pools of destroyed windows kept for reuse, keyed by window type.
+    WindowPoolMap d_windowPools;
+    //! number of pooled type creations that reused a parked window.
+    uint d_poolHits;
+    //! number of pooled type creations that created a new window.
+    uint d_poolMisses;
+
     unsigned long   d_uid_counter;  //!< Counter used to generate unique window names.
     static String d_defaultResourceGroup;   //!< holds default resource group
     //! count of times WM is locked against new window creation.
@@ -428,6 +568,10 @@ public:
 	/*!
 	\brief
 		Return a WindowManager::WindowIterator object to iterate over the currently defined Windows.
+
+        \note
+            The order of iteration is unspecified and may change whenever a
+            window is destroyed.
 	*/
 	WindowIterator	getIterator(void) const;
 
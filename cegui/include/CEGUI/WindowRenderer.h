@@ -135,6 +135,14 @@ public:
     //! perform any time based updates for this WindowRenderer.
     virtual void update(float /*elapsed*/) {}
 
+    /*!
+    \brief
+        Return whether this WindowRenderer needs update to be called.  Windows
+        for which nothing needs updates are skipped during time based updates,
+        so WindowRenderers overriding update should also override this.
+    */
+    virtual bool isUpdateRequired() const { return false; }
+
     /*!
     \brief
         Perform any updates needed because the given font's render size has
@@ -154,6 +162,19 @@ public:
     */
     virtual bool handleFontRenderSizeChange(const Font* const font);
 
+    /*!
+    \brief
+        Return whether the window draws any text using the given font, and
+        so must be redrawn when the imagery of the font's glyphs changes.
+
+    \note
+        This base implementation checks the window's own font and the text
+        components of the assigned widget look.  Renderers drawing text in
+        other fonts (for example, of list items) should override this.
+        Fonts selected by markup in the window text are handled by Window.
+    */
+    virtual bool isUsingFont(const Font* const font) const;
+
 protected:
     /*************************************************************************
         Implementation methods
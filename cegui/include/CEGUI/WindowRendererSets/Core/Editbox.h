@@ -150,6 +150,7 @@ public:
     size_t getTextIndexFromPosition(const Vector2f& pt) const;
     // overridden from WindowRenderer class
     void update(float elapsed);
+    bool isUpdateRequired() const;
     bool handleFontRenderSizeChange(const Font* const font);
 
 protected:
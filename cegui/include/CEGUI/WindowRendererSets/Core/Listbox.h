@@ -91,6 +91,7 @@ namespace CEGUI
                                  bool fit_height) const;
 
         bool handleFontRenderSizeChange(const Font* const font);
+        bool isUsingFont(const Font* const font) const;
 
     protected:
         Rectf getItemRenderingArea(bool hscroll, bool vscroll) const;
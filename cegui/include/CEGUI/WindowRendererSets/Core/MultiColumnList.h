@@ -83,6 +83,10 @@ namespace CEGUI
         Rectf getListRenderArea(void) const;
         // overridden from base class.
         void render();
+        // overridden from base class.
+        bool handleFontRenderSizeChange(const Font* const font);
+        // overridden from base class.
+        bool isUsingFont(const Font* const font) const;
     };
 } // End of  CEGUI namespace section
 
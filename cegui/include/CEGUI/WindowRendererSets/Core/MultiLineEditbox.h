@@ -96,6 +96,7 @@ public:
     Rectf getTextRenderArea(void) const;
     void render();
     void update(float elapsed);
+    bool isUpdateRequired() const;
 
     //! return whether the blinking caret is enabled.
     bool isCaretBlinkEnabled() const;
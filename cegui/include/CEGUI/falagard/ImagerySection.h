@@ -252,6 +252,9 @@ namespace CEGUI
         //! perform any processing required due to the given font having changed.
         bool handleFontRenderSizeChange(Window& window, const Font* font) const;
 
+        //! return whether any text component draws using \a font for \a window.
+        bool isUsingFont(const Window& window, const Font* font) const;
+
     protected:
         /*!
         \brief
@@ -295,6 +295,9 @@ namespace CEGUI
         // overridden from ComponentBase.
         bool handleFontRenderSizeChange(Window& window, const Font* font) const;
 
+        //! return whether this component draws using \a font for \a window.
+        bool isUsingFont(const Window& window, const Font* font) const;
+
     protected:
         // implemets abstract from base
         void render_impl(Window& srcWindow, Rectf& destRect, const CEGUI::ColourRect* modColours, const Rectf* clipper, bool clipToDisplay) const;
@@ -410,6 +410,9 @@ public:
     //! perform any processing required due to the given font having changed.
     bool handleFontRenderSizeChange(Window& window, const Font* font) const;
 
+    //! return whether any imagery of this look draws text using \a font.
+    bool isUsingFont(const Window& window, const Font* font) const;
+
 private:
     typedef std::map<String, StateImagery, StringFastLessCompare
         CEGUI_MAP_ALLOC(String, StateImagery)> StateList;
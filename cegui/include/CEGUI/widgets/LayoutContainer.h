@@ -100,6 +100,10 @@ public:
     \brief
         (re)layouts all windows inside this layout container if it was marked
         necessary
+
+        The layout is performed inside an area update transaction (see
+        Element::beginAreaUpdate), so child move and size notifications are
+        delivered once, after the container has been sized.
     */
     virtual void layoutIfNecessary();
 
@@ -123,6 +127,9 @@ protected:
     /// @copydoc Window::removeChild_impl
     virtual void removeChild_impl(Element* element);
 
+    /// @copydoc Window::isUpdateRequired
+    virtual bool isUpdateRequired() const;
+
     /*************************************************************************
         Event trigger methods
     *************************************************************************/
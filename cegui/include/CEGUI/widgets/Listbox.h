@@ -499,6 +499,10 @@ public:
 		list box.  If you are just adding items, or removed items to update them prior to re-adding them, there is
 		no need to call this method.
 
+        This also discards the cached item extents, so any change to the size
+        of the items is picked up.  Where only the size of an item has
+        changed, ListboxItem::notifySizeChanged is sufficient.
+
 	\return
 		Nothing.
 	*/
@@ -587,6 +591,47 @@ public:
     float   getWidestItemWidth(void) const;
 
 
+    /*!
+    \brief
+        Return the offset, in pixels from the top of the first item, of the
+        top edge of the item at \a item_index.
+
+        Item extents are cached, so this does not need to measure any item
+        unless the list or its items have changed.
+    */
+    float   getItemOffset(size_t item_index) const;
+
+
+    /*!
+    \brief
+        Return the index of the item that spans \a offset pixels from the top
+        of the first item, or getItemCount() if \a offset is below the last
+        item.  This is a binary search over the cached item extents.
+    */
+    size_t  getItemIndexAtOffset(float offset) const;
+
+
+    /*!
+    \brief
+        Discard the cached extents of the items at \a item_index onwards, so
+        they are measured again when next needed.
+
+        This is called automatically for changes made through the Listbox
+        and when a ListboxItem's text changes; it is public so that other
+        changes to item sizes can be reported.
+    */
+    void    invalidateItemExtents(size_t item_index = 0) const;
+
+
+    /*!
+    \brief
+        Discard the cached extents of \a item and the items after it.  Nothing
+        is done if \a item is not attached to the Listbox.  This is called by
+        ListboxItem::notifySizeChanged.
+    */
+    void    notifyItemSizeChanged(const ListboxItem* item) const;
+
+
 	/*!
 	\brief
 		Return a pointer to the ListboxItem attached to this Listbox at the
@@ -741,6 +786,10 @@ protected:
 	virtual void	onMouseButtonDown(MouseEventArgs& e);
 	virtual	void	onMouseWheel(MouseEventArgs& e);
 	virtual void	onMouseMove(MouseEventArgs& e);
+	virtual void	onFontChanged(WindowEventArgs& e);
+
+    //! bring the cached item extents up to date with the list.
+    void    updateItemExtents() const;
 
 
 	/*************************************************************************
@@ -756,6 +805,22 @@ protected:
 	LBItemList	d_listItems;		//!< list of items in the list box.
 	ListboxItem*	d_lastSelected;	//!< holds pointer to the last selected item (used in range selections)
 
+    //! running extents of the items, entry i covers items 0 to i inclusive.
+    struct ItemExtent
+    {
+        //! bottom edge of item i, i.e. sum of heights of items 0 to i.
+        float d_bottom;
+        //! width of the widest of items 0 to i.
+        float d_widest;
+    };
+    typedef std::vector<ItemExtent
+        CEGUI_VECTOR_ALLOC(ItemExtent)> ItemExtentList;
+    //! cached extents, valid for the first d_itemExtents.size() items.
+    mutable ItemExtentList d_itemExtents;
+
+    //! comparator used to binary search d_itemExtents.
+    static bool itemExtentBottomLess(float offset, const ItemExtent& extent);
+
     friend class ListboxWindowRenderer;
 
 private:
@@ -187,6 +187,25 @@ public:
     const Image*    getSelectionBrushImage(void) const      {return d_selectBrush;}
 
 
+    /*!
+    \brief
+        Return whether a numeric sort key has been set for this item.
+
+    \return
+        true if setSortKey has been called since construction or the last call
+        to clearSortKey, false if the item is sorted by its operators.
+    */
+    bool    hasSortKey(void) const      {return d_hasSortKey;}
+
+
+    /*!
+    \brief
+        Return the numeric sort key set for this item.  The value is only
+        meaningful when hasSortKey returns true.
+    */
+    double  getSortKey(void) const      {return d_sortKey;}
+
+
     /*************************************************************************
         Manipulators
     *************************************************************************/
@@ -294,6 +313,59 @@ public:
     void    setOwnerWindow(const Window* owner)     {d_owner = owner;}
 
 
+    /*!
+    \brief
+        Let the owning Listbox or MultiColumnList (if any) know that the pixel
+        size of this item may have changed, so that it does not use a stale
+        cached size.
+
+        The list widgets cache the sizes returned by getPixelSize.  Changes
+        made via the ListboxItem and ListboxTextItem setters call this
+        automatically; subclasses whose size depends on other state must call
+        it whenever that state changes.  The owner measures the items again
+        when next needed, but does not reconfigure its scrollbars or re-sort;
+        call the owner's handleUpdatedItemData if that is also required.
+
+    \return
+        Nothing.
+    */
+    void    notifySizeChanged() const;
+
+
+    /*!
+    \brief
+        Set a numeric sort key for this item.
+
+        When two items being compared by a MultiColumnList both have a sort
+        key, the keys are compared instead of calling the item operators.
+        This avoids repeated text comparisons (and gives a numeric ordering)
+        when sorting columns with large numbers of rows.  In an ascending
+        sort, items with a sort key come before any items without one.
+
+        Attached lists are not re-sorted automatically; call
+        MultiColumnList::handleUpdatedItemData after changing the keys of
+        items that are already attached.
+
+    \param key
+        The value to use when comparing this item with other keyed items.
+
+    \return
+        Nothing.
+    */
+    void    setSortKey(double key)      {d_sortKey = key; d_hasSortKey = true;}
+
+
+    /*!
+    \brief
+        Remove any sort key from this item, so that it is compared by its
+        operators again.
+
+    \return
+        Nothing.
+    */
+    void    clearSortKey(void)          {d_hasSortKey = false;}
+
+
     /*!
     \brief
         Set the colours used for selection highlighting.
@@ -384,6 +456,16 @@ public:
     */
     virtual bool handleFontRenderSizeChange(const Font* const font);
 
+    /*!
+    \brief
+        Return whether the item draws any text using the given font, and so
+        must be redrawn when the imagery of the font's glyphs changes.
+
+    \note
+        The base implementation just returns false.
+    */
+    virtual bool isUsingFont(const Font* const font) const;
+
     /*************************************************************************
         Abstract portion of interface
     *************************************************************************/
@@ -470,6 +552,8 @@ protected:
     const Window*   d_owner;    //!< Pointer to the window that owns this item.
     ColourRect      d_selectCols;       //!< Colours used for selection highlighting.
     const Image*    d_selectBrush;      //!< Image used for rendering selection.
+    double  d_sortKey;      //!< Numeric key used for sorting, when d_hasSortKey is true.
+    bool    d_hasSortKey;   //!< true if d_sortKey should be used in place of the item operators.
 };
 
 } // End of  CEGUI namespace section
@@ -185,6 +185,7 @@ public:
     // base class overrides
     void setText(const String& text);
     bool handleFontRenderSizeChange(const Font* const font);
+    bool isUsingFont(const Font* const font) const;
 
 
 	/*************************************************************************
@@ -211,6 +212,10 @@ protected:
     static DefaultRenderedStringParser d_noTagsStringParser;
     //! boolean that specifies whether text parsing is enabled for the item.
     bool d_textParsingEnabled;
+    //! cached result of getPixelSize.
+    mutable Sizef d_pixelSize;
+    //! font d_pixelSize was measured with, 0 if d_pixelSize is not valid.
+    mutable const Font* d_pixelSizeFont;
 };
 
 } // End of  CEGUI namespace section
@@ -265,6 +265,7 @@ protected:
     virtual void    onMouseLeaves(MouseEventArgs& e);
     virtual void    onTextChanged(WindowEventArgs& e);
     virtual void    updateSelf(float elapsed);
+    virtual bool    isUpdateRequired() const;
 
 
     /*************************************************************************
@@ -33,6 +33,8 @@
 #include "../Base.h"
 #include "../Window.h"
 #include "./ListHeader.h"
+#include <vector>
+#include <map>
 
 #if defined(_MSC_VER)
 #	pragma warning(push)
@@ -761,6 +763,43 @@ public:
     */
     float   getHighestRowItemHeight(uint row_idx) const;
 
+    /*!
+    \brief
+        Return the offset, in pixels from the top of the first row, of the top
+        edge of the row at \a row_idx.
+
+        Row extents are cached, so this does not need to measure any item
+        unless the list or its items have changed.
+    */
+    float   getRowOffset(uint row_idx) const;
+
+    /*!
+    \brief
+        Return the index of the row that spans \a offset pixels from the top
+        of the first row, or getRowCount() if \a offset is below the last
+        row.  This is a binary search over the cached row extents.
+    */
+    uint    getRowIndexAtOffset(float offset) const;
+
+    /*!
+    \brief
+        Discard the cached extents of the rows at \a row_idx onwards, so they
+        are measured again when next needed.
+
+        This is called automatically for changes made through the
+        MultiColumnList and when a ListboxItem's text changes; it is public so
+        that other changes to item sizes can be reported.
+    */
+    void    invalidateRowExtents(uint row_idx = 0) const;
+
+    /*!
+    \brief
+        Discard the cached extents of the row holding \a item and the rows
+        after it.  Nothing is done if \a item is not attached to the
+        MultiColumnList.  This is called by ListboxItem::notifySizeChanged.
+    */
+    void    notifyItemSizeChanged(const ListboxItem* item) const;
+
     /*!
     \brief
         Get whether or not column auto-sizing (autoSizeColumnHeader()) will use
@@ -1243,6 +1282,10 @@ public:
 		Inform the list box that one or more attached ListboxItems have been externally modified, and
 		the list should re-sync its internal state and refresh the display as needed.
 
+        This also discards the cached row extents, so any change to the size
+        of the items is picked up.  Where only the size of an item has
+        changed, ListboxItem::notifySizeChanged is sufficient.
+
 	\return
 		Nothing.
 	*/
@@ -1571,9 +1614,25 @@ protected:
     /*!
     \brief
         Causes the internal list to be (re)sorted.
+
+        The sort key of each row is extracted once and the rows are then
+        stable sorted, so rows that compare equal keep the order given to them
+        by any previous sort; sorting by one column and then another therefore
+        gives a multi-column ordering.
     */
     void resortList();
 
+    //! bring the cached row extents up to date with the grid.
+    void    updateRowExtents() const;
+
+    /*!
+    \brief
+        Record that rows from \a row_idx onwards have been added, removed,
+        reordered or had items replaced, so cached row extents and the item to
+        row index must be refreshed.
+    */
+    void    invalidateGridCaches(uint row_idx = 0);
+
 	/*************************************************************************
 		New event handlers for multi column list
 	*************************************************************************/
@@ -1731,6 +1790,21 @@ protected:
     //! whether header size will be considered when auto-sizing columns.
     bool d_autoSizeColumnUsesHeader;
 
+    typedef std::vector<float
+        CEGUI_VECTOR_ALLOC(float)> RowExtentList;
+    //! cached bottom edge of each row, valid for the first d_rowExtents.size() rows.
+    mutable RowExtentList d_rowExtents;
+
+    typedef std::map<const ListboxItem*, uint, std::less<const ListboxItem*>
+        CEGUI_MAP_ALLOC(const ListboxItem*, uint)> ItemRowIndex;
+    //! maps each attached item to the row containing it.
+    mutable ItemRowIndex d_itemRowIndex;
+    //! true if d_itemRowIndex reflects the current grid.
+    mutable bool d_itemRowIndexValid;
+
+    //! build d_itemRowIndex if it is not valid.
+    void    updateItemRowIndex() const;
+
     friend class MultiColumnListWindowRenderer;
 
 
@@ -303,7 +303,7 @@ public:
     Rectf getTextRenderArea(void) const;
 
     // get d_lines
-    const LineList& getFormattedLines(void) const   {return d_lines;}
+    const LineList& getFormattedLines(void) const;
 
     /*!
     \brief
@@ -468,6 +468,29 @@ public:
     */
     void formatText(const bool update_scrollbars);
 
+    /*!
+    \brief
+        Insert \a text at code point index \a position, re-formatting only the
+        paragraphs that are affected.
+
+    \note
+        As for all changes to the text of a MultiLineEditbox, the text is
+        formatted before EventTextChanged is fired, so handlers see up to date
+        formatted lines, and the event is fired once per change.
+    */
+    void insertText(const String& text, const String::size_type position);
+
+    /*!
+    \brief
+        Append \a text to the edit box text, formatting only the new text and
+        the paragraph it completes.
+
+    \note
+        The text is formatted before EventTextChanged is fired, as for
+        insertText.
+    */
+    void appendText(const String& text);
+
     //! \copydoc Window::performUndo
     virtual bool performUndo();
 
@@ -530,6 +553,53 @@ protected:
 	size_t	getNextTokenLength(const String& text, size_t start_idx) const;
 
 
+    /*!
+    \brief
+        Format the paragraphs of the text from \a start_idx, which must be the
+        start of a paragraph, up to \a end_idx, appending a LineInfo for each
+        resulting line to \a lines.
+    */
+    void    formatTextRange(size_t start_idx, size_t end_idx, float area_width,
+                            LineList& lines) const;
+
+
+    /*!
+    \brief
+        Update d_lines for the pending text change by re-formatting only the
+        paragraphs it touched.
+
+    \return
+        - true if d_lines was updated.
+        - false if d_lines does not match the text before the change, in
+          which case the whole text must be formatted.
+    */
+    bool    formatChangedText(float area_width);
+
+
+    /*!
+    \brief
+        Replace \a length code points at \a start_idx with \a text, editing
+        the window text in place.
+
+        No notification is given; callers follow up with onTextChanged.  The
+        change is recorded so that the resulting formatting pass only needs to
+        re-wrap the paragraphs it touched.
+    */
+    void    replaceTextRange(size_t start_idx, size_t length, const String& text);
+
+
+    //! return the start index of line \a line, allowing for a pending shift.
+    size_t  getLineStartIdx(size_t line) const;
+
+
+    //! return the index of the first line starting at or after \a index.
+    size_t  getFirstLineFromIdx(size_t index) const;
+
+
+    //! apply any pending shift of line start indices to d_lines.
+    void    applyLineStartShift() const;
+
+
     /*!
 	\brief
 		display required integrated scroll bars according to current state of the edit box and update their values.
@@ -772,11 +842,29 @@ protected:
 
 	static String d_lineBreakChars;	//!< Holds what we consider to be line break characters.
     bool		  d_wordWrap;		//!< true when formatting uses word-wrapping.
-	LineList	  d_lines;			//!< Holds the lines for the current formatting.
+	mutable LineList d_lines;	//!< Holds the lines for the current formatting.
 	float         d_lastRenderWidth;  //!< Holds last render area width
 	float		  d_widestExtent;	//!< Holds the extent of the widest line as calculated in the last formatting pass.
 	UndoHandler*  d_undoHandler;    //!< Undo handler class
 
+    //! true if the text has changed since d_lines was last formatted.
+    bool    d_textChangePending;
+    //! index of the first code point covered by the pending text change.
+    size_t  d_changeStartIdx;
+    //! code point length of the changed range before the change.
+    size_t  d_changeOldLength;
+    //! code point length of the changed range after the change.
+    size_t  d_changeNewLength;
+    /*!
+        index of the first line in d_lines whose d_startIdx is yet to be moved
+        by d_lineShiftDelta.  The move is applied when the lines are handed
+        out by getFormattedLines, so that an edit need not update the start
+        of every line that follows it.
+    */
+    mutable size_t  d_lineShiftStart;
+    //! amount (modulo size_t) by which lines from d_lineShiftStart move.
+    mutable size_t  d_lineShiftDelta;
+
 	// component widget settings
 	bool	d_forceVertScroll;		//!< true if vertical scrollbar should always be displayed
 	bool	d_forceHorzScroll;		//!< true if horizontal scrollbar should always be displayed
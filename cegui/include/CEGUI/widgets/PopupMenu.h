@@ -168,6 +168,12 @@ protected:
     */
     virtual void    updateSelf(float elapsed);
 
+    /*!
+    \brief
+    Return whether the popup menu is fading, and so needs to be updated.
+    */
+    virtual bool    isUpdateRequired() const;
+
 
     /*!
     \brief
@@ -322,9 +322,11 @@ namespace CEGUI
             Overridden from Window.
         ************************************************************************/
         void updateSelf(float elapsed);
+        bool isUpdateRequired() const;
         void onHidden(WindowEventArgs& e);
         void onMouseEnters(MouseEventArgs& e);
         void onTextChanged(WindowEventArgs& e);
+        void prepareForRecycling(void);
 
         /************************************************************************
             Data fields
@@ -295,21 +295,22 @@ void Affector::apply(AnimationInstance* instance)
     KeyFrame* left = 0;
     KeyFrame* right = 0;
 
-    // find 2 neighbouring keyframes
-    for (KeyFrameMap::const_iterator it = d_keyFrames.begin();
-         it != d_keyFrames.end(); ++it)
+    // find 2 neighbouring keyframes; left is the last one positioned at or
+    // before the current position, right is the first one at or after it.
+    KeyFrameMap::const_iterator it = d_keyFrames.upper_bound(position);
+
+    if (it != d_keyFrames.begin())
     {
-        KeyFrame* current = it->second;
+        KeyFrameMap::const_iterator prev = it;
+        left = (--prev)->second;
 
-        if (current->getPosition() <= position)
-        {
-            left = current;
-        }
+        if (left->getPosition() == position)
+            right = left;
+    }
 
-        if (current->getPosition() >= position && !right)
-        {
-            right = current;
-        }
+    if (!right && it != d_keyFrames.end())
+    {
+        right = it->second;
     }
 
     float leftDistance, rightDistance;
@@ -348,6 +349,41 @@ void Affector::apply(AnimationInstance* instance)
         right->alterInterpolationPosition(
             leftDistance / (leftDistance + rightDistance));
 
+    // try the typed path first; this uses values pre-parsed by the
+    // interpolator and sets the property natively where possible, avoiding
+    // String round trips on every step.
+    if (d_applicationMethod == AM_Absolute ||
+        d_applicationMethod == AM_Relative)
+    {
+        const InterpolatorValue* const leftValue =
+            left->getParsedValueForAnimation(instance, d_interpolator);
+        const InterpolatorValue* const rightValue =
+            right->getParsedValueForAnimation(instance, d_interpolator);
+
+        if (leftValue && rightValue)
+        {
+            if (d_applicationMethod == AM_Absolute)
+            {
+                d_interpolator->applyAbsolute(*target, d_targetProperty,
+                                              *leftValue, *rightValue,
+                                              interpolationPosition);
+                return;
+            }
+
+            const InterpolatorValue* const base =
+                instance->getParsedSavedPropertyValue(d_targetProperty,
+                                                      d_interpolator);
+
+            if (base)
+            {
+                d_interpolator->applyRelative(*target, d_targetProperty,
+                                              *base, *leftValue, *rightValue,
+                                              interpolationPosition);
+                return;
+            }
+        }
+    }
+
     // absolute application method
     if (d_applicationMethod == AM_Absolute)
     {
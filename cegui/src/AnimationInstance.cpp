@@ -32,6 +32,7 @@
 #include "CEGUI/Exceptions.h"
 #include "CEGUI/Window.h"
 #include "CEGUI/Affector.h"
+#include "CEGUI/Interpolator.h"
 #include "CEGUI/Logger.h"
 
 // Start of CEGUI namespace section
@@ -75,6 +76,8 @@ AnimationInstance::~AnimationInstance(void)
     {
         d_definition->autoUnsubscribe(this);
     }
+
+    purgeSavedPropertyValues();
 }
 
 //----------------------------------------------------------------------------//
@@ -477,12 +480,28 @@ void AnimationInstance::savePropertyValue(const String& propertyName)
     assert(d_target);
 
     d_savedPropertyValues[propertyName] = d_target->getProperty(propertyName);
+
+    ParsedPropertyValueMap::iterator it = d_parsedPropertyValues.find(propertyName);
+
+    if (it != d_parsedPropertyValues.end())
+    {
+        CEGUI_DELETE_AO it->second.second;
+        d_parsedPropertyValues.erase(it);
+    }
 }
 
 //----------------------------------------------------------------------------//
 void AnimationInstance::purgeSavedPropertyValues(void)
 {
     d_savedPropertyValues.clear();
+
+    for (ParsedPropertyValueMap::iterator it = d_parsedPropertyValues.begin();
+         it != d_parsedPropertyValues.end(); ++it)
+    {
+        CEGUI_DELETE_AO it->second.second;
+    }
+
+    d_parsedPropertyValues.clear();
 }
 
 //----------------------------------------------------------------------------//
@@ -503,6 +522,28 @@ const String& AnimationInstance::getSavedPropertyValue(const String& propertyNam
     return it->second;
 }
 
+//----------------------------------------------------------------------------//
+const InterpolatorValue* AnimationInstance::getParsedSavedPropertyValue(
+    const String& propertyName, Interpolator* interpolator)
+{
+    ParsedPropertyValueMap::iterator it = d_parsedPropertyValues.find(propertyName);
+
+    if (it != d_parsedPropertyValues.end() && it->second.first == interpolator->getSerial())
+        return it->second.second;
+
+    // fetch the string first, it may (re)save the property which would drop
+    // any existing parsed value.
+    const String& value = getSavedPropertyValue(propertyName);
+    InterpolatorValue* const parsed = interpolator->createValue(value);
+
+    ParsedPropertyValue& entry = d_parsedPropertyValues[propertyName];
+    CEGUI_DELETE_AO entry.second;
+    entry.first = interpolator->getSerial();
+    entry.second = parsed;
+
+    return parsed;
+}
+
 //----------------------------------------------------------------------------//
 void AnimationInstance::addAutoConnection(Event::Connection conn)
 {
@@ -53,10 +53,50 @@
 
 #include <sstream>
 #include <algorithm>
+#include <vector>
 #include <math.h>
 
 namespace CEGUI
 {
+namespace
+{
+//----------------------------------------------------------------------------//
+// expand RGB pixels to the opaque RGBA that Texture::blitFromMemory expects.
+void convertToRGBA(const RGB_Colour* source, size_t pixel_count,
+                   std::vector<uint8 CEGUI_VECTOR_ALLOC(uint8)>& rgba)
+{
+    rgba.resize(pixel_count * 4);
+
+    for (size_t i = 0; i < pixel_count; ++i)
+    {
+        rgba[i * 4] = source[i].r;
+        rgba[i * 4 + 1] = source[i].g;
+        rgba[i * 4 + 2] = source[i].b;
+        rgba[i * 4 + 3] = 0xFF;
+    }
+}
+
+//----------------------------------------------------------------------------//
+// hue and radius of the HSV wheel at the given relative position.
+void getHueWheelPosition(float xRel, float yRel, float& hue, float& radius)
+{
+    float xCoord = (xRel - 0.5f) * 2.0f;
+    float yCoord = (yRel - 0.5f) * 2.0f;
+
+    float angle = std::atan2(yCoord, xCoord);
+
+    if (angle < 0.0f)
+        angle += 2.0f * 3.1415926535897932384626433832795f;
+
+    angle /= 2.0f * 3.1415926535897932384626433832795f;
+    hue = angle;
+
+    float length = std::sqrt(xCoord * xCoord + yCoord * yCoord);
+    radius = ceguimin(length, 1.0f);
+}
+
+}
+
 //----------------------------------------------------------------------------//
 const String ColourPickerControls::EventNamespace("ColourPickerControls");
 const String ColourPickerControls::WidgetTypeName("CEGUI/ColourPickerControls");
@@ -139,6 +179,7 @@ ColourPickerControls::ColourPickerControls(const String& type, const String& nam
     d_draggingColourPickerCursor(false),
     d_colourPickingTexture(new RGB_Colour[d_colourPickerControlsTextureSize *
                                           d_colourPickerControlsTextureSize]),
+    d_invalidTextureImages(0),
     d_ignoreEvents(false),
     d_regexMatcher(*System::getSingleton().createRegexMatcher())
 {
@@ -205,19 +246,8 @@ HSV_Colour ColourPickerControls::getColourPickingPositionColourHSV(float xAbs,
 
     if (d_sliderMode != SliderMode_HSV_H)
     {
-        float xCoord = (xRel - 0.5f) * 2.0f;
-        float yCoord = (yRel - 0.5f) * 2.0f;
-
-        float angle = std::atan2(yCoord, xCoord);
-
-        if (angle < 0.0f)
-            angle += 2.0f * 3.1415926535897932384626433832795f;
-
-        angle /= 2.0f * 3.1415926535897932384626433832795f;
-        colour.H = angle;
-
-        float length = std::sqrt(xCoord * xCoord + yCoord * yCoord);
-        float value = ceguimin(length, 1.0f);
+        float value;
+        getHueWheelPosition(xRel, yRel, colour.H, value);
 
         if (d_sliderMode != SliderMode_HSV_S)
         {
@@ -408,7 +438,16 @@ void ColourPickerControls::initColourPickerControlsImageSet()
     getColourPickerAlphaSlider()->setProperty(
         "ScrollImage", baseName + '/' + ColourPickerControlsAlphaSliderTextureImageName);
 
-    refreshColourPickerControlsTextures();
+    // the whole texture is loaded now, later changes are blitted in updateSelf
+    Logger::getSingleton().logEvent(
+        "[ColourPicker] Refreshing ColourPickerTexture");
+
+    refreshColourPickingImage();
+    refreshColourSliderImage();
+    refreshAlphaSliderImage();
+
+    reloadColourPickerControlsTexture();
+    d_invalidTextureImages = 0;
 }
 
 //----------------------------------------------------------------------------//
@@ -427,30 +466,131 @@ void ColourPickerControls::deinitColourPickerControlsTexture()
 //----------------------------------------------------------------------------//
 void ColourPickerControls::refreshColourPickerControlsTextures()
 {
-    Logger::getSingleton().logEvent(
-        "[ColourPicker] Refreshing ColourPickerTexture");
-
-    refreshColourPickingImage();
-    refreshColourSliderImage();
-    refreshAlphaSliderImage();
-
-    reloadColourPickerControlsTexture();
+    invalidateColourPickerControlsTextures(TextureImage_All);
 }
 
 //----------------------------------------------------------------------------//
 void ColourPickerControls::reloadColourPickerControlsTexture()
 {
+    // uploaded as RGBA, so the texture has the format that the partial
+    // updates via blitFromMemory use.
+    std::vector<uint8 CEGUI_VECTOR_ALLOC(uint8)> rgba;
+    convertToRGBA(d_colourPickingTexture,
+                  d_colourPickerControlsTextureSize *
+                    d_colourPickerControlsTextureSize,
+                  rgba);
+
     d_colourPickerControlsTextureTarget->getTexture().loadFromMemory(
-        d_colourPickingTexture,
+        &rgba[0],
         Sizef(static_cast<float>(d_colourPickerControlsTextureSize),
               static_cast<float>(d_colourPickerControlsTextureSize)),
-        Texture::PF_RGB);
+        Texture::PF_RGBA);
 
     getColourPickerImageSlider()->invalidate();
     getColourPickerAlphaSlider()->invalidate();
     getColourPickerStaticImage()->invalidate();
 }
 
+//----------------------------------------------------------------------------//
+void ColourPickerControls::invalidateColourPickerControlsTextures(uint images)
+{
+    if ((d_invalidTextureImages | images) == d_invalidTextureImages)
+        return;
+
+    d_invalidTextureImages |= images;
+    notifyUpdateRequirementChanged();
+}
+
+//----------------------------------------------------------------------------//
+void ColourPickerControls::updateColourPickerControlsTextures()
+{
+    const uint images = d_invalidTextureImages;
+    d_invalidTextureImages = 0;
+    notifyUpdateRequirementChanged();
+
+    if (!d_colourPickerControlsTextureTarget || !images)
+        return;
+
+    if (images & TextureImage_Picking)
+        refreshColourPickingImage();
+
+    if (images & TextureImage_ColourSlider)
+        refreshColourSliderImage();
+
+    if (images & TextureImage_AlphaSlider)
+        refreshAlphaSliderImage();
+
+    // the picking and colour slider images share the top rows of the texture
+    // and the alpha slider image is below them; blit the rows that changed.
+    const int alpha_top =
+        d_colourPickerPickingImageHeight + d_colourPickerImageOffset;
+
+    const int top =
+        (images & (TextureImage_Picking | TextureImage_ColourSlider)) ?
+            0 : alpha_top;
+
+    const int bottom = (images & TextureImage_AlphaSlider) ?
+        alpha_top + d_colourPickerAlphaSliderImageHeight :
+        d_colourPickerPickingImageHeight;
+
+    std::vector<uint8 CEGUI_VECTOR_ALLOC(uint8)> rgba;
+    convertToRGBA(d_colourPickingTexture + d_colourPickerControlsTextureSize * top,
+                  d_colourPickerControlsTextureSize * (bottom - top), rgba);
+
+    d_colourPickerControlsTextureTarget->getTexture().blitFromMemory(
+        &rgba[0],
+        Rectf(0.0f, static_cast<float>(top),
+              static_cast<float>(d_colourPickerControlsTextureSize),
+              static_cast<float>(bottom)));
+
+    getColourPickerImageSlider()->invalidate();
+    getColourPickerAlphaSlider()->invalidate();
+    getColourPickerStaticImage()->invalidate();
+}
+
+//----------------------------------------------------------------------------//
+void ColourPickerControls::initHueWheel()
+{
+    const size_t pixel_count = d_colourPickerPickingImageWidth *
+                               d_colourPickerPickingImageHeight;
+
+    if (d_hueWheelHues.size() == pixel_count)
+        return;
+
+    d_hueWheelHues.resize(pixel_count);
+    d_hueWheelRadii.resize(pixel_count);
+
+    size_t i = 0;
+    for (int y = 0; y < d_colourPickerPickingImageHeight; ++y)
+    {
+        const float yRel =
+            y / static_cast<float>(d_colourPickerPickingImageHeight - 1);
+
+        for (int x = 0; x < d_colourPickerPickingImageWidth; ++x, ++i)
+        {
+            const float xRel =
+                x / static_cast<float>(d_colourPickerPickingImageWidth - 1);
+
+            getHueWheelPosition(xRel, yRel, d_hueWheelHues[i], d_hueWheelRadii[i]);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------//
+void ColourPickerControls::updateSelf(float elapsed)
+{
+    Window::updateSelf(elapsed);
+
+    if (d_invalidTextureImages)
+        updateColourPickerControlsTextures();
+}
+
+//----------------------------------------------------------------------------//
+bool ColourPickerControls::isUpdateRequired() const
+{
+    return d_invalidTextureImages || Window::isUpdateRequired();
+}
+
 //----------------------------------------------------------------------------//
 void ColourPickerControls::initialiseComponents()
 {
@@ -1206,38 +1346,65 @@ void ColourPickerControls::onAcceptButtonClicked(WindowEventArgs& e)
 //----------------------------------------------------------------------------//
 void ColourPickerControls::refreshColourPickingImage()
 {
+    const int width = d_colourPickerPickingImageWidth;
+
+    // positions are computed a row at a time and converted in bulk straight
+    // into the texture buffer.
     if (d_sliderMode &
             (SliderMode_Lab_L | SliderMode_Lab_A | SliderMode_Lab_B))
     {
+        std::vector<Lab_Colour CEGUI_VECTOR_ALLOC(Lab_Colour)> row(width);
+
         for (int y = 0; y < d_colourPickerPickingImageHeight; ++y)
         {
-            for (int x = 0; x < d_colourPickerPickingImageWidth; ++x)
-            {
-                int i = d_colourPickerControlsTextureSize * y + x;
-
-                Lab_Colour colour =
-                    getColourPickingPositionColourLAB(static_cast<float>(x),
-                                                      static_cast<float>(y));
-
-                d_colourPickingTexture[i] = RGB_Colour(colour);
-            }
+            for (int x = 0; x < width; ++x)
+                row[x] = getColourPickingPositionColourLAB(
+                    static_cast<float>(x), static_cast<float>(y));
+
+            ColourPickerConversions::toRGB(
+                &row[0],
+                d_colourPickingTexture + d_colourPickerControlsTextureSize * y,
+                width);
         }
     }
     else if (d_sliderMode &
              (SliderMode_HSV_H | SliderMode_HSV_S | SliderMode_HSV_V))
     {
+        std::vector<HSV_Colour CEGUI_VECTOR_ALLOC(HSV_Colour)> row(width);
+
+        // the wheel geometry does not depend on the selected colour, so the
+        // per pixel trigonometry is only ever done once.
+        if (d_sliderMode != SliderMode_HSV_H)
+            initHueWheel();
+
         for (int y = 0; y < d_colourPickerPickingImageHeight; ++y)
         {
-            for (int x = 0; x < d_colourPickerPickingImageWidth; ++x)
+            if (d_sliderMode == SliderMode_HSV_H)
             {
-                int i = d_colourPickerControlsTextureSize * y + x;
-
-                HSV_Colour colour =
-                    getColourPickingPositionColourHSV(static_cast<float>(x),
-                                                      static_cast<float>(y));
-
-                d_colourPickingTexture[i] = RGB_Colour(colour);
+                for (int x = 0; x < width; ++x)
+                    row[x] = getColourPickingPositionColourHSV(
+                        static_cast<float>(x), static_cast<float>(y));
+            }
+            else
+            {
+                const float* const hues = &d_hueWheelHues[width * y];
+                const float* const radii = &d_hueWheelRadii[width * y];
+
+                for (int x = 0; x < width; ++x)
+                {
+                    if (d_sliderMode != SliderMode_HSV_S)
+                        row[x] = HSV_Colour(hues[x], radii[x],
+                                            d_selectedColourHSV.V);
+                    else
+                        row[x] = HSV_Colour(hues[x], d_selectedColourHSV.S,
+                                            radii[x]);
+                }
             }
+
+            ColourPickerConversions::toRGB(
+                &row[0],
+                d_colourPickingTexture + d_colourPickerControlsTextureSize * y,
+                width);
         }
     }
 }
@@ -1245,38 +1412,42 @@ void ColourPickerControls::refreshColourPickingImage()
 //----------------------------------------------------------------------------//
 void ColourPickerControls::refreshColourSliderImage()
 {
+    const int height = d_colourPickerPickingImageHeight;
+    std::vector<RGB_Colour CEGUI_VECTOR_ALLOC(RGB_Colour)> column(height);
+
     if (d_sliderMode &
             (SliderMode_Lab_L | SliderMode_Lab_A | SliderMode_Lab_B))
     {
-        for (int y = 0; y < d_colourPickerPickingImageHeight; ++y)
-        {
-            for (int x = 0; x < d_colourPickerColourSliderImageWidth; ++x)
-            {
-                int i = d_colourPickerControlsTextureSize * y +
-                        (x + d_colourPickerPickingImageWidth + 2);
+        std::vector<Lab_Colour CEGUI_VECTOR_ALLOC(Lab_Colour)> colours(height);
 
-                Lab_Colour colour = getColourSliderPositionColourLAB(
-                    y / static_cast<float>(d_colourPickerPickingImageHeight - 1));
+        for (int y = 0; y < height; ++y)
+            colours[y] = getColourSliderPositionColourLAB(
+                y / static_cast<float>(height - 1));
 
-                d_colourPickingTexture[i] = RGB_Colour(colour);
-            }
-        }
+        ColourPickerConversions::toRGB(&colours[0], &column[0], height);
     }
     else if (d_sliderMode &
              (SliderMode_HSV_H | SliderMode_HSV_S | SliderMode_HSV_V))
     {
-        for (int y = 0; y < d_colourPickerPickingImageHeight; ++y)
-        {
-            for (int x = 0; x < d_colourPickerColourSliderImageWidth; ++x)
-            {
-                int i = d_colourPickerControlsTextureSize * y +
-                        (x + d_colourPickerPickingImageWidth + 2);
+        std::vector<HSV_Colour CEGUI_VECTOR_ALLOC(HSV_Colour)> colours(height);
 
-                HSV_Colour colour = getColourSliderPositionColourHSV(
-                    y / static_cast<float>(d_colourPickerPickingImageHeight - 1));
+        for (int y = 0; y < height; ++y)
+            colours[y] = getColourSliderPositionColourHSV(
+                y / static_cast<float>(height - 1));
 
-                d_colourPickingTexture[i] = RGB_Colour(colour);
-            }
+        ColourPickerConversions::toRGB(&colours[0], &column[0], height);
+    }
+    else
+        return;
+
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < d_colourPickerColourSliderImageWidth; ++x)
+        {
+            int i = d_colourPickerControlsTextureSize * y +
+                    (x + d_colourPickerPickingImageWidth + 2);
+
+            d_colourPickingTexture[i] = column[y];
         }
     }
 }
@@ -1601,16 +1772,14 @@ void ColourPickerControls::onColourCursorPositionChanged()
 {
     refreshEditboxesAndColourRects();
 
-    refreshAlphaSliderImage();
-
-    refreshOnlyColourSliderImage();
+    invalidateColourPickerControlsTextures(TextureImage_AlphaSlider |
+                                           TextureImage_ColourSlider);
 }
 
 //----------------------------------------------------------------------------//
 void ColourPickerControls::refreshOnlyColourSliderImage()
 {
-    refreshColourSliderImage();
-    reloadColourPickerControlsTexture();
+    invalidateColourPickerControlsTextures(TextureImage_ColourSlider);
 }
 
 //----------------------------------------------------------------------------//
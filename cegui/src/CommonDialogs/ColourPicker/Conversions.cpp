@@ -35,6 +35,72 @@
 namespace CEGUI
 {
 
+namespace
+{
+//----------------------------------------------------------------------------//
+// number of colours converted per block by the bulk conversion functions.
+const size_t ConversionBlockSize = 64;
+
+//----------------------------------------------------------------------------//
+/*
+    The helpers below are shared by the single colour and the bulk
+    conversions, so both give identical results.  They avoid calls to pow and
+    data dependent branches, so loops over them can be vectorised.
+*/
+inline float clampUnit(float value)
+{
+    value = value < 0.0f ? 0.0f : value;
+    return value > 1.0f ? 1.0f : value;
+}
+
+//----------------------------------------------------------------------------//
+inline unsigned char unitToByte(float value)
+{
+    return static_cast<unsigned char>(255.0f * clampUnit(value));
+}
+
+//----------------------------------------------------------------------------//
+inline float labInverseCompanding(float value, float compare_value)
+{
+    const float cubed = value * value * value;
+
+    return cubed > compare_value ?
+        cubed : (value - 16.0f / 116.0f) / 7.787f;
+}
+
+//----------------------------------------------------------------------------//
+inline void labToLinearRGB(float L, float a, float b,
+                           float Xn, float Zn, float compare_value,
+                           float& vr, float& vg, float& vb)
+{
+    const float fy = (L + 16.0f) / 116.0f;
+    const float vx = labInverseCompanding(a / 500.0f + fy, compare_value) * Xn;
+    const float vy = labInverseCompanding(fy, compare_value);
+    const float vz = labInverseCompanding(fy - b / 200.0f, compare_value) * Zn;
+
+    vr = vx *  3.2406f + vy * -1.5372f + vz * -0.4986f;
+    vg = vx * -0.9689f + vy *  1.8758f + vz *  0.0415f;
+    vb = vx *  0.0557f + vy * -0.2040f + vz *  1.0570f;
+}
+
+//----------------------------------------------------------------------------//
+// one channel of the HSV to RGB conversion; offset is 5 for red, 3 for green
+// and 1 for blue.
+inline float hsvChannel(float H, float S, float V, float offset)
+{
+    float k = offset + H * 6.0f;
+    k = k >= 6.0f ? k - 6.0f : k;
+
+    float ramp = 4.0f - k;
+    ramp = k < ramp ? k : ramp;
+    ramp = ramp < 1.0f ? ramp : 1.0f;
+    ramp = ramp > 0.0f ? ramp : 0.0f;
+
+    return V - V * S * ramp;
+}
+
+}
+
 //----------------------------------------------------------------------------//
 const float ColourPickerConversions::Xn(0.95047f);
 const float ColourPickerConversions::Yn(1.00000f);
@@ -142,45 +208,87 @@ RGB_Colour ColourPickerConversions::toRGB(const Lab_Colour& colour)
 //----------------------------------------------------------------------------//
 RGB_Colour ColourPickerConversions::toRGB(float L, float a, float b)
 {
-    float vy = (L + 16.0f) / 116.0f;
-    float vx = a / 500.0f + vy;
-    float vz = vy - b / 200.0f;
+    float vr, vg, vb;
+    labToLinearRGB(L, a, b, Xn, Zn, LAB_COMPARE_VALUE_CONST, vr, vg, vb);
 
-    {
-        float vx3 = pow(vx, 3);
-        float vy3 = pow(vy, 3);
-        float vz3 = pow(vz, 3);
-
-        if (vy3 > LAB_COMPARE_VALUE_CONST)
-            vy = vy3;
-        else
-            vy = (vy - 16.0f / 116.0f) / 7.787f;
-
-        if (vx3 > LAB_COMPARE_VALUE_CONST)
-            vx = vx3;
-        else
-            vx = (vx - 16.0f / 116.0f) / 7.787f;
-
-        if (vz3 > LAB_COMPARE_VALUE_CONST)
-            vz = vz3;
-        else
-            vz = (vz - 16.0f / 116.0f) / 7.787f;
-    }
+    return RGB_Colour(unitToByte(vr), unitToByte(vg), unitToByte(vb));
+}
 
-    vx *= Xn;
-    vz *= Zn;
+//----------------------------------------------------------------------------//
+void ColourPickerConversions::toRGB(const Lab_Colour* colours,
+                                    RGB_Colour* result, size_t count)
+{
+    float L[ConversionBlockSize], a[ConversionBlockSize], b[ConversionBlockSize];
+    float vr[ConversionBlockSize], vg[ConversionBlockSize], vb[ConversionBlockSize];
 
-    float vr = vx *  3.2406f + vy * -1.5372f + vz * -0.4986f;
-    float vg = vx * -0.9689f + vy *  1.8758f + vz *  0.0415f;
-    float vb = vx *  0.0557f + vy * -0.2040f + vz *  1.0570f;
+    const float x_ref = Xn;
+    const float z_ref = Zn;
+    const float compare_value = LAB_COMPARE_VALUE_CONST;
 
-    clamp(vr, 0.0f, 1.0f);
-    clamp(vg, 0.0f, 1.0f);
-    clamp(vb, 0.0f, 1.0f);
+    while (count)
+    {
+        const size_t block = ceguimin(count, ConversionBlockSize);
+
+        for (size_t i = 0; i < block; ++i)
+        {
+            L[i] = colours[i].L;
+            a[i] = colours[i].a;
+            b[i] = colours[i].b;
+        }
+
+        for (size_t i = 0; i < block; ++i)
+            labToLinearRGB(L[i], a[i], b[i], x_ref, z_ref, compare_value,
+                           vr[i], vg[i], vb[i]);
+
+        for (size_t i = 0; i < block; ++i)
+        {
+            result[i].r = unitToByte(vr[i]);
+            result[i].g = unitToByte(vg[i]);
+            result[i].b = unitToByte(vb[i]);
+        }
+
+        colours += block;
+        result += block;
+        count -= block;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void ColourPickerConversions::toRGB(const HSV_Colour* colours,
+                                    RGB_Colour* result, size_t count)
+{
+    float H[ConversionBlockSize], S[ConversionBlockSize], V[ConversionBlockSize];
+    float vr[ConversionBlockSize], vg[ConversionBlockSize], vb[ConversionBlockSize];
 
-    return RGB_Colour(static_cast<unsigned char>(255.0f * vr),
-                      static_cast<unsigned char>(255.0f * vg),
-                      static_cast<unsigned char>(255.0f * vb));
+    while (count)
+    {
+        const size_t block = ceguimin(count, ConversionBlockSize);
+
+        for (size_t i = 0; i < block; ++i)
+        {
+            H[i] = colours[i].H;
+            S[i] = colours[i].S;
+            V[i] = colours[i].V;
+        }
+
+        for (size_t i = 0; i < block; ++i)
+        {
+            vr[i] = hsvChannel(H[i], S[i], V[i], 5.0f);
+            vg[i] = hsvChannel(H[i], S[i], V[i], 3.0f);
+            vb[i] = hsvChannel(H[i], S[i], V[i], 1.0f);
+        }
+
+        for (size_t i = 0; i < block; ++i)
+        {
+            result[i].r = unitToByte(vr[i]);
+            result[i].g = unitToByte(vg[i]);
+            result[i].b = unitToByte(vb[i]);
+        }
+
+        colours += block;
+        result += block;
+        count -= block;
+    }
 }
 
 //----------------------------------------------------------------------------//
@@ -271,56 +379,10 @@ void ColourPickerConversions::clampInterpolationValue(float& interPolBalance)
 //----------------------------------------------------------------------------//
 RGB_Colour ColourPickerConversions::toRGB(const HSV_Colour& colour)
 {
-    float r, g, b;
-
-    int i = (int)(colour.H * 6.0f);
-    float f = colour.H * 6 - i;
-    float p = colour.V * (1 - colour.S);
-    float q = colour.V * (1 - f * colour.S);
-    float t = colour.V * (1 - (1 - f) * colour.S);
-
-    switch (i % 6)
-    {
-    case 0:
-        r = colour.V;
-        g = t;
-        b = p;
-        break;
-
-    case 1:
-        r = q;
-        g = colour.V;
-        b = p;
-        break;
-
-    case 2:
-        r = p;
-        g = colour.V;
-        b = t;
-        break;
-
-    case 3:
-        r = p;
-        g = q;
-        b = colour.V;
-        break;
-
-    case 4:
-        r = t;
-        g = p;
-        b = colour.V;
-        break;
-
-    case 5:
-        r = colour.V;
-        g = p;
-        b = q;
-        break;
-    }
-
-    return RGB_Colour(static_cast<unsigned char>(r * 255),
-                      static_cast<unsigned char>(g * 255),
-                      static_cast<unsigned char>(b * 255));
+    return RGB_Colour(
+        unitToByte(hsvChannel(colour.H, colour.S, colour.V, 5.0f)),
+        unitToByte(hsvChannel(colour.H, colour.S, colour.V, 3.0f)),
+        unitToByte(hsvChannel(colour.H, colour.S, colour.V, 1.0f)));
 }
 //----------------------------------------------------------------------------//
 
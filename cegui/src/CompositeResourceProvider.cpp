@@ -90,6 +90,15 @@ void CompositeResourceProvider::loadRawDataContainer(const String& filename,
   CEGUI_THROW(InvalidRequestException(filename + " does not exist"));
 }
 
+void CompositeResourceProvider::prefetchRawData(const String& filename,
+                         const String& resourceGroup)
+{
+  // the hint is cheap, so pass it to every provider that may hold the file
+  ProviderIterator it=getIterator();
+  for(it.toStart(); !it.isAtEnd(); ++it)
+    it.getCurrentValue()->prefetchRawData(filename,resourceGroup);
+}
+
 size_t CompositeResourceProvider::getResourceGroupFileNames(std::vector<String>& out_vec,
                 const String& file_pattern,const String& resource_group)
 {
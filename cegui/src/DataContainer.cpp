@@ -37,11 +37,16 @@ void RawDataContainer::release(void)
 {
     if (mData)
     {
-        CEGUI_DELETE_ARRAY_PT(mData, uint8, mSize, RawDataContainer);
+        if (mDeleter)
+            mDeleter(mData, mSize);
+        else
+            CEGUI_DELETE_ARRAY_PT(mData, uint8, mSize, RawDataContainer);
 
         mData = 0;
         mSize = 0;
     }
+
+    mDeleter = 0;
 }
 
 } // End of  CEGUI namespace section
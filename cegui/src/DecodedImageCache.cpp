@@ -0,0 +1,420 @@
+/***********************************************************************
+    filename:   DecodedImageCache.cpp
+    created:    Sun Oct 18 2026
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2012 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/DecodedImageCache.h"
+#include "CEGUI/DataContainer.h"
+#include "CEGUI/Logger.h"
+
+#include <stdio.h>
+#include <cstring>
+#include <vector>
+
+#if defined(__WIN32__) || defined(_WIN32)
+#   include "CEGUI/System.h"
+#   include <windows.h>
+#else
+#   include <sys/types.h>
+#   include <sys/stat.h>
+#   include <sys/mman.h>
+#   include <fcntl.h>
+#   include <unistd.h>
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+const String DecodedImageCache::FILE_EXTENSION(".decoded");
+
+//----------------------------------------------------------------------------//
+namespace
+{
+const char FILE_MAGIC[4] = { 'C', 'G', 'D', 'I' };
+const uint32 FILE_VERSION = 1;
+// written in native byte order, so files from another platform are rejected.
+const uint32 BYTE_ORDER_MARK = 0x01020304;
+
+const uint32 FORMAT_RGB = 0;
+const uint32 FORMAT_RGBA = 1;
+const uint32 FLAG_PREMULTIPLIED = 1;
+
+//! header at the start of each cache file; the pixel rows follow it.
+struct FileHeader
+{
+    char magic[4];
+    uint32 version;
+    uint32 byteOrder;
+    uint32 format;
+    uint64 key;
+    uint64 encodedSize;
+    uint32 width;
+    uint32 height;
+    uint32 flags;
+    // pad to 64 bytes, so the pixel rows start suitably aligned for any use.
+    uint8 reserved[20];
+};
+
+//! read-only memory mapped view of a whole file, released on destruction.
+class MappedFile
+{
+public:
+    MappedFile(const String& filename) :
+        d_data(0),
+        d_size(0)
+    {
+#if defined(__WIN32__) || defined(_WIN32)
+        const HANDLE file = CreateFileW(
+            System::getStringTranscoder().stringToStdWString(filename).c_str(),
+            GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL, 0);
+
+        if (file == INVALID_HANDLE_VALUE)
+            return;
+
+        LARGE_INTEGER file_size;
+        if (GetFileSizeEx(file, &file_size) && file_size.QuadPart > 0 &&
+            static_cast<ULONGLONG>(file_size.QuadPart) <= static_cast<size_t>(-1))
+        {
+            const HANDLE mapping =
+                CreateFileMappingW(file, 0, PAGE_READONLY, 0, 0, 0);
+
+            if (mapping)
+            {
+                d_data = static_cast<const uint8*>(
+                    MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+                if (d_data)
+                    d_size = static_cast<size_t>(file_size.QuadPart);
+
+                CloseHandle(mapping);
+            }
+        }
+
+        CloseHandle(file);
+#else
+        const int fd = open(filename.c_str(), O_RDONLY);
+
+        if (fd == -1)
+            return;
+
+        struct stat s;
+        if (fstat(fd, &s) == 0 && S_ISREG(s.st_mode) && s.st_size > 0 &&
+            static_cast<unsigned long long>(s.st_size) <= static_cast<size_t>(-1))
+        {
+            void* const mapped = mmap(0, static_cast<size_t>(s.st_size),
+                                      PROT_READ, MAP_PRIVATE, fd, 0);
+
+            if (mapped != MAP_FAILED)
+            {
+                d_data = static_cast<const uint8*>(mapped);
+                d_size = static_cast<size_t>(s.st_size);
+            }
+        }
+
+        close(fd);
+#endif
+    }
+
+    ~MappedFile()
+    {
+        if (!d_data)
+            return;
+
+#if defined(__WIN32__) || defined(_WIN32)
+        UnmapViewOfFile(d_data);
+#else
+        munmap(const_cast<uint8*>(d_data), d_size);
+#endif
+    }
+
+    const uint8* getData() const { return d_data; }
+    size_t getSize() const { return d_size; }
+
+private:
+    MappedFile(const MappedFile&);
+    MappedFile& operator=(const MappedFile&);
+
+    const uint8* d_data;
+    size_t d_size;
+};
+
+//! return the bytes per pixel for a cache file format, or 0 if invalid.
+size_t getBytesPerPixel(uint32 format)
+{
+    return format == FORMAT_RGBA ? 4 : (format == FORMAT_RGB ? 3 : 0);
+}
+
+//! premultiply alpha into the colour channels of RGBA pixels.
+void premultiplyAlpha(const uint8* src, uint8* dst, size_t pixel_count)
+{
+    for (size_t i = 0; i < pixel_count; ++i, src += 4, dst += 4)
+    {
+        const uint32 a = src[3];
+        dst[0] = static_cast<uint8>((src[0] * a + 127) / 255);
+        dst[1] = static_cast<uint8>((src[1] * a + 127) / 255);
+        dst[2] = static_cast<uint8>((src[2] * a + 127) / 255);
+        dst[3] = static_cast<uint8>(a);
+    }
+}
+
+}
+
+//----------------------------------------------------------------------------//
+DecodedImageCache::DecodedImageCache() :
+    d_premultiplied(false),
+    d_hits(0),
+    d_misses(0)
+{
+}
+
+//----------------------------------------------------------------------------//
+DecodedImageCache::~DecodedImageCache()
+{
+}
+
+//----------------------------------------------------------------------------//
+void DecodedImageCache::setCacheDirectory(const String& directory)
+{
+    d_directory = directory;
+
+    // make sure the directory ends with a separator.
+    if (!d_directory.empty() &&
+        d_directory[d_directory.length() - 1] != '/' &&
+        d_directory[d_directory.length() - 1] != '\\')
+            d_directory += '/';
+}
+
+//----------------------------------------------------------------------------//
+const String& DecodedImageCache::getCacheDirectory() const
+{
+    return d_directory;
+}
+
+//----------------------------------------------------------------------------//
+bool DecodedImageCache::isEnabled() const
+{
+    return !d_directory.empty();
+}
+
+//----------------------------------------------------------------------------//
+void DecodedImageCache::setPremultipliedAlpha(bool setting)
+{
+    d_premultiplied = setting;
+}
+
+//----------------------------------------------------------------------------//
+bool DecodedImageCache::isPremultipliedAlpha() const
+{
+    return d_premultiplied;
+}
+
+//----------------------------------------------------------------------------//
+bool DecodedImageCache::load(const RawDataContainer& data, Texture& result)
+{
+    if (!isEnabled())
+        return false;
+
+    const uint64 key = computeKey(data);
+    const MappedFile file(getCacheFilename(key));
+
+    FileHeader header;
+    if (file.getSize() < sizeof(header))
+    {
+        ++d_misses;
+        return false;
+    }
+
+    std::memcpy(&header, file.getData(), sizeof(header));
+
+    const size_t bpp = getBytesPerPixel(header.format);
+    const bool premultiplied = (header.flags & FLAG_PREMULTIPLIED) != 0;
+
+    // the premultiplied flag only matters to images with alpha.
+    if (std::memcmp(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0 ||
+        header.version != FILE_VERSION ||
+        header.byteOrder != BYTE_ORDER_MARK ||
+        header.key != key ||
+        header.encodedSize != data.getSize() ||
+        bpp == 0 ||
+        (header.format == FORMAT_RGBA && premultiplied != d_premultiplied) ||
+        file.getSize() - sizeof(header) !=
+            static_cast<size_t>(header.width) * header.height * bpp)
+    {
+        ++d_misses;
+        return false;
+    }
+
+    result.loadFromMemory(file.getData() + sizeof(header),
+                          Sizef(static_cast<float>(header.width),
+                                static_cast<float>(header.height)),
+                          header.format == FORMAT_RGBA ? Texture::PF_RGBA :
+                                                         Texture::PF_RGB);
+    ++d_hits;
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void DecodedImageCache::loadAndStore(const RawDataContainer& data,
+                                     const void* pixels, const Sizef& size,
+                                     Texture::PixelFormat format,
+                                     Texture& result)
+{
+    if (!isEnabled() ||
+        (format != Texture::PF_RGB && format != Texture::PF_RGBA))
+    {
+        result.loadFromMemory(pixels, size, format);
+        return;
+    }
+
+    const uint32 width = static_cast<uint32>(size.d_width);
+    const uint32 height = static_cast<uint32>(size.d_height);
+
+    std::vector<uint8> premultiplied;
+    if (d_premultiplied && format == Texture::PF_RGBA)
+    {
+        premultiplied.resize(static_cast<size_t>(width) * height * 4);
+        if (!premultiplied.empty())
+        {
+            premultiplyAlpha(static_cast<const uint8*>(pixels),
+                             &premultiplied[0], premultiplied.size() / 4);
+            pixels = &premultiplied[0];
+        }
+    }
+
+    result.loadFromMemory(pixels, size, format);
+
+    const uint64 key = computeKey(data);
+    const String filename(getCacheFilename(key));
+    if (!writeCacheFile(filename, key, data.getSize(),
+                        pixels, width, height, format))
+        Logger::getSingleton().logEvent(
+            "DecodedImageCache::loadAndStore - Unable to write cache file '" +
+            filename + "'.", Warnings);
+}
+
+//----------------------------------------------------------------------------//
+String DecodedImageCache::getCacheFilename(const RawDataContainer& data) const
+{
+    return getCacheFilename(computeKey(data));
+}
+
+//----------------------------------------------------------------------------//
+String DecodedImageCache::getCacheFilename(uint64 key) const
+{
+    static const char hex_digits[] = "0123456789abcdef";
+
+    char name[16];
+    for (int i = 15; i >= 0; --i, key >>= 4)
+        name[i] = hex_digits[key & 0xF];
+
+    return d_directory + String(name, 16) + FILE_EXTENSION;
+}
+
+//----------------------------------------------------------------------------//
+uint64 DecodedImageCache::getHitCount() const
+{
+    return d_hits;
+}
+
+//----------------------------------------------------------------------------//
+uint64 DecodedImageCache::getMissCount() const
+{
+    return d_misses;
+}
+
+//----------------------------------------------------------------------------//
+void DecodedImageCache::resetStatistics()
+{
+    d_hits = d_misses = 0;
+}
+
+//----------------------------------------------------------------------------//
+uint64 DecodedImageCache::computeKey(const RawDataContainer& data)
+{
+    uint64 hash = 14695981039346656037ULL;
+
+    const uint8* byte = data.getDataPtr();
+    const uint8* const end = byte + data.getSize();
+    for (; byte != end; ++byte)
+        hash = (hash ^ *byte) * 1099511628211ULL;
+
+    return hash;
+}
+
+//----------------------------------------------------------------------------//
+bool DecodedImageCache::writeCacheFile(const String& filename, uint64 key,
+                                       size_t encoded_size,
+                                       const void* pixels,
+                                       uint32 width, uint32 height,
+                                       Texture::PixelFormat format) const
+{
+    FileHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC));
+    header.version = FILE_VERSION;
+    header.byteOrder = BYTE_ORDER_MARK;
+    header.format = format == Texture::PF_RGBA ? FORMAT_RGBA : FORMAT_RGB;
+    header.key = key;
+    header.encodedSize = encoded_size;
+    header.width = width;
+    header.height = height;
+    header.flags =
+        (d_premultiplied && format == Texture::PF_RGBA) ? FLAG_PREMULTIPLIED : 0;
+
+    const size_t pixel_bytes =
+        static_cast<size_t>(width) * height * getBytesPerPixel(header.format);
+
+    // write to a temporary file and rename it once complete, so that a
+    // partially written file is never picked up by load.
+    const String temp_filename(filename + ".tmp");
+    FILE* file = fopen(temp_filename.c_str(), "wb");
+    if (!file)
+        return false;
+
+    const bool written =
+        fwrite(&header, sizeof(header), 1, file) == 1 &&
+        (pixel_bytes == 0 || fwrite(pixels, pixel_bytes, 1, file) == 1);
+
+    if (fclose(file) != 0 || !written)
+    {
+        remove(temp_filename.c_str());
+        return false;
+    }
+
+    // rename will not replace an existing file everywhere.
+    remove(filename.c_str());
+    if (rename(temp_filename.c_str(), filename.c_str()) != 0)
+    {
+        remove(temp_filename.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of CEGUI namespace section
@@ -30,15 +30,22 @@
 #include "CEGUI/DefaultLogger.h"
 #include "CEGUI/Exceptions.h"
 #include "CEGUI/System.h"
-#include <ctime>
-#include <iomanip>
+#include <cstdio>
+
+#ifdef _MSC_VER
+#define snprintf _snprintf
+#endif
 
 namespace CEGUI
 {
 //----------------------------------------------------------------------------//
 DefaultLogger::DefaultLogger(void) :
-    d_caching(true)
+    d_caching(true),
+    d_timestampTime(static_cast<std::time_t>(-1)),
+    d_writeBufferSize(0)
 {
+    d_timestamp[0] = 0;
+
     // create log header
     logEvent("+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+");
     logEvent("+                     Crazy Eddie's GUI System - Event log                    +");
@@ -57,78 +64,135 @@ DefaultLogger::~DefaultLogger(void)
         char addr_buff[32];
         sprintf(addr_buff, "(%p)", static_cast<void*>(this));
         logEvent("CEGUI::Logger singleton destroyed. " + String(addr_buff));
+        flush();
         d_ostream.close();
     }
 }
 
+//----------------------------------------------------------------------------//
+bool DefaultLogger::isEventLogged(LoggingLevel level) const
+{
+    // while caching, the level to use is not final, so keep everything.
+    return d_caching || level <= d_level;
+}
+
 //----------------------------------------------------------------------------//
 void DefaultLogger::logEvent(const String& message,
                              LoggingLevel level /* = Standard */)
 {
-    using namespace std;
+    // reject events that will not be written before doing any work.
+    if (!isEventLogged(level))
+        return;
 
-    time_t et;
-    time(&et);
-    tm* etm = localtime(&et);
+    d_line.clear();
 
-    if (!etm)
+    if (!appendEventPrefix(level))
         return;
 
-    // clear sting stream
-    d_workstream.str("");
+    d_line.append(message.c_str());
+    d_line += '\n';
+
+    if (d_caching)
+    {
+        d_cache.push_back(std::make_pair(d_line.c_str(), level));
+    }
+    else if (d_writeBufferSize)
+    {
+        d_writeBuffer.append(d_line);
+
+        // errors are written straight away, in case the application is
+        // about to fall over.
+        if (d_writeBuffer.size() > d_writeBufferSize || level == Errors)
+            flush();
+    }
+    else
+    {
+        // write message
+        d_ostream << d_line;
+        // ensure new event is written to the file, rather than just being
+        // buffered.
+        d_ostream.flush();
+    }
+}
+
+//----------------------------------------------------------------------------//
+bool DefaultLogger::appendEventPrefix(LoggingLevel level)
+{
+    std::time_t et;
+    std::time(&et);
+
+    // the date and time only need formatting once a second
+    if (et != d_timestampTime)
+    {
+        const std::tm* etm = std::localtime(&et);
+
+        if (!etm)
+            return false;
 
-    // write date
-    d_workstream << setfill('0') << setw(2) << etm->tm_mday << '/' <<
-    setfill('0') << setw(2) << 1 + etm->tm_mon << '/' <<
-    setw(4) << (1900 + etm->tm_year) << ' ';
+        snprintf(d_timestamp, sizeof(d_timestamp),
+                 "%02d/%02d/%04d %02d:%02d:%02d ",
+                 etm->tm_mday, 1 + etm->tm_mon, 1900 + etm->tm_year,
+                 etm->tm_hour, etm->tm_min, etm->tm_sec);
+        d_timestampTime = et;
+    }
 
-    // write time
-    d_workstream << setfill('0') << setw(2) << etm->tm_hour << ':' <<
-    setfill('0') << setw(2) << etm->tm_min << ':' <<
-    setfill('0') << setw(2) << etm->tm_sec << ' ';
+    d_line.append(d_timestamp);
 
     // write event type code
     switch(level)
     {
     case Errors:
-        d_workstream << "(Error)\t";
+        d_line.append("(Error)\t");
         break;
 
     case Warnings:
-        d_workstream << "(Warn)\t";
+        d_line.append("(Warn)\t");
         break;
 
     case Standard:
-        d_workstream << "(Std) \t";
+        d_line.append("(Std) \t");
         break;
 
     case Informative:
-        d_workstream << "(Info) \t";
+        d_line.append("(Info) \t");
         break;
 
     case Insane:
-        d_workstream << "(Insan)\t";
+        d_line.append("(Insan)\t");
         break;
 
     default:
-        d_workstream << "(Unkwn)\t";
+        d_line.append("(Unkwn)\t");
         break;
     }
 
-    d_workstream << message << endl;
+    return true;
+}
 
-    if (d_caching)
-    {
-        d_cache.push_back(std::make_pair(d_workstream.str().c_str(), level));
-    }
-    else if (d_level >= level)
-    {
-        // write message
-        d_ostream << d_workstream.str();
-        // ensure new event is written to the file, rather than just being
-        // buffered.
-        d_ostream.flush();
-    }
+//----------------------------------------------------------------------------//
+void DefaultLogger::setWriteBufferSize(size_t size)
+{
+    d_writeBufferSize = size;
+
+    if (!d_writeBufferSize)
+        flush();
+}
+
+//----------------------------------------------------------------------------//
+size_t DefaultLogger::getWriteBufferSize() const
+{
+    return d_writeBufferSize;
+}
+
+//----------------------------------------------------------------------------//
+void DefaultLogger::flush()
+{
+    if (d_writeBuffer.empty() || !d_ostream.is_open())
+        return;
+
+    d_ostream << d_writeBuffer;
+    d_ostream.flush();
+    d_writeBuffer.clear();
 }
 
 //----------------------------------------------------------------------------//
@@ -136,7 +200,10 @@ void DefaultLogger::setLogFilename(const String& filename, bool append)
 {
     // close current log file (if any)
     if (d_ostream.is_open())
+    {
+        flush();
         d_ostream.close();
+    }
 
 
 #if defined(_MSC_VER)
@@ -165,18 +232,16 @@ void DefaultLogger::setLogFilename(const String& filename, bool append)
 
         while (iter != d_cache.end())
         {
+            // write message
             if (d_level >= (*iter).second)
-            {
-                // write message
                 d_ostream << (*iter).first;
-                // ensure new event is written to the file, rather than just
-                // being buffered.
-                d_ostream.flush();
-            }
 
             ++iter;
         }
 
+        // ensure the events are written to the file, rather than just being
+        // buffered.
+        d_ostream.flush();
         d_cache.clear();
     }
 }
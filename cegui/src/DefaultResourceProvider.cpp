@@ -38,14 +38,44 @@
 #else
 #   include <sys/types.h>
 #   include <sys/stat.h>
+#   include <sys/mman.h>
 #   include <dirent.h>
 #   include <fnmatch.h>
+#   include <fcntl.h>
+#   include <unistd.h>
 #endif
 
 // Start of CEGUI namespace section
 namespace CEGUI
 {
 
+//----------------------------------------------------------------------------//
+size_t DefaultResourceProvider::d_mappedFileCount = 0;
+
+//----------------------------------------------------------------------------//
+DefaultResourceProvider::DefaultResourceProvider() :
+    d_memoryMappingEnabled(false)
+{
+}
+
+//----------------------------------------------------------------------------//
+void DefaultResourceProvider::setMemoryMappingEnabled(bool enabled)
+{
+    d_memoryMappingEnabled = enabled;
+}
+
+//----------------------------------------------------------------------------//
+bool DefaultResourceProvider::isMemoryMappingEnabled() const
+{
+    return d_memoryMappingEnabled;
+}
+
+//----------------------------------------------------------------------------//
+size_t DefaultResourceProvider::getMappedFileCount()
+{
+    return d_mappedFileCount;
+}
+
 //----------------------------------------------------------------------------//
 void DefaultResourceProvider::loadRawDataContainer(const String& filename,
                                                    RawDataContainer& output,
@@ -57,6 +87,9 @@ void DefaultResourceProvider::loadRawDataContainer(const String& filename,
 
     const String final_filename(getFinalFilename(filename, resourceGroup));
 
+    if (d_memoryMappingEnabled && mapFile(final_filename, output))
+        return;
+
 #if defined(__WIN32__) || defined(_WIN32)
     FILE* file = _wfopen(System::getStringTranscoder().stringToStdWString(final_filename).c_str(), L"rb");
 #else
@@ -90,9 +123,115 @@ void DefaultResourceProvider::loadRawDataContainer(const String& filename,
 //----------------------------------------------------------------------------//
 void DefaultResourceProvider::unloadRawDataContainer(RawDataContainer& data)
 {
+    // mapped data carries unmapFile as its deleter.
     data.release();
 }
 
+//----------------------------------------------------------------------------//
+void DefaultResourceProvider::prefetchRawData(const String& filename,
+                                              const String& resourceGroup)
+{
+    // ask the kernel to start read-ahead of the whole file; this is only a
+    // hint, so any failure is ignored and the later load reports errors.
+#if defined(POSIX_FADV_WILLNEED)
+    const int fd =
+        open(getFinalFilename(filename, resourceGroup).c_str(), O_RDONLY);
+
+    if (fd == -1)
+        return;
+
+    posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+    close(fd);
+#else
+    (void)filename;
+    (void)resourceGroup;
+#endif
+}
+
+//----------------------------------------------------------------------------//
+bool DefaultResourceProvider::mapFile(const String& final_filename,
+                                      RawDataContainer& output)
+{
+    uint8* data = 0;
+    size_t size = 0;
+
+#if defined(__WIN32__) || defined(_WIN32)
+    const HANDLE file = CreateFileW(
+        System::getStringTranscoder().stringToStdWString(final_filename).c_str(),
+        GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL, 0);
+
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER file_size;
+    if (GetFileSizeEx(file, &file_size) && file_size.QuadPart > 0 &&
+        static_cast<ULONGLONG>(file_size.QuadPart) <= static_cast<size_t>(-1))
+    {
+        const HANDLE mapping =
+            CreateFileMappingW(file, 0, PAGE_WRITECOPY, 0, 0, 0);
+
+        if (mapping)
+        {
+            // the view keeps the mapping alive once the handles are closed.
+            data = static_cast<uint8*>(
+                MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0));
+            size = static_cast<size_t>(file_size.QuadPart);
+            CloseHandle(mapping);
+        }
+    }
+
+    CloseHandle(file);
+#else
+    const int fd = open(final_filename.c_str(), O_RDONLY);
+
+    if (fd == -1)
+        return false;
+
+    struct stat s;
+    if (fstat(fd, &s) == 0 && S_ISREG(s.st_mode) && s.st_size > 0 &&
+        static_cast<unsigned long long>(s.st_size) <= static_cast<size_t>(-1))
+    {
+        size = static_cast<size_t>(s.st_size);
+
+        // private and writable so that any consumer that modifies its input
+        // gets copy-on-write pages rather than a fault or a modified file.
+        void* const mapped = mmap(0, size, PROT_READ | PROT_WRITE,
+                                  MAP_PRIVATE, fd, 0);
+
+        if (mapped != MAP_FAILED)
+            data = static_cast<uint8*>(mapped);
+    }
+
+    // the mapping remains valid after the descriptor is closed.
+    close(fd);
+#endif
+
+    if (!data)
+        return false;
+
+    ++d_mappedFileCount;
+    output.setData(data);
+    output.setSize(size);
+    // the container unmaps the data however it gets released.
+    output.setDeleter(&DefaultResourceProvider::unmapFile);
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void DefaultResourceProvider::unmapFile(uint8* data, size_t size)
+{
+#if defined(__WIN32__) || defined(_WIN32)
+    (void)size;
+    UnmapViewOfFile(data);
+#else
+    munmap(data, size);
+#endif
+
+    --d_mappedFileCount;
+}
+
 //----------------------------------------------------------------------------//
 void DefaultResourceProvider::setResourceGroupDirectory(
                                                 const String& resourceGroup,
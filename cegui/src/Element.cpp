@@ -79,7 +79,12 @@ Element::Element():
     d_rotation(Quaternion::IDENTITY),
 
     d_unclippedOuterRect(this, &Element::getUnclippedOuterRect_impl),
-    d_unclippedInnerRect(this, &Element::getUnclippedInnerRect_impl)
+    d_unclippedInnerRect(this, &Element::getUnclippedInnerRect_impl),
+
+    d_areaUpdateDepth(0),
+    d_areaUpdateDeferred(false),
+    d_deferredMove(false),
+    d_deferredSize(false)
 {
     addElementProperties();
 }
@@ -91,7 +96,11 @@ Element::~Element()
 //----------------------------------------------------------------------------//
 Element::Element(const Element&):
     d_unclippedOuterRect(this, &Element::getUnclippedOuterRect_impl),
-    d_unclippedInnerRect(this, &Element::getUnclippedInnerRect_impl)
+    d_unclippedInnerRect(this, &Element::getUnclippedInnerRect_impl),
+    d_areaUpdateDepth(0),
+    d_areaUpdateDeferred(false),
+    d_deferredMove(false),
+    d_deferredSize(false)
 {}
 
 //----------------------------------------------------------------------------//
@@ -100,6 +109,66 @@ void Element::setArea(const UVector2& pos, const USize& size)
     setArea_impl(pos, size);
 }
 
+//----------------------------------------------------------------------------//
+void Element::beginAreaUpdate()
+{
+    if (d_areaUpdateDepth++ == 0 && !d_areaUpdateDeferred)
+        setAreaUpdateDeferred(true);
+}
+
+//----------------------------------------------------------------------------//
+void Element::endAreaUpdate()
+{
+    if (d_areaUpdateDepth == 0)
+        CEGUI_THROW(InvalidRequestException(
+            "There is no area update in progress for this Element."));
+
+    if (--d_areaUpdateDepth == 0 &&
+        !(d_parent && d_parent->d_areaUpdateDeferred))
+        flushDeferredAreaChanges();
+}
+
+//----------------------------------------------------------------------------//
+bool Element::isAreaUpdateDeferred() const
+{
+    return d_areaUpdateDeferred;
+}
+
+//----------------------------------------------------------------------------//
+void Element::setAreaUpdateDeferred(bool deferred)
+{
+    d_areaUpdateDeferred = deferred;
+
+    // subtrees with their own open transaction are deferred either way.
+    for (size_t i = 0; i < getChildCount(); ++i)
+    {
+        if (d_children[i]->d_areaUpdateDepth == 0)
+            d_children[i]->setAreaUpdateDeferred(deferred);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void Element::flushDeferredAreaChanges()
+{
+    const bool moved = d_deferredMove;
+    const bool sized = d_deferredSize;
+    d_deferredMove = d_deferredSize = false;
+    d_areaUpdateDeferred = false;
+
+    // parents first, so that children are notified against final parent
+    // rects.  A moved parent invalidates the entire subtree, after which
+    // only elements that themselves changed need any further processing.
+    fireAreaChangeEvents(moved, sized);
+
+    // handlers may modify the child list, so it's re-checked each time.
+    for (size_t i = 0; i < getChildCount(); ++i)
+    {
+        // subtrees with their own open transaction are flushed when it ends.
+        if (d_children[i]->d_areaUpdateDepth == 0)
+            d_children[i]->flushDeferredAreaChanges();
+    }
+}
+
 //----------------------------------------------------------------------------//
 void Element::notifyScreenAreaChanged(bool recursive /* = true */)
 {
@@ -524,6 +593,13 @@ void Element::setArea_impl(const UVector2& pos, const USize& size,
 //----------------------------------------------------------------------------//
 void Element::fireAreaChangeEvents(const bool moved, const bool sized)
 {
+    if ((moved || sized) && d_areaUpdateDeferred)
+    {
+        d_deferredMove |= moved;
+        d_deferredSize |= sized;
+        return;
+    }
+
     if (moved)
     {
         ElementEventArgs args(this);
@@ -541,6 +617,11 @@ void Element::fireAreaChangeEvents(const bool moved, const bool sized)
 void Element::setParent(Element* parent)
 {
     d_parent = parent;
+
+    const bool deferred = d_areaUpdateDepth != 0 ||
+                          (d_parent && d_parent->d_areaUpdateDeferred);
+    if (deferred != d_areaUpdateDeferred)
+        setAreaUpdateDeferred(deferred);
 }
 
 //----------------------------------------------------------------------------//
@@ -571,16 +652,24 @@ void Element::addChild_impl(Element* element)
 //----------------------------------------------------------------------------//
 void Element::removeChild_impl(Element* element)
 {
-    // find this element in the child list
-    ChildList::iterator it = std::find(d_children.begin(), d_children.end(), element);
+    // find this element in the child list, searching from the back since
+    // children are most often removed in reverse order of addition
+    ChildList::reverse_iterator it =
+        std::find(d_children.rbegin(), d_children.rend(), element);
 
     // if the element was found in the child list
-    if (it != d_children.end())
+    if (it != d_children.rend())
     {
+        const bool deferred = d_areaUpdateDeferred;
+
         // remove element from child list
-        d_children.erase(it);
+        d_children.erase(--it.base());
         // reset element's parent so it's no longer this element.
         element->setParent(0);
+
+        // deliver any notifications deferred while it was in this hierarchy
+        if (deferred)
+            element->flushDeferredAreaChanges();
     }
 }
 
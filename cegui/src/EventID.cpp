@@ -0,0 +1,95 @@
+/***********************************************************************
+ *    filename:   EventID.cpp
+ *    created:    18/10/2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2013 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/EventID.h"
+#include <map>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+typedef std::map<String, EventID::Entry, StringFastLessCompare
+    CEGUI_MAP_ALLOC(String, EventID::Entry)> EventIDRegistry;
+
+//----------------------------------------------------------------------------//
+// function local static, so EventIDs may be safely created during static
+// initialisation of other translation units.
+static EventIDRegistry& getEventIDRegistry()
+{
+    static EventIDRegistry registry;
+    return registry;
+}
+
+//----------------------------------------------------------------------------//
+EventID::EventID(const String& name, const String& eventNamespace)
+{
+    String global_name;
+    global_name.reserve(eventNamespace.length() + name.length() + 1);
+    global_name.append(eventNamespace);
+    global_name.append(1, '/');
+    global_name.append(name);
+
+    EventIDRegistry& registry = getEventIDRegistry();
+    EventIDRegistry::iterator it = registry.find(global_name);
+
+    if (it == registry.end())
+    {
+        Entry entry;
+        entry.d_name = name;
+        entry.d_namespace = eventNamespace;
+        entry.d_globalName = global_name;
+        entry.d_value = static_cast<uint>(registry.size());
+
+        it = registry.insert(std::make_pair(global_name, entry)).first;
+    }
+
+    // map nodes are stable, so we may hold on to the entry itself.
+    d_entry = &it->second;
+}
+
+//----------------------------------------------------------------------------//
+uint EventID::getCount()
+{
+    return static_cast<uint>(getEventIDRegistry().size());
+}
+
+//----------------------------------------------------------------------------//
+bool EventID::findValue(const String& globalName, uint& value)
+{
+    const EventIDRegistry& registry = getEventIDRegistry();
+    EventIDRegistry::const_iterator it = registry.find(globalName);
+
+    if (it == registry.end())
+        return false;
+
+    value = it->second.d_value;
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
+
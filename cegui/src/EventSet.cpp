@@ -28,6 +28,7 @@
  *   OTHER DEALINGS IN THE SOFTWARE.
  ***************************************************************************/
 #include "CEGUI/EventSet.h"
+#include "CEGUI/EventID.h"
 #include "CEGUI/Exceptions.h"
 #include "CEGUI/GlobalEventSet.h"
 #include "CEGUI/ScriptModule.h"
@@ -38,7 +39,8 @@ namespace CEGUI
 {
 //----------------------------------------------------------------------------//
 EventSet::EventSet() :
-    d_muted(false)
+    d_muted(false),
+    d_eventsGeneration(0)
 {
 }
 
@@ -68,6 +70,7 @@ void EventSet::addEvent(Event& event)
     }
 
     d_events.insert(std::make_pair(name, &event));
+    ++d_eventsGeneration;
 }
 
 //----------------------------------------------------------------------------//
@@ -79,6 +82,7 @@ void EventSet::removeEvent(const String& name)
 	{
 		CEGUI_DELETE_AO pos->second;
 		d_events.erase(pos);
+        ++d_eventsGeneration;
 	}
 }
 
@@ -98,6 +102,7 @@ void EventSet::removeAllEvents(void)
 		CEGUI_DELETE_AO pos->second;
 
     d_events.clear();
+    ++d_eventsGeneration;
 }
 
 //----------------------------------------------------------------------------//
@@ -159,6 +164,15 @@ void EventSet::fireEvent(const String& name,
     fireEvent_impl(name, args);
 }
 
+//----------------------------------------------------------------------------//
+void EventSet::fireEvent(const EventID& id, EventArgs& args)
+{
+    if (GlobalEventSet* ges = GlobalEventSet::getSingletonPtr())
+        ges->fireEvent(id, args);
+
+    fireEvent_impl(id.getName(), args);
+}
+
 //----------------------------------------------------------------------------//
 bool EventSet::isMuted(void) const
 {
@@ -192,6 +206,10 @@ Event* EventSet::getEventObject(const String& name, bool autoAdd)
 //----------------------------------------------------------------------------//
 void EventSet::fireEvent_impl(const String& name, EventArgs& args)
 {
+    // nothing was ever subscribed, so skip the lookup altogether.
+    if (d_events.empty())
+        return;
+
     Event* ev = getEventObject(name);
 
     if ((ev != 0) && !d_muted)
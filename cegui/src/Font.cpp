@@ -31,6 +31,16 @@
 #include "CEGUI/PropertyHelper.h"
 #include "CEGUI/System.h"
 #include "CEGUI/Image.h"
+#include "CEGUI/BasicImage.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/Texture.h"
+#include "CEGUI/Vertex.h"
+#include "CEGUI/ColourRect.h"
+#include "CEGUI/CoordConverter.h"
+#include "CEGUI/SimpleTimer.h"
+
+#include <cstring>
+#include <limits>
 
 namespace CEGUI
 {
@@ -39,6 +49,10 @@ namespace CEGUI
 #define BITS_PER_UINT   (sizeof (uint) * 8)
 // must be a power of two
 #define GLYPHS_PER_PAGE 256
+// maximum number of glyphs sent to a GeometryBuffer in one appendGeometry call
+#define GLYPHS_PER_RUN 32
+// default memory, in bytes, used by the text layout cache
+#define DEFAULT_LAYOUT_CACHE_SIZE (128 * 1024)
 
 //----------------------------------------------------------------------------//
 const argb_t Font::DefaultColour = 0xFFFFFFFF;
@@ -47,6 +61,7 @@ String Font::d_defaultResourceGroup;
 //----------------------------------------------------------------------------//
 const String Font::EventNamespace("Font");
 const String Font::EventRenderSizeChanged("RenderSizeChanged");
+const String Font::EventGlyphsRasterised("GlyphsRasterised");
 
 //----------------------------------------------------------------------------//
 Font::Font(const String& name, const String& type_name, const String& filename,
@@ -62,7 +77,13 @@ Font::Font(const String& name, const String& type_name, const String& filename,
     d_autoScaled(auto_scaled),
     d_nativeResolution(native_res),
     d_maxCodepoint(0),
-    d_glyphPageLoaded(0)
+    d_glyphPageLoaded(0),
+    d_deferredRasterisation(false),
+    d_deferredPageProgress(0),
+    d_layoutCacheSize(DEFAULT_LAYOUT_CACHE_SIZE),
+    d_layoutCacheUsage(0),
+    d_layoutCacheHits(0),
+    d_layoutCacheMisses(0)
 {
     addFontProperties();
 
@@ -74,6 +95,8 @@ Font::Font(const String& name, const String& type_name, const String& filename,
 //----------------------------------------------------------------------------//
 Font::~Font()
 {
+    invalidateGlyphPageIndex();
+
     if (d_glyphPageLoaded)
     {
         const uint old_size = (((d_maxCodepoint + GLYPHS_PER_PAGE) / GLYPHS_PER_PAGE)
@@ -122,6 +145,14 @@ void Font::addFontProperties()
         "resolution.  Value can be 'false', 'vertical', 'horizontal' or 'true'.",
         &Font::setAutoScaled, &Font::getAutoScaled, ASM_Disabled
     );
+
+    CEGUI_DEFINE_PROPERTY(Font, bool,
+        "DeferredRasterisation", "This is a flag indicating whether glyph "
+        "pages are rasterised over subsequent time pulses rather than when "
+        "first used.  Value is either true or false.",
+        &Font::setDeferredRasterisationEnabled,
+        &Font::isDeferredRasterisationEnabled, false
+    );
 }
 
 //----------------------------------------------------------------------------//
@@ -136,6 +167,8 @@ void Font::setMaxCodepoint(utf32 codepoint)
     }
 
     d_maxCodepoint = codepoint;
+    d_deferredPages.clear();
+    d_deferredPageProgress = 0;
 
     const uint npages = (codepoint + GLYPHS_PER_PAGE) / GLYPHS_PER_PAGE;
     const uint size = (npages + BITS_PER_UINT - 1) / BITS_PER_UINT;
@@ -150,7 +183,7 @@ const FontGlyph* Font::getGlyphData(utf32 codepoint) const
     if (codepoint > d_maxCodepoint)
         return 0;
 
-    const FontGlyph* const glyph = findFontGlyph(codepoint);
+    const FontGlyph* const glyph = findIndexedFontGlyph(codepoint);
 
     if (d_glyphPageLoaded)
     {
@@ -160,14 +193,123 @@ const FontGlyph* Font::getGlyphData(utf32 codepoint) const
         if (!(d_glyphPageLoaded[page / BITS_PER_UINT] & mask))
         {
             d_glyphPageLoaded[page / BITS_PER_UINT] |= mask;
-            rasterise(codepoint & ~(GLYPHS_PER_PAGE - 1),
-                      codepoint | (GLYPHS_PER_PAGE - 1));
+
+            if (d_deferredRasterisation)
+                d_deferredPages.push_back(page);
+            else
+                rasteriseGlyphPage(page);
         }
     }
 
     return glyph;
 }
 
+//----------------------------------------------------------------------------//
+void Font::rasteriseGlyphPage(uint page) const
+{
+    rasterise(page * GLYPHS_PER_PAGE, page * GLYPHS_PER_PAGE + GLYPHS_PER_PAGE - 1);
+}
+
+//----------------------------------------------------------------------------//
+void Font::setDeferredRasterisationEnabled(bool setting)
+{
+    d_deferredRasterisation = setting;
+
+    if (!setting)
+        rasteriseDeferredGlyphs(std::numeric_limits<float>::max());
+}
+
+//----------------------------------------------------------------------------//
+bool Font::isDeferredRasterisationEnabled() const
+{
+    return d_deferredRasterisation;
+}
+
+//----------------------------------------------------------------------------//
+void Font::prewarmGlyphs(utf32 start_codepoint, utf32 end_codepoint)
+{
+    if (!d_glyphPageLoaded || start_codepoint > d_maxCodepoint)
+        return;
+
+    const uint first_page = start_codepoint / GLYPHS_PER_PAGE;
+    const uint last_page = ceguimin(end_codepoint, d_maxCodepoint) / GLYPHS_PER_PAGE;
+
+    // pages already queued for deferred rasterisation are done now, and text
+    // drawn with their placeholder glyphs will need redrawing.
+    bool dequeued = false;
+    for (GlyphPageQueue::iterator i = d_deferredPages.begin();
+         i != d_deferredPages.end(); )
+    {
+        if (*i >= first_page && *i <= last_page)
+        {
+            if (i == d_deferredPages.begin())
+                d_deferredPageProgress = 0;
+
+            rasteriseGlyphPage(*i);
+            i = d_deferredPages.erase(i);
+            dequeued = true;
+        }
+        else
+            ++i;
+    }
+
+    for (uint page = first_page; page <= last_page; ++page)
+    {
+        const uint mask = 1 << (page & (BITS_PER_UINT - 1));
+        if (!(d_glyphPageLoaded[page / BITS_PER_UINT] & mask))
+        {
+            d_glyphPageLoaded[page / BITS_PER_UINT] |= mask;
+            rasteriseGlyphPage(page);
+        }
+    }
+
+    if (dequeued)
+    {
+        invalidateTextLayoutCache();
+
+        FontEventArgs args(this);
+        onGlyphsRasterised(args);
+    }
+}
+
+//----------------------------------------------------------------------------//
+size_t Font::getDeferredGlyphPageCount() const
+{
+    return d_deferredPages.size();
+}
+
+//----------------------------------------------------------------------------//
+bool Font::rasteriseDeferredGlyphs(float time_budget)
+{
+    if (d_deferredPages.empty())
+        return false;
+
+    // the budget is checked after each codepoint, since rasterising a whole
+    // page of glyphs at once could well take longer than a frame.
+    SimpleTimer timer;
+    do
+    {
+        const utf32 codepoint =
+            d_deferredPages.front() * GLYPHS_PER_PAGE + d_deferredPageProgress;
+        rasterise(codepoint, codepoint);
+
+        if (++d_deferredPageProgress == GLYPHS_PER_PAGE)
+        {
+            d_deferredPages.pop_front();
+            d_deferredPageProgress = 0;
+        }
+    }
+    while (!d_deferredPages.empty() && timer.elapsed() < time_budget);
+
+    // cached layouts were computed using the placeholder glyphs
+    invalidateTextLayoutCache();
+
+    FontEventArgs args(this);
+    onGlyphsRasterised(args);
+
+    return true;
+}
+
 //----------------------------------------------------------------------------//
 const FontGlyph* Font::findFontGlyph(const utf32 codepoint) const
 {
@@ -176,69 +318,367 @@ const FontGlyph* Font::findFontGlyph(const utf32 codepoint) const
 }
 
 //----------------------------------------------------------------------------//
-float Font::getTextExtent(const String& text, float x_scale) const
+const FontGlyph* Font::findIndexedFontGlyph(const utf32 codepoint) const
+{
+    const size_t page = codepoint / GLYPHS_PER_PAGE;
+
+    if (page >= d_glyphPageIndex.size())
+        d_glyphPageIndex.resize(page + 1, 0);
+
+    GlyphPageEntry* entries = d_glyphPageIndex[page];
+
+    // populate the page from the codepoint map on first use
+    if (!entries)
+    {
+        entries = CEGUI_NEW_ARRAY_PT(GlyphPageEntry, GLYPHS_PER_PAGE, Font);
+        memset(entries, 0, GLYPHS_PER_PAGE * sizeof(GlyphPageEntry));
+
+        const utf32 first = codepoint & ~(GLYPHS_PER_PAGE - 1);
+        CodepointMap::const_iterator i = d_cp_map.lower_bound(first);
+        const CodepointMap::const_iterator end =
+            d_cp_map.lower_bound(first + GLYPHS_PER_PAGE);
+
+        for (; i != end; ++i)
+            entries[i->first - first] = &i->second;
+
+        d_glyphPageIndex[page] = entries;
+    }
+
+    const FontGlyph* const glyph = entries[codepoint & (GLYPHS_PER_PAGE - 1)];
+
+    // glyphs still needing initialisation take the slow path (once)
+    if (glyph && !glyph->isValid())
+        return findFontGlyph(codepoint);
+
+    return glyph;
+}
+
+//----------------------------------------------------------------------------//
+void Font::invalidateGlyphPageIndex()
+{
+    for (size_t i = 0; i < d_glyphPageIndex.size(); ++i)
+    {
+        if (d_glyphPageIndex[i])
+            CEGUI_DELETE_ARRAY_PT(d_glyphPageIndex[i], GlyphPageEntry,
+                                  GLYPHS_PER_PAGE, Font);
+    }
+
+    d_glyphPageIndex.clear();
+}
+
+//----------------------------------------------------------------------------//
+float Font::getKerning(utf32, utf32, float) const
 {
-    const FontGlyph* glyph;
-    float cur_extent = 0, adv_extent = 0, width;
+    // no kerning by default
+    return 0.0f;
+}
+
+//----------------------------------------------------------------------------//
+// 64 bit FNV-1a hash of the text codepoints and the scale used for layout.
+// Cached layouts are identified by this hash and the text length alone, so
+// the hash must be wide enough to make collisions practically impossible.
+static uint64 hashTextLayoutKey(const String& text, float x_scale)
+{
+    uint64 hash = 14695981039346656037ULL;
 
     for (size_t c = 0; c < text.length(); ++c)
     {
-        glyph = getGlyphData(text[c]);
+        hash ^= static_cast<uint64>(text[c]);
+        hash *= 1099511628211ULL;
+    }
 
-        if (glyph)
+    uint scale_bits = 0;
+    memcpy(&scale_bits, &x_scale, ceguimin(sizeof(scale_bits), sizeof(x_scale)));
+    hash ^= scale_bits;
+    hash *= 1099511628211ULL;
+
+    return hash;
+}
+
+//----------------------------------------------------------------------------//
+const Font::TextLayout& Font::getTextLayout(const String& text,
+                                            float x_scale) const
+{
+    const size_t cost = getTextLayoutCost(text.length());
+
+    if (cost > d_layoutCacheSize)
+    {
+        d_uncachedLayout.d_xScale = x_scale;
+        layoutText(d_uncachedLayout, text);
+        return d_uncachedLayout;
+    }
+
+    const uint64 hash = hashTextLayoutKey(text, x_scale);
+
+    std::pair<TextLayoutIndex::iterator, TextLayoutIndex::iterator> range =
+        d_layoutIndex.equal_range(hash);
+
+    for (TextLayoutIndex::iterator i = range.first; i != range.second; ++i)
+    {
+        if (i->second->d_length == text.length() &&
+            i->second->d_xScale == x_scale)
         {
-            width = glyph->getRenderedAdvance(x_scale);
+            ++d_layoutCacheHits;
+            // move to the front of the list as the most recently used
+            d_layoutCache.splice(d_layoutCache.begin(), d_layoutCache, i->second);
+            return *i->second;
+        }
+    }
 
-            if (adv_extent + width > cur_extent)
-                cur_extent = adv_extent + width;
+    ++d_layoutCacheMisses;
 
-            adv_extent += glyph->getAdvance(x_scale);
+    while (d_layoutCacheUsage + cost > d_layoutCacheSize)
+        evictTextLayout();
+
+    d_layoutCache.push_front(TextLayout());
+    d_layoutCacheUsage += cost;
+
+    TextLayout& layout = d_layoutCache.front();
+    layout.d_hash = hash;
+    layout.d_length = text.length();
+    layout.d_xScale = x_scale;
+    layoutText(layout, text);
+
+    d_layoutIndex.insert(std::make_pair(hash, d_layoutCache.begin()));
+
+    return layout;
+}
+
+//----------------------------------------------------------------------------//
+void Font::evictTextLayout() const
+{
+    TextLayoutList::iterator lru = d_layoutCache.end();
+    --lru;
+
+    std::pair<TextLayoutIndex::iterator, TextLayoutIndex::iterator> range =
+        d_layoutIndex.equal_range(lru->d_hash);
+    for (TextLayoutIndex::iterator i = range.first; i != range.second; ++i)
+    {
+        if (i->second == lru)
+        {
+            d_layoutIndex.erase(i);
+            break;
         }
     }
 
-    return ceguimax(adv_extent, cur_extent);
+    d_layoutCacheUsage -= getTextLayoutCost(lru->d_length);
+    d_layoutCache.erase(lru);
 }
 
 //----------------------------------------------------------------------------//
-float Font::getTextAdvance(const String& text, float x_scale) const
+size_t Font::getTextLayoutCost(size_t length)
+{
+    return sizeof(TextLayout) + sizeof(TextLayoutIndex::value_type) +
+           length * (sizeof(const FontGlyph*) + sizeof(float)) + sizeof(float);
+}
+
+//----------------------------------------------------------------------------//
+void Font::layoutText(TextLayout& layout, const String& text) const
 {
-    float advance = 0.0f;
+    const float x_scale = layout.d_xScale;
+    const size_t char_count = text.length();
 
-    for (size_t c = 0; c < text.length(); ++c)
+    layout.d_glyphs.resize(char_count);
+    layout.d_offsets.resize(char_count + 1);
+
+    float pen = 0, extent = 0;
+    const FontGlyph* prev_glyph = 0;
+    utf32 prev_codepoint = 0;
+
+    for (size_t c = 0; c < char_count; ++c)
     {
-        if (const FontGlyph* glyph = getGlyphData(text[c]))
-            advance += glyph->getAdvance(x_scale);
+        const FontGlyph* const glyph = getGlyphData(text[c]);
+        layout.d_glyphs[c] = glyph;
+
+        if (glyph)
+        {
+            if (prev_glyph)
+                pen += getKerning(prev_codepoint, text[c], x_scale);
+
+            layout.d_offsets[c] = pen;
+
+            const float width = glyph->getRenderedAdvance(x_scale);
+            if (pen + width > extent)
+                extent = pen + width;
+
+            pen += glyph->getAdvance(x_scale);
+
+            prev_glyph = glyph;
+            prev_codepoint = text[c];
+        }
+        else
+            layout.d_offsets[c] = pen;
     }
 
-    return advance;
+    layout.d_offsets[char_count] = pen;
+    layout.d_extent = ceguimax(pen, extent);
+}
+
+//----------------------------------------------------------------------------//
+void Font::setTextLayoutCacheSize(size_t size)
+{
+    d_layoutCacheSize = size;
+    invalidateTextLayoutCache();
+}
+
+//----------------------------------------------------------------------------//
+size_t Font::getTextLayoutCacheSize() const
+{
+    return d_layoutCacheSize;
+}
+
+//----------------------------------------------------------------------------//
+size_t Font::getTextLayoutCacheUsage() const
+{
+    return d_layoutCacheUsage;
+}
+
+//----------------------------------------------------------------------------//
+uint Font::getTextLayoutCacheHits() const
+{
+    return d_layoutCacheHits;
+}
+
+//----------------------------------------------------------------------------//
+uint Font::getTextLayoutCacheMisses() const
+{
+    return d_layoutCacheMisses;
+}
+
+//----------------------------------------------------------------------------//
+void Font::resetTextLayoutCacheStatistics()
+{
+    d_layoutCacheHits = 0;
+    d_layoutCacheMisses = 0;
+}
+
+//----------------------------------------------------------------------------//
+void Font::invalidateTextLayoutCache()
+{
+    d_layoutIndex.clear();
+    d_layoutCache.clear();
+    d_layoutCacheUsage = 0;
+    d_uncachedLayout.d_glyphs.clear();
+}
+
+//----------------------------------------------------------------------------//
+float Font::getTextExtent(const String& text, float x_scale) const
+{
+    if (text.empty())
+        return 0.0f;
+
+    return getTextLayout(text, x_scale).d_extent;
+}
+
+//----------------------------------------------------------------------------//
+float Font::getTextAdvance(const String& text, float x_scale) const
+{
+    if (text.empty())
+        return 0.0f;
+
+    return getTextLayout(text, x_scale).d_offsets.back();
 }
 
 //----------------------------------------------------------------------------//
 size_t Font::getCharAtPixel(const String& text, size_t start_char, float pixel,
                             float x_scale) const
 {
-    const FontGlyph* glyph;
-    float cur_extent = 0;
     size_t char_count = text.length();
 
     // handle simple cases
     if ((pixel <= 0) || (char_count <= start_char))
         return start_char;
 
+    const TextLayout& layout = getTextLayout(text, x_scale);
+    const float start_offset = layout.d_offsets[start_char];
+
     for (size_t c = start_char; c < char_count; ++c)
     {
-        glyph = getGlyphData(text[c]);
+        if (layout.d_glyphs[c] &&
+            (pixel < layout.d_offsets[c + 1] - start_offset))
+            return c;
+    }
 
-        if (glyph)
-        {
-            cur_extent += glyph->getAdvance(x_scale);
+    return char_count;
+}
 
-            if (pixel < cur_extent)
-                return c;
-        }
+//----------------------------------------------------------------------------//
+/*
+    Fill vbuffer with the six vertices for a glyph quad using the texture area
+    of the BasicImage \a img.  This produces the same geometry as
+    BasicImage::render (with the TopLeftToBottomRight split), but avoids the
+    per-glyph virtual calls and does the clipping work only for glyphs that
+    actually straddle the clip rect.  Returns false if the glyph is completely
+    clipped, in which case nothing is written.
+*/
+static bool fillGlyphQuad(Vertex* vbuffer, const BasicImage& img,
+                          const Vector2f& position, const Sizef& size,
+                          const Vector2f& texel_scale, const Rectf* clip_rect,
+                          const ColourRect& colours)
+{
+    Rectf dest(position, size);
+    dest.offset(img.getRenderedOffset());
+
+    const Rectf& area = img.getArea();
+    Rectf final_rect(dest);
+    Rectf tex_rect(area.d_min * texel_scale, area.d_max * texel_scale);
+
+    if (clip_rect &&
+        (dest.left() < clip_rect->left() || dest.top() < clip_rect->top() ||
+         dest.right() > clip_rect->right() || dest.bottom() > clip_rect->bottom()))
+    {
+        final_rect = dest.getIntersection(*clip_rect);
+
+        if ((final_rect.getWidth() == 0) || (final_rect.getHeight() == 0))
+            return false;
+
+        const Vector2f tex_per_pix(area.getWidth() / dest.getWidth(),
+                                   area.getHeight() / dest.getHeight());
+
+        tex_rect = Rectf(
+            (area.d_min + ((final_rect.d_min - dest.d_min) * tex_per_pix)) * texel_scale,
+            (area.d_max + ((final_rect.d_max - dest.d_max) * tex_per_pix)) * texel_scale);
     }
+    else if ((final_rect.getWidth() == 0) || (final_rect.getHeight() == 0))
+        return false;
 
-    return char_count;
+    final_rect.d_min.d_x = CoordConverter::alignToPixels(final_rect.d_min.d_x);
+    final_rect.d_min.d_y = CoordConverter::alignToPixels(final_rect.d_min.d_y);
+    final_rect.d_max.d_x = CoordConverter::alignToPixels(final_rect.d_max.d_x);
+    final_rect.d_max.d_y = CoordConverter::alignToPixels(final_rect.d_max.d_y);
+
+    vbuffer[0].position   = Vector3f(final_rect.left(), final_rect.top(), 0.0f);
+    vbuffer[0].colour_val = colours.d_top_left;
+    vbuffer[0].tex_coords = Vector2f(tex_rect.left(), tex_rect.top());
+
+    vbuffer[1].position   = Vector3f(final_rect.left(), final_rect.bottom(), 0.0f);
+    vbuffer[1].colour_val = colours.d_bottom_left;
+    vbuffer[1].tex_coords = Vector2f(tex_rect.left(), tex_rect.bottom());
+
+    vbuffer[2].position   = Vector3f(final_rect.right(), final_rect.bottom(), 0.0f);
+    vbuffer[2].colour_val = colours.d_bottom_right;
+    vbuffer[2].tex_coords = Vector2f(tex_rect.right(), tex_rect.bottom());
+
+    vbuffer[3].position   = Vector3f(final_rect.right(), final_rect.top(), 0.0f);
+    vbuffer[3].colour_val = colours.d_top_right;
+    vbuffer[3].tex_coords = Vector2f(tex_rect.right(), tex_rect.top());
+
+    vbuffer[4] = vbuffer[0];
+    vbuffer[5] = vbuffer[2];
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+static void flushGlyphRun(GeometryBuffer& buffer, Texture* texture,
+                          const Vertex* vbuffer, size_t& glyph_count)
+{
+    if (!glyph_count)
+        return;
+
+    buffer.setActiveTexture(texture);
+    buffer.appendGeometry(vbuffer, static_cast<uint>(glyph_count * 6));
+    glyph_count = 0;
 }
 
 //----------------------------------------------------------------------------//
@@ -250,24 +690,71 @@ float Font::drawText(GeometryBuffer& buffer, const String& text,
     const float base_y = position.d_y + getBaseline(y_scale);
     Vector2f glyph_pos(position);
 
+    // Glyphs sharing a texture are collected into a run that is sent to the
+    // buffer in one go, rather than having each glyph image render itself.
+    Vertex run_buffer[GLYPHS_PER_RUN * 6];
+    size_t run_length = 0;
+    Texture* run_texture = 0;
+    Vector2f texel_scale(0, 0);
+
+    const TextLayout& layout = getTextLayout(text, x_scale);
+    // total extra spacing added for space chars so far
+    float space_offset = 0.0f;
+
     for (size_t c = 0; c < text.length(); ++c)
     {
-        const FontGlyph* glyph;
-        if ((glyph = getGlyphData(text[c]))) // NB: assignment
+        // codepoints with no glyph take no space, not even space_extra.
+        const FontGlyph* const glyph = layout.d_glyphs[c];
+        if (!glyph)
+            continue;
+
+        // a glyph awaiting deferred rasterisation has no image yet, and is
+        // left as empty space until its page is rasterised.
+        const Image* const img = glyph->getImage();
+        if (img)
         {
-            const Image* const img = glyph->getImage();
+            glyph_pos.d_x = position.d_x + layout.d_offsets[c] + space_offset;
             glyph_pos.d_y =
                 base_y - (img->getRenderedOffset().d_y - img->getRenderedOffset().d_y * y_scale);
-            img->render(buffer, glyph_pos,
-                      glyph->getSize(x_scale, y_scale), clip_rect, colours);
-            glyph_pos.d_x += glyph->getAdvance(x_scale);
-            // apply extra spacing to space chars
-            if (text[c] == ' ')
-                glyph_pos.d_x += space_extra;
+
+            const BasicImage* const basic_img = glyph->getBasicImage();
+            Texture* const texture = basic_img ? basic_img->getTexture() : 0;
+
+            if (texture)
+            {
+                if (texture != run_texture || run_length == GLYPHS_PER_RUN)
+                {
+                    flushGlyphRun(buffer, run_texture, run_buffer, run_length);
+
+                    if (texture != run_texture)
+                    {
+                        run_texture = texture;
+                        texel_scale = texture->getTexelScaling();
+                    }
+                }
+
+                if (fillGlyphQuad(&run_buffer[run_length * 6], *basic_img,
+                                  glyph_pos, glyph->getSize(x_scale, y_scale),
+                                  texel_scale, clip_rect, colours))
+                    ++run_length;
+            }
+            else
+            {
+                // not something we can batch; have the image draw itself.
+                flushGlyphRun(buffer, run_texture, run_buffer, run_length);
+                img->render(buffer, glyph_pos,
+                          glyph->getSize(x_scale, y_scale), clip_rect, colours);
+            }
         }
+
+        // apply extra spacing to space chars
+        if (text[c] == ' ')
+            space_offset += space_extra;
     }
 
-    return glyph_pos.d_x;
+    flushGlyphRun(buffer, run_texture, run_buffer, run_length);
+
+    return position.d_x + layout.d_offsets[text.length()] + space_offset;
 }
 
 //----------------------------------------------------------------------------//
@@ -362,6 +849,12 @@ void Font::onRenderSizeChanged(FontEventArgs& e)
     fireEvent(EventRenderSizeChanged, e, EventNamespace);
 }
 
+//----------------------------------------------------------------------------//
+void Font::onGlyphsRasterised(FontEventArgs& e)
+{
+    fireEvent(EventGlyphsRasterised, e, EventNamespace);
+}
+
 //----------------------------------------------------------------------------//
 
 } // End of  CEGUI namespace section
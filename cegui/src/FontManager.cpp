@@ -35,6 +35,7 @@
 #include "CEGUI/System.h"
 #include "CEGUI/XMLParser.h"
 #include "CEGUI/PixmapFont.h"
+#include "CEGUI/SimpleTimer.h"
 
 #ifdef CEGUI_HAS_FREETYPE
 #   include "CEGUI/FreeTypeFont.h"
@@ -50,7 +51,8 @@ template<> FontManager* Singleton<FontManager>::ms_Singleton = 0;
 
 //----------------------------------------------------------------------------//
 FontManager::FontManager() :
-    NamedXMLResourceManager<Font, Font_xmlHandler>("Font")
+    NamedXMLResourceManager<Font, Font_xmlHandler>("Font"),
+    d_deferredRasterisationBudget(0.002f)
 {
     char addr_buff[32];
     sprintf(addr_buff, "(%p)", static_cast<void*>(this));
@@ -130,6 +132,44 @@ void FontManager::notifyDisplaySizeChanged(const Sizef& size)
         pos->second->notifyDisplaySizeChanged(size);
 }
 
+//----------------------------------------------------------------------------//
+bool FontManager::rasteriseDeferredGlyphs()
+{
+    SimpleTimer timer;
+    bool rasterised = false;
+
+    ObjectRegistry::iterator pos = d_objects.begin(), end = d_objects.end();
+
+    for (; pos != end; ++pos)
+    {
+        if (!pos->second->getDeferredGlyphPageCount())
+            continue;
+
+        const float remaining = d_deferredRasterisationBudget -
+                                static_cast<float>(timer.elapsed());
+
+        // always make some progress, even if the budget is already spent.
+        if (rasterised && remaining <= 0.0f)
+            break;
+
+        rasterised |= pos->second->rasteriseDeferredGlyphs(remaining);
+    }
+
+    return rasterised;
+}
+
+//----------------------------------------------------------------------------//
+void FontManager::setDeferredRasterisationBudget(float seconds)
+{
+    d_deferredRasterisationBudget = seconds;
+}
+
+//----------------------------------------------------------------------------//
+float FontManager::getDeferredRasterisationBudget() const
+{
+    return d_deferredRasterisationBudget;
+}
+
 //----------------------------------------------------------------------------//
 FontManager::FontIterator FontManager::getIterator(void) const
 {
@@ -30,6 +30,7 @@
 #include "CEGUI/FreeTypeFont.h"
 #include "CEGUI/Exceptions.h"
 #include "CEGUI/Texture.h"
+#include "CEGUI/GlyphAtlas.h"
 #include "CEGUI/ImageManager.h"
 #include "CEGUI/System.h"
 #include "CEGUI/Logger.h"
@@ -47,8 +48,6 @@
 namespace CEGUI
 {
 //----------------------------------------------------------------------------//
-// Pixels to put between glyphs
-#define INTER_GLYPH_PAD_SPACE 2
 // A multiplication coefficient to convert FT_Pos values into normal floats
 #define FT_POS_COEF  (1.0/64.0)
 
@@ -77,7 +76,8 @@ FreeTypeFont::FreeTypeFont(const String& font_name, const float point_size,
     d_specificLineSpacing(specific_line_spacing),
     d_ptSize(point_size),
     d_antiAliased(anti_aliased),
-    d_fontFace(0)
+    d_fontFace(0),
+    d_glyphAtlas(0)
 {
     if (!ft_usage_count++)
         FT_Init_FreeType(&ft_lib);
@@ -116,200 +116,86 @@ void FreeTypeFont::addFreeTypeFontProperties ()
         "Value is either true or false.",
         &FreeTypeFont::setAntiAliased, &FreeTypeFont::isAntiAliased, 0
     );
-}
-
-//----------------------------------------------------------------------------//
-uint FreeTypeFont::getTextureSize(CodepointMap::const_iterator s,
-                                  CodepointMap::const_iterator e) const
-{
-    uint texsize = 32; // start with 32x32
-    uint max_texsize = System::getSingleton().getRenderer()->getMaxTextureSize();
-    uint glyph_count = 0;
-
-    // Compute approximatively the optimal texture size for font
-    while (texsize < max_texsize)
-    {
-        uint x = INTER_GLYPH_PAD_SPACE, y = INTER_GLYPH_PAD_SPACE;
-        uint yb = INTER_GLYPH_PAD_SPACE;
-        for (CodepointMap::const_iterator c = s; c != e; ++c)
-        {
-            // skip glyphs that are already rendered
-            if (c->second.getImage())
-                continue;
-
-            // load glyph metrics (don't render)
-            if (FT_Load_Char(d_fontFace, c->first,
-                             FT_LOAD_DEFAULT | FT_LOAD_FORCE_AUTOHINT))
-                continue;
-
-            uint glyph_w = int (ceil(d_fontFace->glyph->metrics.width * FT_POS_COEF)) +
-                           INTER_GLYPH_PAD_SPACE;
-            uint glyph_h = int (ceil(d_fontFace->glyph->metrics.height * FT_POS_COEF)) +
-                           INTER_GLYPH_PAD_SPACE;
-
-            x += glyph_w;
-            if (x > texsize)
-            {
-                x = INTER_GLYPH_PAD_SPACE;
-                y = yb;
-            }
-            uint yy = y + glyph_h;
-            if (yy > texsize)
-                goto too_small;
-
-            if (yy > yb)
-                yb = yy;
-
-            ++glyph_count;
-        }
-        // Okay, the texture size is enough for holding our glyphs
-        break;
-
-    too_small:
-        texsize *= 2;
-    }
 
-    return glyph_count ? texsize : 0;
+    CEGUI_DEFINE_PROPERTY(FreeTypeFont, String,
+        "GlyphAtlas", "This is the name of the glyph atlas shared by fonts "
+        "using the same name.  Empty gives the font a private atlas.",
+        &FreeTypeFont::setGlyphAtlasName, &FreeTypeFont::getGlyphAtlasName, ""
+    );
 }
 
 //----------------------------------------------------------------------------//
 void FreeTypeFont::rasterise(utf32 start_codepoint, utf32 end_codepoint) const
 {
     CodepointMap::iterator s = d_cp_map.lower_bound(start_codepoint);
-    if (s == d_cp_map.end())
+    const CodepointMap::iterator e = d_cp_map.upper_bound(end_codepoint);
+    if (s == e)
         return;
 
-    CodepointMap::iterator orig_s = s;
-    CodepointMap::iterator e = d_cp_map.upper_bound(end_codepoint);
-    while (true)
+    if (!d_glyphAtlas)
+        d_glyphAtlas = &GlyphAtlas::acquire(d_glyphAtlasName.empty() ?
+            d_name + "_auto_glyph_atlas" : d_glyphAtlasName);
+
+    // buffer re-used for the imagery of each glyph
+    std::vector<argb_t CEGUI_VECTOR_ALLOC(argb_t)> glyph_buffer;
+
+    for (; s != e; ++s)
     {
-        // Create a new Imageset for glyphs
-        uint texsize = getTextureSize(s, e);
-        // If all glyphs were already rendered, do nothing
-        if (!texsize)
-            break;
+        // skip glyphs that are already rendered
+        if (s->second.getImage())
+            continue;
+
+        Texture* texture;
+        Rectf area(0, 0, 0, 0);
+        Vector2f offset(0, 0);
 
-        const String texture_name(d_name + "_auto_glyph_images_" +
-                                   PropertyHelper<int>::toString(s->first));
-        Texture& texture = System::getSingleton().getRenderer()->createTexture(
-            texture_name, Sizef(static_cast<float>(texsize), static_cast<float>(texsize)));
-        d_glyphTextures.push_back(&texture);
-
-        // Create a memory buffer where we will render our glyphs
-        argb_t* mem_buffer = CEGUI_NEW_ARRAY_PT(argb_t, texsize * texsize, BufferAllocator);
-        memset(mem_buffer, 0, texsize * texsize * sizeof(argb_t));
-
-        // Go ahead, line by line, top-left to bottom-right
-        uint x = INTER_GLYPH_PAD_SPACE, y = INTER_GLYPH_PAD_SPACE;
-        uint yb = INTER_GLYPH_PAD_SPACE;
-
-        // Set to true when we finish rendering all glyphs we were asked to
-        bool finished = false;
-        // Set to false when we reach d_cp_map.end() and we start going backward
-        bool forward = true;
-
-        /* To conserve texture space we will render more glyphs than asked,
-         * but never less than asked. First we render all glyphs from s to e
-         * and after that we render glyphs until we reach d_cp_map.end(),
-         * and if there's still free texture space we will go backward
-         * from s until we hit d_cp_map.begin().
-         */
-        while (s != d_cp_map.end())
+        // Render the glyph
+        if (FT_Load_Char(d_fontFace, s->first, FT_LOAD_RENDER | FT_LOAD_FORCE_AUTOHINT |
+                         (d_antiAliased ? FT_LOAD_TARGET_NORMAL : FT_LOAD_TARGET_MONO)))
+        {
+            std::stringstream err;
+            err << "Font::loadFreetypeGlyph - Failed to load glyph for codepoint: ";
+            err << static_cast<unsigned int>(s->first);
+            err << ".  Will use an empty image for this glyph!";
+            Logger::getSingleton().logEvent(err.str().c_str(), Errors);
+
+            // Use a 'null' image for this glyph so we do not seg later
+            d_glyphAtlas->addImage(0, 0, 0, texture, area);
+        }
+        else
         {
-            // Check if we finished rendering all the required glyphs
-            finished |= (s == e);
+            const uint glyph_w = d_fontFace->glyph->bitmap.width;
+            const uint glyph_h = d_fontFace->glyph->bitmap.rows;
+
+            glyph_buffer.assign(glyph_w * glyph_h, 0);
+            if (!glyph_buffer.empty())
+                drawGlyphToBuffer(&glyph_buffer[0], glyph_w);
 
-            // Check if glyph already rendered
-            if (!s->second.getImage())
+            if (!d_glyphAtlas->addImage(glyph_buffer.empty() ? 0 : &glyph_buffer[0],
+                                        glyph_w, glyph_h, texture, area))
             {
-                // Render the glyph
-                if (FT_Load_Char(d_fontFace, s->first, FT_LOAD_RENDER | FT_LOAD_FORCE_AUTOHINT |
-                                 (d_antiAliased ? FT_LOAD_TARGET_NORMAL : FT_LOAD_TARGET_MONO)))
-                {
-                    std::stringstream err;
-                    err << "Font::loadFreetypeGlyph - Failed to load glyph for codepoint: ";
-                    err << static_cast<unsigned int>(s->first);
-                    err << ".  Will use an empty image for this glyph!";
-                    Logger::getSingleton().logEvent(err.str().c_str(), Errors);
-
-                    // Create a 'null' image for this glyph so we do not seg later
-                    Rectf area(0, 0, 0, 0);
-                    Vector2f offset(0, 0);
-                    const String name(PropertyHelper<unsigned long>::toString(s->first));
-                    BasicImage* img =
-                        CEGUI_NEW_AO BasicImage(name, &texture, area, offset, ASM_Disabled,
-                                       d_nativeResolution);
-                    d_glyphImages.push_back(img);
-                    s->second.setImage(img);
-                }
-                else
-                {
-                    uint glyph_w = d_fontFace->glyph->bitmap.width + INTER_GLYPH_PAD_SPACE;
-                    uint glyph_h = d_fontFace->glyph->bitmap.rows + INTER_GLYPH_PAD_SPACE;
-
-                    // Check if glyph right margin does not exceed texture size
-                    uint x_next = x + glyph_w;
-                    if (x_next > texsize)
-                    {
-                        x = INTER_GLYPH_PAD_SPACE;
-                        x_next = x + glyph_w;
-                        y = yb;
-                    }
-
-                    // Check if glyph bottom margine does not exceed texture size
-                    uint y_bot = y + glyph_h;
-                    if (y_bot > texsize)
-                        break;
-
-                    // Copy rendered glyph to memory buffer in RGBA format
-                    drawGlyphToBuffer(mem_buffer + (y * texsize) + x, texsize);
-
-                    // Create a new image in the imageset
-                    const Rectf area(static_cast<float>(x),
-                                      static_cast<float>(y),
-                                      static_cast<float>(x + glyph_w - INTER_GLYPH_PAD_SPACE),
-                                      static_cast<float>(y + glyph_h - INTER_GLYPH_PAD_SPACE));
-
-                    Vector2f offset(d_fontFace->glyph->metrics.horiBearingX * static_cast<float>(FT_POS_COEF),
-                                    -d_fontFace->glyph->metrics.horiBearingY * static_cast<float>(FT_POS_COEF));
-
-                    const String name(PropertyHelper<unsigned long>::toString(s->first));
-                    BasicImage* img =
-                        CEGUI_NEW_AO BasicImage(name, &texture, area, offset, ASM_Disabled,
-                                       d_nativeResolution);
-                    d_glyphImages.push_back(img);
-                    s->second.setImage(img);
-
-                    // Advance to next position
-                    x = x_next;
-                    if (y_bot > yb)
-                    {
-                        yb = y_bot;
-                    }
-                }
+                std::stringstream err;
+                err << "Font::loadFreetypeGlyph - Glyph for codepoint: ";
+                err << static_cast<unsigned int>(s->first);
+                err << " is too large for the glyph atlas.  Will use an empty "
+                       "image for this glyph!";
+                Logger::getSingleton().logEvent(err.str().c_str(), Errors);
             }
 
-            // Go to next glyph, if we are going forward
-            if (forward)
-                if (++s == d_cp_map.end())
-                {
-                    finished = true;
-                    forward = false;
-                    s = orig_s;
-                }
-            // Go to previous glyph, if we are going backward
-            if (!forward)
-                if ((s == d_cp_map.begin()) || (--s == d_cp_map.begin()))
-                    break;
+            offset = Vector2f(d_fontFace->glyph->metrics.horiBearingX * static_cast<float>(FT_POS_COEF),
+                              -d_fontFace->glyph->metrics.horiBearingY * static_cast<float>(FT_POS_COEF));
         }
 
-        // Copy our memory buffer into the texture and free it
-        texture.loadFromMemory(mem_buffer, Sizef(static_cast<float>(texsize), static_cast<float>(texsize)), Texture::PF_RGBA);
-        CEGUI_DELETE_ARRAY_PT(mem_buffer, argb_t, texsize * texsize, BufferAllocator);
-
-        if (finished)
-            break;
+        const String name(PropertyHelper<unsigned long>::toString(s->first));
+        BasicImage* img =
+            CEGUI_NEW_AO BasicImage(name, texture, area, offset, ASM_Disabled,
+                                    d_nativeResolution);
+        d_glyphImages.push_back(img);
+        s->second.setImage(img);
     }
+
+    // Upload the newly rendered glyphs to the atlas texture(s)
+    d_glyphAtlas->flush();
 }
 
 //----------------------------------------------------------------------------//
@@ -358,15 +244,26 @@ void FreeTypeFont::free()
     if (!d_fontFace)
         return;
 
+    invalidateTextLayoutCache();
+    invalidateGlyphPageIndex();
     d_cp_map.clear();
 
     for (size_t i = 0; i < d_glyphImages.size(); ++i)
+    {
+        // the atlas may be shared, so return the space to it for reuse.
+        if (d_glyphAtlas && d_glyphImages[i]->getTexture())
+            d_glyphAtlas->freeImage(*d_glyphImages[i]->getTexture(),
+                                    d_glyphImages[i]->getArea());
+
         CEGUI_DELETE_AO d_glyphImages[i];
+    }
     d_glyphImages.clear();
 
-    for (size_t i = 0; i < d_glyphTextures.size(); i++)
-        System::getSingleton().getRenderer()->destroyTexture(*d_glyphTextures[i]);
-    d_glyphTextures.clear();
+    if (d_glyphAtlas)
+    {
+        GlyphAtlas::release(*d_glyphAtlas);
+        d_glyphAtlas = 0;
+    }
 
     FT_Done_Face(d_fontFace);
     d_fontFace = 0;
@@ -514,6 +411,22 @@ void FreeTypeFont::initialiseFontGlyph(CodepointMap::iterator cp) const
     cp->second.setValid(true);
 }
 
+//----------------------------------------------------------------------------//
+float FreeTypeFont::getKerning(utf32 left, utf32 right, float x_scale) const
+{
+    if (!d_fontFace || !FT_HAS_KERNING(d_fontFace))
+        return 0.0f;
+
+    FT_Vector kerning;
+    if (FT_Get_Kerning(d_fontFace,
+                       FT_Get_Char_Index(d_fontFace, left),
+                       FT_Get_Char_Index(d_fontFace, right),
+                       FT_KERNING_DEFAULT, &kerning))
+        return 0.0f;
+
+    return kerning.x * static_cast<float>(FT_POS_COEF) * x_scale;
+}
+
 //----------------------------------------------------------------------------//
 void FreeTypeFont::writeXMLToStream_impl(XMLSerializer& xml_stream) const
 {
@@ -565,6 +478,32 @@ void FreeTypeFont::setAntiAliased(const bool anti_alaised)
     onRenderSizeChanged(args);
 }
 
+//----------------------------------------------------------------------------//
+void FreeTypeFont::setGlyphAtlasName(const String& name)
+{
+    if (name == d_glyphAtlasName)
+        return;
+
+    d_glyphAtlasName = name;
+    // existing glyph images reference the old atlas textures
+    updateFont();
+
+    FontEventArgs args(this);
+    onRenderSizeChanged(args);
+}
+
+//----------------------------------------------------------------------------//
+const String& FreeTypeFont::getGlyphAtlasName() const
+{
+    return d_glyphAtlasName;
+}
+
+//----------------------------------------------------------------------------//
+const GlyphAtlas* FreeTypeFont::getGlyphAtlas() const
+{
+    return d_glyphAtlas;
+}
+
 //----------------------------------------------------------------------------//
 
 } // End of  CEGUI namespace section
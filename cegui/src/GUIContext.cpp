@@ -91,6 +91,10 @@ GUIContext::GUIContext(RenderTarget& target) :
     d_weCreatedTooltipObject(false),
     d_defaultFont(0),
     d_surfaceSize(target.getArea().getSize()),
+    d_hitTestIndexEnabled(false),
+    d_partialRedrawEnabled(false),
+    d_autoCachingThreshold(0),
+    d_idleUpdateSkippingEnabled(false),
     d_modalWindow(0),
     d_captureWindow(0),
     d_mouseClickTrackers(new MouseClickTracker[MouseButtonCount]),
@@ -310,6 +314,16 @@ void GUIContext::drawWindowContentToTarget()
 //----------------------------------------------------------------------------//
 void GUIContext::renderWindowHierarchyToSurfaces()
 {
+    // surfaces are enabled and released before rendering, so that the content
+    // rendered is already arranged the way it will be drawn.
+    if (d_autoCachingThreshold)
+    {
+        const size_t child_count = d_rootWindow->getChildCount();
+        for (size_t i = 0; i < child_count; ++i)
+            d_rootWindow->getChildAtIdx(i)->updateAutoCaching(
+                d_autoCachingThreshold);
+    }
+
     RenderingSurface& rs = d_rootWindow->getTargetRenderingSurface();
     rs.clearGeometry();
 
@@ -526,6 +540,58 @@ void GUIContext::updateWindowContainingMouse()
     d_windowContainingMouseIsUpToDate = false;
 }
 
+//----------------------------------------------------------------------------//
+void GUIContext::setHitTestIndexEnabled(bool setting)
+{
+    if (d_hitTestIndexEnabled == setting)
+        return;
+
+    d_hitTestIndexEnabled = setting;
+    updateWindowContainingMouse();
+}
+
+//----------------------------------------------------------------------------//
+bool GUIContext::isHitTestIndexEnabled() const
+{
+    return d_hitTestIndexEnabled;
+}
+
+//----------------------------------------------------------------------------//
+void GUIContext::setPartialRedrawEnabled(bool setting)
+{
+    d_partialRedrawEnabled = setting;
+}
+
+//----------------------------------------------------------------------------//
+bool GUIContext::isPartialRedrawEnabled() const
+{
+    return d_partialRedrawEnabled;
+}
+
+//----------------------------------------------------------------------------//
+void GUIContext::setAutoCachingThreshold(uint redraws)
+{
+    d_autoCachingThreshold = redraws;
+}
+
+//----------------------------------------------------------------------------//
+uint GUIContext::getAutoCachingThreshold() const
+{
+    return d_autoCachingThreshold;
+}
+
+//----------------------------------------------------------------------------//
+void GUIContext::setIdleUpdateSkippingEnabled(bool setting)
+{
+    d_idleUpdateSkippingEnabled = setting;
+}
+
+//----------------------------------------------------------------------------//
+bool GUIContext::isIdleUpdateSkippingEnabled() const
+{
+    return d_idleUpdateSkippingEnabled;
+}
+
 //----------------------------------------------------------------------------//
 bool GUIContext::updateWindowContainingMouse_impl() const
 {
@@ -630,8 +696,9 @@ Window* GUIContext::getTargetWindow(const Vector2f& pt,
 
     if (!dest_window)
     {
-        dest_window = d_rootWindow->
-            getTargetChildAtPosition(pt, allow_disabled);
+        dest_window = d_rootWindow->getChildAtPosition(
+            pt, &Window::isHitTargetWindow, allow_disabled,
+            d_hitTestIndexEnabled);
 
         if (!dest_window)
             dest_window = d_rootWindow;
@@ -640,8 +707,9 @@ Window* GUIContext::getTargetWindow(const Vector2f& pt,
     {
         if (dest_window->distributesCapturedInputs())
         {
-            Window* child_window = dest_window->
-                getTargetChildAtPosition(pt, allow_disabled);
+            Window* child_window = dest_window->getChildAtPosition(
+                pt, &Window::isHitTargetWindow, allow_disabled,
+                d_hitTestIndexEnabled);
 
             if (child_window)
                 dest_window = child_window;
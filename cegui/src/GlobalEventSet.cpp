@@ -26,6 +26,7 @@
  *   OTHER DEALINGS IN THE SOFTWARE.
  ***************************************************************************/
 #include "CEGUI/GlobalEventSet.h"
+#include "CEGUI/EventID.h"
 #include "CEGUI/Logger.h"
 
 
@@ -41,7 +42,9 @@ namespace CEGUI
 	/*************************************************************************
 		GlobalEventSet constructor.
 	*************************************************************************/
-	GlobalEventSet::GlobalEventSet()
+	GlobalEventSet::GlobalEventSet() :
+        d_indexedEventsGeneration(0),
+        d_indexedEventIDCount(0)
 	{
         char addr_buff[32];
         sprintf(addr_buff, "(%p)", static_cast<void*>(this));
@@ -81,6 +84,16 @@ namespace CEGUI
 	*************************************************************************/
 	void GlobalEventSet::fireEvent(const String& name, EventArgs& args, const String& eventNamespace)
 	{
+        // quick outs for when nothing is subscribed in the given namespace.
+        if (d_events.empty())
+            return;
+
+        updateEventIndex();
+
+        if (d_namespaceEventCounts.find(eventNamespace) ==
+                d_namespaceEventCounts.end())
+            return;
+
         // here we are very explicit about how we construct the event string.
         // Doing it 'longhand' like this saves significant time when compared
         // to the obvious - and previous - implementation:
@@ -93,4 +106,68 @@ namespace CEGUI
         fireEvent_impl(evt_name, args);
 	}
 
+    //------------------------------------------------------------------------//
+    void GlobalEventSet::fireEvent(const EventID& id, EventArgs& args)
+    {
+        if (d_events.empty() || d_muted)
+            return;
+
+        updateEventIndex();
+
+        const uint value = id.getValue();
+
+        if (value < d_eventIndex.size() && d_eventIndex[value])
+            (*d_eventIndex[value])(args);
+    }
+
+    //------------------------------------------------------------------------//
+    bool GlobalEventSet::isEventPresent(const EventID& id)
+    {
+        if (d_events.empty())
+            return false;
+
+        updateEventIndex();
+
+        const uint value = id.getValue();
+        return value < d_eventIndex.size() && d_eventIndex[value] != 0;
+    }
+
+    //------------------------------------------------------------------------//
+    bool GlobalEventSet::isEventSubscribed(const EventID& id)
+    {
+        if (!isEventPresent(id))
+            return false;
+
+        return d_eventIndex[id.getValue()]->getConnectionCount() != 0;
+    }
+
+    //------------------------------------------------------------------------//
+    void GlobalEventSet::updateEventIndex()
+    {
+        const uint id_count = EventID::getCount();
+
+        if (d_indexedEventsGeneration == d_eventsGeneration &&
+            d_indexedEventIDCount == id_count)
+                return;
+
+        d_eventIndex.assign(id_count, static_cast<Event*>(0));
+        d_namespaceEventCounts.clear();
+
+        for (EventMap::const_iterator it = d_events.begin();
+             it != d_events.end(); ++it)
+        {
+            const String::size_type sep = it->first.rfind('/');
+
+            if (sep != String::npos)
+                ++d_namespaceEventCounts[it->first.substr(0, sep)];
+
+            uint value;
+            if (EventID::findValue(it->first, value))
+                d_eventIndex[value] = it->second;
+        }
+
+        d_indexedEventsGeneration = d_eventsGeneration;
+        d_indexedEventIDCount = id_count;
+    }
+
 } // End of  CEGUI namespace section
@@ -0,0 +1,515 @@
+/***********************************************************************
+    filename:   GlyphAtlas.cpp
+    created:    18/10/2026
+
+    purpose:    Implements the GlyphAtlas class
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2013 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/GlyphAtlas.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Texture.h"
+#include "CEGUI/PropertyHelper.h"
+#include <map>
+#include <algorithm>
+#include <cstring>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+// Pixels to put between images (and around the texture edges)
+#define GLYPH_ATLAS_PADDING 2
+// Size of the first atlas texture; each further texture doubles the size
+#define GLYPH_ATLAS_INITIAL_SIZE 512
+
+//----------------------------------------------------------------------------//
+typedef std::map<String, GlyphAtlas*, StringFastLessCompare
+    CEGUI_MAP_ALLOC(String, GlyphAtlas*)> GlyphAtlasRegistry;
+
+//----------------------------------------------------------------------------//
+static GlyphAtlasRegistry& getGlyphAtlasRegistry()
+{
+    static GlyphAtlasRegistry registry;
+    return registry;
+}
+
+//----------------------------------------------------------------------------//
+GlyphAtlas& GlyphAtlas::acquire(const String& name)
+{
+    GlyphAtlasRegistry& registry = getGlyphAtlasRegistry();
+    GlyphAtlasRegistry::iterator i = registry.find(name);
+
+    if (i == registry.end())
+        i = registry.insert(
+            std::make_pair(name, CEGUI_NEW_AO GlyphAtlas(name))).first;
+
+    ++i->second->d_refCount;
+    return *i->second;
+}
+
+//----------------------------------------------------------------------------//
+void GlyphAtlas::release(GlyphAtlas& atlas)
+{
+    if (--atlas.d_refCount)
+        return;
+
+    getGlyphAtlasRegistry().erase(atlas.d_name);
+    CEGUI_DELETE_AO &atlas;
+}
+
+//----------------------------------------------------------------------------//
+bool GlyphAtlas::isAtlasPresent(const String& name)
+{
+    return getGlyphAtlasRegistry().find(name) != getGlyphAtlasRegistry().end();
+}
+
+//----------------------------------------------------------------------------//
+GlyphAtlas::GlyphAtlas(const String& name) :
+    d_name(name),
+    d_refCount(0),
+    d_maxTextureSize(System::getSingleton().getRenderer()->getMaxTextureSize()),
+    d_imageCount(0),
+    d_usedArea(0)
+{
+}
+
+//----------------------------------------------------------------------------//
+GlyphAtlas::~GlyphAtlas()
+{
+    for (size_t i = 0; i < d_pages.size(); ++i)
+        System::getSingleton().getRenderer()->destroyTexture(*d_pages[i].d_texture);
+}
+
+//----------------------------------------------------------------------------//
+const String& GlyphAtlas::getName() const
+{
+    return d_name;
+}
+
+//----------------------------------------------------------------------------//
+bool GlyphAtlas::addImage(const argb_t* pixels, uint width, uint height,
+                          Texture*& texture, Rectf& area)
+{
+    Page* page = d_pages.empty() ? &addPage() : &d_pages.back();
+
+    texture = page->d_texture;
+    area = Rectf(0, 0, 0, 0);
+
+    if (!width || !height)
+        return true;
+
+    const uint padded_width = width + GLYPH_ATLAS_PADDING;
+    const uint padded_height = height + GLYPH_ATLAS_PADDING;
+
+    if (padded_width + GLYPH_ATLAS_PADDING > d_maxTextureSize ||
+        padded_height + GLYPH_ATLAS_PADDING > d_maxTextureSize)
+            return false;
+
+    uint x, y;
+    size_t page_idx, region_idx;
+    if (findFreeRegion(padded_width, padded_height, page_idx, region_idx))
+    {
+        page = &d_pages[page_idx];
+        const FreeRegion region = page->d_freeRegions[region_idx];
+        page->d_freeRegions.erase(page->d_freeRegions.begin() + region_idx);
+        x = region.d_x;
+        y = region.d_y;
+
+        // the rest of the region remains free, to the right of and below
+        // the new image.
+        if (region.d_width - padded_width > GLYPH_ATLAS_PADDING)
+        {
+            const FreeRegion right = {x + padded_width, y,
+                                      region.d_width - padded_width,
+                                      padded_height};
+            page->d_freeRegions.push_back(right);
+        }
+        if (region.d_height - padded_height > GLYPH_ATLAS_PADDING)
+        {
+            const FreeRegion below = {x, y + padded_height, region.d_width,
+                                      region.d_height - padded_height};
+            page->d_freeRegions.push_back(below);
+        }
+
+        // the whole region is uploaded, so that no part of the image
+        // previously held there remains visible around the new one.
+        stageImage(*page, x, y, region.d_width - GLYPH_ATLAS_PADDING,
+                   region.d_height - GLYPH_ATLAS_PADDING,
+                   pixels, width, height);
+    }
+    else
+    {
+        size_t node;
+        // a new page is at least as large as the current one, and the
+        // largest possible page always has room for the image, so this
+        // terminates.
+        while (!findPosition(*page, padded_width, padded_height, x, y, node))
+            page = &addPage();
+
+        placeRegion(*page, node, x, y, padded_width, padded_height);
+        stageImage(*page, x, y, width, height, pixels, width, height);
+    }
+
+    ++page->d_imageCount;
+    ++d_imageCount;
+    d_usedArea += padded_width * padded_height;
+
+    texture = page->d_texture;
+    area = Rectf(static_cast<float>(x), static_cast<float>(y),
+                 static_cast<float>(x + width), static_cast<float>(y + height));
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void GlyphAtlas::flush()
+{
+    for (size_t i = 0; i < d_pages.size(); ++i)
+        flushPage(d_pages[i]);
+}
+
+//----------------------------------------------------------------------------//
+size_t GlyphAtlas::getTextureCount() const
+{
+    return d_pages.size();
+}
+
+//----------------------------------------------------------------------------//
+Texture& GlyphAtlas::getTexture(size_t index) const
+{
+    if (index >= d_pages.size())
+        CEGUI_THROW(InvalidRequestException(
+            "The texture index " + PropertyHelper<uint>::toString(static_cast<uint>(index)) +
+            " is out of range for GlyphAtlas '" + d_name + "'."));
+
+    return *d_pages[index].d_texture;
+}
+
+//----------------------------------------------------------------------------//
+void GlyphAtlas::freeImage(const Texture& texture, const Rectf& area)
+{
+    const uint width = static_cast<uint>(area.getWidth());
+    const uint height = static_cast<uint>(area.getHeight());
+
+    // empty images take no space in the atlas.
+    if (!width || !height)
+        return;
+
+    size_t i = 0;
+    while (i < d_pages.size() && d_pages[i].d_texture != &texture)
+        ++i;
+
+    if (i == d_pages.size())
+        CEGUI_THROW(InvalidRequestException(
+            "The texture '" + texture.getName() + "' is not a texture of "
+            "GlyphAtlas '" + d_name + "'."));
+
+    Page& page = d_pages[i];
+    const uint padded_width = width + GLYPH_ATLAS_PADDING;
+    const uint padded_height = height + GLYPH_ATLAS_PADDING;
+
+    --d_imageCount;
+    d_usedArea -= padded_width * padded_height;
+
+    if (!--page.d_imageCount)
+    {
+        resetPage(page);
+        return;
+    }
+
+    const FreeRegion region = {static_cast<uint>(area.left()),
+                               static_cast<uint>(area.top()),
+                               padded_width, padded_height};
+    page.d_freeRegions.push_back(region);
+}
+
+//----------------------------------------------------------------------------//
+size_t GlyphAtlas::getImageCount() const
+{
+    return d_imageCount;
+}
+
+//----------------------------------------------------------------------------//
+size_t GlyphAtlas::getUsedArea() const
+{
+    return d_usedArea;
+}
+
+//----------------------------------------------------------------------------//
+size_t GlyphAtlas::getTotalArea() const
+{
+    size_t area = 0;
+    for (size_t i = 0; i < d_pages.size(); ++i)
+        area += d_pages[i].d_size * d_pages[i].d_size;
+
+    return area;
+}
+
+//----------------------------------------------------------------------------//
+float GlyphAtlas::getOccupancy() const
+{
+    const size_t total = getTotalArea();
+    return total ? static_cast<float>(d_usedArea) / total : 0.0f;
+}
+
+//----------------------------------------------------------------------------//
+uint GlyphAtlas::getReferenceCount() const
+{
+    return d_refCount;
+}
+
+//----------------------------------------------------------------------------//
+GlyphAtlas::Page& GlyphAtlas::addPage()
+{
+    // textures are never resized (that would invalidate geometry already
+    // built using them), so each new page is made larger instead.
+    const uint size = d_pages.empty() ?
+        static_cast<uint>(GLYPH_ATLAS_INITIAL_SIZE) : d_pages.back().d_size * 2;
+
+    Page page;
+    page.d_size = ceguimin(size, d_maxTextureSize);
+
+    const String texture_name(d_name + "_" +
+        PropertyHelper<uint>::toString(static_cast<uint>(d_pages.size())));
+    page.d_texture = &System::getSingleton().getRenderer()->createTexture(
+        texture_name, Sizef(static_cast<float>(page.d_size),
+                            static_cast<float>(page.d_size)));
+
+    page.d_imageCount = 0;
+    resetPage(page);
+
+    d_pages.push_back(page);
+    return d_pages.back();
+}
+
+//----------------------------------------------------------------------------//
+void GlyphAtlas::resetPage(Page& page)
+{
+    const SkylineNode node = {GLYPH_ATLAS_PADDING, GLYPH_ATLAS_PADDING,
+                              page.d_size - GLYPH_ATLAS_PADDING};
+    Skyline(1, node).swap(page.d_skyline);
+    FreeRegionList().swap(page.d_freeRegions);
+    PendingImageList().swap(page.d_pendingImages);
+    PixelBuffer().swap(page.d_pendingPixels);
+
+    // content of a newly created texture is undefined, and that of a reset
+    // one stale, so upload all of it.
+    page.d_reload = true;
+}
+
+//----------------------------------------------------------------------------//
+bool GlyphAtlas::findFreeRegion(uint width, uint height,
+                                size_t& page, size_t& region) const
+{
+    size_t best_area = 0;
+
+    for (size_t i = 0; i < d_pages.size(); ++i)
+    {
+        const FreeRegionList& regions = d_pages[i].d_freeRegions;
+
+        for (size_t j = 0; j < regions.size(); ++j)
+        {
+            if (regions[j].d_width < width || regions[j].d_height < height)
+                continue;
+
+            const size_t area = regions[j].d_width * regions[j].d_height;
+            if (!best_area || area < best_area)
+            {
+                best_area = area;
+                page = i;
+                region = j;
+            }
+        }
+    }
+
+    return best_area != 0;
+}
+
+//----------------------------------------------------------------------------//
+void GlyphAtlas::stageImage(Page& page, uint x, uint y, uint width,
+                            uint height, const argb_t* pixels,
+                            uint pixels_width, uint pixels_height)
+{
+    const PendingImage pending = {x, y, width, height,
+                                  page.d_pendingPixels.size()};
+    page.d_pendingImages.push_back(pending);
+
+    // the image is placed at the top left of the area, which is otherwise
+    // cleared.
+    PixelBuffer& buffer = page.d_pendingPixels;
+    buffer.resize(pending.d_offset + width * height, 0);
+
+    for (uint row = 0; row < pixels_height; ++row)
+        std::copy(pixels + row * pixels_width,
+                  pixels + (row + 1) * pixels_width,
+                  buffer.begin() + pending.d_offset + row * width);
+}
+
+//----------------------------------------------------------------------------//
+bool GlyphAtlas::findPosition(const Page& page, uint width, uint height,
+                              uint& x, uint& y, size_t& node) const
+{
+    const Skyline& skyline = page.d_skyline;
+    uint best_bottom = page.d_size + 1;
+    uint best_width = 0;
+    bool found = false;
+
+    for (size_t i = 0; i < skyline.size(); ++i)
+    {
+        const uint left = skyline[i].d_x;
+
+        // nodes are ordered by x, so no later node can fit either.
+        if (left + width > page.d_size)
+            break;
+
+        // find the highest skyline point under the span
+        uint top = 0;
+        uint remaining = width;
+        for (size_t j = i; ; ++j)
+        {
+            top = ceguimax(top, skyline[j].d_y);
+
+            if (skyline[j].d_width >= remaining)
+                break;
+
+            remaining -= skyline[j].d_width;
+        }
+
+        const uint bottom = top + height;
+        if (bottom > page.d_size)
+            continue;
+
+        if (bottom < best_bottom ||
+            (bottom == best_bottom && skyline[i].d_width < best_width))
+        {
+            best_bottom = bottom;
+            best_width = skyline[i].d_width;
+            x = left;
+            y = top;
+            node = i;
+            found = true;
+        }
+    }
+
+    return found;
+}
+
+//----------------------------------------------------------------------------//
+void GlyphAtlas::placeRegion(Page& page, size_t node, uint x, uint y,
+                             uint width, uint height)
+{
+    Skyline& skyline = page.d_skyline;
+
+    const SkylineNode new_node = {x, y + height, width};
+    skyline.insert(skyline.begin() + node, new_node);
+
+    // trim or remove the nodes now lying under the new one
+    const uint right = x + width;
+    for (size_t i = node + 1; i < skyline.size(); )
+    {
+        SkylineNode& current = skyline[i];
+
+        if (current.d_x >= right)
+            break;
+
+        const uint overlap = right - current.d_x;
+        if (current.d_width <= overlap)
+            skyline.erase(skyline.begin() + i);
+        else
+        {
+            current.d_x += overlap;
+            current.d_width -= overlap;
+            break;
+        }
+    }
+
+    // merge neighbouring nodes at the same height
+    for (size_t i = 0; i + 1 < skyline.size(); )
+    {
+        if (skyline[i].d_y == skyline[i + 1].d_y)
+        {
+            skyline[i].d_width += skyline[i + 1].d_width;
+            skyline.erase(skyline.begin() + i + 1);
+        }
+        else
+            ++i;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void GlyphAtlas::flushPage(Page& page)
+{
+    const PendingImageList& images = page.d_pendingImages;
+    const argb_t* const pixels =
+        page.d_pendingPixels.empty() ? 0 : &page.d_pendingPixels[0];
+
+    if (page.d_reload)
+    {
+        // build the initial texture content in a temporary buffer
+        const size_t pixel_count = page.d_size * page.d_size;
+        argb_t* buffer = CEGUI_NEW_ARRAY_PT(argb_t, pixel_count, BufferAllocator);
+        memset(buffer, 0, pixel_count * sizeof(argb_t));
+
+        for (size_t i = 0; i < images.size(); ++i)
+        {
+            const PendingImage& image = images[i];
+            for (uint row = 0; row < image.d_height; ++row)
+                memcpy(buffer + (image.d_y + row) * page.d_size + image.d_x,
+                       pixels + image.d_offset + row * image.d_width,
+                       image.d_width * sizeof(argb_t));
+        }
+
+        page.d_texture->loadFromMemory(buffer,
+                                       Sizef(static_cast<float>(page.d_size),
+                                             static_cast<float>(page.d_size)),
+                                       Texture::PF_RGBA);
+
+        CEGUI_DELETE_ARRAY_PT(buffer, argb_t, pixel_count, BufferAllocator);
+        page.d_reload = false;
+    }
+    else
+    {
+        // the area around the new images may already hold other images, so
+        // each one is uploaded individually.
+        for (size_t i = 0; i < images.size(); ++i)
+        {
+            const PendingImage& image = images[i];
+            page.d_texture->blitFromMemory(pixels + image.d_offset,
+                Rectf(static_cast<float>(image.d_x),
+                      static_cast<float>(image.d_y),
+                      static_cast<float>(image.d_x + image.d_width),
+                      static_cast<float>(image.d_y + image.d_height)));
+        }
+    }
+
+    // release the staging memory, not just its content.
+    PendingImageList().swap(page.d_pendingImages);
+    PixelBuffer().swap(page.d_pendingPixels);
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
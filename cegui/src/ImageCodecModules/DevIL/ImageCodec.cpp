@@ -29,7 +29,9 @@
  ***************************************************************************/
 #include "CEGUI/ImageCodecModules/DevIL/ImageCodec.h"
 #include "CEGUI/Size.h"
+#include "CEGUI/DecodedImageCache.h"
 #include "CEGUI/Exceptions.h"
+#include "CEGUI/System.h"
 #include <IL/il.h>
 #include <string.h>
 
@@ -55,6 +57,10 @@ DevILImageCodec::~DevILImageCodec()
 //----------------------------------------------------------------------------//
 Texture* DevILImageCodec::load(const RawDataContainer& data, Texture* result)
 {
+    DecodedImageCache& cache(System::getSingleton().getDecodedImageCache());
+    if (cache.load(data, *result))
+        return result;
+
     ilPushAttrib(IL_ORIGIN_SET);
     ilOriginFunc(IL_ORIGIN_UPPER_LEFT);
     ilEnable(IL_ORIGIN_SET);
@@ -127,7 +133,8 @@ Texture* DevILImageCodec::load(const RawDataContainer& data, Texture* result)
         // create cegui texture
         CEGUI_TRY
         {
-            result->loadFromMemory(pixel_data, Sizef(width, height), cefmt);
+            cache.loadAndStore(data, pixel_data, Sizef(width, height), cefmt,
+                               *result);
         }
         CEGUI_CATCH(...)
         {
@@ -27,10 +27,12 @@ purpose:	This codec provide FreeImage based image loading
  *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
  *   OTHER DEALINGS IN THE SOFTWARE.
  ***************************************************************************/
+#include "CEGUI/DecodedImageCache.h"
 #include "CEGUI/Exceptions.h"
 #include "CEGUI/ImageCodecModules/FreeImage/ImageCodec.h"
 #include "CEGUI/Logger.h"
 #include "CEGUI/Size.h"
+#include "CEGUI/System.h"
 
 #include <FreeImage.h>
 
@@ -78,6 +80,10 @@ FreeImageImageCodec::~FreeImageImageCodec()
 
 Texture* FreeImageImageCodec::load(const RawDataContainer& data, Texture* result)
 {
+    DecodedImageCache& cache(System::getSingleton().getDecodedImageCache());
+    if (cache.load(data, *result))
+        return result;
+
     int len = (int)data.getSize();
     FIMEMORY *mem = 0;
     FIBITMAP *img = 0;
@@ -159,7 +165,8 @@ Texture* FreeImageImageCodec::load(const RawDataContainer& data, Texture* result
         FreeImage_Unload(img);
         img = 0;
 
-        result->loadFromMemory(rawBuf, Sizef(width, height), Texture::PF_RGBA);
+        cache.loadAndStore(data, rawBuf, Sizef(width, height), Texture::PF_RGBA,
+                           *result);
         delete [] rawBuf;
         retval = result;
     }
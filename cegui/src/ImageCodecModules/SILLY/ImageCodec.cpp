@@ -27,11 +27,13 @@
  *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
  *   OTHER DEALINGS IN THE SOFTWARE.
  ***************************************************************************/
+#include "CEGUI/DecodedImageCache.h"
 #include "CEGUI/Exceptions.h"
 #include "CEGUI/ImageCodecModules/SILLY/ImageCodec.h"
 #include <SILLY.h>
 #include "CEGUI/Logger.h"
 #include "CEGUI/Size.h"
+#include "CEGUI/System.h"
 
 // Start of CEGUI namespace section
 namespace CEGUI
@@ -52,6 +54,10 @@ SILLYImageCodec::~SILLYImageCodec()
 
 Texture* SILLYImageCodec::load(const RawDataContainer& data, Texture* result)
 {
+    DecodedImageCache& cache(System::getSingleton().getDecodedImageCache());
+    if (cache.load(data, *result))
+        return result;
+
     SILLY::MemoryDataSource md(static_cast<const SILLY::byte*>(data.getDataPtr()), data.getSize());
     SILLY::Image img(md);
     if (!img.loadImageHeader())
@@ -84,8 +90,9 @@ Texture* SILLYImageCodec::load(const RawDataContainer& data, Texture* result)
         return 0;
     }
 
-    result->loadFromMemory(img.getPixelsDataPtr(),
-                           Sizef(static_cast<float>(img.getWidth()), static_cast<float>(img.getHeight())), cefmt);
+    cache.loadAndStore(data, img.getPixelsDataPtr(),
+                       Sizef(static_cast<float>(img.getWidth()), static_cast<float>(img.getHeight())), cefmt,
+                       *result);
     return result;
 }
 
@@ -27,10 +27,12 @@
  *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
  *   OTHER DEALINGS IN THE SOFTWARE.
  ***************************************************************************/
+#include "CEGUI/DecodedImageCache.h"
 #include "CEGUI/Exceptions.h"
 #include "CEGUI/ImageCodecModules/STB/ImageCodec.h"
 #include "CEGUI/Logger.h"
 #include "CEGUI/Size.h"
+#include "CEGUI/System.h"
 #define STBI_HEADER_FILE_ONLY
 #include "stb_image.cpp"
 
@@ -52,6 +54,10 @@ STBImageCodec::~STBImageCodec()
 //----------------------------------------------------------------------------//
 Texture* STBImageCodec::load(const RawDataContainer& data, Texture* result)
 {
+    DecodedImageCache& cache(System::getSingleton().getDecodedImageCache());
+    if (cache.load(data, *result))
+        return result;
+
     int width, height, comp;
 
     // load image
@@ -85,10 +91,10 @@ Texture* STBImageCodec::load(const RawDataContainer& data, Texture* result)
         return 0;
     }
 
-    result->loadFromMemory(image,
-                           Sizef(static_cast<float>(width),
-                                  static_cast<float>(height)),
-                           format);
+    cache.loadAndStore(data, image,
+                       Sizef(static_cast<float>(width),
+                             static_cast<float>(height)),
+                       format, *result);
 
     // delete temporary image data
     stbi_image_free(image);
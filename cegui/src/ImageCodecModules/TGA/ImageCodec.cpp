@@ -29,8 +29,10 @@
  *   OTHER DEALINGS IN THE SOFTWARE.
  ***************************************************************************/
 #include "CEGUI/ImageCodecModules/TGA/ImageCodec.h"
+#include "CEGUI/DecodedImageCache.h"
 #include "CEGUI/Logger.h"
 #include "CEGUI/Size.h"
+#include "CEGUI/System.h"
 #	define TGA_RGB		 2		// This tells us it's a normal RGB (really BGR) file
 #	define TGA_A		 3		// This tells us it's a ALPHA file
 #	define TGA_RLE		10		// This tells us that the targa is Run-Length Encoded (RLE)
@@ -49,6 +51,11 @@ TGAImageCodec::~TGAImageCodec()
 Texture* TGAImageCodec::load(const RawDataContainer& data, Texture* result)
 {
     Logger::getSingleton().logEvent("TGAImageCodec::load()", Informative);
+
+    DecodedImageCache& cache(System::getSingleton().getDecodedImageCache());
+    if (cache.load(data, *result))
+        return result;
+
     ImageTGA* img = loadTGA(data.getDataPtr(), data.getSize());
     if (img == 0)
     {
@@ -57,7 +64,7 @@ Texture* TGAImageCodec::load(const RawDataContainer& data, Texture* result)
     else 
     {
         Texture::PixelFormat fmt = (img->channels == 3) ? Texture::PF_RGB : Texture::PF_RGBA;
-        result->loadFromMemory(img->data, Sizef(static_cast<float>(img->sizeX), static_cast<float>(img->sizeY)), fmt);
+        cache.loadAndStore(data, img->data, Sizef(static_cast<float>(img->sizeX), static_cast<float>(img->sizeY)), fmt, *result);
         if (img->data)
         {
             delete[] img->data; 
@@ -0,0 +1,83 @@
+/***********************************************************************
+ *    filename:   Interpolator.cpp
+ *    created:    18/10/2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2013 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/Interpolator.h"
+#include "CEGUI/Exceptions.h"
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+// serial to be given to the next interpolator created
+static uint s_nextInterpolatorSerial = 1;
+
+//----------------------------------------------------------------------------//
+Interpolator::Interpolator() :
+    d_serial(s_nextInterpolatorSerial++)
+{
+}
+
+//----------------------------------------------------------------------------//
+uint Interpolator::getSerial() const
+{
+    return d_serial;
+}
+
+//----------------------------------------------------------------------------//
+InterpolatorValue* Interpolator::createValue(const String& /*value*/) const
+{
+    return 0;
+}
+
+//----------------------------------------------------------------------------//
+void Interpolator::applyAbsolute(PropertySet& /*target*/,
+                                 const String& /*property*/,
+                                 const InterpolatorValue& /*value1*/,
+                                 const InterpolatorValue& /*value2*/,
+                                 float /*position*/)
+{
+    CEGUI_THROW(InvalidRequestException(
+        "Interpolator of type '" + getType() + "' does not support "
+        "pre-parsed values."));
+}
+
+//----------------------------------------------------------------------------//
+void Interpolator::applyRelative(PropertySet& /*target*/,
+                                 const String& /*property*/,
+                                 const InterpolatorValue& /*base*/,
+                                 const InterpolatorValue& /*value1*/,
+                                 const InterpolatorValue& /*value2*/,
+                                 float /*position*/)
+{
+    CEGUI_THROW(InvalidRequestException(
+        "Interpolator of type '" + getType() + "' does not support "
+        "pre-parsed values."));
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
+
@@ -30,6 +30,7 @@
 #include "CEGUI/KeyFrame.h"
 #include "CEGUI/AnimationInstance.h"
 #include "CEGUI/Affector.h"
+#include "CEGUI/Interpolator.h"
 #include "CEGUI/Animation_xmlHandler.h"
 #include "CEGUI/XMLSerializer.h"
 #include "CEGUI/PropertyHelper.h"
@@ -45,12 +46,16 @@ KeyFrame::KeyFrame(Affector* parent, float position):
         d_parent(parent),
         d_position(position),
 
-        d_progression(P_Linear)
+        d_progression(P_Linear),
+        d_parsedValueSerial(0),
+        d_parsedValue(0)
 {}
 
 //----------------------------------------------------------------------------//
 KeyFrame::~KeyFrame(void)
-{}
+{
+    invalidateParsedValue();
+}
 
 //----------------------------------------------------------------------------//
 Affector* KeyFrame::getParent() const
@@ -97,6 +102,7 @@ float KeyFrame::getPosition() const
 void KeyFrame::setValue(const String& value)
 {
     d_value = value;
+    invalidateParsedValue();
 }
 
 //----------------------------------------------------------------------------//
@@ -130,6 +136,36 @@ const String& KeyFrame::getValueForAnimation(AnimationInstance* instance) const
     }
 }
 
+//----------------------------------------------------------------------------//
+const InterpolatorValue* KeyFrame::getParsedValueForAnimation(
+    AnimationInstance* instance, Interpolator* interpolator) const
+{
+    if (!d_sourceProperty.empty())
+        return instance->getParsedSavedPropertyValue(d_sourceProperty,
+                                                     interpolator);
+
+    // a null result is cached as well, so unsupported interpolators do not
+    // attempt to parse the value over and over again.  The serial is used
+    // rather than the address, which may be reused by a later interpolator.
+    if (d_parsedValueSerial != interpolator->getSerial())
+    {
+        CEGUI_DELETE_AO d_parsedValue;
+        d_parsedValue = 0;
+        d_parsedValueSerial = interpolator->getSerial();
+        d_parsedValue = interpolator->createValue(d_value);
+    }
+
+    return d_parsedValue;
+}
+
+//----------------------------------------------------------------------------//
+void KeyFrame::invalidateParsedValue()
+{
+    CEGUI_DELETE_AO d_parsedValue;
+    d_parsedValue = 0;
+    d_parsedValueSerial = 0;
+}
+
 //----------------------------------------------------------------------------//
 void KeyFrame::setProgression(Progression p)
 {
@@ -75,8 +75,8 @@ void NamedElement::setName(const String& name)
     }
 
     // log this under informative level
-    Logger::getSingleton().logEvent("Renamed element at: " + getNamePath() +
-                                    " as: " + name, Informative);
+    CEGUI_LOGEVENT("Renamed element at: " + getNamePath() +
+                   " as: " + name, Informative);
 
     d_name = name;
 
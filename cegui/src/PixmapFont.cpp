@@ -111,6 +111,8 @@ void PixmapFont::updateFont()
 {
     const float factor = (d_autoScaled != ASM_Disabled ? d_horzScaling : 1.0f) / d_origHorzScaling;
 
+    invalidateTextLayoutCache();
+
     d_ascender = 0;
     d_descender = 0;
     d_height = 0;
@@ -192,6 +194,9 @@ void PixmapFont::defineMapping(const utf32 codepoint, const String& image_name,
 
     // add glyph to the map
     d_cp_map[codepoint] = glyph;
+
+    invalidateGlyphPageIndex();
+    invalidateTextLayoutCache();
 }
 
 //----------------------------------------------------------------------------//
@@ -34,7 +34,11 @@
 #include "CEGUI/Font.h"
 #include "CEGUI/Exceptions.h"
 
+#include <clocale>
+#include <cmath>
 #include <cstdio>
+#include <cstdlib>
+#include <limits>
 #include <sstream>
 
 #ifdef _MSC_VER
@@ -45,6 +49,670 @@
 namespace CEGUI
 {
 
+namespace
+{
+//! significant digits kept when reading a real; any further ones are sticky.
+const int MAX_REAL_DIGITS = 40;
+
+//! powers of ten that are exactly representable as a double.
+const double DOUBLE_POWERS_OF_TEN[] =
+{
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+//! powers of ten that are exactly representable as a float.
+const float FLOAT_POWERS_OF_TEN[] =
+{
+    1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f
+};
+
+//----------------------------------------------------------------------------//
+inline uint32 codePoint(char c)
+{
+    return static_cast<unsigned char>(c);
+}
+
+//----------------------------------------------------------------------------//
+inline uint32 codePoint(utf32 c)
+{
+    return c;
+}
+
+//----------------------------------------------------------------------------//
+inline bool isSpace(uint32 c)
+{
+    return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+//----------------------------------------------------------------------------//
+inline bool isDigit(uint32 c)
+{
+    return c - '0' < 10;
+}
+
+//----------------------------------------------------------------------------//
+inline int hexDigitValue(uint32 c)
+{
+    if (c - '0' < 10)
+        return static_cast<int>(c - '0');
+    if (c - 'A' < 6)
+        return static_cast<int>(c - 'A' + 10);
+    if (c - 'a' < 6)
+        return static_cast<int>(c - 'a' + 10);
+
+    return -1;
+}
+
+//----------------------------------------------------------------------------//
+double powerOfTen(int exponent)
+{
+    if (exponent >= 0 && exponent <= 22)
+        return DOUBLE_POWERS_OF_TEN[exponent];
+
+    return std::pow(10.0, exponent);
+}
+
+//----------------------------------------------------------------------------//
+/*
+    Compute mantissa * 10^exponent directly when both fit the target type
+    exactly, in which case the single rounding step gives the correctly
+    rounded result.  Returns false when the slower path is needed.
+*/
+bool fastDecimalToReal(uint64 mantissa, int exponent, bool is_float,
+                       double& result)
+{
+    if (is_float && mantissa <= (1u << 24) &&
+        exponent >= -10 && exponent <= 10)
+    {
+        const float m = static_cast<float>(mantissa);
+        result = exponent < 0 ? m / FLOAT_POWERS_OF_TEN[-exponent] :
+                                m * FLOAT_POWERS_OF_TEN[exponent];
+        return true;
+    }
+
+    if (mantissa <= (static_cast<uint64>(1) << 53) &&
+        exponent >= -22 && exponent <= 22)
+    {
+        const double m = static_cast<double>(mantissa);
+        result = exponent < 0 ? m / DOUBLE_POWERS_OF_TEN[-exponent] :
+                                m * DOUBLE_POWERS_OF_TEN[exponent];
+        return true;
+    }
+
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+/*
+    Return the value digits * 10^exponent, where digits holds count decimal
+    digits with no leading zeros.  Anything the fast path can not handle goes
+    through strtod using a string with no decimal point, so the current
+    locale is irrelevant.
+*/
+double decimalToReal(const char* digits, int count, int exponent,
+                     bool is_float)
+{
+    double result;
+
+    if (count <= 19)
+    {
+        uint64 mantissa = 0;
+        for (int i = 0; i < count; ++i)
+            mantissa = mantissa * 10 + (digits[i] - '0');
+
+        if (fastDecimalToReal(mantissa, exponent, is_float, result))
+            return result;
+    }
+
+    char text[MAX_REAL_DIGITS + 16];
+    int length = 0;
+    for (int i = 0; i < count; ++i)
+        text[length++] = digits[i];
+
+    text[length++] = 'e';
+    if (exponent < 0)
+    {
+        text[length++] = '-';
+        exponent = -exponent;
+    }
+
+    char exponent_digits[12];
+    int exponent_length = 0;
+    do
+    {
+        exponent_digits[exponent_length++] = static_cast<char>('0' + exponent % 10);
+        exponent /= 10;
+    }
+    while (exponent);
+
+    while (exponent_length)
+        text[length++] = exponent_digits[--exponent_length];
+
+    text[length] = 0;
+
+    return std::strtod(text, 0);
+}
+
+//----------------------------------------------------------------------------//
+//! write the decimal digits of val to digits, returning how many there are.
+int unsignedToDigits(uint64 val, char* digits)
+{
+    char reversed[20];
+    int count = 0;
+    do
+    {
+        reversed[count++] = static_cast<char>('0' + val % 10);
+        val /= 10;
+    }
+    while (val);
+
+    for (int i = 0; i < count; ++i)
+        digits[i] = reversed[count - 1 - i];
+
+    return count;
+}
+
+//----------------------------------------------------------------------------//
+template<typename Char>
+bool matchWordNoCase(const Char*& pos, const Char* end, const char* word)
+{
+    const Char* p = pos;
+    for (; *word; ++word, ++p)
+    {
+        if (p == end || (codePoint(*p) | 0x20) != static_cast<uint32>(*word))
+            return false;
+    }
+
+    pos = p;
+    return true;
+}
+
+}
+
+//----------------------------------------------------------------------------//
+PropertyParser::PropertyParser(const String& str) :
+#if CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UNICODE
+    d_pos(str.ptr()),
+#else
+    d_pos(str.c_str()),
+#endif
+    d_end(d_pos + str.length()),
+    d_failed(false)
+{
+}
+
+//----------------------------------------------------------------------------//
+void PropertyParser::skipWhitespace()
+{
+    while (d_pos != d_end && isSpace(codePoint(*d_pos)))
+        ++d_pos;
+}
+
+//----------------------------------------------------------------------------//
+PropertyParser& PropertyParser::match(const char* pattern)
+{
+    for (; !d_failed && *pattern; ++pattern)
+    {
+        const uint32 c = codePoint(*pattern);
+
+        if (isSpace(c))
+            skipWhitespace();
+        else if (d_pos != d_end && codePoint(*d_pos) == c)
+            ++d_pos;
+        else
+            d_failed = true;
+    }
+
+    return *this;
+}
+
+//----------------------------------------------------------------------------//
+bool PropertyParser::readUnsigned(uint64& val, bool& negative)
+{
+    if (d_failed)
+        return false;
+
+    skipWhitespace();
+
+    const String::value_type* p = d_pos;
+    negative = false;
+    if (p != d_end && (*p == '+' || *p == '-'))
+        negative = *p++ == '-';
+
+    if (p == d_end || !isDigit(codePoint(*p)))
+    {
+        d_failed = true;
+        return false;
+    }
+
+    val = 0;
+    for (; p != d_end && isDigit(codePoint(*p)); ++p)
+        val = val * 10 + (codePoint(*p) - '0');
+
+    d_pos = p;
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+bool PropertyParser::readReal(double& val, bool is_float)
+{
+    if (d_failed)
+        return false;
+
+    skipWhitespace();
+
+    const String::value_type* p = d_pos;
+    bool negative = false;
+    if (p != d_end && (*p == '+' || *p == '-'))
+        negative = *p++ == '-';
+
+    double result;
+
+    if (matchWordNoCase(p, d_end, "infinity") ||
+        matchWordNoCase(p, d_end, "inf"))
+    {
+        result = std::numeric_limits<double>::infinity();
+    }
+    else if (matchWordNoCase(p, d_end, "nan"))
+    {
+        result = std::numeric_limits<double>::quiet_NaN();
+    }
+    else
+    {
+        // significant digits, without leading zeros, plus room for a final
+        // sticky digit standing in for any non-zero digits that were dropped.
+        char digits[MAX_REAL_DIGITS + 1];
+        int count = 0;
+        int exponent = 0;
+        bool any_digits = false;
+        bool dropped_non_zero = false;
+
+        for (; p != d_end && isDigit(codePoint(*p)); ++p)
+        {
+            any_digits = true;
+            const char d = static_cast<char>(codePoint(*p));
+
+            if (count < MAX_REAL_DIGITS)
+            {
+                if (count || d != '0')
+                    digits[count++] = d;
+            }
+            else
+            {
+                ++exponent;
+                dropped_non_zero |= d != '0';
+            }
+        }
+
+        if (p != d_end && *p == '.')
+        {
+            for (++p; p != d_end && isDigit(codePoint(*p)); ++p)
+            {
+                any_digits = true;
+                const char d = static_cast<char>(codePoint(*p));
+
+                if (count < MAX_REAL_DIGITS)
+                {
+                    if (count || d != '0')
+                        digits[count++] = d;
+
+                    --exponent;
+                }
+                else
+                    dropped_non_zero |= d != '0';
+            }
+        }
+
+        if (!any_digits)
+        {
+            d_failed = true;
+            return false;
+        }
+
+        // the exponent is only consumed when it has at least one digit.
+        if (p != d_end && (*p == 'e' || *p == 'E'))
+        {
+            const String::value_type* q = p + 1;
+            bool negative_exponent = false;
+            if (q != d_end && (*q == '+' || *q == '-'))
+                negative_exponent = *q++ == '-';
+
+            if (q != d_end && isDigit(codePoint(*q)))
+            {
+                int value = 0;
+                for (; q != d_end && isDigit(codePoint(*q)); ++q)
+                {
+                    if (value < 100000)
+                        value = value * 10 + static_cast<int>(codePoint(*q) - '0');
+                }
+
+                exponent += negative_exponent ? -value : value;
+                p = q;
+            }
+        }
+
+        if (dropped_non_zero)
+        {
+            digits[count++] = '1';
+            --exponent;
+        }
+
+        result = count ? decimalToReal(digits, count, exponent, is_float) : 0.0;
+    }
+
+    val = negative ? -result : result;
+    d_pos = p;
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+PropertyParser& PropertyParser::read(float& val)
+{
+    double result;
+    if (readReal(result, true))
+        val = static_cast<float>(result);
+
+    return *this;
+}
+
+//----------------------------------------------------------------------------//
+PropertyParser& PropertyParser::read(double& val)
+{
+    readReal(val, false);
+    return *this;
+}
+
+//----------------------------------------------------------------------------//
+PropertyParser& PropertyParser::read(int& val)
+{
+    uint64 result;
+    bool negative;
+    if (readUnsigned(result, negative))
+        val = static_cast<int>(negative ? 0 - result : result);
+
+    return *this;
+}
+
+//----------------------------------------------------------------------------//
+PropertyParser& PropertyParser::read(uint& val)
+{
+    uint64 result;
+    bool negative;
+    if (readUnsigned(result, negative))
+        val = static_cast<uint>(negative ? 0 - result : result);
+
+    return *this;
+}
+
+//----------------------------------------------------------------------------//
+PropertyParser& PropertyParser::read(unsigned long& val)
+{
+    uint64 result;
+    bool negative;
+    if (readUnsigned(result, negative))
+        val = static_cast<unsigned long>(negative ? 0 - result : result);
+
+    return *this;
+}
+
+//----------------------------------------------------------------------------//
+PropertyParser& PropertyParser::read(uint64& val)
+{
+    uint64 result;
+    bool negative;
+    if (readUnsigned(result, negative))
+        val = negative ? 0 - result : result;
+
+    return *this;
+}
+
+//----------------------------------------------------------------------------//
+PropertyParser& PropertyParser::readHex(uint32& val)
+{
+    if (d_failed)
+        return *this;
+
+    skipWhitespace();
+
+    uint32 result = 0;
+    int count = 0;
+    for (; count < 8 && d_pos != d_end; ++count, ++d_pos)
+    {
+        const int digit = hexDigitValue(codePoint(*d_pos));
+        if (digit < 0)
+            break;
+
+        result = (result << 4) | static_cast<uint32>(digit);
+    }
+
+    if (count)
+        val = result;
+    else
+        d_failed = true;
+
+    return *this;
+}
+
+//----------------------------------------------------------------------------//
+void PropertyFormatter::append(char c)
+{
+    if (d_length < sizeof(d_buffer))
+        d_buffer[d_length++] = c;
+}
+
+//----------------------------------------------------------------------------//
+void PropertyFormatter::appendUnsigned(uint64 val)
+{
+    char digits[20];
+    const int count = unsignedToDigits(val, digits);
+
+    for (int i = 0; i < count; ++i)
+        append(digits[i]);
+}
+
+//----------------------------------------------------------------------------//
+/*
+    Finds the shortest digit string that reads back (via the same conversion
+    PropertyParser uses) as the given value by trying increasing precisions,
+    then lays it out the way "%g" would.  Should no precision verify, the
+    value is written with snprintf at full precision instead.
+*/
+void PropertyFormatter::appendReal(double val, bool is_float)
+{
+    if (val != val)
+    {
+        *this << "nan";
+        return;
+    }
+
+    if (val < 0 || (val == 0 && 1.0 / val < 0))
+    {
+        append('-');
+        val = -val;
+    }
+
+    if (val == 0)
+    {
+        append('0');
+        return;
+    }
+
+    if (val > std::numeric_limits<double>::max())
+    {
+        *this << "inf";
+        return;
+    }
+
+    int magnitude = static_cast<int>(std::floor(std::log10(val)));
+    if (powerOfTen(magnitude) > val)
+        --magnitude;
+    else if (powerOfTen(magnitude + 1) <= val)
+        ++magnitude;
+
+    const int max_precision = is_float ? 9 : 17;
+    char digits[20];
+    int count = 0;
+    int exponent = 0;
+
+    for (int precision = 1; precision <= max_precision && !count; ++precision)
+    {
+        const int scale = precision - 1 - magnitude;
+        const double scaled = scale < 0 ? val / powerOfTen(-scale) :
+                                          val * powerOfTen(scale);
+        if (!(scaled < 1e19))
+            break;
+
+        const uint64 mantissa = static_cast<uint64>(scaled + 0.5);
+
+        double back;
+        if (!fastDecimalToReal(mantissa, -scale, is_float, back))
+        {
+            const int length = unsignedToDigits(mantissa, digits);
+            back = decimalToReal(digits, length, -scale, is_float);
+        }
+
+        const bool exact = is_float ?
+            static_cast<float>(back) == static_cast<float>(val) : back == val;
+
+        if (exact)
+        {
+            count = unsignedToDigits(mantissa, digits);
+            exponent = -scale;
+        }
+    }
+
+    if (!count)
+    {
+        char buff[32];
+        snprintf(buff, sizeof(buff), is_float ? "%.9g" : "%.17g", val);
+
+        const char point = std::localeconv()->decimal_point[0];
+        for (const char* c = buff; *c; ++c)
+            append(*c == point ? '.' : *c);
+
+        return;
+    }
+
+    while (count > 1 && digits[count - 1] == '0')
+    {
+        --count;
+        ++exponent;
+    }
+
+    // decimal exponent of the leading digit, as "%g" uses it.
+    const int x = exponent + count - 1;
+
+    if (x < -4 || x >= ceguimax(count, 6))
+    {
+        append(digits[0]);
+        if (count > 1)
+        {
+            append('.');
+            for (int i = 1; i < count; ++i)
+                append(digits[i]);
+        }
+
+        append('e');
+        append(x < 0 ? '-' : '+');
+        const int abs_x = x < 0 ? -x : x;
+        if (abs_x < 10)
+            append('0');
+        appendUnsigned(static_cast<uint64>(abs_x));
+    }
+    else if (x >= 0)
+    {
+        for (int i = 0; i <= x; ++i)
+            append(i < count ? digits[i] : '0');
+
+        if (count > x + 1)
+        {
+            append('.');
+            for (int i = x + 1; i < count; ++i)
+                append(digits[i]);
+        }
+    }
+    else
+    {
+        append('0');
+        append('.');
+        for (int i = -1; i > x; --i)
+            append('0');
+        for (int i = 0; i < count; ++i)
+            append(digits[i]);
+    }
+}
+
+//----------------------------------------------------------------------------//
+PropertyFormatter& PropertyFormatter::operator<<(const char* text)
+{
+    while (*text)
+        append(*text++);
+
+    return *this;
+}
+
+//----------------------------------------------------------------------------//
+PropertyFormatter& PropertyFormatter::operator<<(float val)
+{
+    appendReal(val, true);
+    return *this;
+}
+
+//----------------------------------------------------------------------------//
+PropertyFormatter& PropertyFormatter::operator<<(double val)
+{
+    appendReal(val, false);
+    return *this;
+}
+
+//----------------------------------------------------------------------------//
+PropertyFormatter& PropertyFormatter::operator<<(int val)
+{
+    if (val < 0)
+    {
+        append('-');
+        appendUnsigned(0 - static_cast<uint64>(static_cast<long long>(val)));
+    }
+    else
+        appendUnsigned(static_cast<uint64>(val));
+
+    return *this;
+}
+
+//----------------------------------------------------------------------------//
+PropertyFormatter& PropertyFormatter::operator<<(uint val)
+{
+    appendUnsigned(val);
+    return *this;
+}
+
+//----------------------------------------------------------------------------//
+PropertyFormatter& PropertyFormatter::operator<<(unsigned long val)
+{
+    appendUnsigned(val);
+    return *this;
+}
+
+//----------------------------------------------------------------------------//
+PropertyFormatter& PropertyFormatter::operator<<(uint64 val)
+{
+    appendUnsigned(val);
+    return *this;
+}
+
+//----------------------------------------------------------------------------//
+PropertyFormatter& PropertyFormatter::appendHex(uint32 val)
+{
+    static const char hex_digits[] = "0123456789ABCDEF";
+
+    for (int shift = 28; shift >= 0; shift -= 4)
+        append(hex_digits[(val >> shift) & 0xF]);
+
+    return *this;
+}
+
+//----------------------------------------------------------------------------//
 //----------------------------------------------------------------------------//
 PropertyHelper<Image*>::return_type
 PropertyHelper<Image*>::fromString(const String& str)
@@ -33,6 +33,7 @@
 #include "CEGUI/String.h"
 #include "CEGUI/PropertyHelper.h"
 #include "CEGUI/Exceptions.h"
+#include "CEGUI/TplInterpolators.h"
 #include <limits>
 
 // Start of CEGUI namespace section
@@ -189,6 +190,42 @@ String QuaternionSlerpInterpolator::interpolateRelativeMultiply(
     return Helper::toString(Quaternion::IDENTITY);
 }
 
+//----------------------------------------------------------------------------//
+InterpolatorValue* QuaternionSlerpInterpolator::createValue(
+                                            const String& value) const
+{
+    return CEGUI_NEW_AO TplInterpolatorValue<Quaternion>(
+        Helper::fromString(value));
+}
+
+//----------------------------------------------------------------------------//
+void QuaternionSlerpInterpolator::applyAbsolute(PropertySet& target,
+                                    const String& property,
+                                    const InterpolatorValue& value1,
+                                    const InterpolatorValue& value2,
+                                    float position)
+{
+    target.setProperty<Quaternion>(property, Quaternion::slerp(
+        TplInterpolatorValue<Quaternion>::get(value1),
+        TplInterpolatorValue<Quaternion>::get(value2),
+        position));
+}
+
+//----------------------------------------------------------------------------//
+void QuaternionSlerpInterpolator::applyRelative(PropertySet& target,
+                                    const String& property,
+                                    const InterpolatorValue& base,
+                                    const InterpolatorValue& value1,
+                                    const InterpolatorValue& value2,
+                                    float position)
+{
+    target.setProperty<Quaternion>(property,
+        TplInterpolatorValue<Quaternion>::get(base) * Quaternion::slerp(
+            TplInterpolatorValue<Quaternion>::get(value1),
+            TplInterpolatorValue<Quaternion>::get(value2),
+            position));
+}
+
 //----------------------------------------------------------------------------//
 
 } // End of  CEGUI namespace section
@@ -365,6 +365,12 @@ size_t RenderedStringTextComponent::getSpaceCount() const
 {
     // TODO: The value calculated here is a good candidate for caching.
 
+    // Font::drawText adds no extra spacing for a space the font has no glyph
+    // for, so such spaces must not be counted either.
+    const Font* fnt = getEffectiveFont(0);
+    if (fnt && !fnt->isCodepointAvailable(' '))
+        return 0;
+
     size_t space_count = 0;
 
     // Count the number of spaces in this component.
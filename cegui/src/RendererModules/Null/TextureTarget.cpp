@@ -65,6 +65,17 @@ void NullTextureTarget::clear()
 {
 }
 
+//----------------------------------------------------------------------------//
+bool NullTextureTarget::isPartialClearSupported() const
+{
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void NullTextureTarget::clearArea(const Rectf&)
+{
+}
+
 //----------------------------------------------------------------------------//
 Texture& NullTextureTarget::getTexture() const
 {
@@ -74,10 +85,7 @@ Texture& NullTextureTarget::getTexture() const
 //----------------------------------------------------------------------------//
 void NullTextureTarget::declareRenderSize(const Sizef& sz)
 {
-	Rectf r;
-	r.setSize(sz);
-	r.setPosition(Vector2f(0, 0));
-    setArea(r);
+    setArea(Rectf(Vector2f(0, 0), sz));
 }
 
 //----------------------------------------------------------------------------//
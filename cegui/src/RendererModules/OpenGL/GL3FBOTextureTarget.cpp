@@ -125,6 +125,51 @@ void OpenGL3FBOTextureTarget::clear()
     glClearColor(old_col[0], old_col[1], old_col[2], old_col[3]);
 }
 
+//----------------------------------------------------------------------------//
+bool OpenGL3FBOTextureTarget::isPartialClearSupported() const
+{
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void OpenGL3FBOTextureTarget::clearArea(const Rectf& area)
+{
+    const Rectf clear_area(area.getIntersection(
+        Rectf(Vector2f(0, 0), d_area.getSize())));
+
+    if (clear_area.getWidth() < 1.0f || clear_area.getHeight() < 1.0f)
+        return;
+
+    // save old clear colour and scissor state
+    GLfloat old_col[4];
+    glGetFloatv(GL_COLOR_CLEAR_VALUE, old_col);
+    const GLboolean old_scissor = glIsEnabled(GL_SCISSOR_TEST);
+
+    // remember previously bound FBO to make sure we set it back
+    GLuint previousFBO = 0;
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING,
+            reinterpret_cast<GLint*>(&previousFBO));
+
+    // switch to our FBO
+    glBindFramebuffer(GL_FRAMEBUFFER, d_frameBuffer);
+    // Clear the area, using the scissor to leave the rest untouched.
+    glEnable(GL_SCISSOR_TEST);
+    static_cast<OpenGL3Renderer&>(d_owner).getOpenGLStateChanger()->scissor(
+        static_cast<GLint>(clear_area.left()),
+        static_cast<GLint>(d_area.getHeight() - clear_area.bottom()),
+        static_cast<GLint>(clear_area.getWidth()),
+        static_cast<GLint>(clear_area.getHeight()));
+    glClearColor(0,0,0,0);
+    glClear(GL_COLOR_BUFFER_BIT);
+    // switch back to rendering to the previously bound FBO
+    glBindFramebuffer(GL_FRAMEBUFFER, previousFBO);
+
+    // restore previous clear colour and scissor state
+    glClearColor(old_col[0], old_col[1], old_col[2], old_col[3]);
+    if (!old_scissor)
+        glDisable(GL_SCISSOR_TEST);
+}
+
 //----------------------------------------------------------------------------//
 void OpenGL3FBOTextureTarget::initialiseRenderTexture()
 {
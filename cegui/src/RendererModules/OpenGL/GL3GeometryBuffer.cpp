@@ -55,7 +55,8 @@ OpenGL3GeometryBuffer::OpenGL3GeometryBuffer(OpenGL3Renderer& owner) :
     d_shaderColourLoc(owner.getShaderStandardColourLoc()),
     d_shaderStandardMatrixLoc(owner.getShaderStandardMatrixUniformLoc()),
     d_glStateChanger(owner.getOpenGLStateChanger()),
-    d_bufferSize(0)
+    d_bufferSize(0),
+    d_uploadedVertexCount(0)
 {
     initialiseOpenGLBuffers();
 }
@@ -76,6 +77,10 @@ void OpenGL3GeometryBuffer::draw() const
               static_cast<GLint>(d_clipRect.getWidth()),
               static_cast<GLint>(d_clipRect.getHeight()));
 
+    // upload any geometry that was appended since the last draw
+    if (d_uploadedVertexCount != d_vertices.size())
+        updateOpenGLBuffers();
+
     // apply the transformations we need to use.
     if (!d_matrixValid)
         updateMatrix();
@@ -129,15 +134,16 @@ void OpenGL3GeometryBuffer::draw() const
 void OpenGL3GeometryBuffer::appendGeometry(const Vertex* const vbuff,
     uint vertex_count)
 {
+    // the vbo is updated lazily in draw, so that building a buffer from many
+    // small appends does not re-upload all existing vertices each time.
     OpenGLGeometryBufferBase::appendGeometry(vbuff, vertex_count);
-    updateOpenGLBuffers();
 }
 
 //----------------------------------------------------------------------------//
 void OpenGL3GeometryBuffer::reset()
 {
     OpenGLGeometryBufferBase::reset();
-    updateOpenGLBuffers();
+    d_uploadedVertexCount = 0;
 }
 
 //----------------------------------------------------------------------------//
@@ -182,35 +188,38 @@ void OpenGL3GeometryBuffer::deinitialiseOpenGLBuffers()
 }
 
 //----------------------------------------------------------------------------//
-void OpenGL3GeometryBuffer::updateOpenGLBuffers()
+void OpenGL3GeometryBuffer::updateOpenGLBuffers() const
 {
-    bool needNewBuffer = false;
-    unsigned int vertexCount = d_vertices.size();
+    const GLuint vertexCount = d_vertices.size();
 
-    if(d_bufferSize < vertexCount)
-    {
-        needNewBuffer = true;
-        d_bufferSize = vertexCount;
-    }
+    if (d_uploadedVertexCount == vertexCount)
+        return;
 
     d_glStateChanger->bindBuffer(GL_ARRAY_BUFFER, d_verticesVBO);
 
-    GLsizei dataSize = d_bufferSize * sizeof(GLVertex);
+    if (d_bufferSize < vertexCount)
+    {
+        // grow the buffer geometrically so that buffers which keep getting
+        // geometry appended do not need re-allocating on every draw.
+        d_bufferSize = ceguimax(vertexCount, d_bufferSize * 2);
 
-    GLVertex* data;
-    if(d_vertices.empty())
-        data = 0;
-    else
-        data = &d_vertices[0];
+        glBufferData(GL_ARRAY_BUFFER, d_bufferSize * sizeof(GLVertex), 0,
+                     GL_DYNAMIC_DRAW);
 
-    if(needNewBuffer)
-    {
-        glBufferData(GL_ARRAY_BUFFER, dataSize, data, GL_DYNAMIC_DRAW);
+        // freshly allocated storage: everything needs uploading.
+        d_uploadedVertexCount = 0;
     }
-    else
+
+    // upload only the vertices that are not in the vbo yet.
+    if (d_uploadedVertexCount < vertexCount)
     {
-        glBufferSubData(GL_ARRAY_BUFFER, 0, dataSize, data);
+        glBufferSubData(GL_ARRAY_BUFFER,
+                        d_uploadedVertexCount * sizeof(GLVertex),
+                        (vertexCount - d_uploadedVertexCount) * sizeof(GLVertex),
+                        &d_vertices[d_uploadedVertexCount]);
     }
+
+    d_uploadedVertexCount = vertexCount;
 }
 
 //----------------------------------------------------------------------------//
@@ -122,6 +122,50 @@ void OpenGLFBOTextureTarget::clear()
     glClearColor(old_col[0], old_col[1], old_col[2], old_col[3]);
 }
 
+//----------------------------------------------------------------------------//
+bool OpenGLFBOTextureTarget::isPartialClearSupported() const
+{
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void OpenGLFBOTextureTarget::clearArea(const Rectf& area)
+{
+    const Rectf clear_area(area.getIntersection(
+        Rectf(Vector2f(0, 0), d_area.getSize())));
+
+    if (clear_area.getWidth() < 1.0f || clear_area.getHeight() < 1.0f)
+        return;
+
+    // save old clear colour and scissor state
+    GLfloat old_col[4];
+    glGetFloatv(GL_COLOR_CLEAR_VALUE, old_col);
+    const GLboolean old_scissor = glIsEnabled(GL_SCISSOR_TEST);
+
+    // remember previously bound FBO to make sure we set it back
+    GLuint previousFBO = 0;
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING_EXT,
+            reinterpret_cast<GLint*>(&previousFBO));
+
+    // switch to our FBO
+    glBindFramebufferEXT(GL_FRAMEBUFFER_EXT, d_frameBuffer);
+    // Clear the area, using the scissor to leave the rest untouched.
+    glEnable(GL_SCISSOR_TEST);
+    glScissor(static_cast<GLint>(clear_area.left()),
+              static_cast<GLint>(d_area.getHeight() - clear_area.bottom()),
+              static_cast<GLint>(clear_area.getWidth()),
+              static_cast<GLint>(clear_area.getHeight()));
+    glClearColor(0,0,0,0);
+    glClear(GL_COLOR_BUFFER_BIT);
+    // switch back to rendering to the previously bound FBO
+    glBindFramebufferEXT(GL_FRAMEBUFFER_EXT, previousFBO);
+
+    // restore previous clear colour and scissor state
+    glClearColor(old_col[0], old_col[1], old_col[2], old_col[3]);
+    if (!old_scissor)
+        glDisable(GL_SCISSOR_TEST);
+}
+
 //----------------------------------------------------------------------------//
 void OpenGLFBOTextureTarget::initialiseRenderTexture()
 {
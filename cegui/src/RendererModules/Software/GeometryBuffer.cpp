@@ -0,0 +1,822 @@
+/***********************************************************************
+    filename:   CEGUISoftwareGeometryBuffer.cpp
+    created:    Sun Oct 18 2026
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2012 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/RendererModules/Software/GeometryBuffer.h"
+#include "CEGUI/RendererModules/Software/Renderer.h"
+#include "CEGUI/RendererModules/Software/Texture.h"
+#include "CEGUI/RenderEffect.h"
+#include "CEGUI/Vertex.h"
+
+#include <algorithm>
+#include <cmath>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+namespace
+{
+//----------------------------------------------------------------------------//
+// tangent of half the vertical field of view used by the other renderers.
+const float s_yfovTan = 0.267949192431123f;
+
+//! how texels are obtained for a span.
+enum FetchMode
+{
+    //! no texture; the vertex colour is used directly.
+    FM_NONE,
+    //! texels map 1:1 onto pixels at a constant integer offset.
+    FM_BLIT,
+    //! bilinear filtered sampling with clamp to edge addressing.
+    FM_BILINEAR
+};
+
+//! how the vertex colour modulates a span.
+enum ShadeMode
+{
+    //! all vertices are opaque white; no modulation is required.
+    SM_WHITE,
+    //! all vertices share one colour.
+    SM_CONSTANT,
+    //! the colour is interpolated across the triangle.
+    SM_INTERPOLATED
+};
+
+//! integer pixel bounds; left and top inclusive, right and bottom exclusive.
+struct PixelBounds
+{
+    int left, top, right, bottom;
+};
+
+//! state used when filling a single span of pixels.
+struct SpanParams
+{
+    const argb_t* texture;
+    int textureWidth;
+    int textureHeight;
+    //! first texel of the span for FM_BLIT.
+    const argb_t* source;
+    //! 16.16 fixed point texel coordinates and steps for FM_BILINEAR.
+    int u, v, du, dv;
+    //! 16.16 fixed point a, r, g, b in the 0 - 255 range and their steps.
+    int colour[4], colourStep[4];
+    //! colour for SM_CONSTANT.
+    argb_t constant;
+};
+
+//! signature of the span filling functions.
+typedef void (*SpanFunction)(argb_t* dst, int count, SpanParams& params);
+
+//----------------------------------------------------------------------------//
+// divide each of the two 16 bit fields in x (each <= 255 * 255) by 255.
+inline uint32 div255Pair(uint32 x)
+{
+    x += 0x00800080;
+    return ((x + ((x >> 8) & 0x00FF00FF)) >> 8) & 0x00FF00FF;
+}
+
+//----------------------------------------------------------------------------//
+// return (a * b) / 255 for 8 bit values, correctly rounded.
+inline uint32 mul255(uint32 a, uint32 b)
+{
+    const uint32 t = a * b + 128;
+    return (t + (t >> 8)) >> 8;
+}
+
+//----------------------------------------------------------------------------//
+// interpolate between the packed colours a and b; w is in the 0 - 255 range.
+inline argb_t lerpARGB(argb_t a, argb_t b, uint32 w)
+{
+    const uint32 iw = 256 - w;
+    const uint32 rb =
+        (((a & 0x00FF00FF) * iw + (b & 0x00FF00FF) * w) >> 8) & 0x00FF00FF;
+    const uint32 ag =
+        (((a >> 8) & 0x00FF00FF) * iw + ((b >> 8) & 0x00FF00FF) * w) &
+        0xFF00FF00;
+    return ag | rb;
+}
+
+//----------------------------------------------------------------------------//
+// multiply each channel of the packed colours a and b.
+inline argb_t modulateARGB(argb_t a, argb_t b)
+{
+    return (mul255(a >> 24, b >> 24) << 24) |
+           (mul255((a >> 16) & 0xFF, (b >> 16) & 0xFF) << 16) |
+           (mul255((a >> 8) & 0xFF, (b >> 8) & 0xFF) << 8) |
+           mul255(a & 0xFF, b & 0xFF);
+}
+
+//----------------------------------------------------------------------------//
+inline uint32 clampChannel(int fixed_value)
+{
+    const int c = fixed_value >> 16;
+    return static_cast<uint32>(c < 0 ? 0 : (c > 255 ? 255 : c));
+}
+
+//----------------------------------------------------------------------------//
+inline void splitCoordinate(int fixed_value, int size, int& i0, int& i1,
+                            uint32& weight)
+{
+    // coordinates left of the first texel centre clamp to the edge.
+    if (fixed_value < 0)
+    {
+        i0 = i1 = 0;
+        weight = 0;
+        return;
+    }
+
+    i0 = fixed_value >> 16;
+    i1 = i0 + 1;
+    weight = (fixed_value >> 8) & 0xFF;
+
+    if (i0 >= size)
+        i0 = size - 1;
+    if (i1 >= size)
+        i1 = size - 1;
+}
+
+//----------------------------------------------------------------------------//
+inline argb_t sampleBilinear(const SpanParams& p)
+{
+    int x0, x1, y0, y1;
+    uint32 wx, wy;
+    splitCoordinate(p.u, p.textureWidth, x0, x1, wx);
+    splitCoordinate(p.v, p.textureHeight, y0, y1, wy);
+
+    const argb_t* const row0 = p.texture + y0 * p.textureWidth;
+    const argb_t* const row1 = p.texture + y1 * p.textureWidth;
+
+    return lerpARGB(lerpARGB(row0[x0], row0[x1], wx),
+                    lerpARGB(row1[x0], row1[x1], wx), wy);
+}
+
+//----------------------------------------------------------------------------//
+template<BlendMode BLEND>
+inline void blendPixel(argb_t& dst, const argb_t src)
+{
+    const uint32 sa = src >> 24;
+    const uint32 isa = 255 - sa;
+
+    if (BLEND == BM_RTT_PREMULTIPLIED)
+    {
+        // out = src + dst * (1 - src_alpha), saturated.
+        uint32 rb = (src & 0x00FF00FF) + div255Pair((dst & 0x00FF00FF) * isa);
+        uint32 ag = ((src >> 8) & 0x00FF00FF) +
+                    div255Pair(((dst >> 8) & 0x00FF00FF) * isa);
+
+        uint32 sat = rb & 0x01000100;
+        rb = (rb | (sat - (sat >> 8))) & 0x00FF00FF;
+        sat = ag & 0x01000100;
+        ag = (ag | (sat - (sat >> 8))) & 0x00FF00FF;
+
+        dst = (ag << 8) | rb;
+    }
+    else
+    {
+        if (sa == 0)
+            return;
+
+        if (sa == 255)
+        {
+            dst = src;
+            return;
+        }
+
+        // rgb = src * sa + dst * (1 - sa); a = sa + da * (1 - sa).  The
+        // source alpha field is forced to 255 so that both are handled by
+        // the same multiply.
+        const uint32 rb = div255Pair((src & 0x00FF00FF) * sa +
+                                     (dst & 0x00FF00FF) * isa);
+        const uint32 ag = div255Pair((((src >> 8) & 0xFF) | 0x00FF0000) * sa +
+                                     ((dst >> 8) & 0x00FF00FF) * isa);
+        dst = (ag << 8) | rb;
+    }
+}
+
+//----------------------------------------------------------------------------//
+template<int FETCH, int SHADE, BlendMode BLEND>
+void fillSpan(argb_t* dst, int count, SpanParams& p)
+{
+    for (int i = 0; i < count; ++i)
+    {
+        argb_t colour;
+        if (SHADE == SM_WHITE)
+            colour = 0xFFFFFFFF;
+        else if (SHADE == SM_CONSTANT)
+            colour = p.constant;
+        else
+        {
+            colour = (clampChannel(p.colour[0]) << 24) |
+                     (clampChannel(p.colour[1]) << 16) |
+                     (clampChannel(p.colour[2]) << 8) |
+                     clampChannel(p.colour[3]);
+
+            for (int c = 0; c < 4; ++c)
+                p.colour[c] += p.colourStep[c];
+        }
+
+        argb_t src;
+        if (FETCH == FM_NONE)
+            src = colour;
+        else
+        {
+            argb_t texel;
+            if (FETCH == FM_BLIT)
+                texel = p.source[i];
+            else
+            {
+                texel = sampleBilinear(p);
+                p.u += p.du;
+                p.v += p.dv;
+            }
+
+            src = (SHADE == SM_WHITE) ? texel : modulateARGB(texel, colour);
+        }
+
+        blendPixel<BLEND>(dst[i], src);
+    }
+}
+
+//----------------------------------------------------------------------------//
+// span function for a solid opaque colour.
+void fillSpanSolid(argb_t* dst, int count, SpanParams& p)
+{
+    std::fill(dst, dst + count, p.constant);
+}
+
+//----------------------------------------------------------------------------//
+template<BlendMode BLEND>
+SpanFunction getSpanFunction(FetchMode fetch, ShadeMode shade)
+{
+    static const SpanFunction functions[3][3] =
+    {
+        {&fillSpan<FM_NONE, SM_WHITE, BLEND>,
+         &fillSpan<FM_NONE, SM_CONSTANT, BLEND>,
+         &fillSpan<FM_NONE, SM_INTERPOLATED, BLEND>},
+        {&fillSpan<FM_BLIT, SM_WHITE, BLEND>,
+         &fillSpan<FM_BLIT, SM_CONSTANT, BLEND>,
+         &fillSpan<FM_BLIT, SM_INTERPOLATED, BLEND>},
+        {&fillSpan<FM_BILINEAR, SM_WHITE, BLEND>,
+         &fillSpan<FM_BILINEAR, SM_CONSTANT, BLEND>,
+         &fillSpan<FM_BILINEAR, SM_INTERPOLATED, BLEND>}
+    };
+
+    return functions[fetch][shade];
+}
+
+//----------------------------------------------------------------------------//
+inline int toFixed(float value)
+{
+    return static_cast<int>(std::floor(value * 65536.0f + 0.5f));
+}
+
+//----------------------------------------------------------------------------//
+// first pixel whose centre lies at or beyond the given coordinate.
+inline int pixelEdge(float value)
+{
+    return static_cast<int>(std::ceil(value - 0.5f));
+}
+
+//----------------------------------------------------------------------------//
+/*
+    Triangle edge, always built from its upper to its lower vertex so that
+    triangles sharing an edge compute identical coordinates for it and
+    neither leave gaps nor fill pixels twice.
+*/
+struct Edge
+{
+    Edge(const Vector2f& a, const Vector2f& b) :
+        x(a.d_x),
+        y(a.d_y),
+        dxdy(b.d_y != a.d_y ? (b.d_x - a.d_x) / (b.d_y - a.d_y) : 0.0f)
+    {}
+
+    float at(float yc) const
+    {
+        return x + (yc - y) * dxdy;
+    }
+
+    float x, y, dxdy;
+};
+
+//----------------------------------------------------------------------------//
+inline bool vertexLess(const Vector2f* a, const Vector2f* b)
+{
+    return a->d_y < b->d_y || (a->d_y == b->d_y && a->d_x < b->d_x);
+}
+
+//----------------------------------------------------------------------------//
+// gradients of a value over the plane of a triangle.
+struct Gradient
+{
+    Gradient(const float* value, const Vector2f* const* pos, float inv_det)
+    {
+        const float d1 = value[1] - value[0];
+        const float d2 = value[2] - value[0];
+        const float x1 = pos[1]->d_x - pos[0]->d_x;
+        const float y1 = pos[1]->d_y - pos[0]->d_y;
+        const float x2 = pos[2]->d_x - pos[0]->d_x;
+        const float y2 = pos[2]->d_y - pos[0]->d_y;
+
+        base = value[0];
+        ddx = (d1 * y2 - d2 * y1) * inv_det;
+        ddy = (d2 * x1 - d1 * x2) * inv_det;
+    }
+
+    float at(float fx, float fy) const
+    {
+        return base + fx * ddx + fy * ddy;
+    }
+
+    float base, ddx, ddy;
+};
+
+//----------------------------------------------------------------------------//
+// return whether the texture maps 1:1 onto the triangle, and the offset.
+bool isBlit(const Vector2f* const* pos, const float* const* tex,
+            const SoftwareTexture& texture, int& off_x, int& off_y)
+{
+    const float tolerance = 1.0f / 512.0f;
+    const float w = static_cast<float>(texture.getPixelWidth());
+    const float h = static_cast<float>(texture.getPixelHeight());
+
+    const float ox = std::floor(tex[0][0] * w - pos[0]->d_x + 0.5f);
+    const float oy = std::floor(tex[0][1] * h - pos[0]->d_y + 0.5f);
+
+    for (int i = 0; i < 3; ++i)
+    {
+        const float tx = tex[i][0] * w;
+        const float ty = tex[i][1] * h;
+
+        if (std::fabs(tx - pos[i]->d_x - ox) > tolerance ||
+            std::fabs(ty - pos[i]->d_y - oy) > tolerance ||
+            tx < -tolerance || tx > w + tolerance ||
+            ty < -tolerance || ty > h + tolerance)
+                return false;
+    }
+
+    off_x = static_cast<int>(ox);
+    off_y = static_cast<int>(oy);
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+inline argb_t packColour(const float* colour)
+{
+    return (static_cast<argb_t>(colour[3] + 0.5f) << 24) |
+           (static_cast<argb_t>(colour[0] + 0.5f) << 16) |
+           (static_cast<argb_t>(colour[1] + 0.5f) << 8) |
+           static_cast<argb_t>(colour[2] + 0.5f);
+}
+
+//----------------------------------------------------------------------------//
+/*
+    Rasterise one triangle into the surface.  Pixels are filled when their
+    centre lies inside the triangle, and attributes are interpolated linearly
+    in screen space.  Returns the number of pixels covered.
+*/
+size_t rasteriseTriangle(const Vector2f* const* screen_pos,
+                         const float* const* tex_coords,
+                         const float* const* colours,
+                         const SoftwareTexture* texture,
+                         BlendMode blend, const PixelBounds& bounds,
+                         argb_t* pixels, int pitch)
+{
+    // order the vertices top to bottom (then left to right).
+    int idx[3] = {0, 1, 2};
+    if (vertexLess(screen_pos[idx[1]], screen_pos[idx[0]]))
+        std::swap(idx[0], idx[1]);
+    if (vertexLess(screen_pos[idx[2]], screen_pos[idx[1]]))
+        std::swap(idx[1], idx[2]);
+    if (vertexLess(screen_pos[idx[1]], screen_pos[idx[0]]))
+        std::swap(idx[0], idx[1]);
+
+    const Vector2f* const pos[3] =
+        {screen_pos[idx[0]], screen_pos[idx[1]], screen_pos[idx[2]]};
+
+    const float det = (pos[1]->d_x - pos[0]->d_x) * (pos[2]->d_y - pos[0]->d_y) -
+                      (pos[2]->d_x - pos[0]->d_x) * (pos[1]->d_y - pos[0]->d_y);
+    if (std::fabs(det) < 1e-6f)
+        return 0;
+
+    const int y_start = ceguimax(bounds.top, pixelEdge(pos[0]->d_y));
+    const int y_end = ceguimin(bounds.bottom, pixelEdge(pos[2]->d_y));
+    if (y_start >= y_end)
+        return 0;
+
+    const float inv_det = 1.0f / det;
+    const float* const tex[3] =
+        {tex_coords[idx[0]], tex_coords[idx[1]], tex_coords[idx[2]]};
+    const float* const col[3] =
+        {colours[idx[0]], colours[idx[1]], colours[idx[2]]};
+
+    // decide how texels will be fetched
+    FetchMode fetch = FM_NONE;
+    int blit_x = 0, blit_y = 0;
+    if (texture && texture->getPixelData())
+        fetch = isBlit(pos, tex, *texture, blit_x, blit_y) ?
+                    FM_BLIT : FM_BILINEAR;
+
+    // decide how the vertex colour is applied
+    const argb_t packed[3] =
+        {packColour(col[0]), packColour(col[1]), packColour(col[2])};
+    ShadeMode shade = SM_INTERPOLATED;
+    if (packed[0] == packed[1] && packed[0] == packed[2])
+        shade = (packed[0] == 0xFFFFFFFF) ? SM_WHITE : SM_CONSTANT;
+
+    SpanParams params;
+    params.texture = texture ? texture->getPixelData() : 0;
+    params.textureWidth = texture ? texture->getPixelWidth() : 0;
+    params.textureHeight = texture ? texture->getPixelHeight() : 0;
+    params.source = 0;
+    params.u = params.v = params.du = params.dv = 0;
+    params.constant = packed[0];
+
+    SpanFunction span;
+    if (fetch == FM_NONE && shade != SM_INTERPOLATED &&
+        (params.constant >> 24) == 0xFF)
+        span = &fillSpanSolid;
+    else if (blend == BM_RTT_PREMULTIPLIED)
+        span = getSpanFunction<BM_RTT_PREMULTIPLIED>(fetch, shade);
+    else
+        span = getSpanFunction<BM_NORMAL>(fetch, shade);
+
+    // plane equations for the interpolated attributes.
+    float u_values[3], v_values[3];
+    for (int i = 0; i < 3; ++i)
+    {
+        u_values[i] = tex[i][0] * params.textureWidth - 0.5f;
+        v_values[i] = tex[i][1] * params.textureHeight - 0.5f;
+    }
+    const Gradient u_grad(u_values, pos, inv_det);
+    const Gradient v_grad(v_values, pos, inv_det);
+
+    float channel_values[4][3];
+    for (int i = 0; i < 3; ++i)
+    {
+        // stored as r, g, b, a; the spans want a, r, g, b.
+        channel_values[0][i] = col[i][3];
+        channel_values[1][i] = col[i][0];
+        channel_values[2][i] = col[i][1];
+        channel_values[3][i] = col[i][2];
+    }
+    const Gradient channel_grad[4] =
+    {
+        Gradient(channel_values[0], pos, inv_det),
+        Gradient(channel_values[1], pos, inv_det),
+        Gradient(channel_values[2], pos, inv_det),
+        Gradient(channel_values[3], pos, inv_det)
+    };
+
+    if (fetch == FM_BILINEAR)
+    {
+        params.du = toFixed(u_grad.ddx);
+        params.dv = toFixed(v_grad.ddx);
+    }
+    if (shade == SM_INTERPOLATED)
+        for (int c = 0; c < 4; ++c)
+            params.colourStep[c] = toFixed(channel_grad[c].ddx);
+
+    const Edge long_edge(*pos[0], *pos[2]);
+    const Edge top_edge(*pos[0], *pos[1]);
+    const Edge bottom_edge(*pos[1], *pos[2]);
+
+    size_t covered = 0;
+    for (int y = y_start; y < y_end; ++y)
+    {
+        const float yc = y + 0.5f;
+        const float xa = long_edge.at(yc);
+        const float xb = yc < pos[1]->d_y ? top_edge.at(yc) :
+                                            bottom_edge.at(yc);
+
+        const int x_start = ceguimax(bounds.left, pixelEdge(ceguimin(xa, xb)));
+        const int x_end = ceguimin(bounds.right, pixelEdge(ceguimax(xa, xb)));
+        if (x_start >= x_end)
+            continue;
+
+        const float fx = x_start + 0.5f - pos[0]->d_x;
+        const float fy = yc - pos[0]->d_y;
+
+        if (fetch == FM_BLIT)
+            params.source = params.texture +
+                (y + blit_y) * params.textureWidth + x_start + blit_x;
+        else if (fetch == FM_BILINEAR)
+        {
+            params.u = toFixed(u_grad.at(fx, fy));
+            params.v = toFixed(v_grad.at(fx, fy));
+        }
+
+        if (shade == SM_INTERPOLATED)
+            for (int c = 0; c < 4; ++c)
+                params.colour[c] = toFixed(channel_grad[c].at(fx, fy));
+
+        span(pixels + y * pitch + x_start, x_end - x_start, params);
+        covered += x_end - x_start;
+    }
+
+    return covered;
+}
+
+//----------------------------------------------------------------------------//
+PixelBounds intersectBounds(const PixelBounds& a, const Rectf& r)
+{
+    const PixelBounds b =
+    {
+        ceguimax(a.left, pixelEdge(r.left())),
+        ceguimax(a.top, pixelEdge(r.top())),
+        ceguimin(a.right, pixelEdge(r.right())),
+        ceguimin(a.bottom, pixelEdge(r.bottom()))
+    };
+
+    return b;
+}
+
+}
+
+//----------------------------------------------------------------------------//
+SoftwareGeometryBuffer::SoftwareGeometryBuffer(SoftwareRenderer& owner) :
+    d_owner(owner),
+    d_activeTexture(0),
+    d_clipRect(0, 0, 0, 0),
+    d_clippingActive(true),
+    d_translation(0, 0, 0),
+    d_rotation(Quaternion::IDENTITY),
+    d_pivot(0, 0, 0),
+    d_effect(0)
+{
+}
+
+//----------------------------------------------------------------------------//
+SoftwareGeometryBuffer::~SoftwareGeometryBuffer()
+{
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareGeometryBuffer::draw() const
+{
+    SoftwareTexture* const surface = d_owner.getActiveRenderSurface();
+    if (!surface || !surface->getPixelData())
+        return;
+
+    const Rectf& area = d_owner.getActiveRenderArea();
+
+    // transform the geometry to surface pixel positions, applying the same
+    // model and perspective projection as the hardware renderers.
+    const float mid_x = area.getWidth() * 0.5f;
+    const float mid_y = area.getHeight() * 0.5f;
+    const float eye_dist = mid_y / s_yfovTan;
+
+    const float qw = d_rotation.d_w, qx = d_rotation.d_x,
+                qy = d_rotation.d_y, qz = d_rotation.d_z;
+    const float m[3][3] =
+    {
+        {1 - 2 * (qy * qy + qz * qz), 2 * (qx * qy - qw * qz), 2 * (qx * qz + qw * qy)},
+        {2 * (qx * qy + qw * qz), 1 - 2 * (qx * qx + qz * qz), 2 * (qy * qz - qw * qx)},
+        {2 * (qx * qz - qw * qy), 2 * (qy * qz + qw * qx), 1 - 2 * (qx * qx + qy * qy)}
+    };
+
+    d_screenPositions.resize(d_vertices.size());
+    for (size_t i = 0; i < d_vertices.size(); ++i)
+    {
+        const float* const p = d_vertices[i].position;
+        const float px = p[0] - d_pivot.d_x;
+        const float py = p[1] - d_pivot.d_y;
+        const float pz = p[2] - d_pivot.d_z;
+
+        const float x = m[0][0] * px + m[0][1] * py + m[0][2] * pz + d_pivot.d_x + d_translation.d_x;
+        const float y = m[1][0] * px + m[1][1] * py + m[1][2] * pz + d_pivot.d_y + d_translation.d_y;
+        const float z = m[2][0] * px + m[2][1] * py + m[2][2] * pz + d_pivot.d_z + d_translation.d_z;
+
+        const float denom = eye_dist + z;
+        const float scale = denom > 0.0f ? eye_dist / denom : 1.0f;
+
+        d_screenPositions[i].d_x = area.left() + mid_x + (x - mid_x) * scale;
+        d_screenPositions[i].d_y = area.top() + mid_y + (y - mid_y) * scale;
+    }
+
+    // work out the pixel bounds for clipped and unclipped batches.
+    const PixelBounds surface_bounds =
+    {
+        0, 0,
+        static_cast<int>(surface->getPixelWidth()),
+        static_cast<int>(surface->getPixelHeight())
+    };
+    const PixelBounds target_bounds = intersectBounds(surface_bounds, area);
+    const PixelBounds clip_bounds = intersectBounds(target_bounds,
+        Rectf(d_clipRect.left() + area.left(), d_clipRect.top() + area.top(),
+              d_clipRect.right() + area.left(), d_clipRect.bottom() + area.top()));
+
+    argb_t* const pixels = surface->getPixelData();
+    const int pitch = static_cast<int>(surface->getPixelWidth());
+    const BlendMode blend = d_blendMode;
+
+    size_t triangles = 0;
+    size_t covered = 0;
+
+    const int pass_count = d_effect ? d_effect->getPassCount() : 1;
+    for (int pass = 0; pass < pass_count; ++pass)
+    {
+        // set up RenderEffect
+        if (d_effect)
+            d_effect->performPreRenderFunctions(pass);
+
+        // draw the batches
+        size_t pos = 0;
+        BatchList::const_iterator i = d_batches.begin();
+        for ( ; i != d_batches.end(); ++i)
+        {
+            const PixelBounds& bounds = i->clip ? clip_bounds : target_bounds;
+
+            const size_t end = pos + i->vertexCount - i->vertexCount % 3;
+            for (size_t v = pos; v < end; v += 3)
+            {
+                const Vector2f* const screen[3] =
+                {
+                    &d_screenPositions[v],
+                    &d_screenPositions[v + 1],
+                    &d_screenPositions[v + 2]
+                };
+                const float* const tex[3] =
+                {
+                    d_vertices[v].tex,
+                    d_vertices[v + 1].tex,
+                    d_vertices[v + 2].tex
+                };
+                const float* const colours[3] =
+                {
+                    d_vertices[v].colour,
+                    d_vertices[v + 1].colour,
+                    d_vertices[v + 2].colour
+                };
+
+                covered += rasteriseTriangle(screen, tex, colours, i->texture,
+                                             blend, bounds, pixels, pitch);
+                ++triangles;
+            }
+
+            pos += i->vertexCount;
+        }
+    }
+
+    // clean up RenderEffect
+    if (d_effect)
+        d_effect->performPostRenderFunctions();
+
+    d_owner.addFillStatistics(triangles, covered);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareGeometryBuffer::setTranslation(const Vector3f& v)
+{
+    d_translation = v;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareGeometryBuffer::setRotation(const Quaternion& r)
+{
+    d_rotation = r;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareGeometryBuffer::setPivot(const Vector3f& p)
+{
+    d_pivot = p;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareGeometryBuffer::setClippingRegion(const Rectf& region)
+{
+    d_clipRect.top(ceguimax(0.0f, region.top()));
+    d_clipRect.left(ceguimax(0.0f, region.left()));
+    d_clipRect.bottom(ceguimax(0.0f, region.bottom()));
+    d_clipRect.right(ceguimax(0.0f, region.right()));
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareGeometryBuffer::appendVertex(const Vertex& vertex)
+{
+    appendGeometry(&vertex, 1);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareGeometryBuffer::appendGeometry(const Vertex* const vbuff,
+                                            uint vertex_count)
+{
+    performBatchManagement();
+
+    // update size of current batch
+    d_batches.back().vertexCount += vertex_count;
+
+    // buffer these vertices
+    SoftwareVertex vd;
+    const Vertex* vs = vbuff;
+    for (uint i = 0; i < vertex_count; ++i, ++vs)
+    {
+        vd.tex[0]      = vs->tex_coords.d_x;
+        vd.tex[1]      = vs->tex_coords.d_y;
+        vd.colour[0]   = vs->colour_val.getRed() * 255.0f;
+        vd.colour[1]   = vs->colour_val.getGreen() * 255.0f;
+        vd.colour[2]   = vs->colour_val.getBlue() * 255.0f;
+        vd.colour[3]   = vs->colour_val.getAlpha() * 255.0f;
+        vd.position[0] = vs->position.d_x;
+        vd.position[1] = vs->position.d_y;
+        vd.position[2] = vs->position.d_z;
+        d_vertices.push_back(vd);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareGeometryBuffer::setActiveTexture(Texture* texture)
+{
+    d_activeTexture = static_cast<SoftwareTexture*>(texture);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareGeometryBuffer::reset()
+{
+    d_batches.clear();
+    d_vertices.clear();
+    d_activeTexture = 0;
+}
+
+//----------------------------------------------------------------------------//
+Texture* SoftwareGeometryBuffer::getActiveTexture() const
+{
+    return d_activeTexture;
+}
+
+//----------------------------------------------------------------------------//
+uint SoftwareGeometryBuffer::getVertexCount() const
+{
+    return static_cast<uint>(d_vertices.size());
+}
+
+//----------------------------------------------------------------------------//
+uint SoftwareGeometryBuffer::getBatchCount() const
+{
+    return static_cast<uint>(d_batches.size());
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareGeometryBuffer::setRenderEffect(RenderEffect* effect)
+{
+    d_effect = effect;
+}
+
+//----------------------------------------------------------------------------//
+RenderEffect* SoftwareGeometryBuffer::getRenderEffect()
+{
+    return d_effect;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareGeometryBuffer::setClippingActive(const bool active)
+{
+    d_clippingActive = active;
+}
+
+//----------------------------------------------------------------------------//
+bool SoftwareGeometryBuffer::isClippingActive() const
+{
+    return d_clippingActive;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareGeometryBuffer::performBatchManagement()
+{
+    // create a new batch if there are no batches yet, or if the active texture
+    // differs from that used by the current batch.
+    if (d_batches.empty() ||
+        d_activeTexture != d_batches.back().texture ||
+        d_clippingActive != d_batches.back().clip)
+    {
+        const BatchInfo batch = {d_activeTexture, 0, d_clippingActive};
+        d_batches.push_back(batch);
+    }
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -0,0 +1,423 @@
+/***********************************************************************
+    filename:   CEGUISoftwareRenderer.cpp
+    created:    Sun Oct 18 2026
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2012 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/RendererModules/Software/Renderer.h"
+#include "CEGUI/RendererModules/Software/GeometryBuffer.h"
+#include "CEGUI/RendererModules/Software/TextureTarget.h"
+#include "CEGUI/RendererModules/Software/Texture.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/System.h"
+#include "CEGUI/DefaultResourceProvider.h"
+#include "CEGUI/Logger.h"
+
+#include <algorithm>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+String SoftwareRenderer::d_rendererID(
+    "CEGUI::SoftwareRenderer - Software rasteriser renderer module.");
+
+//----------------------------------------------------------------------------//
+SoftwareRenderer& SoftwareRenderer::bootstrapSystem(const Sizef& display_size,
+                                                    const int abi)
+{
+    System::performVersionTest(CEGUI_VERSION_ABI, abi, CEGUI_FUNCTION_NAME);
+
+    if (System::getSingletonPtr())
+        CEGUI_THROW(InvalidRequestException(
+            "CEGUI::System object is already initialised."));
+
+    SoftwareRenderer& renderer = create(display_size);
+    DefaultResourceProvider* rp = CEGUI_NEW_AO DefaultResourceProvider();
+    System::create(renderer, rp);
+
+    return renderer;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::destroySystem()
+{
+    System* sys;
+    if (!(sys = System::getSingletonPtr()))
+        CEGUI_THROW(InvalidRequestException(
+            "CEGUI::System object is not created or was already destroyed."));
+
+    SoftwareRenderer* renderer =
+        static_cast<SoftwareRenderer*>(sys->getRenderer());
+    ResourceProvider* rp = sys->getResourceProvider();
+
+    System::destroy();
+    CEGUI_DELETE_AO rp;
+    destroy(*renderer);
+}
+
+//----------------------------------------------------------------------------//
+SoftwareRenderer& SoftwareRenderer::create(const Sizef& display_size,
+                                           const int abi)
+{
+    System::performVersionTest(CEGUI_VERSION_ABI, abi, CEGUI_FUNCTION_NAME);
+
+    return *CEGUI_NEW_AO SoftwareRenderer(display_size);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::destroy(SoftwareRenderer& renderer)
+{
+    CEGUI_DELETE_AO &renderer;
+}
+
+//----------------------------------------------------------------------------//
+SoftwareTexture& SoftwareRenderer::getDisplayTexture() const
+{
+    return *d_displayTexture;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::saveDisplayToPNG(const String& filename) const
+{
+    d_displayTexture->saveToPNG(filename);
+}
+
+//----------------------------------------------------------------------------//
+size_t SoftwareRenderer::getFilledPixelCount() const
+{
+    return d_filledPixels;
+}
+
+//----------------------------------------------------------------------------//
+size_t SoftwareRenderer::getRasterisedTriangleCount() const
+{
+    return d_rasterisedTriangles;
+}
+
+//----------------------------------------------------------------------------//
+float SoftwareRenderer::getOverdraw() const
+{
+    const float display_area =
+        static_cast<float>(d_displayTexture->getPixelWidth()) *
+        static_cast<float>(d_displayTexture->getPixelHeight());
+
+    return display_area > 0.0f ?
+        static_cast<float>(d_filledPixels) / display_area : 0.0f;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::setActiveRenderSurface(SoftwareTexture* surface,
+                                              const Rectf& area)
+{
+    d_activeSurface = surface;
+    d_activeArea = area;
+}
+
+//----------------------------------------------------------------------------//
+SoftwareTexture* SoftwareRenderer::getActiveRenderSurface() const
+{
+    return d_activeSurface;
+}
+
+//----------------------------------------------------------------------------//
+const Rectf& SoftwareRenderer::getActiveRenderArea() const
+{
+    return d_activeArea;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::addFillStatistics(size_t triangles, size_t pixels)
+{
+    d_rasterisedTriangles += triangles;
+    d_filledPixels += pixels;
+}
+
+//----------------------------------------------------------------------------//
+RenderTarget& SoftwareRenderer::getDefaultRenderTarget()
+{
+    return *d_defaultTarget;
+}
+
+//----------------------------------------------------------------------------//
+GeometryBuffer& SoftwareRenderer::createGeometryBuffer()
+{
+    SoftwareGeometryBuffer* gb = CEGUI_NEW_AO SoftwareGeometryBuffer(*this);
+
+    d_geometryBuffers.push_back(gb);
+    return *gb;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::destroyGeometryBuffer(const GeometryBuffer& buffer)
+{
+    GeometryBufferList::iterator i = std::find(d_geometryBuffers.begin(),
+                                               d_geometryBuffers.end(),
+                                               &buffer);
+
+    if (d_geometryBuffers.end() != i)
+    {
+        d_geometryBuffers.erase(i);
+        CEGUI_DELETE_AO &buffer;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::destroyAllGeometryBuffers()
+{
+    while (!d_geometryBuffers.empty())
+        destroyGeometryBuffer(**d_geometryBuffers.begin());
+}
+
+//----------------------------------------------------------------------------//
+TextureTarget* SoftwareRenderer::createTextureTarget()
+{
+    TextureTarget* tt = CEGUI_NEW_AO SoftwareTextureTarget(*this);
+    d_textureTargets.push_back(tt);
+    return tt;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::destroyTextureTarget(TextureTarget* target)
+{
+    TextureTargetList::iterator i = std::find(d_textureTargets.begin(),
+                                              d_textureTargets.end(),
+                                              target);
+
+    if (d_textureTargets.end() != i)
+    {
+        d_textureTargets.erase(i);
+        CEGUI_DELETE_AO target;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::destroyAllTextureTargets()
+{
+    while (!d_textureTargets.empty())
+        destroyTextureTarget(*d_textureTargets.begin());
+}
+
+//----------------------------------------------------------------------------//
+Texture& SoftwareRenderer::createTexture(const String& name)
+{
+    throwIfNameExists(name);
+
+    SoftwareTexture* t = CEGUI_NEW_AO SoftwareTexture(name);
+    d_textures[name] = t;
+
+    logTextureCreation(name);
+
+    return *t;
+}
+
+//----------------------------------------------------------------------------//
+Texture& SoftwareRenderer::createTexture(const String& name,
+                                         const String& filename,
+                                         const String& resourceGroup)
+{
+    throwIfNameExists(name);
+
+    SoftwareTexture* t =
+        CEGUI_NEW_AO SoftwareTexture(name, filename, resourceGroup);
+    d_textures[name] = t;
+
+    logTextureCreation(name);
+
+    return *t;
+}
+
+//----------------------------------------------------------------------------//
+Texture& SoftwareRenderer::createTexture(const String& name, const Sizef& size)
+{
+    throwIfNameExists(name);
+
+    SoftwareTexture* t = CEGUI_NEW_AO SoftwareTexture(name, size);
+    d_textures[name] = t;
+
+    logTextureCreation(name);
+
+    return *t;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::throwIfNameExists(const String& name) const
+{
+    if (d_textures.find(name) != d_textures.end())
+        CEGUI_THROW(AlreadyExistsException(
+            "[SoftwareRenderer] Texture already exists: " + name));
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::logTextureCreation(const String& name)
+{
+    Logger* logger = Logger::getSingletonPtr();
+    if (logger)
+        logger->logEvent("[SoftwareRenderer] Created texture: " + name);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::destroyTexture(Texture& texture)
+{
+    destroyTexture(texture.getName());
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::destroyTexture(const String& name)
+{
+    TextureMap::iterator i = d_textures.find(name);
+
+    if (d_textures.end() != i)
+    {
+        logTextureDestruction(name);
+        CEGUI_DELETE_AO i->second;
+        d_textures.erase(i);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::logTextureDestruction(const String& name)
+{
+    Logger* logger = Logger::getSingletonPtr();
+    if (logger)
+        logger->logEvent("[SoftwareRenderer] Destroyed texture: " + name);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::destroyAllTextures()
+{
+    while (!d_textures.empty())
+        destroyTexture(d_textures.begin()->first);
+}
+
+//----------------------------------------------------------------------------//
+Texture& SoftwareRenderer::getTexture(const String& name) const
+{
+    TextureMap::const_iterator i = d_textures.find(name);
+
+    if (i == d_textures.end())
+        CEGUI_THROW(UnknownObjectException(
+            "Texture does not exist: " + name));
+
+    return *i->second;
+}
+
+//----------------------------------------------------------------------------//
+bool SoftwareRenderer::isTextureDefined(const String& name) const
+{
+    return d_textures.find(name) != d_textures.end();
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::beginRendering()
+{
+    d_filledPixels = 0;
+    d_rasterisedTriangles = 0;
+
+    d_displayTexture->fill(Rectf(Vector2f(0, 0), d_displayTexture->getSize()),
+                           0);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::endRendering()
+{
+    d_activeSurface = 0;
+}
+
+//----------------------------------------------------------------------------//
+const Sizef& SoftwareRenderer::getDisplaySize() const
+{
+    return d_displaySize;
+}
+
+//----------------------------------------------------------------------------//
+const Vector2f& SoftwareRenderer::getDisplayDPI() const
+{
+    return d_displayDPI;
+}
+
+//----------------------------------------------------------------------------//
+uint SoftwareRenderer::getMaxTextureSize() const
+{
+    return d_maxTextureSize;
+}
+
+//----------------------------------------------------------------------------//
+const String& SoftwareRenderer::getIdentifierString() const
+{
+    return d_rendererID;
+}
+
+//----------------------------------------------------------------------------//
+SoftwareRenderer::SoftwareRenderer(const Sizef& display_size) :
+    d_displaySize(display_size),
+    d_displayDPI(96, 96),
+    d_displayTexture(0),
+    d_defaultTarget(0),
+    d_maxTextureSize(8192),
+    d_activeSurface(0),
+    d_activeArea(0, 0, 0, 0),
+    d_filledPixels(0),
+    d_rasterisedTriangles(0)
+{
+    d_displayTexture = CEGUI_NEW_AO SoftwareTexture("_software_display",
+                                                    display_size);
+
+    // create default target & rendering root (surface) that uses it
+    d_defaultTarget =
+        CEGUI_NEW_AO SoftwareRenderTarget<>(*this, d_displayTexture);
+    d_defaultTarget->setArea(Rectf(Vector2f(0, 0), display_size));
+}
+
+//----------------------------------------------------------------------------//
+SoftwareRenderer::~SoftwareRenderer()
+{
+    destroyAllGeometryBuffers();
+    destroyAllTextureTargets();
+    destroyAllTextures();
+
+    CEGUI_DELETE_AO d_defaultTarget;
+    CEGUI_DELETE_AO d_displayTexture;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::setDisplaySize(const Sizef& sz)
+{
+    if (sz != d_displaySize)
+    {
+        d_displaySize = sz;
+        d_displayTexture->setTextureSize(sz);
+
+        Rectf area(d_defaultTarget->getArea());
+        area.setSize(sz);
+        d_defaultTarget->setArea(area);
+    }
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
+
+//----------------------------------------------------------------------------//
+// Implementation of template base class
+#include "./RenderTarget.inl"
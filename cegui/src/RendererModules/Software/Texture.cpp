@@ -0,0 +1,492 @@
+/***********************************************************************
+    filename:   CEGUISoftwareTexture.cpp
+    created:    Sun Oct 18 2026
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2012 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/RendererModules/Software/Texture.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/ImageCodec.h"
+#include "CEGUI/System.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+namespace
+{
+//----------------------------------------------------------------------------//
+// return the number of bytes used by each pixel of the given format.
+size_t getBytesPerPixel(Texture::PixelFormat fmt)
+{
+    switch (fmt)
+    {
+    case Texture::PF_RGB:
+        return 3;
+    case Texture::PF_RGBA_4444:
+    case Texture::PF_RGB_565:
+        return 2;
+    default:
+        return 4;
+    }
+}
+
+//----------------------------------------------------------------------------//
+// convert a row of pixels in the given format to ARGB.
+void convertToARGB(const uint8* src, argb_t* dst, size_t count,
+                   Texture::PixelFormat fmt)
+{
+    switch (fmt)
+    {
+    case Texture::PF_RGB:
+        for (size_t i = 0; i < count; ++i, src += 3)
+            dst[i] = 0xFF000000 | (src[0] << 16) | (src[1] << 8) | src[2];
+        break;
+
+    case Texture::PF_RGBA_4444:
+        for (size_t i = 0; i < count; ++i, src += 2)
+        {
+            const uint16 p = *reinterpret_cast<const uint16*>(src);
+            dst[i] = (((p & 0xF) * 17) << 24) | (((p >> 12) * 17) << 16) |
+                     ((((p >> 8) & 0xF) * 17) << 8) | (((p >> 4) & 0xF) * 17);
+        }
+        break;
+
+    case Texture::PF_RGB_565:
+        for (size_t i = 0; i < count; ++i, src += 2)
+        {
+            const uint16 p = *reinterpret_cast<const uint16*>(src);
+            const uint32 r = p >> 11, g = (p >> 5) & 0x3F, b = p & 0x1F;
+            dst[i] = 0xFF000000 | (((r << 3) | (r >> 2)) << 16) |
+                     (((g << 2) | (g >> 4)) << 8) | ((b << 3) | (b >> 2));
+        }
+        break;
+
+    default:
+        for (size_t i = 0; i < count; ++i, src += 4)
+            dst[i] = (src[3] << 24) | (src[0] << 16) | (src[1] << 8) | src[2];
+        break;
+    }
+}
+
+//----------------------------------------------------------------------------//
+// convert a row of ARGB pixels to the given format.
+void convertFromARGB(const argb_t* src, uint8* dst, size_t count,
+                     Texture::PixelFormat fmt)
+{
+    switch (fmt)
+    {
+    case Texture::PF_RGB:
+        for (size_t i = 0; i < count; ++i, dst += 3)
+        {
+            dst[0] = static_cast<uint8>(src[i] >> 16);
+            dst[1] = static_cast<uint8>(src[i] >> 8);
+            dst[2] = static_cast<uint8>(src[i]);
+        }
+        break;
+
+    case Texture::PF_RGBA_4444:
+        for (size_t i = 0; i < count; ++i, dst += 2)
+            *reinterpret_cast<uint16*>(dst) = static_cast<uint16>(
+                ((src[i] >> 8) & 0xF000) | ((src[i] >> 4) & 0x0F00) |
+                (src[i] & 0x00F0) | (src[i] >> 28));
+        break;
+
+    case Texture::PF_RGB_565:
+        for (size_t i = 0; i < count; ++i, dst += 2)
+            *reinterpret_cast<uint16*>(dst) = static_cast<uint16>(
+                ((src[i] >> 8) & 0xF800) | ((src[i] >> 5) & 0x07E0) |
+                ((src[i] >> 3) & 0x001F));
+        break;
+
+    default:
+        for (size_t i = 0; i < count; ++i, dst += 4)
+        {
+            dst[0] = static_cast<uint8>(src[i] >> 16);
+            dst[1] = static_cast<uint8>(src[i] >> 8);
+            dst[2] = static_cast<uint8>(src[i]);
+            dst[3] = static_cast<uint8>(src[i] >> 24);
+        }
+        break;
+    }
+}
+
+//----------------------------------------------------------------------------//
+// return the CRC-32 of the given data as used by PNG, continuing from crc.
+uint32 updateCRC(uint32 crc, const uint8* data, size_t length)
+{
+    static uint32 table[256];
+    static bool table_valid = false;
+
+    if (!table_valid)
+    {
+        for (uint32 n = 0; n < 256; ++n)
+        {
+            uint32 c = n;
+            for (int k = 0; k < 8; ++k)
+                c = (c & 1) ? 0xEDB88320 ^ (c >> 1) : c >> 1;
+
+            table[n] = c;
+        }
+
+        table_valid = true;
+    }
+
+    crc ^= 0xFFFFFFFF;
+    for (size_t i = 0; i < length; ++i)
+        crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+
+    return crc ^ 0xFFFFFFFF;
+}
+
+//----------------------------------------------------------------------------//
+void appendUInt32(std::vector<uint8>& out, uint32 value)
+{
+    out.push_back(static_cast<uint8>(value >> 24));
+    out.push_back(static_cast<uint8>(value >> 16));
+    out.push_back(static_cast<uint8>(value >> 8));
+    out.push_back(static_cast<uint8>(value));
+}
+
+//----------------------------------------------------------------------------//
+void appendChunk(std::vector<uint8>& out, const char* type,
+                 const std::vector<uint8>& data)
+{
+    appendUInt32(out, static_cast<uint32>(data.size()));
+
+    const size_t type_pos = out.size();
+    out.insert(out.end(), type, type + 4);
+    out.insert(out.end(), data.begin(), data.end());
+
+    appendUInt32(out, updateCRC(0, &out[type_pos], out.size() - type_pos));
+}
+
+//----------------------------------------------------------------------------//
+/*
+    Build an RGBA PNG image of the given pixels.  The image data is stored in
+    uncompressed deflate blocks; this keeps the module free of a zlib
+    dependency, and the files are only intended for inspection and
+    comparison.
+*/
+void buildPNG(std::vector<uint8>& out, const argb_t* pixels,
+              uint width, uint height)
+{
+    static const uint8 signature[] = {137, 80, 78, 71, 13, 10, 26, 10};
+    out.assign(signature, signature + sizeof(signature));
+
+    std::vector<uint8> header;
+    appendUInt32(header, width);
+    appendUInt32(header, height);
+    header.push_back(8);    // bit depth
+    header.push_back(6);    // colour type: RGBA
+    header.push_back(0);    // compression method
+    header.push_back(0);    // filter method
+    header.push_back(0);    // interlace method
+    appendChunk(out, "IHDR", header);
+
+    // raw scanlines, each preceded by a filter type of 'none'.
+    const size_t row_size = static_cast<size_t>(width) * 4 + 1;
+    std::vector<uint8> raw(row_size * height);
+    for (uint y = 0; y < height; ++y)
+    {
+        raw[y * row_size] = 0;
+        convertFromARGB(pixels + y * width, &raw[y * row_size + 1], width,
+                        Texture::PF_RGBA);
+    }
+
+    // zlib stream made of stored deflate blocks.
+    std::vector<uint8> idat;
+    idat.push_back(0x78);
+    idat.push_back(0x01);
+
+    size_t pos = 0;
+    do
+    {
+        const size_t len = std::min(raw.size() - pos, static_cast<size_t>(65535));
+        const bool final_block = pos + len == raw.size();
+        idat.push_back(final_block ? 1 : 0);
+        idat.push_back(static_cast<uint8>(len));
+        idat.push_back(static_cast<uint8>(len >> 8));
+        idat.push_back(static_cast<uint8>(~len));
+        idat.push_back(static_cast<uint8>(~len >> 8));
+        idat.insert(idat.end(), raw.begin() + pos, raw.begin() + pos + len);
+        pos += len;
+    }
+    while (pos < raw.size());
+
+    uint32 a = 1, b = 0;
+    for (size_t i = 0; i < raw.size(); ++i)
+    {
+        a = (a + raw[i]) % 65521;
+        b = (b + a) % 65521;
+    }
+    appendUInt32(idat, (b << 16) | a);
+
+    appendChunk(out, "IDAT", idat);
+    appendChunk(out, "IEND", std::vector<uint8>());
+}
+
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTexture::setTextureSize(const Sizef& sz)
+{
+    d_pixelWidth = static_cast<uint>(ceguimax(0.0f, std::ceil(sz.d_width)));
+    d_pixelHeight = static_cast<uint>(ceguimax(0.0f, std::ceil(sz.d_height)));
+
+    d_pixels.assign(static_cast<size_t>(d_pixelWidth) * d_pixelHeight, 0);
+    d_format = PF_RGBA;
+
+    d_size = d_dataSize =
+        Sizef(static_cast<float>(d_pixelWidth),
+              static_cast<float>(d_pixelHeight));
+    updateCachedScaleValues();
+}
+
+//----------------------------------------------------------------------------//
+uint SoftwareTexture::getPixelWidth() const
+{
+    return d_pixelWidth;
+}
+
+//----------------------------------------------------------------------------//
+uint SoftwareTexture::getPixelHeight() const
+{
+    return d_pixelHeight;
+}
+
+//----------------------------------------------------------------------------//
+argb_t* SoftwareTexture::getPixelData()
+{
+    return d_pixels.empty() ? 0 : &d_pixels[0];
+}
+
+//----------------------------------------------------------------------------//
+const argb_t* SoftwareTexture::getPixelData() const
+{
+    return d_pixels.empty() ? 0 : &d_pixels[0];
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTexture::fill(const Rectf& area, argb_t colour)
+{
+    // fill pixels whose centres lie within the area.
+    const int x0 = static_cast<int>(ceguimax(0.0f, std::ceil(area.left() - 0.5f)));
+    const int y0 = static_cast<int>(ceguimax(0.0f, std::ceil(area.top() - 0.5f)));
+    const int x1 = static_cast<int>(ceguimin(static_cast<float>(d_pixelWidth),
+                                    ceguimax(0.0f, std::ceil(area.right() - 0.5f))));
+    const int y1 = static_cast<int>(ceguimin(static_cast<float>(d_pixelHeight),
+                                    ceguimax(0.0f, std::ceil(area.bottom() - 0.5f))));
+
+    for (int y = y0; y < y1; ++y)
+    {
+        argb_t* const row = &d_pixels[static_cast<size_t>(y) * d_pixelWidth];
+        std::fill(row + x0, row + ceguimax(x0, x1), colour);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTexture::saveToPNG(const String& filename) const
+{
+    std::vector<uint8> png;
+    buildPNG(png, getPixelData(), d_pixelWidth, d_pixelHeight);
+
+    std::ofstream file(filename.c_str(), std::ios::out | std::ios::binary);
+    if (file)
+        file.write(reinterpret_cast<const char*>(&png[0]), png.size());
+
+    if (!file)
+        CEGUI_THROW(FileIOException(
+            "[SoftwareRenderer] Unable to write PNG file: " + filename));
+}
+
+//----------------------------------------------------------------------------//
+const String& SoftwareTexture::getName() const
+{
+    return d_name;
+}
+
+//----------------------------------------------------------------------------//
+const Sizef& SoftwareTexture::getSize() const
+{
+    return d_size;
+}
+
+//----------------------------------------------------------------------------//
+const Sizef& SoftwareTexture::getOriginalDataSize() const
+{
+    return d_dataSize;
+}
+
+//----------------------------------------------------------------------------//
+const Vector2f& SoftwareTexture::getTexelScaling() const
+{
+    return d_texelScaling;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTexture::loadFromFile(const String& filename,
+                                   const String& resourceGroup)
+{
+    // get and check existence of CEGUI::System object
+    System* sys = System::getSingletonPtr();
+    if (!sys)
+        CEGUI_THROW(RendererException(
+            "CEGUI::System object has not been created!"));
+
+    // load file to memory via resource provider
+    RawDataContainer texFile;
+    sys->getResourceProvider()->loadRawDataContainer(filename, texFile,
+                                                     resourceGroup);
+
+    Texture* res = sys->getImageCodec().load(texFile, this);
+
+    // unload file data buffer
+    sys->getResourceProvider()->unloadRawDataContainer(texFile);
+
+    // throw exception if data was load loaded to texture.
+    if (!res)
+        CEGUI_THROW(RendererException(
+            sys->getImageCodec().getIdentifierString() +
+            " failed to load image '" + filename + "'."));
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTexture::loadFromMemory(const void* buffer,
+                                     const Sizef& buffer_size,
+                                     PixelFormat pixel_format)
+{
+    if (!isPixelFormatSupported(pixel_format))
+        CEGUI_THROW(InvalidRequestException(
+            "Data was supplied in an unsupported pixel format."));
+
+    setTextureSize(buffer_size);
+    d_format = pixel_format;
+
+    blitFromMemory(buffer, Rectf(Vector2f(0, 0), d_size));
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTexture::blitFromMemory(const void* sourceData, const Rectf& area)
+{
+    const uint x0 = static_cast<uint>(ceguimax(0.0f, area.left()));
+    const uint y0 = static_cast<uint>(ceguimax(0.0f, area.top()));
+    const uint w = static_cast<uint>(area.getWidth());
+    const uint h = static_cast<uint>(area.getHeight());
+
+    if (x0 + w > d_pixelWidth || y0 + h > d_pixelHeight)
+        CEGUI_THROW(InvalidRequestException(
+            "[SoftwareRenderer] Blit area exceeds the texture size."));
+
+    const uint8* src = static_cast<const uint8*>(sourceData);
+    const size_t src_pitch = w * getBytesPerPixel(d_format);
+
+    for (uint y = 0; y < h; ++y, src += src_pitch)
+        convertToARGB(src, &d_pixels[(y0 + y) * d_pixelWidth + x0], w,
+                      d_format);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTexture::blitToMemory(void* targetData)
+{
+    uint8* dst = static_cast<uint8*>(targetData);
+    const size_t dst_pitch = d_pixelWidth * getBytesPerPixel(d_format);
+
+    for (uint y = 0; y < d_pixelHeight; ++y, dst += dst_pitch)
+        convertFromARGB(&d_pixels[y * d_pixelWidth], dst, d_pixelWidth,
+                        d_format);
+}
+
+//----------------------------------------------------------------------------//
+bool SoftwareTexture::isPixelFormatSupported(const PixelFormat fmt) const
+{
+    switch (fmt)
+    {
+    case PF_RGB:
+    case PF_RGBA:
+    case PF_RGBA_4444:
+    case PF_RGB_565:
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTexture::updateCachedScaleValues()
+{
+    d_texelScaling.d_x = d_size.d_width > 0.0f ? 1.0f / d_size.d_width : 0.0f;
+    d_texelScaling.d_y = d_size.d_height > 0.0f ? 1.0f / d_size.d_height : 0.0f;
+}
+
+//----------------------------------------------------------------------------//
+SoftwareTexture::SoftwareTexture(const String& name) :
+    d_pixelWidth(0),
+    d_pixelHeight(0),
+    d_format(PF_RGBA),
+    d_size(0, 0),
+    d_dataSize(0, 0),
+    d_texelScaling(0, 0),
+    d_name(name)
+{
+}
+
+//----------------------------------------------------------------------------//
+SoftwareTexture::SoftwareTexture(const String& name, const String& filename,
+                                 const String& resourceGroup) :
+    d_pixelWidth(0),
+    d_pixelHeight(0),
+    d_format(PF_RGBA),
+    d_size(0, 0),
+    d_dataSize(0, 0),
+    d_texelScaling(0, 0),
+    d_name(name)
+{
+    loadFromFile(filename, resourceGroup);
+}
+
+//----------------------------------------------------------------------------//
+SoftwareTexture::SoftwareTexture(const String& name, const Sizef& sz) :
+    d_pixelWidth(0),
+    d_pixelHeight(0),
+    d_format(PF_RGBA),
+    d_size(0, 0),
+    d_dataSize(0, 0),
+    d_texelScaling(0, 0),
+    d_name(name)
+{
+    setTextureSize(sz);
+}
+
+//----------------------------------------------------------------------------//
+SoftwareTexture::~SoftwareTexture()
+{
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -0,0 +1,121 @@
+/***********************************************************************
+    filename:   CEGUISoftwareTextureTarget.cpp
+    created:    Sun Oct 18 2026
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2012 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/RendererModules/Software/TextureTarget.h"
+#include "CEGUI/RendererModules/Software/Texture.h"
+#include "CEGUI/PropertyHelper.h"
+
+#include <cmath>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+uint SoftwareTextureTarget::s_textureNumber = 0;
+const float SoftwareTextureTarget::DEFAULT_SIZE = 128.0f;
+
+//----------------------------------------------------------------------------//
+SoftwareTextureTarget::SoftwareTextureTarget(SoftwareRenderer& owner) :
+    SoftwareRenderTarget<TextureTarget>(owner, 0)
+{
+    d_surface = static_cast<SoftwareTexture*>(
+        &d_owner.createTexture(generateTextureName()));
+
+    // setup area and cause the initial texture to be generated.
+    declareRenderSize(Sizef(DEFAULT_SIZE, DEFAULT_SIZE));
+}
+
+//----------------------------------------------------------------------------//
+SoftwareTextureTarget::~SoftwareTextureTarget()
+{
+    d_owner.destroyTexture(*d_surface);
+}
+
+//----------------------------------------------------------------------------//
+bool SoftwareTextureTarget::isImageryCache() const
+{
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTextureTarget::clear()
+{
+    d_surface->fill(Rectf(Vector2f(0, 0), d_surface->getSize()), 0);
+}
+
+//----------------------------------------------------------------------------//
+bool SoftwareTextureTarget::isPartialClearSupported() const
+{
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTextureTarget::clearArea(const Rectf& area)
+{
+    d_surface->fill(area, 0);
+}
+
+//----------------------------------------------------------------------------//
+Texture& SoftwareTextureTarget::getTexture() const
+{
+    return *d_surface;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTextureTarget::declareRenderSize(const Sizef& sz)
+{
+    const Sizef pixel_size(std::ceil(sz.d_width), std::ceil(sz.d_height));
+
+    // content is always redrawn after a size is declared, so there is no
+    // need to preserve it when resizing.
+    if (pixel_size != d_surface->getSize())
+        d_surface->setTextureSize(pixel_size);
+
+    setArea(Rectf(Vector2f(0, 0), pixel_size));
+}
+
+//----------------------------------------------------------------------------//
+bool SoftwareTextureTarget::isRenderingInverted() const
+{
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+String SoftwareTextureTarget::generateTextureName()
+{
+    String tmp("_software_tt_tex_");
+    tmp.append(PropertyHelper<uint>::toString(s_textureNumber++));
+
+    return tmp;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
+
+//----------------------------------------------------------------------------//
+// Implementation of template base class
+#include "./RenderTarget.inl"
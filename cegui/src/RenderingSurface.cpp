@@ -53,7 +53,11 @@ const String RenderingSurface::EventRenderQueueEnded("RenderQueueEnded");
 //----------------------------------------------------------------------------//
 RenderingSurface::RenderingSurface(RenderTarget& target) :
     d_target(&target),
-    d_invalidated(true)
+    d_invalidated(true),
+    d_partiallyInvalidated(false),
+    d_invalidatedArea(0, 0, 0, 0),
+    d_redrawnArea(0.0f),
+    d_lastRedrawnArea(0.0f)
 {
 }
 
@@ -103,6 +107,9 @@ void RenderingSurface::draw()
     drawContent();
 
     d_target->deactivate();
+
+    d_lastRedrawnArea = d_redrawnArea;
+    d_redrawnArea = 0.0f;
 }
 
 //----------------------------------------------------------------------------//
@@ -136,6 +143,31 @@ void RenderingSurface::draw(const RenderQueue& queue,
 void RenderingSurface::invalidate()
 {
     d_invalidated = true;
+    d_partiallyInvalidated = false;
+}
+
+//----------------------------------------------------------------------------//
+void RenderingSurface::invalidateArea(const Rectf&)
+{
+    invalidate();
+}
+
+//----------------------------------------------------------------------------//
+bool RenderingSurface::isPartiallyInvalidated() const
+{
+    return d_partiallyInvalidated;
+}
+
+//----------------------------------------------------------------------------//
+const Rectf& RenderingSurface::getInvalidatedArea() const
+{
+    return d_invalidatedArea;
+}
+
+//----------------------------------------------------------------------------//
+float RenderingSurface::getLastRedrawnArea() const
+{
+    return d_lastRedrawnArea;
 }
 
 //----------------------------------------------------------------------------//
@@ -33,6 +33,7 @@
 #include "CEGUI/GeometryBuffer.h"
 #include "CEGUI/Texture.h"
 #include "CEGUI/RenderEffect.h"
+#include "CEGUI/TextureTargetPool.h"
 
 // Start of CEGUI namespace section
 namespace CEGUI
@@ -41,13 +42,16 @@ namespace CEGUI
 RenderingWindow::RenderingWindow(TextureTarget& target, RenderingSurface& owner) :
     RenderingSurface(target),
     d_renderer(*System::getSingleton().getRenderer()),
-    d_textarget(target),
+    d_targetPool(System::getSingleton().getTextureTargetPool()),
+    d_textarget(&target),
     d_owner(&owner),
     d_geometry(&d_renderer.createGeometryBuffer()),
     d_geometryValid(false),
     d_position(0, 0),
     d_size(0, 0),
-    d_rotation(Quaternion::IDENTITY)
+    d_rotation(Quaternion::IDENTITY),
+    d_clippingRegion(0, 0, 0, 0),
+    d_geometryClippedToDamage(false)
 {
     d_geometry->setBlendMode(BM_RTT_PREMULTIPLIED);
 }
@@ -72,7 +76,9 @@ void RenderingWindow::setClippingRegion(const Rectf& region)
                       -static_cast<RenderingWindow*>(d_owner)->d_position.d_y));
     }
 
-    d_geometry->setClippingRegion(final_region);
+    d_clippingRegion = final_region;
+    d_geometry->setClippingRegion(d_clippingRegion);
+    d_geometryClippedToDamage = false;
 }
 
 //----------------------------------------------------------------------------//
@@ -101,7 +107,22 @@ void RenderingWindow::setSize(const Sizef& size)
     d_size = size;
     d_geometryValid = false;
 
-    d_textarget.declareRenderSize(d_size);
+    if (!d_targetPool.isAcquired(*d_textarget))
+    {
+        d_textarget->declareRenderSize(d_size);
+        return;
+    }
+
+    TextureTarget* const target = d_targetPool.resize(d_textarget, d_size);
+
+    // a different target has none of our content, so it all needs drawing.
+    if (target != d_textarget)
+    {
+        d_textarget = target;
+        d_target = target;
+        RenderingSurface::invalidate();
+        d_owner->invalidate();
+    }
 }
 
 //----------------------------------------------------------------------------//
@@ -145,7 +166,7 @@ const Vector3f& RenderingWindow::getPivot() const
 //----------------------------------------------------------------------------//
 const TextureTarget& RenderingWindow::getTextureTarget() const
 {
-    return d_textarget;
+    return *d_textarget;
 }
 
 //----------------------------------------------------------------------------//
@@ -204,14 +225,48 @@ void RenderingWindow::draw()
 
     if (d_invalidated)
     {
+        if (d_partiallyInvalidated)
+        {
+            // only the invalidated area gets cleared; our queued geometry has
+            // been clipped to that same area as it was queued.
+            d_textarget->clearArea(d_invalidatedArea);
+            d_redrawnArea += d_invalidatedArea.getWidth() *
+                             d_invalidatedArea.getHeight();
+        }
+        else
+            d_redrawnArea += d_size.d_width * d_size.d_height;
+
         // base class will render out queues for us
         RenderingSurface::draw();
+        d_targetPool.notifyCacheMiss();
         // mark as no longer invalidated
         d_invalidated = false;
+        d_partiallyInvalidated = false;
+    }
+    else
+    {
+        d_redrawnArea = 0.0f;
+        d_lastRedrawnArea = 0.0f;
+        d_targetPool.notifyCacheHit();
+    }
+
+    // restrict our imagery to the area being redrawn on a partially
+    // invalidated owner.
+    if (d_owner->isPartiallyInvalidated())
+    {
+        d_geometry->setClippingRegion(d_clippingRegion.getIntersection(
+            d_owner->getInvalidatedArea()));
+        d_geometryClippedToDamage = true;
+    }
+    else if (d_geometryClippedToDamage)
+    {
+        d_geometry->setClippingRegion(d_clippingRegion);
+        d_geometryClippedToDamage = false;
     }
 
     // add our geometry to our owner for rendering
     d_owner->addGeometryBuffer(RQ_BASE, *d_geometry);
+    d_owner->d_redrawnArea += d_lastRedrawnArea;
 }
 
 //----------------------------------------------------------------------------//
@@ -219,16 +274,68 @@ void RenderingWindow::invalidate()
 {
     // this override is potentially expensive, so only do the main work when we
     // have to.
-    if (!d_invalidated)
+    if (!d_invalidated || d_partiallyInvalidated)
     {
         RenderingSurface::invalidate();
-        d_textarget.clear();
+        d_textarget->clear();
     }
 
     // also invalidate what we render back to.
     d_owner->invalidate();
 }
 
+//----------------------------------------------------------------------------//
+void RenderingWindow::invalidateArea(const Rectf& area)
+{
+    // without partial clearing the whole surface has to be redrawn.
+    if (!d_textarget->isPartialClearSupported())
+    {
+        invalidate();
+        return;
+    }
+
+    const Rectf damage(area.getIntersection(Rectf(Vector2f(0, 0), d_size)));
+
+    // nothing we cache is affected.
+    if (damage.getWidth() <= 0.0f || damage.getHeight() <= 0.0f)
+        return;
+
+    if (!d_invalidated)
+    {
+        d_invalidated = true;
+        d_partiallyInvalidated = true;
+        d_invalidatedArea = damage;
+    }
+    else if (d_partiallyInvalidated)
+    {
+        d_invalidatedArea.d_min.d_x =
+            ceguimin(d_invalidatedArea.d_min.d_x, damage.d_min.d_x);
+        d_invalidatedArea.d_min.d_y =
+            ceguimin(d_invalidatedArea.d_min.d_y, damage.d_min.d_y);
+        d_invalidatedArea.d_max.d_x =
+            ceguimax(d_invalidatedArea.d_max.d_x, damage.d_max.d_x);
+        d_invalidatedArea.d_max.d_y =
+            ceguimax(d_invalidatedArea.d_max.d_y, damage.d_max.d_y);
+    }
+
+    // also invalidate what we render back to.  The area can only be mapped
+    // onto our owner when we are drawn there as a plain, unrotated quad.
+    if (d_rotation == Quaternion::IDENTITY && !d_geometry->getRenderEffect())
+    {
+        Rectf owner_area(damage);
+        owner_area.offset(d_position);
+
+        if (d_owner->isRenderingWindow())
+            owner_area.offset(Vector2f(
+                -static_cast<RenderingWindow*>(d_owner)->d_position.d_x,
+                -static_cast<RenderingWindow*>(d_owner)->d_position.d_y));
+
+        d_owner->invalidateArea(owner_area);
+    }
+    else
+        d_owner->invalidate();
+}
+
 //----------------------------------------------------------------------------//
 bool RenderingWindow::isRenderingWindow() const
 {
@@ -254,11 +361,11 @@ void RenderingWindow::realiseGeometry()
 //----------------------------------------------------------------------------//
 void RenderingWindow::realiseGeometry_impl()
 {
-   Texture& tex = d_textarget.getTexture();
+   Texture& tex = d_textarget->getTexture();
 
     const float tu = d_size.d_width * tex.getTexelScaling().d_x;
     const float tv = d_size.d_height * tex.getTexelScaling().d_y;
-    const Rectf tex_rect(d_textarget.isRenderingInverted() ?
+    const Rectf tex_rect(d_textarget->isRenderingInverted() ?
                           Rectf(0, 1, tu, 1 - tv) :
                           Rectf(0, 0, tu, tv));
 
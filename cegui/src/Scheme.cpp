@@ -43,6 +43,9 @@
 #include "CEGUI/XMLParser.h"
 #include "CEGUI/falagard/WidgetLookManager.h"
 #include "CEGUI/DynamicModule.h"
+#include "CEGUI/PropertyHelper.h"
+#include "CEGUI/ResourceProvider.h"
+#include "CEGUI/SimpleTimer.h"
 
 #ifdef HAVE_CONFIG_H
 #   include "config.h"
@@ -62,6 +65,18 @@ CEGUI::FactoryModule& getWindowFactoryModule();
 // Start of CEGUI namespace section
 namespace CEGUI
 {
+namespace
+{
+//! log the time taken to load the given resource.
+void logResourceLoadTime(const String& type, const String& name, double time)
+{
+    Logger& logger(Logger::getSingleton());
+
+    if (logger.isEventLogged(Informative))
+        logger.logEvent("Loaded " + type + " '" + name + "' in " +
+            PropertyHelper<double>::toString(time) + "s", Informative);
+}
+}
 
 /*************************************************************************
     Static Data definitions
@@ -100,6 +115,11 @@ void Scheme::loadResources(void)
 {
     Logger::getSingleton().logEvent("---- Begining resource loading for GUI scheme '" + d_name + "' ----", Informative);
 
+    SimpleTimer timer;
+
+    // start reading all data files before we begin to parse the first
+    prefetchResources();
+
     // load all resources specified for this scheme.
     loadXMLImagesets();
     loadImageFileImagesets();
@@ -110,7 +130,7 @@ void Scheme::loadResources(void)
     loadFactoryAliases();
     loadFalagardMappings();
 
-    Logger::getSingleton().logEvent("---- Resource loading for GUI scheme '" + d_name + "' completed ----", Informative);
+    Logger::getSingleton().logEvent("---- Resource loading for GUI scheme '" + d_name + "' completed in " + PropertyHelper<double>::toString(timer.elapsed()) + "s ----", Informative);
 }
 
 
@@ -156,6 +176,35 @@ bool Scheme::resourcesLoaded(void) const
 }
 
 
+/*************************************************************************
+    Hint to the resource provider that all data files will be loaded.
+*************************************************************************/
+void Scheme::prefetchResources() const
+{
+    ResourceProvider* const rp = System::getSingleton().getResourceProvider();
+    LoadableUIElementList::const_iterator pos;
+
+    for (pos = d_imagesets.begin(); pos != d_imagesets.end(); ++pos)
+        rp->prefetchRawData((*pos).filename, (*pos).resourceGroup.empty() ?
+            ImageManager::getImagesetDefaultResourceGroup() :
+            (*pos).resourceGroup);
+
+    for (pos = d_imagesetsFromImages.begin();
+        pos != d_imagesetsFromImages.end(); ++pos)
+        rp->prefetchRawData((*pos).filename, (*pos).resourceGroup.empty() ?
+            ImageManager::getImagesetDefaultResourceGroup() :
+            (*pos).resourceGroup);
+
+    for (pos = d_fonts.begin(); pos != d_fonts.end(); ++pos)
+        rp->prefetchRawData((*pos).filename, (*pos).resourceGroup.empty() ?
+            Font::getDefaultResourceGroup() : (*pos).resourceGroup);
+
+    for (pos = d_looknfeels.begin(); pos != d_looknfeels.end(); ++pos)
+        rp->prefetchRawData((*pos).filename, (*pos).resourceGroup.empty() ?
+            WidgetLookManager::getDefaultResourceGroup() :
+            (*pos).resourceGroup);
+}
+
 /*************************************************************************
     Load all xml imagesets specified.
 *************************************************************************/
@@ -165,8 +214,10 @@ void Scheme::loadXMLImagesets()
     for (LoadableUIElementList::iterator pos = d_imagesets.begin();
         pos != d_imagesets.end(); ++pos)
     {
+        SimpleTimer timer;
         ImageManager::getSingleton().loadImageset(
             (*pos).filename, (*pos).resourceGroup);
+        logResourceLoadTime("imageset", (*pos).filename, timer.elapsed());
     }
 }
 
@@ -187,7 +238,11 @@ void Scheme::loadImageFileImagesets()
 
         // see if image is present, and create it if not.
         if (!imgr.isDefined((*pos).name))
+        {
+            SimpleTimer timer;
             imgr.addFromImageFile((*pos).name, (*pos).filename, (*pos).resourceGroup);
+            logResourceLoadTime("image file", (*pos).filename, timer.elapsed());
+        }
     }
 }
 
@@ -207,7 +262,9 @@ void Scheme::loadFonts()
             continue;
 
         // create font using specified xml file.
+        SimpleTimer timer;
         Font& font = fntmgr.createFromFile((*pos).filename, (*pos).resourceGroup);
+        logResourceLoadTime("font", (*pos).filename, timer.elapsed());
         const String realname(font.getName());
 
         // if name was not in scheme, set it now and proceed to next font
@@ -242,7 +299,9 @@ void Scheme::loadLookNFeels()
     for (LoadableUIElementList::const_iterator pos = d_looknfeels.begin();
         pos != d_looknfeels.end(); ++pos)
     {
+        SimpleTimer timer;
         wlfMgr.parseLookNFeelSpecificationFromFile((*pos).filename, (*pos).resourceGroup);
+        logResourceLoadTime("looknfeel", (*pos).filename, timer.elapsed());
     }
 }
 
@@ -309,6 +368,8 @@ void Scheme::loadWindowRendererFactories()
     for (WRModuleList::iterator cmod = d_windowRendererModules.begin();
         cmod != d_windowRendererModules.end(); ++cmod)
     {
+        SimpleTimer timer;
+
         if (!(*cmod).factoryModule)
         {
 #if !defined(CEGUI_STATIC)
@@ -350,6 +411,9 @@ void Scheme::loadWindowRendererFactories()
             for (; elem != (*cmod).types.end(); ++elem)
                 (*cmod).factoryModule->registerFactory(*elem);
         }
+
+        logResourceLoadTime("window renderer module", (*cmod).name,
+                            timer.elapsed());
     }
 }
 
@@ -52,6 +52,8 @@
 #include "CEGUI/XMLParser.h"
 #include "CEGUI/GUIContext.h"
 #include "CEGUI/RenderingWindow.h"
+#include "CEGUI/TextureTargetPool.h"
+#include "CEGUI/DecodedImageCache.h"
 #include "CEGUI/RenderingContext.h"
 #include "CEGUI/DefaultResourceProvider.h"
 #include "CEGUI/ImageCodec.h"
@@ -122,6 +124,8 @@ System::System(Renderer& renderer,
                const String& logFile)
 
 : d_renderer(&renderer),
+  d_textureTargetPool(CEGUI_NEW_AO TextureTargetPool(renderer)),
+  d_decodedImageCache(CEGUI_NEW_AO DecodedImageCache()),
   d_resourceProvider(resourceProvider),
   d_ourResourceProvider(false),
   d_clipboard(CEGUI_NEW_AO Clipboard()),
@@ -303,6 +307,10 @@ System::~System(void)
         CEGUI_DELETE_AO *i;
     }
 
+    // all windows are gone, so all pooled targets are idle now.
+    CEGUI_DELETE_AO d_textureTargetPool;
+    CEGUI_DELETE_AO d_decodedImageCache;
+
     // cleanup resource provider if we own it
     if (d_ourResourceProvider)
         CEGUI_DELETE_AO d_resourceProvider;
@@ -415,6 +423,18 @@ const String& System::getVerboseVersion()
     return ret;
 }
 
+//----------------------------------------------------------------------------//
+TextureTargetPool& System::getTextureTargetPool() const
+{
+    return *d_textureTargetPool;
+}
+
+//----------------------------------------------------------------------------//
+DecodedImageCache& System::getDecodedImageCache() const
+{
+    return *d_decodedImageCache;
+}
+
 //----------------------------------------------------------------------------//
 void System::renderAllGUIContexts()
 {
@@ -574,6 +594,11 @@ void System::executeScriptString(const String& str) const
 bool System::injectTimePulse(float timeElapsed)
 {
     AnimationManager::getSingleton().autoStepInstances(timeElapsed);
+
+    // windows drawn using placeholders for the glyphs rasterised here are
+    // invalidated via Font::EventGlyphsRasterised.
+    FontManager::getSingleton().rasteriseDeferredGlyphs();
+
     return true;
 }
 
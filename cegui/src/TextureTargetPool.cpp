@@ -0,0 +1,297 @@
+/***********************************************************************
+    filename:   TextureTargetPool.cpp
+    created:    Sun Oct 18 2026
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2012 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/TextureTargetPool.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/TextureTarget.h"
+
+#include <cmath>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+const float TextureTargetPool::SIZE_GRANULARITY = 64.0f;
+const size_t TextureTargetPool::DEFAULT_IDLE_BUDGET = 8 * 1024 * 1024;
+
+//----------------------------------------------------------------------------//
+TextureTargetPool::TextureTargetPool(Renderer& renderer) :
+    d_renderer(renderer),
+    d_idleBudget(DEFAULT_IDLE_BUDGET),
+    d_idleBytes(0),
+    d_acquiredBytes(0),
+    d_cacheHits(0),
+    d_cacheMisses(0)
+{
+}
+
+//----------------------------------------------------------------------------//
+TextureTargetPool::~TextureTargetPool()
+{
+    destroyIdleTargets();
+}
+
+//----------------------------------------------------------------------------//
+TextureTarget* TextureTargetPool::acquire(const Sizef& size)
+{
+    Sizef capacity;
+    TextureTarget* target = takeIdleTarget(size, capacity);
+
+    if (target)
+    {
+        target->clear();
+    }
+    else
+    {
+        target = d_renderer.createTextureTarget();
+
+        // TextureTargets may not be available.
+        if (!target)
+            return 0;
+
+        capacity = getCapacityFor(size);
+        target->declareRenderSize(capacity);
+    }
+
+    d_acquiredTargets[target] = capacity;
+    d_acquiredBytes += getByteSize(capacity);
+
+    return target;
+}
+
+//----------------------------------------------------------------------------//
+void TextureTargetPool::release(TextureTarget* target)
+{
+    CapacityMap::iterator i = d_acquiredTargets.find(target);
+
+    if (i == d_acquiredTargets.end())
+        return;
+
+    const Entry entry = { target, i->second };
+    d_acquiredBytes -= getByteSize(entry.capacity);
+    d_acquiredTargets.erase(i);
+
+    d_idleTargets.push_back(entry);
+    d_idleBytes += getByteSize(entry.capacity);
+
+    trimIdleTargets();
+}
+
+//----------------------------------------------------------------------------//
+TextureTarget* TextureTargetPool::resize(TextureTarget* target,
+                                         const Sizef& size)
+{
+    CapacityMap::iterator i = d_acquiredTargets.find(target);
+
+    if (i == d_acquiredTargets.end() || isSuitable(i->second, size))
+        return target;
+
+    Sizef capacity;
+    TextureTarget* const idle = takeIdleTarget(size, capacity);
+
+    if (idle)
+    {
+        idle->clear();
+        d_acquiredTargets[idle] = capacity;
+        d_acquiredBytes += getByteSize(capacity);
+
+        release(target);
+        return idle;
+    }
+
+    // no idle target to swap in, so the texture has to be reallocated anyway.
+    capacity = getCapacityFor(size);
+    d_acquiredBytes += getByteSize(capacity);
+    d_acquiredBytes -= getByteSize(i->second);
+    i->second = capacity;
+    target->declareRenderSize(capacity);
+
+    return target;
+}
+
+//----------------------------------------------------------------------------//
+bool TextureTargetPool::isAcquired(const TextureTarget& target) const
+{
+    return d_acquiredTargets.find(&target) != d_acquiredTargets.end();
+}
+
+//----------------------------------------------------------------------------//
+void TextureTargetPool::destroyIdleTargets()
+{
+    for (EntryList::iterator i = d_idleTargets.begin();
+         i != d_idleTargets.end();
+         ++i)
+    {
+        d_renderer.destroyTextureTarget(i->target);
+    }
+
+    d_idleTargets.clear();
+    d_idleBytes = 0;
+}
+
+//----------------------------------------------------------------------------//
+void TextureTargetPool::setIdleBudget(size_t bytes)
+{
+    d_idleBudget = bytes;
+    trimIdleTargets();
+}
+
+//----------------------------------------------------------------------------//
+size_t TextureTargetPool::getIdleBudget() const
+{
+    return d_idleBudget;
+}
+
+//----------------------------------------------------------------------------//
+size_t TextureTargetPool::getTextureBytesInUse() const
+{
+    return d_acquiredBytes;
+}
+
+//----------------------------------------------------------------------------//
+size_t TextureTargetPool::getIdleTextureBytes() const
+{
+    return d_idleBytes;
+}
+
+//----------------------------------------------------------------------------//
+size_t TextureTargetPool::getAcquiredTargetCount() const
+{
+    return d_acquiredTargets.size();
+}
+
+//----------------------------------------------------------------------------//
+size_t TextureTargetPool::getIdleTargetCount() const
+{
+    return d_idleTargets.size();
+}
+
+//----------------------------------------------------------------------------//
+void TextureTargetPool::notifyCacheHit()
+{
+    ++d_cacheHits;
+}
+
+//----------------------------------------------------------------------------//
+void TextureTargetPool::notifyCacheMiss()
+{
+    ++d_cacheMisses;
+}
+
+//----------------------------------------------------------------------------//
+uint64 TextureTargetPool::getCacheHitCount() const
+{
+    return d_cacheHits;
+}
+
+//----------------------------------------------------------------------------//
+uint64 TextureTargetPool::getCacheMissCount() const
+{
+    return d_cacheMisses;
+}
+
+//----------------------------------------------------------------------------//
+void TextureTargetPool::resetCacheStatistics()
+{
+    d_cacheHits = 0;
+    d_cacheMisses = 0;
+}
+
+//----------------------------------------------------------------------------//
+Sizef TextureTargetPool::getCapacityFor(const Sizef& size)
+{
+    const float w = std::ceil(ceguimax(size.d_width, 1.0f) / SIZE_GRANULARITY);
+    const float h = std::ceil(ceguimax(size.d_height, 1.0f) / SIZE_GRANULARITY);
+
+    return Sizef(w * SIZE_GRANULARITY, h * SIZE_GRANULARITY);
+}
+
+//----------------------------------------------------------------------------//
+size_t TextureTargetPool::getByteSize(const Sizef& capacity)
+{
+    // assume 32 bit pixels, which is what all the renderer modules use.
+    return static_cast<size_t>(capacity.d_width) *
+           static_cast<size_t>(capacity.d_height) * 4;
+}
+
+//----------------------------------------------------------------------------//
+bool TextureTargetPool::isSuitable(const Sizef& capacity, const Sizef& size)
+{
+    if (capacity.d_width < size.d_width || capacity.d_height < size.d_height)
+        return false;
+
+    // avoid tying up a texture that is much larger than is needed.
+    const Sizef needed(getCapacityFor(size));
+    return capacity.d_width * capacity.d_height <=
+           needed.d_width * needed.d_height * 4.0f;
+}
+
+//----------------------------------------------------------------------------//
+TextureTarget* TextureTargetPool::takeIdleTarget(const Sizef& size,
+                                                 Sizef& capacity)
+{
+    EntryList::iterator best = d_idleTargets.end();
+
+    for (EntryList::iterator i = d_idleTargets.begin();
+         i != d_idleTargets.end();
+         ++i)
+    {
+        if (!isSuitable(i->capacity, size))
+            continue;
+
+        if (best == d_idleTargets.end() ||
+            i->capacity.d_width * i->capacity.d_height <
+                best->capacity.d_width * best->capacity.d_height)
+        {
+            best = i;
+        }
+    }
+
+    if (best == d_idleTargets.end())
+        return 0;
+
+    TextureTarget* const target = best->target;
+    capacity = best->capacity;
+    d_idleBytes -= getByteSize(capacity);
+    d_idleTargets.erase(best);
+
+    return target;
+}
+
+//----------------------------------------------------------------------------//
+void TextureTargetPool::trimIdleTargets()
+{
+    while (d_idleBytes > d_idleBudget && !d_idleTargets.empty())
+    {
+        d_idleBytes -= getByteSize(d_idleTargets.front().capacity);
+        d_renderer.destroyTextureTarget(d_idleTargets.front().target);
+        d_idleTargets.erase(d_idleTargets.begin());
+    }
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -45,7 +45,9 @@
 #include "CEGUI/GUIContext.h"
 #include "CEGUI/RenderingContext.h"
 #include "CEGUI/RenderingWindow.h"
+#include "CEGUI/TextureTargetPool.h"
 #include "CEGUI/GlobalEventSet.h"
+#include "CEGUI/EventID.h"
 #include <algorithm>
 #include <iterator>
 #include <cmath>
@@ -113,6 +115,52 @@ const String Window::EventKeyDown("KeyDown");
 const String Window::EventKeyUp("KeyUp");
 const String Window::EventCharacterKey("CharacterKey");
 
+//----------------------------------------------------------------------------//
+// Interned ids of the Window events, used to fire them without building and
+// looking up the global "Window/<Event>" name each time.
+static const EventID s_eventUpdatedID(Window::EventUpdated, Window::EventNamespace);
+static const EventID s_eventTextChangedID(Window::EventTextChanged, Window::EventNamespace);
+static const EventID s_eventFontChangedID(Window::EventFontChanged, Window::EventNamespace);
+static const EventID s_eventAlphaChangedID(Window::EventAlphaChanged, Window::EventNamespace);
+static const EventID s_eventIDChangedID(Window::EventIDChanged, Window::EventNamespace);
+static const EventID s_eventActivatedID(Window::EventActivated, Window::EventNamespace);
+static const EventID s_eventDeactivatedID(Window::EventDeactivated, Window::EventNamespace);
+static const EventID s_eventShownID(Window::EventShown, Window::EventNamespace);
+static const EventID s_eventHiddenID(Window::EventHidden, Window::EventNamespace);
+static const EventID s_eventEnabledID(Window::EventEnabled, Window::EventNamespace);
+static const EventID s_eventDisabledID(Window::EventDisabled, Window::EventNamespace);
+static const EventID s_eventClippedByParentChangedID(Window::EventClippedByParentChanged, Window::EventNamespace);
+static const EventID s_eventDestroyedByParentChangedID(Window::EventDestroyedByParentChanged, Window::EventNamespace);
+static const EventID s_eventInheritsAlphaChangedID(Window::EventInheritsAlphaChanged, Window::EventNamespace);
+static const EventID s_eventAlwaysOnTopChangedID(Window::EventAlwaysOnTopChanged, Window::EventNamespace);
+static const EventID s_eventInputCaptureGainedID(Window::EventInputCaptureGained, Window::EventNamespace);
+static const EventID s_eventInputCaptureLostID(Window::EventInputCaptureLost, Window::EventNamespace);
+static const EventID s_eventInvalidatedID(Window::EventInvalidated, Window::EventNamespace);
+static const EventID s_eventRenderingStartedID(Window::EventRenderingStarted, Window::EventNamespace);
+static const EventID s_eventRenderingEndedID(Window::EventRenderingEnded, Window::EventNamespace);
+static const EventID s_eventDestructionStartedID(Window::EventDestructionStarted, Window::EventNamespace);
+static const EventID s_eventDragDropItemEntersID(Window::EventDragDropItemEnters, Window::EventNamespace);
+static const EventID s_eventDragDropItemLeavesID(Window::EventDragDropItemLeaves, Window::EventNamespace);
+static const EventID s_eventDragDropItemDroppedID(Window::EventDragDropItemDropped, Window::EventNamespace);
+static const EventID s_eventWindowRendererAttachedID(Window::EventWindowRendererAttached, Window::EventNamespace);
+static const EventID s_eventWindowRendererDetachedID(Window::EventWindowRendererDetached, Window::EventNamespace);
+static const EventID s_eventTextParsingChangedID(Window::EventTextParsingChanged, Window::EventNamespace);
+static const EventID s_eventMarginChangedID(Window::EventMarginChanged, Window::EventNamespace);
+static const EventID s_eventMouseEntersAreaID(Window::EventMouseEntersArea, Window::EventNamespace);
+static const EventID s_eventMouseLeavesAreaID(Window::EventMouseLeavesArea, Window::EventNamespace);
+static const EventID s_eventMouseEntersSurfaceID(Window::EventMouseEntersSurface, Window::EventNamespace);
+static const EventID s_eventMouseLeavesSurfaceID(Window::EventMouseLeavesSurface, Window::EventNamespace);
+static const EventID s_eventMouseMoveID(Window::EventMouseMove, Window::EventNamespace);
+static const EventID s_eventMouseWheelID(Window::EventMouseWheel, Window::EventNamespace);
+static const EventID s_eventMouseButtonDownID(Window::EventMouseButtonDown, Window::EventNamespace);
+static const EventID s_eventMouseButtonUpID(Window::EventMouseButtonUp, Window::EventNamespace);
+static const EventID s_eventMouseClickID(Window::EventMouseClick, Window::EventNamespace);
+static const EventID s_eventMouseDoubleClickID(Window::EventMouseDoubleClick, Window::EventNamespace);
+static const EventID s_eventMouseTripleClickID(Window::EventMouseTripleClick, Window::EventNamespace);
+static const EventID s_eventKeyDownID(Window::EventKeyDown, Window::EventNamespace);
+static const EventID s_eventKeyUpID(Window::EventKeyUp, Window::EventNamespace);
+static const EventID s_eventCharacterKeyID(Window::EventCharacterKey, Window::EventNamespace);
+
 //----------------------------------------------------------------------------//
 // XML element and attribute names that relate to Window.
 const String Window::WindowXMLElementName("Window");
@@ -127,6 +175,14 @@ const String Window::UserStringValueXMLAttributeName("value");
 //----------------------------------------------------------------------------//
 const String Window::TooltipNameSuffix("__auto_tooltip__");
 
+//----------------------------------------------------------------------------//
+// return whether something has subscribed to the update event of all windows.
+static bool isGlobalUpdateEventSubscribed()
+{
+    GlobalEventSet* const ges = GlobalEventSet::getSingletonPtr();
+    return ges && ges->isEventSubscribed(s_eventUpdatedID);
+}
+
 //----------------------------------------------------------------------------//
 BasicRenderedStringParser Window::d_basicStringParser;
 DefaultRenderedStringParser Window::d_defaultStringParser;
@@ -201,6 +257,10 @@ Window::Window(const String& type, const String& name):
     d_surface(0),
     d_needsRedraw(true),
     d_autoRenderingWindow(false),
+    d_autoCached(false),
+    d_contentChanged(true),
+    d_unchangedRedrawCount(0),
+    d_changedRedrawCount(0),
     d_mouseCursor(0),
 
     // alpha transparency set up
@@ -270,6 +330,14 @@ Window::Window(const String& type, const String& name):
     d_outerRectClipperValid(false),
     d_innerRectClipperValid(false),
     d_hitTestRectValid(false),
+    d_hitTestBounds(0, 0, 0, 0),
+    d_hitTestBoundsUnbounded(false),
+    d_hitTestBoundsValid(false),
+    d_subtreeUpdateRequired(false),
+    d_updateRequirementValid(false),
+    d_updateEventSubscribed(false),
+    d_recordSubscriptions(false),
+    d_geometryClippedToDamage(false),
 
     // Initial update mode
     d_updateMode(WUM_VISIBLE),
@@ -284,7 +352,12 @@ Window::Window(const String& type, const String& name):
     d_fontRenderSizeChangeConnection(
         GlobalEventSet::getSingleton().subscribeEvent(
             "Font/RenderSizeChanged",
-            Event::Subscriber(&Window::handleFontRenderSizeChange, this)))
+            Event::Subscriber(&Window::handleFontRenderSizeChange, this))),
+
+    d_fontGlyphsRasterisedConnection(
+        GlobalEventSet::getSingleton().subscribeEvent(
+            "Font/GlyphsRasterised",
+            Event::Subscriber(&Window::handleFontGlyphsRasterised, this)))
 {
     // add properties
     addWindowProperties();
@@ -598,7 +671,7 @@ Window* Window::getChildAtPosition(const Vector2f& position) const
 //----------------------------------------------------------------------------//
 Window* Window::getChildAtPosition(const Vector2f& position,
                     bool (Window::*hittestfunc)(const Vector2f&, bool) const,
-                    bool allow_disabled) const
+                    bool allow_disabled, bool use_hit_test_bounds) const
 {
     Vector2f p;
     // if the window has RenderingWindow backing
@@ -614,8 +687,12 @@ Window* Window::getChildAtPosition(const Vector2f& position,
     {
         if ((*child)->isEffectiveVisible())
         {
+            // skip the child, and its children, if none of them can be hit
+            if (use_hit_test_bounds && !(*child)->isInHitTestBounds(p))
+                continue;
+
             // recursively scan for hit on children of this child window...
-            if (Window* const wnd = (*child)->getChildAtPosition(p, hittestfunc, allow_disabled))
+            if (Window* const wnd = (*child)->getChildAtPosition(p, hittestfunc, allow_disabled, use_hit_test_bounds))
                 return wnd;
             // see if this child is hit and return it's pointer if it is
             else if (((*child)->*hittestfunc)(p, allow_disabled))
@@ -627,6 +704,71 @@ Window* Window::getChildAtPosition(const Vector2f& position,
     return 0;
 }
 
+//----------------------------------------------------------------------------//
+bool Window::isInHitTestBounds(const Vector2f& position) const
+{
+    if (!d_hitTestBoundsValid)
+        updateHitTestBounds();
+
+    return d_hitTestBoundsUnbounded || d_hitTestBounds.isPointInRect(position);
+}
+
+//----------------------------------------------------------------------------//
+void Window::updateHitTestBounds() const
+{
+    // children of a rotated RenderingWindow are hit tested using unprojected
+    // positions, so their areas can not bound positions given to this window.
+    d_hitTestBoundsUnbounded = d_surface && d_surface->isRenderingWindow() &&
+        static_cast<RenderingWindow*>(d_surface)->getRotation() != Quaternion::IDENTITY;
+
+    Rectf bounds(getHitTestRect());
+    bool empty = (bounds.getWidth() <= 0.0f) || (bounds.getHeight() <= 0.0f);
+
+    const size_t child_count = getChildCount();
+    for (size_t i = 0; i < child_count; ++i)
+    {
+        const Window* const child = getChildAtIdx(i);
+
+        if (!child->d_hitTestBoundsValid)
+            child->updateHitTestBounds();
+
+        if (child->d_hitTestBoundsUnbounded)
+            d_hitTestBoundsUnbounded = true;
+
+        const Rectf& child_bounds = child->d_hitTestBounds;
+        if ((child_bounds.getWidth() <= 0.0f) || (child_bounds.getHeight() <= 0.0f))
+            continue;
+
+        if (empty)
+        {
+            bounds = child_bounds;
+            empty = false;
+        }
+        else
+        {
+            bounds.d_min.d_x = ceguimin(bounds.d_min.d_x, child_bounds.d_min.d_x);
+            bounds.d_min.d_y = ceguimin(bounds.d_min.d_y, child_bounds.d_min.d_y);
+            bounds.d_max.d_x = ceguimax(bounds.d_max.d_x, child_bounds.d_max.d_x);
+            bounds.d_max.d_y = ceguimax(bounds.d_max.d_y, child_bounds.d_max.d_y);
+        }
+    }
+
+    d_hitTestBounds = empty ? Rectf(0, 0, 0, 0) : bounds;
+    d_hitTestBoundsValid = true;
+}
+
+//----------------------------------------------------------------------------//
+void Window::invalidateHitTestBounds() const
+{
+    // bounds are only ever valid when those of all descendants are, so we can
+    // stop at the first ancestor that is already invalid.
+    for (const Window* wnd = this; wnd && wnd->d_hitTestBoundsValid;
+         wnd = wnd->getParent())
+    {
+        wnd->d_hitTestBoundsValid = false;
+    }
+}
+
 //----------------------------------------------------------------------------//
 Window* Window::getTargetChildAtPosition(const Vector2f& position,
                                          const bool allow_disabled) const
@@ -1036,7 +1178,11 @@ void Window::invalidate(const bool recursive)
 void Window::invalidate_impl(const bool recursive)
 {
     d_needsRedraw = true;
-    invalidateRenderingSurface();
+
+    if (getGUIContext().isPartialRedrawEnabled())
+        invalidateRenderingSurfaceArea();
+    else
+        invalidateRenderingSurface();
 
     WindowEventArgs args(this);
     onInvalidated(args);
@@ -1122,6 +1268,20 @@ void Window::bufferGeometry(const RenderingContext&)
 //----------------------------------------------------------------------------//
 void Window::queueGeometry(const RenderingContext& ctx)
 {
+    // when only part of the surface is being redrawn, restrict our geometry to
+    // that part so content outside of it is left as it is.
+    if (ctx.surface->isPartiallyInvalidated())
+    {
+        d_geometry->setClippingRegion(getGeometryClipRect(ctx).getIntersection(
+            ctx.surface->getInvalidatedArea()));
+        d_geometryClippedToDamage = true;
+    }
+    else if (d_geometryClippedToDamage)
+    {
+        d_geometry->setClippingRegion(getGeometryClipRect(ctx));
+        d_geometryClippedToDamage = false;
+    }
+
     // add geometry so that it gets drawn to the target surface.
     ctx.surface->addGeometryBuffer(ctx.queue, *d_geometry);
 }
@@ -1155,9 +1315,11 @@ void Window::syncTargetSurface()
 //----------------------------------------------------------------------------//
 void Window::cleanupChildren(void)
 {
+    // work from the back so each removal from the child and draw lists is
+    // cheap, otherwise tearing down a wide window is quadratic.
     while(getChildCount() != 0)
     {
-        Window* wnd = static_cast<Window*>(d_children[0]);
+        Window* wnd = static_cast<Window*>(d_children.back());
 
         // always remove child
         removeChild(wnd);
@@ -1185,6 +1347,8 @@ void Window::addChild_impl(Element* element)
     NamedElement::addChild_impl(wnd);
 
     addWindowToDrawList(*wnd);
+    invalidateHitTestBounds();
+    notifyUpdateRequirementChanged();
 
     wnd->invalidate(true);
 
@@ -1203,6 +1367,8 @@ void Window::removeChild_impl(Element* element)
 
     // remove from draw list
     removeWindowFromDrawList(*wnd);
+    invalidateHitTestBounds();
+    notifyUpdateRequirementChanged();
 
     Element::removeChild_impl(wnd);
     
@@ -1562,21 +1728,120 @@ void Window::update(float elapsed)
         static_cast<RenderingWindow*>(d_surface)->update(elapsed);
 
     UpdateEventArgs e(this,elapsed);
-    fireEvent(EventUpdated,e,EventNamespace);
+    fireEvent(s_eventUpdatedID, e);
+
+    // the last subscription may have been disconnected since we last looked.
+    if (d_updateEventSubscribed)
+    {
+        const Event* const updated = getEventObject(EventUpdated);
+        if (!updated || updated->getConnectionCount() == 0)
+        {
+            d_updateEventSubscribed = false;
+            notifyUpdateRequirementChanged();
+        }
+    }
+
+    if (getChildCount() == 0)
+        return;
+
+    // idle subtrees are only skipped when the GUIContext asks for that, and
+    // never while something subscribed to the update event globally, since
+    // that wants to hear about every window.
+    const bool update_all =
+        !getGUIContext().isIdleUpdateSkippingEnabled() ||
+        isGlobalUpdateEventSubscribed();
 
     // update child windows
     for (size_t i = 0; i < getChildCount(); ++i)
     {
+        Window* const child = getChildAtIdx(i);
+
         // update children based on their WindowUpdateMode setting.
-        if (getChildAtIdx(i)->d_updateMode == WUM_ALWAYS ||
-                (getChildAtIdx(i)->d_updateMode == WUM_VISIBLE &&
-                 getChildAtIdx(i)->isVisible()))
+        if ((child->d_updateMode == WUM_ALWAYS ||
+                (child->d_updateMode == WUM_VISIBLE && child->isVisible())) &&
+            (update_all || child->isSubtreeUpdateRequired()))
         {
-            getChildAtIdx(i)->update(elapsed);
+            child->update(elapsed);
         }
     }
 }
 
+//----------------------------------------------------------------------------//
+bool Window::isUpdateRequired() const
+{
+    return d_updateEventSubscribed ||
+           (d_autoRepeat && d_repeatButton != NoButton) ||
+           (d_surface && d_surface->isRenderingWindow()) ||
+           (d_windowRenderer && d_windowRenderer->isUpdateRequired());
+}
+
+//----------------------------------------------------------------------------//
+bool Window::isSubtreeUpdateRequired() const
+{
+    if (!d_updateRequirementValid)
+    {
+        d_subtreeUpdateRequired = isUpdateRequired();
+
+        // all children are visited (no early out) so that every cache below
+        // us is valid when ours is; notifyUpdateRequirementChanged relies on
+        // that to stop at the first already invalid window.
+        const size_t child_count = getChildCount();
+        for (size_t i = 0; i < child_count; ++i)
+            if (getChildAtIdx(i)->isSubtreeUpdateRequired())
+                d_subtreeUpdateRequired = true;
+
+        d_updateRequirementValid = true;
+    }
+
+    return d_subtreeUpdateRequired;
+}
+
+//----------------------------------------------------------------------------//
+void Window::notifyUpdateRequirementChanged() const
+{
+    for (const Window* wnd = this; wnd && wnd->d_updateRequirementValid;
+         wnd = wnd->getParent())
+    {
+        wnd->d_updateRequirementValid = false;
+    }
+}
+
+//----------------------------------------------------------------------------//
+Event::Connection Window::subscribeEvent(const String& name,
+                                         Event::Subscriber subscriber)
+{
+    if (name == EventUpdated)
+    {
+        d_updateEventSubscribed = true;
+        notifyUpdateRequirementChanged();
+    }
+
+    const Event::Connection connection(EventSet::subscribeEvent(name, subscriber));
+
+    if (d_recordSubscriptions)
+        recordSubscription(connection);
+
+    return connection;
+}
+
+//----------------------------------------------------------------------------//
+Event::Connection Window::subscribeEvent(const String& name, Event::Group group,
+                                         Event::Subscriber subscriber)
+{
+    if (name == EventUpdated)
+    {
+        d_updateEventSubscribed = true;
+        notifyUpdateRequirementChanged();
+    }
+
+    const Event::Connection connection(EventSet::subscribeEvent(name, group, subscriber));
+
+    if (d_recordSubscriptions)
+        recordSubscription(connection);
+
+    return connection;
+}
+
 //----------------------------------------------------------------------------//
 void Window::updateSelf(float elapsed)
 {
@@ -1749,6 +2014,71 @@ void Window::destroy(void)
     invalidate();
 }
 
+//----------------------------------------------------------------------------//
+static bool isDisconnected(const Event::Connection& connection)
+{
+    return !connection->connected();
+}
+
+//----------------------------------------------------------------------------//
+void Window::recordSubscription(const Event::Connection& connection)
+{
+    // drop connections that went away meanwhile before growing the list, so
+    // that long lived windows do not accumulate them.
+    if (d_recordedSubscriptions.size() == d_recordedSubscriptions.capacity())
+        d_recordedSubscriptions.erase(
+            std::remove_if(d_recordedSubscriptions.begin(),
+                           d_recordedSubscriptions.end(),
+                           isDisconnected),
+            d_recordedSubscriptions.end());
+
+    d_recordedSubscriptions.push_back(connection);
+}
+
+//----------------------------------------------------------------------------//
+void Window::prepareForRecycling(void)
+{
+    // let interested parties know this incarnation of the window is ending
+    WindowEventArgs args(this);
+    onDestructionStarted(args);
+    d_destructionStarted = false;
+
+    // drop subscriptions made by whoever was using the window
+    for (ConnectionList::iterator i = d_recordedSubscriptions.begin();
+         i != d_recordedSubscriptions.end(); ++i)
+    {
+        (*i)->disconnect();
+    }
+    d_recordedSubscriptions.clear();
+
+    releaseInput();
+
+    Tooltip* const tip = getTooltip();
+    if (tip && tip->getTargetWindow()==this)
+        tip->setTargetWindow(0);
+
+    setTooltip(static_cast<Tooltip*>(0));
+
+    if (d_parent)
+        d_parent->removeChild(this);
+
+    // remove everything but the auto-windows created by our look
+    for (size_t i = getChildCount(); i != 0; --i)
+    {
+        Window* wnd = static_cast<Window*>(d_children[i - 1]);
+
+        if (wnd->isAutoWindow())
+            continue;
+
+        removeChild(wnd);
+
+        if (wnd->isDestroyedByParent())
+            WindowManager::getSingleton().destroyWindow(wnd);
+    }
+
+    d_userData = 0;
+}
+
 //----------------------------------------------------------------------------//
 bool Window::isUsingDefaultTooltip(void) const
 {
@@ -1842,6 +2172,15 @@ void Window::setInheritsTooltipText(bool setting)
     d_inheritsTipText = setting;
 }
 
+//----------------------------------------------------------------------------//
+void Window::endAreaUpdate()
+{
+    Element::endAreaUpdate();
+
+    if (!isAreaUpdateDeferred())
+        getGUIContext().updateWindowContainingMouse();
+}
+
 //----------------------------------------------------------------------------//
 void Window::setArea_impl(const UVector2& pos, const USize& size,
                           bool topLeftSizing, bool fireEvents)
@@ -1849,6 +2188,10 @@ void Window::setArea_impl(const UVector2& pos, const USize& size,
     markCachedWindowRectsInvalid();
     Element::setArea_impl(pos, size, topLeftSizing, fireEvents);
 
+    // the remaining updates happen when the deferred notifications are sent.
+    if (isAreaUpdateDeferred())
+        return;
+
     //if (moved || sized)
     // FIXME: This is potentially wasteful
     getGUIContext().updateWindowContainingMouse();
@@ -1865,6 +2208,7 @@ void Window::markCachedWindowRectsInvalid()
     d_outerRectClipperValid = false;
     d_innerRectClipperValid = false;
     d_hitTestRectValid = false;
+    invalidateHitTestBounds();
 }
 
 //----------------------------------------------------------------------------//
@@ -1893,7 +2237,7 @@ void Window::setLookNFeel(const String& look)
     }
 
     d_lookName = look;
-    Logger::getSingleton().logEvent("Assigning LookNFeel '" + look +
+    CEGUI_LOGEVENT("Assigning LookNFeel '" + look +
         "' to window '" + d_name + "'.", Informative);
 
     // Work to initialise the look and feel...
@@ -2153,13 +2497,14 @@ void Window::removeWindowFromDrawList(const Window& wnd)
     // if draw list is not empty
     if (!d_drawList.empty())
     {
-        // attempt to find the window in the draw list
-        const ChildDrawList::iterator position =
-            std::find(d_drawList.begin(), d_drawList.end(), &wnd);
+        // attempt to find the window in the draw list (searching backwards,
+        // since recently added windows are the most likely to be removed)
+        const ChildDrawList::reverse_iterator position =
+            std::find(d_drawList.rbegin(), d_drawList.rend(), &wnd);
 
         // remove the window if it was found in the draw list
-        if (position != d_drawList.end())
-            d_drawList.erase(position);
+        if (position != d_drawList.rend())
+            d_drawList.erase(--position.base());
     }
 }
 
@@ -2215,9 +2560,14 @@ void Window::onSized(ElementEventArgs& e)
     notifyScreenAreaChanged(false);
     performChildWindowLayout(true, true);
 
+    // area covered changes, so the whole surface must be redrawn.
+    invalidateRenderingSurface();
     invalidate();
 
-    fireEvent(EventSized, e, EventNamespace);
+    // Element's event names are defined in another translation unit, so
+    // this id is interned on first use rather than during static init.
+    static const EventID sized_id(EventSized, EventNamespace);
+    fireEvent(sized_id, e);
 }
 
 //----------------------------------------------------------------------------//
@@ -2239,7 +2589,7 @@ void Window::onMoved(ElementEventArgs& e)
 void Window::onTextChanged(WindowEventArgs& e)
 {
     invalidate();
-    fireEvent(EventTextChanged, e, EventNamespace);
+    fireEvent(s_eventTextChangedID, e);
 }
 
 //----------------------------------------------------------------------------//
@@ -2251,7 +2601,7 @@ void Window::onFontChanged(WindowEventArgs& e)
     performChildWindowLayout();
 
     invalidate();
-    fireEvent(EventFontChanged, e, EventNamespace);
+    fireEvent(s_eventFontChangedID, e);
 }
 
 //----------------------------------------------------------------------------//
@@ -2271,20 +2621,22 @@ void Window::onAlphaChanged(WindowEventArgs& e)
     }
 
     invalidate();
-    fireEvent(EventAlphaChanged, e, EventNamespace);
+    fireEvent(s_eventAlphaChangedID, e);
 }
 
 //----------------------------------------------------------------------------//
 void Window::onIDChanged(WindowEventArgs& e)
 {
-    fireEvent(EventIDChanged, e, EventNamespace);
+    fireEvent(s_eventIDChangedID, e);
 }
 
 //----------------------------------------------------------------------------//
 void Window::onShown(WindowEventArgs& e)
 {
+    // area covered may change, so the whole surface must be redrawn.
+    invalidateRenderingSurface();
     invalidate();
-    fireEvent(EventShown, e, EventNamespace);
+    fireEvent(s_eventShownID, e);
 }
 
 //----------------------------------------------------------------------------//
@@ -2294,8 +2646,10 @@ void Window::onHidden(WindowEventArgs& e)
     if (isActive())
         deactivate();
 
+    // area covered changes, so the whole surface must be redrawn.
+    invalidateRenderingSurface();
     invalidate();
-    fireEvent(EventHidden, e, EventNamespace);
+    fireEvent(s_eventHiddenID, e);
 }
 
 //----------------------------------------------------------------------------//
@@ -2314,7 +2668,7 @@ void Window::onEnabled(WindowEventArgs& e)
     }
 
     invalidate();
-    fireEvent(EventEnabled, e, EventNamespace);
+    fireEvent(s_eventEnabledID, e);
 }
 
 //----------------------------------------------------------------------------//
@@ -2333,28 +2687,30 @@ void Window::onDisabled(WindowEventArgs& e)
     }
 
     invalidate();
-    fireEvent(EventDisabled, e, EventNamespace);
+    fireEvent(s_eventDisabledID, e);
 }
 
 //----------------------------------------------------------------------------//
 void Window::onClippingChanged(WindowEventArgs& e)
 {
+    // area covered may change, so the whole surface must be redrawn.
+    invalidateRenderingSurface();
     invalidate();
     notifyClippingChanged();
-    fireEvent(EventClippedByParentChanged, e, EventNamespace);
+    fireEvent(s_eventClippedByParentChangedID, e);
 }
 
 //----------------------------------------------------------------------------//
 void Window::onParentDestroyChanged(WindowEventArgs& e)
 {
-    fireEvent(EventDestroyedByParentChanged, e, EventNamespace);
+    fireEvent(s_eventDestroyedByParentChangedID, e);
 }
 
 //----------------------------------------------------------------------------//
 void Window::onInheritsAlphaChanged(WindowEventArgs& e)
 {
     invalidate();
-    fireEvent(EventInheritsAlphaChanged, e, EventNamespace);
+    fireEvent(s_eventInheritsAlphaChangedID, e);
 }
 
 //----------------------------------------------------------------------------//
@@ -2363,13 +2719,13 @@ void Window::onAlwaysOnTopChanged(WindowEventArgs& e)
     // we no longer want a total redraw here, instead we just get each window
     // to resubmit it's imagery to the Renderer.
     getGUIContext().markAsDirty();
-    fireEvent(EventAlwaysOnTopChanged, e, EventNamespace);
+    fireEvent(s_eventAlwaysOnTopChangedID, e);
 }
 
 //----------------------------------------------------------------------------//
 void Window::onCaptureGained(WindowEventArgs& e)
 {
-    fireEvent(EventInputCaptureGained, e, EventNamespace);
+    fireEvent(s_eventInputCaptureGainedID, e);
 }
 
 //----------------------------------------------------------------------------//
@@ -2389,25 +2745,25 @@ void Window::onCaptureLost(WindowEventArgs& e)
     // this for us).
     getGUIContext().injectMouseMove(0, 0);
 
-    fireEvent(EventInputCaptureLost, e, EventNamespace);
+    fireEvent(s_eventInputCaptureLostID, e);
 }
 
 //----------------------------------------------------------------------------//
 void Window::onInvalidated(WindowEventArgs& e)
 {
-    fireEvent(EventInvalidated, e, EventNamespace);
+    fireEvent(s_eventInvalidatedID, e);
 }
 
 //----------------------------------------------------------------------------//
 void Window::onRenderingStarted(WindowEventArgs& e)
 {
-    fireEvent(EventRenderingStarted, e, EventNamespace);
+    fireEvent(s_eventRenderingStartedID, e);
 }
 
 //----------------------------------------------------------------------------//
 void Window::onRenderingEnded(WindowEventArgs& e)
 {
-    fireEvent(EventRenderingEnded, e, EventNamespace);
+    fireEvent(s_eventRenderingEndedID, e);
 }
 
 //----------------------------------------------------------------------------//
@@ -2416,14 +2772,16 @@ void Window::onZChanged(WindowEventArgs& e)
     // we no longer want a total redraw here, instead we just get each window
     // to resubmit it's imagery to the Renderer.
     getGUIContext().markAsDirty();
-    fireEvent(EventZOrderChanged, e, EventNamespace);
+    // see onSized as to why this id is interned on first use.
+    static const EventID zorder_changed_id(EventZOrderChanged, EventNamespace);
+    fireEvent(zorder_changed_id, e);
 }
 
 //----------------------------------------------------------------------------//
 void Window::onDestructionStarted(WindowEventArgs& e)
 {
     d_destructionStarted = true;
-    fireEvent(EventDestructionStarted, e, EventNamespace);
+    fireEvent(s_eventDestructionStartedID, e);
 }
 
 //----------------------------------------------------------------------------//
@@ -2431,7 +2789,7 @@ void Window::onActivated(ActivationEventArgs& e)
 {
     d_active = true;
     invalidate();
-    fireEvent(EventActivated, e, EventNamespace);
+    fireEvent(s_eventActivatedID, e);
 }
 
 //----------------------------------------------------------------------------//
@@ -2453,7 +2811,7 @@ void Window::onDeactivated(ActivationEventArgs& e)
 
     d_active = false;
     invalidate();
-    fireEvent(EventDeactivated, e, EventNamespace);
+    fireEvent(s_eventDeactivatedID, e);
 }
 
 //----------------------------------------------------------------------------//
@@ -2493,14 +2851,14 @@ void Window::onChildRemoved(ElementEventArgs& e)
 void Window::onMouseEntersArea(MouseEventArgs& e)
 {
     d_containsMouse = true;
-    fireEvent(EventMouseEntersArea, e, EventNamespace);
+    fireEvent(s_eventMouseEntersAreaID, e);
 }
 
 //----------------------------------------------------------------------------//
 void Window::onMouseLeavesArea(MouseEventArgs& e)
 {
     d_containsMouse = false;
-    fireEvent(EventMouseLeavesArea, e, EventNamespace);
+    fireEvent(s_eventMouseLeavesAreaID, e);
 }
 
 //----------------------------------------------------------------------------//
@@ -2515,7 +2873,7 @@ void Window::onMouseEnters(MouseEventArgs& e)
     if (tip && !isAncestor(tip))
         tip->setTargetWindow(this);
 
-    fireEvent(EventMouseEntersSurface, e, EventNamespace);
+    fireEvent(s_eventMouseEntersSurfaceID, e);
 }
 
 //----------------------------------------------------------------------------//
@@ -2527,7 +2885,7 @@ void Window::onMouseLeaves(MouseEventArgs& e)
     if (tip && mw != tip && !(mw && mw->isAncestor(tip)))
         tip->setTargetWindow(0);
 
-    fireEvent(EventMouseLeavesSurface, e, EventNamespace);
+    fireEvent(s_eventMouseLeavesSurfaceID, e);
 }
 
 //----------------------------------------------------------------------------//
@@ -2538,7 +2896,7 @@ void Window::onMouseMove(MouseEventArgs& e)
     if (tip)
         tip->resetTimer();
 
-    fireEvent(EventMouseMove, e, EventNamespace);
+    fireEvent(s_eventMouseMoveID, e);
 
     // optionally propagate to parent
     if (!e.handled && d_propagateMouseInputs &&
@@ -2558,7 +2916,7 @@ void Window::onMouseMove(MouseEventArgs& e)
 //----------------------------------------------------------------------------//
 void Window::onMouseWheel(MouseEventArgs& e)
 {
-    fireEvent(EventMouseWheel, e, EventNamespace);
+    fireEvent(s_eventMouseWheelID, e);
 
     // optionally propagate to parent
     if (!e.handled && d_propagateMouseInputs &&
@@ -2599,10 +2957,11 @@ void Window::onMouseButtonDown(MouseEventArgs& e)
             d_repeatButton = e.button;
             d_repeatElapsed = 0;
             d_repeating = false;
+            notifyUpdateRequirementChanged();
         }
     }
 
-    fireEvent(EventMouseButtonDown, e, EventNamespace);
+    fireEvent(s_eventMouseButtonDownID, e);
 
     // optionally propagate to parent
     if (!e.handled && d_propagateMouseInputs &&
@@ -2629,7 +2988,7 @@ void Window::onMouseButtonUp(MouseEventArgs& e)
         d_repeatButton = NoButton;
     }
 
-    fireEvent(EventMouseButtonUp, e, EventNamespace);
+    fireEvent(s_eventMouseButtonUpID, e);
 
     // optionally propagate to parent
     if (!e.handled && d_propagateMouseInputs &&
@@ -2649,7 +3008,7 @@ void Window::onMouseButtonUp(MouseEventArgs& e)
 //----------------------------------------------------------------------------//
 void Window::onMouseClicked(MouseEventArgs& e)
 {
-    fireEvent(EventMouseClick, e, EventNamespace);
+    fireEvent(s_eventMouseClickID, e);
 
     // optionally propagate to parent
     if (!e.handled && d_propagateMouseInputs &&
@@ -2670,7 +3029,7 @@ void Window::onMouseClicked(MouseEventArgs& e)
 //----------------------------------------------------------------------------//
 void Window::onMouseDoubleClicked(MouseEventArgs& e)
 {
-    fireEvent(EventMouseDoubleClick, e, EventNamespace);
+    fireEvent(s_eventMouseDoubleClickID, e);
 
     // optionally propagate to parent
     if (!e.handled && d_propagateMouseInputs &&
@@ -2688,7 +3047,7 @@ void Window::onMouseDoubleClicked(MouseEventArgs& e)
 //----------------------------------------------------------------------------//
 void Window::onMouseTripleClicked(MouseEventArgs& e)
 {
-    fireEvent(EventMouseTripleClick, e, EventNamespace);
+    fireEvent(s_eventMouseTripleClickID, e);
 
     // optionally propagate to parent
     if (!e.handled && d_propagateMouseInputs &&
@@ -2706,7 +3065,7 @@ void Window::onMouseTripleClicked(MouseEventArgs& e)
 //----------------------------------------------------------------------------//
 void Window::onKeyDown(KeyEventArgs& e)
 {
-    fireEvent(EventKeyDown, e, EventNamespace);
+    fireEvent(s_eventKeyDownID, e);
 
     // As of 0.7.0 CEGUI::System no longer does input event propogation, so by
     // default we now do that here.  Generally speaking key handling widgets
@@ -2722,7 +3081,7 @@ void Window::onKeyDown(KeyEventArgs& e)
 //----------------------------------------------------------------------------//
 void Window::onKeyUp(KeyEventArgs& e)
 {
-    fireEvent(EventKeyUp, e, EventNamespace);
+    fireEvent(s_eventKeyUpID, e);
 
     // As of 0.7.0 CEGUI::System no longer does input event propogation, so by
     // default we now do that here.  Generally speaking key handling widgets
@@ -2738,7 +3097,7 @@ void Window::onKeyUp(KeyEventArgs& e)
 //----------------------------------------------------------------------------//
 void Window::onCharacter(KeyEventArgs& e)
 {
-    fireEvent(EventCharacterKey, e, EventNamespace);
+    fireEvent(s_eventCharacterKeyID, e);
 
     // As of 0.7.0 CEGUI::System no longer does input event propogation, so by
     // default we now do that here.  Generally speaking key handling widgets
@@ -2754,19 +3113,19 @@ void Window::onCharacter(KeyEventArgs& e)
 //----------------------------------------------------------------------------//
 void Window::onDragDropItemEnters(DragDropEventArgs& e)
 {
-    fireEvent(EventDragDropItemEnters, e, EventNamespace);
+    fireEvent(s_eventDragDropItemEntersID, e);
 }
 
 //----------------------------------------------------------------------------//
 void Window::onDragDropItemLeaves(DragDropEventArgs& e)
 {
-    fireEvent(EventDragDropItemLeaves, e, EventNamespace);
+    fireEvent(s_eventDragDropItemLeavesID, e);
 }
 
 //----------------------------------------------------------------------------//
 void Window::onDragDropItemDropped(DragDropEventArgs& e)
 {
-    fireEvent(EventDragDropItemDropped, e, EventNamespace);
+    fireEvent(s_eventDragDropItemDroppedID, e);
 }
 
 //----------------------------------------------------------------------------//
@@ -2789,7 +3148,7 @@ void Window::setWindowRenderer(const String& name)
 
     if (!name.empty())
     {
-        Logger::getSingleton().logEvent("Assigning the window renderer '" +
+        CEGUI_LOGEVENT("Assigning the window renderer '" +
             name + "' to the window '" + d_name + "'", Informative);
         d_windowRenderer = wrm.createWindowRenderer(name);
         WindowEventArgs e(this);
@@ -2817,7 +3176,8 @@ void Window::onWindowRendererAttached(WindowEventArgs& e)
 
     d_windowRenderer->d_window = this;
     d_windowRenderer->onAttach();
-    fireEvent(EventWindowRendererAttached, e, EventNamespace);
+    notifyUpdateRequirementChanged();
+    fireEvent(s_eventWindowRendererAttachedID, e);
 }
 
 //----------------------------------------------------------------------------//
@@ -2825,7 +3185,7 @@ void Window::onWindowRendererDetached(WindowEventArgs& e)
 {
     d_windowRenderer->onDetach();
     d_windowRenderer->d_window = 0;
-    fireEvent(EventWindowRendererDetached, e, EventNamespace);
+    fireEvent(s_eventWindowRendererDetachedID, e);
 }
 
 //----------------------------------------------------------------------------//
@@ -3170,6 +3530,8 @@ void Window::setRenderingSurface(RenderingSurface* surface)
         setUsingAutoRenderingSurface(false);
 
     d_surface = surface;
+    invalidateHitTestBounds();
+    notifyUpdateRequirementChanged();
 
     // transfer child surfaces to this new surface
     if (d_surface)
@@ -3182,6 +3544,8 @@ void Window::setRenderingSurface(RenderingSurface* surface)
 //----------------------------------------------------------------------------//
 void Window::invalidateRenderingSurface()
 {
+    d_contentChanged = true;
+
     // invalidate our surface chain if we have one
     if (d_surface)
         d_surface->invalidate();
@@ -3190,6 +3554,23 @@ void Window::invalidateRenderingSurface()
         getParent()->invalidateRenderingSurface();
 }
 
+//----------------------------------------------------------------------------//
+void Window::invalidateRenderingSurfaceArea()
+{
+    markContentChanged();
+
+    // a surface of our own is entirely covered by our imagery anyway.
+    if (d_surface)
+    {
+        d_surface->invalidate();
+        return;
+    }
+
+    RenderingContext ctx;
+    getRenderingContext(ctx);
+    ctx.surface->invalidateArea(getGeometryClipRect(ctx));
+}
+
 //----------------------------------------------------------------------------//
 const Window* Window::getRootWindow() const
 {
@@ -3212,6 +3593,9 @@ bool Window::isUsingAutoRenderingSurface() const
 //----------------------------------------------------------------------------//
 void Window::setUsingAutoRenderingSurface(bool setting)
 {
+    // the client is taking over from the automatic caching heuristic.
+    d_autoCached = false;
+
     if (setting)
     {
         allocateRenderingWindow();
@@ -3237,8 +3621,8 @@ void Window::allocateRenderingWindow()
     {
         d_autoRenderingWindow = true;
 
-        TextureTarget* const t =
-            System::getSingleton().getRenderer()->createTextureTarget();
+        TextureTarget* const t = System::getSingleton().
+            getTextureTargetPool().acquire(getPixelSize());
 
         // TextureTargets may not be available, so check that first.
         if (!t)
@@ -3252,6 +3636,8 @@ void Window::allocateRenderingWindow()
         }
 
         d_surface = &getTargetRenderingSurface().createRenderingWindow(*t);
+        invalidateHitTestBounds();
+        notifyUpdateRequirementChanged();
         transferChildSurfaces();
 
         // set size and position of RenderingWindow
@@ -3272,17 +3658,74 @@ void Window::releaseRenderingWindow()
             static_cast<RenderingWindow*>(d_surface);
         d_autoRenderingWindow = false;
         d_surface = 0;
+        invalidateHitTestBounds();
+        notifyUpdateRequirementChanged();
         // detach child surfaces prior to destroying the owning surface
         transferChildSurfaces();
-        // destroy surface and texture target it used
+        // destroy surface and return the texture target it used to the pool
         TextureTarget* tt = &old_surface->getTextureTarget();
         old_surface->getOwner().destroyRenderingWindow(*old_surface);
-        System::getSingleton().getRenderer()->destroyTextureTarget(tt);
+        System::getSingleton().getTextureTargetPool().release(tt);
 
         getGUIContext().markAsDirty();
     }
 }
 
+//----------------------------------------------------------------------------//
+void Window::updateAutoCaching(uint threshold)
+{
+    if (d_contentChanged)
+    {
+        d_unchangedRedrawCount = 0;
+        ++d_changedRedrawCount;
+    }
+    else
+    {
+        ++d_unchangedRedrawCount;
+        d_changedRedrawCount = 0;
+    }
+
+    d_contentChanged = false;
+
+    bool toggle;
+    if (d_autoCached)
+        toggle = d_changedRedrawCount >= threshold || !isEffectiveVisible();
+    else
+        toggle = !d_surface && !d_autoRenderingWindow &&
+                 d_unchangedRedrawCount >= threshold &&
+                 getChildCount() != 0 && isEffectiveVisible();
+
+    if (!toggle)
+        return;
+
+    const bool cache = !d_autoCached;
+    setUsingAutoRenderingSurface(cache);
+    d_autoCached = cache && d_surface != 0;
+
+    // the switch itself invalidates our content; don't count that.
+    d_contentChanged = false;
+    d_unchangedRedrawCount = 0;
+    d_changedRedrawCount = 0;
+}
+
+//----------------------------------------------------------------------------//
+bool Window::isAutoCached() const
+{
+    return d_autoCached;
+}
+
+//----------------------------------------------------------------------------//
+void Window::markContentChanged()
+{
+    for (Window* w = this; ; w = w->getParent())
+    {
+        w->d_contentChanged = true;
+
+        if (w->d_surface || !w->d_parent)
+            break;
+    }
+}
+
 //----------------------------------------------------------------------------//
 void Window::transferChildSurfaces()
 {
@@ -3315,18 +3758,24 @@ void Window::initialiseClippers(const RenderingContext& ctx)
         else
             rendering_window->setClippingRegion(
                 Rectf(Vector2f(0, 0), getRootContainerSize()));
-
-        d_geometry->setClippingRegion(Rectf(Vector2f(0, 0), d_pixelSize));
     }
-    else
-    {
-        Rectf geo_clip(getOuterRectClipper());
 
-        if (geo_clip.getWidth() != 0.0f && geo_clip.getHeight() != 0.0f)
-            geo_clip.offset(Vector2f(-ctx.offset.d_x, -ctx.offset.d_y));
+    d_geometry->setClippingRegion(getGeometryClipRect(ctx));
+    d_geometryClippedToDamage = false;
+}
 
-        d_geometry->setClippingRegion(geo_clip);
-    }
+//----------------------------------------------------------------------------//
+Rectf Window::getGeometryClipRect(const RenderingContext& ctx) const
+{
+    if (ctx.surface->isRenderingWindow() && ctx.owner == this)
+        return Rectf(Vector2f(0, 0), d_pixelSize);
+
+    Rectf geo_clip(getOuterRectClipper());
+
+    if (geo_clip.getWidth() != 0.0f && geo_clip.getHeight() != 0.0f)
+        geo_clip.offset(Vector2f(-ctx.offset.d_x, -ctx.offset.d_y));
+
+    return geo_clip;
 }
 
 //----------------------------------------------------------------------------//
@@ -3367,6 +3816,7 @@ void Window::onRotated(ElementEventArgs& e)
 
     // Checks / setup complete!  Now we can finally set the rotation.
     static_cast<RenderingWindow*>(d_surface)->setRotation(d_rotation);
+    invalidateHitTestBounds();
     static_cast<RenderingWindow*>(d_surface)->setPivot(
         Vector3f(d_pixelSize.d_width / 2.0f, d_pixelSize.d_height / 2.0f, 0.0f));
 }
@@ -3501,13 +3951,13 @@ const UBox& Window::getMargin() const
 //----------------------------------------------------------------------------//
 void Window::onTextParsingChanged(WindowEventArgs& e)
 {
-    fireEvent(EventTextParsingChanged, e, EventNamespace);
+    fireEvent(s_eventTextParsingChangedID, e);
 }
 
 //----------------------------------------------------------------------------//
 void Window::onMarginChanged(WindowEventArgs& e)
 {
-    fireEvent(EventMarginChanged, e, EventNamespace);
+    fireEvent(s_eventMarginChangedID, e);
 }
 
 //----------------------------------------------------------------------------//
@@ -3823,6 +4273,22 @@ bool Window::handleFontRenderSizeChange(const EventArgs& args)
         static_cast<const FontEventArgs&>(args).font);
 }
 
+//----------------------------------------------------------------------------//
+bool Window::handleFontGlyphsRasterised(const EventArgs& args)
+{
+    const Font* const font = static_cast<const FontEventArgs&>(args).font;
+
+    // text may have been drawn using placeholders for the new glyphs.  Any
+    // markup in parsed text may select other fonts, so be conservative there.
+    if ((d_windowRenderer ? !d_windowRenderer->isUsingFont(font) :
+                            getFont() != font) &&
+        !(d_textParsingEnabled && getText().find('[') != String::npos))
+        return false;
+
+    invalidate();
+    return true;
+}
+
 //----------------------------------------------------------------------------//
 bool Window::isMouseContainedInArea() const
 {
@@ -29,6 +29,7 @@
  ***************************************************************************/
 #include "CEGUI/WindowFactoryManager.h"
 #include "CEGUI/WindowFactory.h"
+#include "CEGUI/WindowManager.h"
 #include "CEGUI/Exceptions.h"
 #include <algorithm>
 
@@ -112,7 +113,14 @@ void WindowFactoryManager::removeFactory(const String& name)
     char addr_buff[32];
     sprintf(addr_buff, "(%p)", static_cast<void*>((*i).second));
 
-	d_factoryRegistry.erase(name);
+    // windows parked for reuse may have been created by the factory, so
+    // they must be destroyed via it before it goes.
+    if (WindowManager* wmgr = WindowManager::getSingletonPtr())
+    {
+        wmgr->clearAllWindowPools();
+    }
+
+    d_factoryRegistry.erase(name);
 
     Logger::getSingleton().logEvent("WindowFactory for '" + name +
                                     "' windows removed. " + addr_buff);
@@ -320,6 +328,13 @@ void WindowFactoryManager::addFalagardWindowMapping(const String& newType,
         renderer + "' Look'N'Feel '" + lookName + "' and RenderEffect '" +
         effectName + "'. " + addr_buff);
 
+    // parked windows of the type may be using the previous mapping, and are
+    // destroyed via the factory it names.
+    if (WindowManager* wmgr = WindowManager::getSingletonPtr())
+    {
+        wmgr->clearWindowPool(newType);
+    }
+
     d_falagardRegistry[newType] = mapping;
 }
 
@@ -330,13 +345,26 @@ void WindowFactoryManager::removeFalagardWindowMapping(const String& type)
     if (iter != d_falagardRegistry.end())
     {
         Logger::getSingleton().logEvent("Removing falagard mapping for type '" + type + "'.");
+
+        // parked windows of the type are destroyed via the mapping.
+        if (WindowManager* wmgr = WindowManager::getSingletonPtr())
+        {
+            wmgr->clearWindowPool(type);
+        }
+
         d_falagardRegistry.erase(iter);
     }
 }
 
 void WindowFactoryManager::removeAllFalagardWindowMappings()
 {
-	d_falagardRegistry.clear();
+    // parked windows are destroyed via the mappings of their types.
+    if (WindowManager* wmgr = WindowManager::getSingletonPtr())
+    {
+        wmgr->clearAllWindowPools();
+    }
+
+    d_falagardRegistry.clear();
 }
 
 WindowFactoryManager::FalagardMappingIterator WindowFactoryManager::getFalagardMappingIterator() const
@@ -66,6 +66,8 @@ const String WindowManager::EventWindowDestroyed("WindowDestroyed");
     Constructor
 *************************************************************************/
 WindowManager::WindowManager(void) :
+    d_poolHits(0),
+    d_poolMisses(0),
     d_uid_counter(0),
     d_lockCount(0)
 {
@@ -81,6 +83,8 @@ WindowManager::WindowManager(void) :
 *************************************************************************/
 WindowManager::~WindowManager(void)
 {
+    clearAllWindowPools();
+    d_windowPools.clear();
 	destroyAllWindows();
     cleanDeadPool();
 
@@ -103,15 +107,24 @@ Window* WindowManager::createWindow(const String& type, const String& name)
 
     String finalName(name.empty() ? generateUniqueWindowName() : name);
 
+    // reuse a parked window where pooling is enabled for the type.
+    WindowPool* const pool = getWindowPool(type);
+    if (pool && !pool->d_windows.empty())
+        return takePooledWindow(*pool, finalName);
+
     WindowFactoryManager& wfMgr = WindowFactoryManager::getSingleton();
     WindowFactory* factory = wfMgr.getFactory(type);
 
     Window* newWindow = factory->createWindow(finalName);
 
-    char addr_buff[32];
-    sprintf(addr_buff, "(%p)", static_cast<void*>(newWindow));
-    Logger::getSingleton().logEvent("Window '" + finalName +"' of type '" +
-        type + "' has been created. " + addr_buff, Informative);
+    Logger& logger(Logger::getSingleton());
+    if (logger.isEventLogged(Informative))
+    {
+        char addr_buff[32];
+        sprintf(addr_buff, "(%p)", static_cast<void*>(newWindow));
+        logger.logEvent("Window '" + finalName +"' of type '" +
+            type + "' has been created. " + addr_buff, Informative);
+    }
 
     // see if we need to assign a look to this window
     if (wfMgr.isFalagardMappedType(type))
@@ -126,7 +139,13 @@ Window* WindowManager::createWindow(const String& type, const String& name)
         initialiseRenderEffect(newWindow, fwm.d_effectName);
     }
 
-	d_windowRegistry.push_back(newWindow);
+    if (pool)
+    {
+        ++d_poolMisses;
+        captureInitialState(*pool, *newWindow);
+    }
+
+    addToRegistry(newWindow);
 
     // fire event to notify interested parites about the new window.
     WindowEventArgs args(newWindow);
@@ -189,16 +208,13 @@ void WindowManager::initialiseRenderEffect(
 *************************************************************************/
 void WindowManager::destroyWindow(Window* window)
 {
-	WindowVector::iterator iter =
-        std::find(d_windowRegistry.begin(),
-                  d_windowRegistry.end(),
-                  window);
+    const size_t slot = findRegistrySlot(window);
 
     char addr_buff[32];
-    sprintf(addr_buff, "(%p)", static_cast<void*>(&window));
 
-	if (iter == d_windowRegistry.end())
+	if (slot == static_cast<size_t>(-1))
     {
+        sprintf(addr_buff, "(%p)", static_cast<void*>(&window));
         Logger::getSingleton().logEvent("[WindowManager] Attempt to delete "
             "Window that does not exist!  Address was: " + String(addr_buff) +
             ". WARNING: This could indicate a double-deletion issue!!",
@@ -206,10 +222,27 @@ void WindowManager::destroyWindow(Window* window)
         return;
     }
 
-    d_windowRegistry.erase(iter);
+    removeFromRegistry(slot);
 
-    Logger::getSingleton().logEvent("Window at '" + window->getNamePath() +
-        "' will be added to dead pool. " + addr_buff, Informative);
+    Logger& logger(Logger::getSingleton());
+
+    if (parkWindow(window))
+    {
+        if (logger.isEventLogged(Informative))
+            logger.logEvent("Window at '" + window->getNamePath() +
+                "' has been parked for reuse.", Informative);
+
+        WindowEventArgs args(window);
+        fireEvent(EventWindowDestroyed, args, EventNamespace);
+        return;
+    }
+
+    if (logger.isEventLogged(Informative))
+    {
+        sprintf(addr_buff, "(%p)", static_cast<void*>(&window));
+        logger.logEvent("Window at '" + window->getNamePath() +
+            "' will be added to dead pool. " + addr_buff, Informative);
+    }
 
     // do 'safe' part of cleanup
     window->destroy();
@@ -229,19 +262,137 @@ void WindowManager::destroyWindow(Window* window)
 *************************************************************************/
 void WindowManager::destroyAllWindows(void)
 {
+    // nothing gets parked while everything is going away; limits and
+    // captured state are kept for later.
+    clearAllWindowPools();
+    WindowPoolMap pools;
+    pools.swap(d_windowPools);
+
+    // destroying from the back keeps registry removal trivial
 	while (!d_windowRegistry.empty())
-		destroyWindow(*d_windowRegistry.begin());
+		destroyWindow(d_windowRegistry.back());
+
+    d_windowPools.swap(pools);
 }
 
 //----------------------------------------------------------------------------//
 bool WindowManager::isAlive(const Window* window) const
 {
-	WindowVector::const_iterator iter =
-        std::find(d_windowRegistry.begin(),
-                  d_windowRegistry.end(),
-                  window);
+    return findRegistrySlot(window) != static_cast<size_t>(-1);
+}
+
+//----------------------------------------------------------------------------//
+size_t WindowManager::getRegistryHash(const Window* window) const
+{
+    // mix the pointer bits; low bits are mostly alignment and carry little
+    // information on their own.
+    size_t h = reinterpret_cast<size_t>(window);
+    h ^= h >> 16;
+    h *= 0x45d9f3b;
+    h ^= h >> 16;
+
+    return h & (d_registryIndex.size() - 1);
+}
+
+//----------------------------------------------------------------------------//
+size_t WindowManager::findRegistrySlot(const Window* window) const
+{
+    const size_t npos = static_cast<size_t>(-1);
+
+    if (d_registryIndex.empty())
+        return npos;
+
+    const size_t mask = d_registryIndex.size() - 1;
+
+    for (size_t slot = getRegistryHash(window);
+         d_registryIndex[slot] != npos;
+         slot = (slot + 1) & mask)
+    {
+        if (d_windowRegistry[d_registryIndex[slot]] == window)
+            return slot;
+    }
+
+    return npos;
+}
+
+//----------------------------------------------------------------------------//
+void WindowManager::addToRegistry(Window* window)
+{
+    // keep the table at most half full so probe sequences stay short
+    if ((d_windowRegistry.size() + 1) * 2 > d_registryIndex.size())
+        rehashRegistry(ceguimax(static_cast<size_t>(64),
+                                d_registryIndex.size() * 2));
+
+    const size_t mask = d_registryIndex.size() - 1;
+    size_t slot = getRegistryHash(window);
+
+    while (d_registryIndex[slot] != static_cast<size_t>(-1))
+        slot = (slot + 1) & mask;
+
+    d_registryIndex[slot] = d_windowRegistry.size();
+    d_windowRegistry.push_back(window);
+}
+
+//----------------------------------------------------------------------------//
+void WindowManager::removeFromRegistry(size_t slot)
+{
+    const size_t npos = static_cast<size_t>(-1);
+    const size_t mask = d_registryIndex.size() - 1;
+    const size_t index = d_registryIndex[slot];
+    const size_t last = d_windowRegistry.size() - 1;
+
+    // move the last window into the vacated registry position, updating the
+    // table slot that references it.
+    if (index != last)
+    {
+        const size_t moved_slot = findRegistrySlot(d_windowRegistry[last]);
+        d_windowRegistry[index] = d_windowRegistry[last];
+        d_registryIndex[moved_slot] = index;
+    }
+
+    d_windowRegistry.pop_back();
 
-	return iter != d_windowRegistry.end();
+    // clear the slot, shifting back any following entries whose probe
+    // sequence passed through it so that lookups never stop short.
+    size_t hole = slot;
+    for (size_t next = (slot + 1) & mask;
+         d_registryIndex[next] != npos;
+         next = (next + 1) & mask)
+    {
+        const size_t home =
+            getRegistryHash(d_windowRegistry[d_registryIndex[next]]);
+
+        const bool in_place = (hole <= next) ?
+            (hole < home && home <= next) :
+            (hole < home || home <= next);
+
+        if (!in_place)
+        {
+            d_registryIndex[hole] = d_registryIndex[next];
+            hole = next;
+        }
+    }
+
+    d_registryIndex[hole] = npos;
+}
+
+//----------------------------------------------------------------------------//
+void WindowManager::rehashRegistry(size_t table_size)
+{
+    const size_t npos = static_cast<size_t>(-1);
+
+    d_registryIndex.assign(table_size, npos);
+
+    const size_t mask = table_size - 1;
+    for (size_t i = 0; i < d_windowRegistry.size(); ++i)
+    {
+        size_t slot = getRegistryHash(d_windowRegistry[i]);
+
+        while (d_registryIndex[slot] != npos)
+            slot = (slot + 1) & mask;
+
+        d_registryIndex[slot] = i;
+    }
 }
 
 Window* WindowManager::loadLayoutFromContainer(const RawDataContainer& source, PropertyCallback* callback, void* userdata)
@@ -447,6 +598,231 @@ bool WindowManager::isLocked() const
     return d_lockCount != 0;
 }
 
+//----------------------------------------------------------------------------//
+void WindowManager::setWindowPoolLimit(const String& type, size_t limit)
+{
+    WindowPoolMap::iterator i = d_windowPools.find(type);
+
+    if (limit == 0)
+    {
+        if (i != d_windowPools.end())
+        {
+            WindowVector windows;
+            windows.swap(i->second.d_windows);
+            d_windowPools.erase(i);
+            destroyPooledWindows(windows);
+        }
+
+        return;
+    }
+
+    if (i == d_windowPools.end())
+        i = d_windowPools.insert(std::make_pair(type, WindowPool())).first;
+
+    WindowPool& pool = i->second;
+    pool.d_limit = limit;
+
+    if (pool.d_windows.size() > limit)
+    {
+        WindowVector excess(pool.d_windows.begin() + limit,
+                            pool.d_windows.end());
+        pool.d_windows.resize(limit);
+        destroyPooledWindows(excess);
+    }
+}
+
+//----------------------------------------------------------------------------//
+size_t WindowManager::getWindowPoolLimit(const String& type) const
+{
+    const WindowPoolMap::const_iterator i = d_windowPools.find(type);
+    return i != d_windowPools.end() ? i->second.d_limit : 0;
+}
+
+//----------------------------------------------------------------------------//
+size_t WindowManager::getPooledWindowCount(const String& type) const
+{
+    const WindowPoolMap::const_iterator i = d_windowPools.find(type);
+    return i != d_windowPools.end() ? i->second.d_windows.size() : 0;
+}
+
+//----------------------------------------------------------------------------//
+void WindowManager::clearWindowPool(const String& type)
+{
+    WindowPoolMap::iterator i = d_windowPools.find(type);
+
+    if (i == d_windowPools.end())
+        return;
+
+    // the type may have been remapped, so capture state afresh next time.
+    i->second.d_initialValuesValid = false;
+    i->second.d_initialValues.clear();
+
+    WindowVector windows;
+    windows.swap(i->second.d_windows);
+    destroyPooledWindows(windows);
+}
+
+//----------------------------------------------------------------------------//
+void WindowManager::clearAllWindowPools()
+{
+    for (WindowPoolMap::iterator i = d_windowPools.begin();
+         i != d_windowPools.end();
+         ++i)
+    {
+        clearWindowPool(i->first);
+    }
+}
+
+//----------------------------------------------------------------------------//
+uint WindowManager::getWindowPoolHitCount() const
+{
+    return d_poolHits;
+}
+
+//----------------------------------------------------------------------------//
+uint WindowManager::getWindowPoolMissCount() const
+{
+    return d_poolMisses;
+}
+
+//----------------------------------------------------------------------------//
+void WindowManager::resetWindowPoolStatistics()
+{
+    d_poolHits = 0;
+    d_poolMisses = 0;
+}
+
+//----------------------------------------------------------------------------//
+WindowManager::WindowPool* WindowManager::getWindowPool(const String& type)
+{
+    if (d_windowPools.empty())
+        return 0;
+
+    WindowPoolMap::iterator i = d_windowPools.find(type);
+    return i != d_windowPools.end() ? &i->second : 0;
+}
+
+//----------------------------------------------------------------------------//
+Window* WindowManager::takePooledWindow(WindowPool& pool, const String& name)
+{
+    ++d_poolHits;
+
+    Window* const window = pool.d_windows.back();
+    pool.d_windows.pop_back();
+
+    if (window->getName() != name)
+        window->setName(name);
+
+    Logger& logger(Logger::getSingleton());
+    if (logger.isEventLogged(Informative))
+    {
+        char addr_buff[32];
+        sprintf(addr_buff, "(%p)", static_cast<void*>(window));
+        logger.logEvent("Window '" + name +"' of type '" +
+            window->getType() + "' has been reused. " + addr_buff,
+            Informative);
+    }
+
+    addToRegistry(window);
+
+    WindowEventArgs args(window);
+    fireEvent(EventWindowCreated, args, EventNamespace);
+
+    return window;
+}
+
+//----------------------------------------------------------------------------//
+void WindowManager::captureInitialState(WindowPool& pool,
+                                        Window& window) const
+{
+    if (!pool.d_initialValuesValid)
+    {
+        pool.d_lookName = window.getLookNFeel();
+        pool.d_initialValues.clear();
+
+        PropertySet::PropertyIterator i = window.getPropertyIterator();
+        for (; !i.isAtEnd(); ++i)
+        {
+            const Property* const property = i.getCurrentValue();
+            const String& property_name = i.getCurrentKey();
+
+            // these define the window's identity rather than its state
+            if (!property->isReadable() || !property->isWritable() ||
+                property_name == "Name" || property_name == "LookNFeel" ||
+                property_name == "WindowRenderer")
+                continue;
+
+            pool.d_initialValues.push_back(
+                PropertyValue(property_name, window.getProperty(property_name)));
+        }
+
+        // reading the properties above defined all the user strings needed.
+        pool.d_initialUserStrings = window.d_userStrings;
+
+        pool.d_initialValuesValid = true;
+    }
+
+    // track subscriptions made by the client from here on, so they can be
+    // dropped if the window gets parked.
+    window.d_recordSubscriptions = true;
+}
+
+//----------------------------------------------------------------------------//
+bool WindowManager::parkWindow(Window* window)
+{
+    // windows created while pooling was off for their type can not be reset
+    // reliably, nor can auto-windows which belong to their parent.
+    if (!window->d_recordSubscriptions || window->isAutoWindow())
+        return false;
+
+    WindowPool* const pool = getWindowPool(window->getType());
+
+    if (!pool || !pool->d_initialValuesValid ||
+        pool->d_windows.size() >= pool->d_limit ||
+        window->getLookNFeel() != pool->d_lookName)
+        return false;
+
+    window->prepareForRecycling();
+
+    for (PropertyValueList::const_iterator i = pool->d_initialValues.begin();
+         i != pool->d_initialValues.end();
+         ++i)
+    {
+        if (window->getProperty(i->first) != i->second)
+            window->setProperty(i->first, i->second);
+    }
+
+    // this drops user strings set by the client, while those backing property
+    // definitions now hold their initial values anyway.
+    window->d_userStrings = pool->d_initialUserStrings;
+
+    // parking of children may have filled the pool meanwhile
+    if (pool->d_windows.size() >= pool->d_limit)
+        return false;
+
+    pool->d_windows.push_back(window);
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void WindowManager::destroyPooledWindows(WindowVector& windows)
+{
+    WindowFactoryManager& wfmgr = WindowFactoryManager::getSingleton();
+
+    for (WindowVector::iterator i = windows.begin(); i != windows.end(); ++i)
+    {
+        // the window is not registered, so this does the actual cleanup.
+        (*i)->destroy();
+
+        // parked windows are not referenced from anywhere, so there is no
+        // need for the dead pool.  They are destroyed right away, while the
+        // factory or mapping for their type is known to be still present.
+        wfmgr.getFactory((*i)->getType())->destroyWindow(*i);
+    }
+
+    windows.clear();
+}
+
 //----------------------------------------------------------------------------//
 
 } // End of  CEGUI namespace section
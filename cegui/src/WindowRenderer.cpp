@@ -136,6 +136,14 @@ bool WindowRenderer::handleFontRenderSizeChange(const Font* const font)
     return lf.handleFontRenderSizeChange(*d_window, font);
 }
 
+//----------------------------------------------------------------------------//
+bool WindowRenderer::isUsingFont(const Font* const font) const
+{
+    return d_window->getFont() == font ||
+           (!d_window->getLookNFeel().empty() &&
+            getLookNFeel().isUsingFont(*d_window, font));
+}
+
 //----------------------------------------------------------------------------//
 
 } // End of CEGUI namespace
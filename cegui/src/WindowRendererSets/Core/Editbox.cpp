@@ -491,6 +491,15 @@ float FalagardEditbox::getCaretBlinkTimeout() const
 void FalagardEditbox::setCaretBlinkEnabled(bool enable)
 {
     d_blinkCaret = enable;
+
+    if (d_window)
+        d_window->notifyUpdateRequirementChanged();
+}
+
+//----------------------------------------------------------------------------//
+bool FalagardEditbox::isUpdateRequired() const
+{
+    return d_blinkCaret;
 }
 
 //----------------------------------------------------------------------------//
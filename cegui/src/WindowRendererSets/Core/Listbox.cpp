@@ -148,19 +148,22 @@ namespace CEGUI
         Rectf itemsArea(getListRenderArea());
 
         // set up some initial positional details for items
+        const float scrollPos = lb->getVertScrollbar()->getScrollPosition();
         itemPos.d_x = itemsArea.left() - lb->getHorzScrollbar()->getScrollPosition();
-        itemPos.d_y = itemsArea.top() - lb->getVertScrollbar()->getScrollPosition();
         itemPos.d_z = 0.0f;
 
         const float alpha = lb->getEffectiveAlpha();
 
-        // loop through the items
-        size_t itemCount = lb->getItemCount();
+        // only loop through the visible items; the first is found by a binary
+        // search of the listbox's cached item extents.
+        const size_t itemCount = lb->getItemCount();
+        size_t i = lb->getItemIndexAtOffset(scrollPos);
+        itemPos.d_y = itemsArea.top() - scrollPos + lb->getItemOffset(i);
 
-        for (size_t i = 0; i < itemCount; ++i)
+        for (; i < itemCount && itemPos.d_y < itemsArea.bottom(); ++i)
         {
             ListboxItem* listItem = lb->getListboxItemFromIndex(i);
-            itemSize.d_height = listItem->getPixelSize().d_height;
+            itemSize.d_height = lb->getItemOffset(i + 1) - lb->getItemOffset(i);
 
             // allow item to have full width of box if this is wider than items
             itemSize.d_width = ceguimax(itemsArea.getWidth(), widest);
@@ -203,18 +206,41 @@ namespace CEGUI
     {
         bool res = ListboxWindowRenderer::handleFontRenderSizeChange(font);
 
-        if (!res)
-        {
-            Listbox* const listbox = static_cast<Listbox*>(d_window);
+        // items may use the font even when the list itself does not, and
+        // their cached extents are stale either way.
+        Listbox* const listbox = static_cast<Listbox*>(d_window);
+        const size_t count = listbox->getItemCount();
+        size_t first_changed = count;
 
-            for (size_t i = 0; i < listbox->getItemCount(); ++i)
-                res |= listbox->getListboxItemFromIndex(i)->handleFontRenderSizeChange(font);
+        for (size_t i = 0; i < count; ++i)
+            if (listbox->getListboxItemFromIndex(i)->handleFontRenderSizeChange(font) &&
+                first_changed == count)
+                    first_changed = i;
 
-            if (res)
-                listbox->invalidate();
+        if (first_changed != count)
+        {
+            listbox->invalidateItemExtents(first_changed);
+            res = true;
         }
 
+        if (res)
+            listbox->invalidate();
+
         return res;
     }
 
+    bool FalagardListbox::isUsingFont(const Font* const font) const
+    {
+        if (ListboxWindowRenderer::isUsingFont(font))
+            return true;
+
+        const Listbox* const listbox = static_cast<const Listbox*>(d_window);
+
+        for (size_t i = 0; i < listbox->getItemCount(); ++i)
+            if (listbox->getListboxItemFromIndex(i)->isUsingFont(font))
+                return true;
+
+        return false;
+    }
+
 } // End of  CEGUI namespace section
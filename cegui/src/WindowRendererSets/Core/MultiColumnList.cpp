@@ -98,20 +98,27 @@ namespace CEGUI
         // calculate position of area we have to render into
         Rectf itemsArea(getListRenderArea());
 
+        // skip the rows that are scrolled out of view above the list area
+        const float scrollPos = vertScrollbar->getScrollPosition();
+        uint i = w->getRowIndexAtOffset(scrollPos);
+        float rowTop = w->getRowOffset(i);
+
         // set up initial positional details for items
-        itemPos.d_y = itemsArea.top() - vertScrollbar->getScrollPosition();
+        itemPos.d_y = itemsArea.top() - scrollPos + rowTop;
         itemPos.d_z = 0.0f;
 
         const float alpha = w->getEffectiveAlpha();
 
-        // loop through the items
-        for (uint i = 0; i < w->getRowCount(); ++i)
+        // loop through the rows until the bottom of the list area is reached
+        for (; (i < w->getRowCount()) && (itemPos.d_y < itemsArea.bottom()); ++i)
         {
             // set initial x position for this row.
             itemPos.d_x = itemsArea.left() - horzScrollbar->getScrollPosition();
 
             // calculate height for this row.
-            itemSize.d_height = w->getHighestRowItemHeight(i);
+            const float rowBottom = w->getRowOffset(i + 1);
+            itemSize.d_height = rowBottom - rowTop;
+            rowTop = rowBottom;
 
             // loop through the columns in this row
             for (uint j = 0; j < w->getColumnCount(); ++j)
@@ -162,4 +169,51 @@ namespace CEGUI
         imagery->render(*d_window);
     }
 
+    bool FalagardMultiColumnList::handleFontRenderSizeChange(const Font* const font)
+    {
+        bool res = MultiColumnListWindowRenderer::handleFontRenderSizeChange(font);
+
+        // items may use the font even when the list itself does not, and
+        // their cached extents are stale either way.
+        MultiColumnList* const list = static_cast<MultiColumnList*>(d_window);
+        const uint row_count = list->getRowCount();
+        uint first_changed = row_count;
+
+        for (uint i = 0; i < row_count; ++i)
+            for (uint j = 0; j < list->getColumnCount(); ++j)
+                if (ListboxItem* const item = list->getItemAtGridReference(MCLGridRef(i, j)))
+                    if (item->handleFontRenderSizeChange(font) &&
+                        first_changed == row_count)
+                            first_changed = i;
+
+        if (first_changed != row_count)
+        {
+            list->invalidateRowExtents(first_changed);
+            res = true;
+        }
+
+        if (res)
+            list->invalidate();
+
+        return res;
+    }
+
+    bool FalagardMultiColumnList::isUsingFont(const Font* const font) const
+    {
+        if (MultiColumnListWindowRenderer::isUsingFont(font))
+            return true;
+
+        const MultiColumnList* const list =
+            static_cast<const MultiColumnList*>(d_window);
+
+        for (uint i = 0; i < list->getRowCount(); ++i)
+            for (uint j = 0; j < list->getColumnCount(); ++j)
+                if (const ListboxItem* const item =
+                        list->getItemAtGridReference(MCLGridRef(i, j)))
+                    if (item->isUsingFont(font))
+                        return true;
+
+        return false;
+    }
+
 } // End of  CEGUI namespace section
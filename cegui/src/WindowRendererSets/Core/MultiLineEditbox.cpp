@@ -395,6 +395,15 @@ float FalagardMultiLineEditbox::getCaretBlinkTimeout() const
 void FalagardMultiLineEditbox::setCaretBlinkEnabled(bool enable)
 {
     d_blinkCaret = enable;
+
+    if (d_window)
+        d_window->notifyUpdateRequirementChanged();
+}
+
+//----------------------------------------------------------------------------//
+bool FalagardMultiLineEditbox::isUpdateRequired() const
+{
+    return d_blinkCaret;
 }
 
 //----------------------------------------------------------------------------//
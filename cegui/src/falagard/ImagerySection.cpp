@@ -349,6 +349,20 @@ namespace CEGUI
         return result;
     }
 
+    bool ImagerySection::isUsingFont(const Window& window,
+                                     const Font* font) const
+    {
+        for(TextList::const_iterator text = d_texts.begin();
+            text != d_texts.end();
+            ++text)
+        {
+            if ((*text).isUsingFont(window, font))
+                return true;
+        }
+
+        return false;
+    }
+
     ImagerySection::ImageryComponentIterator
     ImagerySection::getImageryComponentIterator() const
     {
@@ -432,6 +432,12 @@ namespace CEGUI
         return res;
     }
 
+    bool TextComponent::isUsingFont(const Window& window,
+                                    const Font* font) const
+    {
+        return getFontObject(window) == font;
+    }
+
 //----------------------------------------------------------------------------//
 String TextComponent::getEffectiveText(const Window& wnd) const
 {
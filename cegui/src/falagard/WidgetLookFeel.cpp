@@ -1020,6 +1020,24 @@ bool WidgetLookFeel::handleFontRenderSizeChange(Window& window,
     return result;
 }
 
+//---------------------------------------------------------------------------//
+bool WidgetLookFeel::isUsingFont(const Window& window, const Font* font) const
+{
+    for(ImageryList::const_iterator i = d_imagerySections.begin();
+        i != d_imagerySections.end();
+        ++i)
+    {
+        if (i->second.isUsingFont(window, font))
+            return true;
+    }
+
+    if (!d_inheritedLookName.empty())
+        return WidgetLookManager::getSingleton().
+            getWidgetLook(d_inheritedLookName).isUsingFont(window, font);
+
+    return false;
+}
+
 //---------------------------------------------------------------------------//
 
 } // End of  CEGUI namespace section
@@ -31,6 +31,7 @@
 #include "CEGUI/XMLParser.h"
 #include "CEGUI/Exceptions.h"
 #include "CEGUI/Logger.h"
+#include "CEGUI/WindowManager.h"
 
 // Start of CEGUI namespace section
 namespace CEGUI
@@ -159,6 +160,10 @@ namespace CEGUI
         WidgetLookList::iterator wlf = d_widgetLooks.find(widget);
         if (wlf != d_widgetLooks.end())
         {
+            // windows parked for reuse may still be using the look
+            if (WindowManager* wmgr = WindowManager::getSingletonPtr())
+                wmgr->clearAllWindowPools();
+
             d_widgetLooks.erase(wlf);
         }
         else
@@ -171,6 +176,9 @@ namespace CEGUI
 
     void WidgetLookManager::eraseAllWidgetLooks()
     {
+        if (WindowManager* wmgr = WindowManager::getSingletonPtr())
+            wmgr->clearAllWindowPools();
+
         d_widgetLooks.clear();
     }
 
@@ -69,6 +69,7 @@ LayoutContainer::~LayoutContainer(void)
 void LayoutContainer::markNeedsLayouting()
 {
     d_needsLayouting = true;
+    notifyUpdateRequirementChanged();
 
     //invalidate();
 }
@@ -82,12 +83,33 @@ bool LayoutContainer::needsLayouting() const
 //----------------------------------------------------------------------------//
 void LayoutContainer::layoutIfNecessary()
 {
-    if (d_needsLayouting)
+    if (!d_needsLayouting)
+        return;
+
+    // batch the area changes made while laying out, so each child gets a
+    // single notification once the container has its final size.  Without
+    // children there is nothing to batch.
+    if (getChildCount() == 0)
     {
         layout();
-
-        d_needsLayouting = false;
     }
+    else
+    {
+        beginAreaUpdate();
+        CEGUI_TRY
+        {
+            layout();
+        }
+        CEGUI_CATCH(...)
+        {
+            endAreaUpdate();
+            CEGUI_RETHROW;
+        }
+        endAreaUpdate();
+    }
+
+    d_needsLayouting = false;
+    notifyUpdateRequirementChanged();
 }
 
 //----------------------------------------------------------------------------//
@@ -98,6 +120,12 @@ void LayoutContainer::update(float elapsed)
     layoutIfNecessary();
 }
 
+//----------------------------------------------------------------------------//
+bool LayoutContainer::isUpdateRequired() const
+{
+    return d_needsLayouting || Window::isUpdateRequired();
+}
+
 //----------------------------------------------------------------------------//
 const Element::CachedRectf& LayoutContainer::getClientChildContentArea() const
 {
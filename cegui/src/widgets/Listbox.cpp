@@ -286,13 +286,14 @@ void Listbox::addItem(ListboxItem* item)
 		// if sorting is enabled, re-sort the list
 		if (isSortEnabled())
 		{
-			d_listItems.insert(std::upper_bound(d_listItems.begin(), d_listItems.end(), item, &lbi_less), item);
-
+			LBItemList::iterator ins_pos = d_listItems.insert(std::upper_bound(d_listItems.begin(), d_listItems.end(), item, &lbi_less), item);
+            invalidateItemExtents(std::distance(d_listItems.begin(), ins_pos));
 		}
 		// not sorted, just stick it on the end.
 		else
 		{
 			d_listItems.push_back(item);
+            invalidateItemExtents(d_listItems.size() - 1);
 		}
 
 		WindowEventArgs args(this);
@@ -338,7 +339,8 @@ void Listbox::insertItem(ListboxItem* item, const ListboxItem* position)
 
 		}
 
-		d_listItems.insert(ins_pos, item);
+		ins_pos = d_listItems.insert(ins_pos, item);
+        invalidateItemExtents(std::distance(d_listItems.begin(), ins_pos));
 
 		WindowEventArgs args(this);
 		onListContentsChanged(args);
@@ -363,6 +365,7 @@ void Listbox::removeItem(const ListboxItem* item)
 			(*pos)->setOwnerWindow(0);
 
 			// remove item
+            invalidateItemExtents(std::distance(d_listItems.begin(), pos));
 			d_listItems.erase(pos);
 
 			// if item was the last selected item, reset that to NULL
@@ -556,6 +559,7 @@ void Listbox::handleUpdatedItemData(void)
     if (d_sorted)
         resortList();
 
+    invalidateItemExtents();
 	configureScrollbars();
 	invalidate();
 }
@@ -680,14 +684,9 @@ void Listbox::selectRange(size_t start, size_t end)
 *************************************************************************/
 float Listbox::getTotalItemsHeight(void) const
 {
-	float height = 0;
+    updateItemExtents();
 
-	for (size_t i = 0; i < getItemCount(); ++i)
-	{
-		height += d_listItems[i]->getPixelSize().d_height;
-	}
-
-	return height;
+    return d_itemExtents.empty() ? 0.0f : d_itemExtents.back().d_bottom;
 }
 
 
@@ -696,20 +695,102 @@ float Listbox::getTotalItemsHeight(void) const
 *************************************************************************/
 float Listbox::getWidestItemWidth(void) const
 {
-	float widest = 0;
+    updateItemExtents();
 
-	for (size_t i = 0; i < getItemCount(); ++i)
-	{
-		float thisWidth = d_listItems[i]->getPixelSize().d_width;
+    return d_itemExtents.empty() ? 0.0f : d_itemExtents.back().d_widest;
+}
 
-		if (thisWidth > widest)
-		{
-			widest = thisWidth;
-		}
 
-	}
+/*************************************************************************
+	Return the offset of the top edge of the item at the given index
+*************************************************************************/
+float Listbox::getItemOffset(size_t item_index) const
+{
+    if (item_index == 0)
+        return 0.0f;
 
-	return widest;
+    updateItemExtents();
+
+    return d_itemExtents[ceguimin(item_index, d_itemExtents.size()) - 1].d_bottom;
+}
+
+
+/*************************************************************************
+	used to binary search the cached item extents
+*************************************************************************/
+bool Listbox::itemExtentBottomLess(float offset, const ItemExtent& extent)
+{
+    return offset < extent.d_bottom;
+}
+
+
+/*************************************************************************
+	Return the index of the item that spans the given offset
+*************************************************************************/
+size_t Listbox::getItemIndexAtOffset(float offset) const
+{
+    updateItemExtents();
+
+    // first item whose bottom edge is below the offset
+    return std::distance(d_itemExtents.begin(),
+                         std::upper_bound(d_itemExtents.begin(),
+                                          d_itemExtents.end(),
+                                          offset, &itemExtentBottomLess));
+}
+
+
+/*************************************************************************
+	Discard cached item extents from the given index onwards
+*************************************************************************/
+void Listbox::invalidateItemExtents(size_t item_index) const
+{
+    if (item_index < d_itemExtents.size())
+        d_itemExtents.resize(item_index);
+}
+
+
+/*************************************************************************
+	Discard cached item extents from the given item onwards
+*************************************************************************/
+void Listbox::notifyItemSizeChanged(const ListboxItem* item) const
+{
+    if (d_itemExtents.empty())
+        return;
+
+    // search from the end, so recently added items (which are not measured
+    // yet) are found at once.
+    for (size_t i = d_listItems.size(); i-- > 0; )
+    {
+        if (d_listItems[i] == item)
+        {
+            invalidateItemExtents(i);
+            return;
+        }
+    }
+}
+
+
+/*************************************************************************
+	Measure any items whose extents are not cached
+*************************************************************************/
+void Listbox::updateItemExtents() const
+{
+    size_t i = d_itemExtents.size();
+
+    if (i == d_listItems.size())
+        return;
+
+    ItemExtent extent;
+    extent.d_bottom = i ? d_itemExtents[i - 1].d_bottom : 0.0f;
+    extent.d_widest = i ? d_itemExtents[i - 1].d_widest : 0.0f;
+
+    for (; i < d_listItems.size(); ++i)
+    {
+        const Sizef sz(d_listItems[i]->getPixelSize());
+        extent.d_bottom += sz.d_height;
+        extent.d_widest = ceguimax(extent.d_widest, sz.d_width);
+        d_itemExtents.push_back(extent);
+    }
 }
 
 
@@ -751,16 +832,10 @@ ListboxItem* Listbox::getItemAtPoint(const Vector2f& pt) const
 		// test if point is above first item
 		if (local_pos.d_y >= y)
 		{
-			for (size_t i = 0; i < getItemCount(); ++i)
-			{
-				y += d_listItems[i]->getPixelSize().d_height;
+            const size_t i = getItemIndexAtOffset(local_pos.d_y - y);
 
-				if (local_pos.d_y < y)
-				{
-					return d_listItems[i];
-				}
-
-			}
+            if (i < getItemCount())
+                return d_listItems[i];
 		}
 	}
 
@@ -845,6 +920,18 @@ void Listbox::onSized(ElementEventArgs& e)
 }
 
 
+/*************************************************************************
+	Handler for when the font changes (items may be using it)
+*************************************************************************/
+void Listbox::onFontChanged(WindowEventArgs& e)
+{
+    invalidateItemExtents();
+
+	// base class handling
+	Window::onFontChanged(e);
+}
+
+
 /*************************************************************************
 	Handler for when mouse button is pressed
 *************************************************************************/
@@ -973,19 +1060,11 @@ void Listbox::ensureItemIsVisible(size_t item_index)
 	}
 	else
 	{
-		float bottom;
 		float listHeight = getListRenderArea().getHeight();
-		float top = 0;
 
-		// get height to top of item
-		size_t i;
-		for (i = 0; i < item_index; ++i)
-		{
-			top += d_listItems[i]->getPixelSize().d_height;
-		}
-
-		// calculate height to bottom of item
-		bottom = top + d_listItems[i]->getPixelSize().d_height;
+		// get height to top and bottom of item
+		float top = getItemOffset(item_index);
+		float bottom = getItemOffset(item_index + 1);
 
 		// account for current scrollbar value
 		float currPos = vertScrollbar->getScrollPosition();
@@ -1084,6 +1163,8 @@ bool Listbox::resetList_impl(void)
 	// we have items to be removed and possible deleted
 	else
 	{
+        invalidateItemExtents();
+
 		// delete any items we are supposed to
 		for (size_t i = 0; i < getItemCount(); ++i)
 		{
@@ -1163,6 +1244,7 @@ bool Listbox::validateWindowRenderer(const WindowRenderer* renderer) const
 void Listbox::resortList()
 {
     std::sort(d_listItems.begin(), d_listItems.end(), &lbi_less);
+    invalidateItemExtents();
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -32,6 +32,8 @@
 #endif
 
 #include "CEGUI/widgets/ListboxItem.h"
+#include "CEGUI/widgets/Listbox.h"
+#include "CEGUI/widgets/MultiColumnList.h"
 #include "CEGUI/System.h"
 #include "CEGUI/ImageManager.h"
 
@@ -71,7 +73,9 @@ ListboxItem::ListboxItem(const String& text, uint item_id, void* item_data, bool
     d_autoDelete(auto_delete),
 	d_owner(0),
     d_selectCols(DefaultSelectionColour, DefaultSelectionColour, DefaultSelectionColour, DefaultSelectionColour),
-	d_selectBrush(0)
+	d_selectBrush(0),
+    d_sortKey(0.0),
+    d_hasSortKey(false)
 {
    setText(text);
 }
@@ -135,6 +139,17 @@ void ListboxItem::setText( const String& text )
 {
    d_textLogical = text;
    d_bidiDataValid = false;
+   notifySizeChanged();
+}
+
+//----------------------------------------------------------------------------//
+void ListboxItem::notifySizeChanged() const
+{
+    if (const Listbox* const listbox = dynamic_cast<const Listbox*>(d_owner))
+        listbox->notifyItemSizeChanged(this);
+    else if (const MultiColumnList* const mcl =
+                dynamic_cast<const MultiColumnList*>(d_owner))
+        mcl->notifyItemSizeChanged(this);
 }
 
 //----------------------------------------------------------------------------//
@@ -159,6 +174,12 @@ bool ListboxItem::handleFontRenderSizeChange(const Font* const /*font*/)
     return false;
 }
 
+//----------------------------------------------------------------------------//
+bool ListboxItem::isUsingFont(const Font* const /*font*/) const
+{
+    return false;
+}
+
 //----------------------------------------------------------------------------//
 
 } // End of  CEGUI namespace section
@@ -55,7 +55,9 @@ ListboxTextItem::ListboxTextItem(const String& text, uint item_id, void* item_da
 	d_textCols(DefaultTextColour, DefaultTextColour, DefaultTextColour, DefaultTextColour),
 	d_font(0),
     d_renderedStringValid(false),
-    d_textParsingEnabled(true)
+    d_textParsingEnabled(true),
+    d_pixelSize(0.0f, 0.0f),
+    d_pixelSizeFont(0)
 {
 }
 
@@ -98,6 +100,7 @@ void ListboxTextItem::setFont(Font* font)
     d_font = font;
 
     d_renderedStringValid = false;
+    notifySizeChanged();
 }
 
 
@@ -114,6 +117,11 @@ Sizef ListboxTextItem::getPixelSize(void) const
     if (!d_renderedStringValid)
         parseTextString();
 
+    // measuring walks every glyph, so it is only done when the rendered
+    // string or the font in effect changes.
+    if (d_pixelSizeFont == fnt)
+        return d_pixelSize;
+
     Sizef sz(0.0f, 0.0f);
 
     for (size_t i = 0; i < d_renderedString.getLineCount(); ++i)
@@ -125,6 +133,9 @@ Sizef ListboxTextItem::getPixelSize(void) const
             sz.d_width = line_sz.d_width;
     }
 
+    d_pixelSize = sz;
+    d_pixelSizeFont = fnt;
+
     return sz;
 }
 
@@ -198,6 +209,7 @@ void ListboxTextItem::parseTextString() const
             d_noTagsStringParser.parse(getTextVisual(), const_cast<Font*>(getFont()), &d_textCols);
 
     d_renderedStringValid = true;
+    d_pixelSizeFont = 0;
 }
 
 //----------------------------------------------------------------------------//
@@ -205,6 +217,7 @@ void ListboxTextItem::setTextParsingEnabled(const bool enable)
 {
     d_textParsingEnabled = enable;
     d_renderedStringValid = false;
+    notifySizeChanged();
 }
 
 //----------------------------------------------------------------------------//
@@ -216,7 +229,19 @@ bool ListboxTextItem::isTextParsingEnabled() const
 //----------------------------------------------------------------------------//
 bool ListboxTextItem::handleFontRenderSizeChange(const Font* const font)
 {
-    return getFont() == font;
+    if (getFont() != font)
+        return false;
+
+    d_pixelSizeFont = 0;
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+bool ListboxTextItem::isUsingFont(const Font* const font) const
+{
+    // markup in parsed text may select other fonts, so be conservative there.
+    return getFont() == font ||
+           (d_textParsingEnabled && getText().find('[') != String::npos);
 }
 
 //----------------------------------------------------------------------------//
@@ -294,6 +294,7 @@ void MenuItem::startPopupClosing(void)
     {
         d_autoPopupTimeElapsed = 0.0f;
         d_popupClosing = true;
+        notifyUpdateRequirementChanged();
         invalidate();
     }
     else
@@ -314,6 +315,7 @@ void MenuItem::startPopupOpening(void)
     {
         d_autoPopupTimeElapsed = 0.0f;
         d_popupOpening = true;
+        notifyUpdateRequirementChanged();
     }
 }
 
@@ -535,6 +537,15 @@ void MenuItem::updateSelf(float elapsed)
     }
 }
 
+/*************************************************************************
+    Return whether the delayed popup opening / closing needs updates.
+*************************************************************************/
+bool MenuItem::isUpdateRequired() const
+{
+    return (d_autoPopupTimeout != 0.0f && (d_popupOpening || d_popupClosing)) ||
+           ItemEntry::isUpdateRequired();
+}
+
 /*************************************************************************
     Internal version of adding a child window.
 *************************************************************************/
@@ -43,6 +43,80 @@
 // Start of CEGUI namespace section
 namespace CEGUI
 {
+namespace
+{
+//----------------------------------------------------------------------------//
+// The sort ordering of two (possibly empty) slots.  An empty slot sorts
+// before any item, and an item with a sort key before any item without one.
+// Items that both carry a sort key compare by key, others fall back to the
+// virtual ListboxItem operators.  Keeping keyed and unkeyed items apart is
+// what makes this a strict weak ordering when the two are mixed.
+bool itemSortsBefore(const ListboxItem* a, const ListboxItem* b)
+{
+    if (!b)
+        return false;
+
+    if (!a)
+        return true;
+
+    if (a->hasSortKey() != b->hasSortKey())
+        return a->hasSortKey();
+
+    if (a->hasSortKey())
+        return a->getSortKey() < b->getSortKey();
+
+    return *a < *b;
+}
+
+//----------------------------------------------------------------------------//
+bool itemSortsAfter(const ListboxItem* a, const ListboxItem* b)
+{
+    if (!a)
+        return false;
+
+    if (!b)
+        return true;
+
+    if (a->hasSortKey() != b->hasSortKey())
+        return b->hasSortKey();
+
+    if (a->hasSortKey())
+        return a->getSortKey() > b->getSortKey();
+
+    return *a > *b;
+}
+
+//----------------------------------------------------------------------------//
+// Sort column slot of one row, extracted once before sorting so the
+// comparisons do not have to go through the grid.
+struct RowSortEntry
+{
+    const ListboxItem* d_item;
+    double d_key;
+    bool d_hasKey;
+    uint d_row;
+};
+
+//----------------------------------------------------------------------------//
+bool rowEntryLess(const RowSortEntry& a, const RowSortEntry& b)
+{
+    if (a.d_hasKey && b.d_hasKey)
+        return a.d_key < b.d_key;
+
+    return itemSortsBefore(a.d_item, b.d_item);
+}
+
+//----------------------------------------------------------------------------//
+bool rowEntryGreater(const RowSortEntry& a, const RowSortEntry& b)
+{
+    if (a.d_hasKey && b.d_hasKey)
+        return a.d_key > b.d_key;
+
+    return itemSortsAfter(a.d_item, b.d_item);
+}
+
+//----------------------------------------------------------------------------//
+}
 const String MultiColumnList::EventNamespace("MultiColumnList");
 const String MultiColumnList::WidgetTypeName("CEGUI/MultiColumnList");
 
@@ -88,7 +162,8 @@ MultiColumnList::MultiColumnList(const String& type, const String& name) :
 	d_nominatedSelectRow(0),
 	d_lastSelected(0),
     d_columnCount(0),
-    d_autoSizeColumnUsesHeader(false)
+    d_autoSizeColumnUsesHeader(false),
+    d_itemRowIndexValid(true)
 {
 	// add properties
 	addMultiColumnListProperties();
@@ -239,17 +314,15 @@ ListHeaderSegment& MultiColumnList::getHeaderSegmentForColumn(uint col_idx) cons
 *************************************************************************/
 uint MultiColumnList::getItemRowIndex(const ListboxItem* item) const
 {
-	for (uint i = 0; i < getRowCount(); ++i)
-	{
-		if (isListboxItemInRow(item, i))
-		{
-			return i;
-		}
+    updateItemRowIndex();
 
-	}
+    const ItemRowIndex::const_iterator i = d_itemRowIndex.find(item);
 
-	// item is not attached to the list box, throw...
-	CEGUI_THROW(InvalidRequestException(
+    if (item && i != d_itemRowIndex.end())
+        return i->second;
+
+    // item is not attached to the list box, throw...
+    CEGUI_THROW(InvalidRequestException(
         "the given ListboxItem is not attached to this MultiColumnList."));
 }
 
@@ -259,9 +332,12 @@ uint MultiColumnList::getItemRowIndex(const ListboxItem* item) const
 *************************************************************************/
 uint MultiColumnList::getItemColumnIndex(const ListboxItem* item) const
 {
+    // NB: throws InvalidRequestException if item is not attached.
+    const ListRow& row = d_grid[getItemRowIndex(item)];
+
 	for (uint i = 0; i < getColumnCount(); ++i)
 	{
-		if (isListboxItemInColumn(item, i))
+		if (row[i] == item)
 		{
 			return i;
 		}
@@ -371,20 +447,9 @@ bool MultiColumnList::isListboxItemInRow(const ListboxItem* item, uint row_idx)
 *************************************************************************/
 bool MultiColumnList::isListboxItemInList(const ListboxItem* item) const
 {
-	for (uint i = 0; i < getRowCount(); ++i)
-	{
-		for (uint j = 0; j < getColumnCount(); ++j)
-		{
-			if (d_grid[i][j] == item)
-			{
-				return true;
-			}
-
-		}
-
-	}
+    updateItemRowIndex();
 
-	return false;
+    return item && d_itemRowIndex.find(item) != d_itemRowIndex.end();
 }
 
 
@@ -809,6 +874,8 @@ void MultiColumnList::removeColumn(uint col_idx)
 		getListHeader()->removeColumn(col_idx);
         --d_columnCount;
 
+        invalidateGridCaches();
+
 		// signal a change to the list contents
 		WindowEventArgs args(this);
 		onListContentsChanged(args);
@@ -891,12 +958,18 @@ uint MultiColumnList::addRow(ListboxItem* item, uint col_id, uint row_id)
         ListItemGrid::iterator final_pos = d_grid.insert(ins_pos, row);
 		// get final inserted position as an uint.
 		pos = (uint)std::distance(d_grid.begin(), final_pos);
+
+        invalidateGridCaches(pos);
 	}
 	// not sorted, just stick it on the end.
 	else
 	{
 		pos = getRowCount();
 		d_grid.push_back(row);
+
+        // existing rows keep their indices, so the item index stays valid.
+        if (item && d_itemRowIndexValid)
+            d_itemRowIndex.insert(std::make_pair(item, pos));
 	}
 
 	// signal a change to the list contents
@@ -941,6 +1014,7 @@ uint MultiColumnList::insertRow(ListboxItem* item, uint col_id, uint row_idx, ui
 		}
 
 		d_grid.insert(d_grid.begin() + row_idx, row);
+        invalidateGridCaches(row_idx);
 
 		// set the initial item in the new row
 		setItem(item, col_id, row_idx);
@@ -982,6 +1056,7 @@ void MultiColumnList::removeRow(uint row_idx)
 
 		// erase the row from the grid.
 		d_grid.erase(d_grid.begin() + row_idx);
+        invalidateGridCaches(row_idx);
 
 		// if we have erased the selection row, reset that to 0
 		if (d_nominatedSelectRow == row_idx)
@@ -1029,6 +1104,34 @@ void MultiColumnList::setItem(ListboxItem* item, const MCLGridRef& position)
 
 	d_grid[position.row][position.column] = item;
 
+    // rows are not shifted, so the item index can be patched in place.
+    invalidateRowExtents(position.row);
+
+    if (d_itemRowIndexValid && oldItem != item)
+    {
+        // the old item may be in other cells too, and finding out where
+        // means scanning the grid; leave that until the index is next used.
+        if (oldItem)
+        {
+            const ItemRowIndex::iterator i = d_itemRowIndex.find(oldItem);
+
+            if (i != d_itemRowIndex.end() && i->second == position.row)
+            {
+                d_itemRowIndex.clear();
+                d_itemRowIndexValid = false;
+            }
+        }
+
+        // the index holds the first row containing each item.
+        if (item && d_itemRowIndexValid)
+        {
+            const std::pair<ItemRowIndex::iterator, bool> res =
+                d_itemRowIndex.insert(std::make_pair(item, position.row));
+
+            if (!res.second && res.first->second > position.row)
+                res.first->second = position.row;
+        }
+    }
 
 	// signal a change to the list contents
 	WindowEventArgs args(this);
@@ -1330,6 +1433,7 @@ void MultiColumnList::setItemSelectState(const MCLGridRef& grid_ref, bool state)
 *************************************************************************/
 void MultiColumnList::handleUpdatedItemData(void)
 {
+    invalidateRowExtents();
     resortList();
 	configureScrollbars();
 	invalidate();
@@ -1467,14 +1571,7 @@ bool MultiColumnList::selectRange(const MCLGridRef& start, const MCLGridRef& end
 *************************************************************************/
 float MultiColumnList::getTotalRowsHeight(void) const
 {
-	float height = 0.0f;
-
-	for (uint i = 0; i < getRowCount(); ++i)
-	{
-		height += getHighestRowItemHeight(i);
-	}
-
-	return height;
+    return getRowOffset(getRowCount());
 }
 
 
@@ -1562,6 +1659,138 @@ float MultiColumnList::getHighestRowItemHeight(uint row_idx) const
 }
 
 
+/*************************************************************************
+	Return the offset of the top edge of the row at the given index
+*************************************************************************/
+float MultiColumnList::getRowOffset(uint row_idx) const
+{
+    if (row_idx == 0)
+        return 0.0f;
+
+    updateRowExtents();
+
+    if (d_rowExtents.empty())
+        return 0.0f;
+
+    return d_rowExtents[ceguimin(static_cast<size_t>(row_idx), d_rowExtents.size()) - 1];
+}
+
+
+/*************************************************************************
+	Return the index of the row that spans the given offset
+*************************************************************************/
+uint MultiColumnList::getRowIndexAtOffset(float offset) const
+{
+    updateRowExtents();
+
+    // first row whose bottom edge is below the offset
+    return static_cast<uint>(std::distance(d_rowExtents.begin(),
+                                           std::upper_bound(d_rowExtents.begin(),
+                                                            d_rowExtents.end(),
+                                                            offset)));
+}
+
+
+/*************************************************************************
+	Discard cached row extents from the given index onwards
+*************************************************************************/
+void MultiColumnList::invalidateRowExtents(uint row_idx) const
+{
+    if (row_idx < d_rowExtents.size())
+        d_rowExtents.resize(row_idx);
+}
+
+
+/*************************************************************************
+	Discard cached row extents from the row holding the given item onwards
+*************************************************************************/
+void MultiColumnList::notifyItemSizeChanged(const ListboxItem* item) const
+{
+    if (d_rowExtents.empty())
+        return;
+
+    // use the row index if it is already built; otherwise search from the
+    // end, so items in recently added rows are found at once.
+    if (d_itemRowIndexValid)
+    {
+        const ItemRowIndex::const_iterator i = d_itemRowIndex.find(item);
+
+        if (i != d_itemRowIndex.end())
+            invalidateRowExtents(i->second);
+
+        return;
+    }
+
+    for (uint row = static_cast<uint>(d_grid.size()); row-- > 0; )
+    {
+        for (uint col = 0; col < getColumnCount(); ++col)
+        {
+            if (d_grid[row][col] == item)
+            {
+                invalidateRowExtents(row);
+                return;
+            }
+        }
+    }
+}
+
+
+/*************************************************************************
+	Measure any rows whose extents are not cached
+*************************************************************************/
+void MultiColumnList::updateRowExtents() const
+{
+    size_t i = d_rowExtents.size();
+
+    if (i == d_grid.size())
+        return;
+
+    float bottom = i ? d_rowExtents[i - 1] : 0.0f;
+
+    for (; i < d_grid.size(); ++i)
+    {
+        bottom += getHighestRowItemHeight(static_cast<uint>(i));
+        d_rowExtents.push_back(bottom);
+    }
+}
+
+
+/*************************************************************************
+	Invalidate the caches that depend upon the layout of the grid
+*************************************************************************/
+void MultiColumnList::invalidateGridCaches(uint row_idx)
+{
+    invalidateRowExtents(row_idx);
+    d_itemRowIndex.clear();
+    d_itemRowIndexValid = false;
+}
+
+
+/*************************************************************************
+	Build the item to row index if it is out of date
+*************************************************************************/
+void MultiColumnList::updateItemRowIndex() const
+{
+    if (d_itemRowIndexValid)
+        return;
+
+    d_itemRowIndex.clear();
+
+    for (uint i = 0; i < getRowCount(); ++i)
+    {
+        for (uint j = 0; j < getColumnCount(); ++j)
+        {
+            // insert does not replace, so the first row wins for any item
+            // that has been placed in the grid more than once.
+            if (const ListboxItem* const item = d_grid[i][j])
+                d_itemRowIndex.insert(std::make_pair(item, i));
+        }
+    }
+
+    d_itemRowIndexValid = true;
+}
+
+
 /*************************************************************************
 	Clear the selected state for all items (implementation)
 *************************************************************************/
@@ -1601,29 +1830,26 @@ ListboxItem* MultiColumnList::getItemAtPoint(const Vector2f& pt) const
     const ListHeader* header = getListHeader();
     Rectf listArea(getListRenderArea());
 
-    float y = listArea.d_min.d_y - getVertScrollbar()->getScrollPosition();
+    const float y = listArea.d_min.d_y - getVertScrollbar()->getScrollPosition();
     float x = listArea.d_min.d_x - getHorzScrollbar()->getScrollPosition();
 
-    for (uint i = 0; i < getRowCount(); ++i)
+    // locate the row
+    const uint i = getRowIndexAtOffset(pt.d_y - y);
+
+    if (i >= getRowCount())
+        return 0;
+
+    // scan across to find column that was clicked
+    for (uint j = 0; j < getColumnCount(); ++j)
     {
-        y += getHighestRowItemHeight(i);
+        const ListHeaderSegment& seg = header->getSegmentFromColumn(j);
+        x += CoordConverter::asAbsolute(seg.getWidth(), header->getPixelSize().d_width);
 
-        // have we located the row?
-        if (pt.d_y < y)
+        // was this the column?
+        if (pt.d_x < x)
         {
-            // scan across to find column that was clicked
-            for (uint j = 0; j < getColumnCount(); ++j)
-            {
-                const ListHeaderSegment& seg = header->getSegmentFromColumn(j);
-                x += CoordConverter::asAbsolute(seg.getWidth(), header->getPixelSize().d_width);
-
-                // was this the column?
-                if (pt.d_x < x)
-                {
-                    // return contents of grid element that was clicked.
-                    return d_grid[i][j];
-                }
-            }
+            // return contents of grid element that was clicked.
+            return d_grid[i][j];
         }
     }
 
@@ -1893,6 +2119,8 @@ void MultiColumnList::onListColumnMoved(WindowEventArgs& e)
 *************************************************************************/
 void MultiColumnList::onFontChanged(WindowEventArgs& e)
 {
+    invalidateRowExtents();
+
     // Propagate to children
     // Set the font equal to that of our list
     for (uint col = 0; col < getColumnCount(); col++)
@@ -2316,6 +2544,7 @@ bool MultiColumnList::resetList_impl(void)
 
 		// clear all items from the grid.
 		d_grid.clear();
+        invalidateGridCaches();
 
 		// reset other affected fields
 		d_nominatedSelectRow = 0;
@@ -2524,17 +2753,11 @@ void MultiColumnList::ensureRowIsVisible(uint row_idx)
     }
     else
     {
-        float bottom;
-        float top = 0.0f;
         float listHeight = getListRenderArea().getHeight();
 
-        // get distance to top of item
-        uint row;
-        for (row = 0; row < row_idx; ++row)
-            top += getHighestRowItemHeight(row);
-
-        // calculate distance to bottom of item
-        bottom = top + getHighestRowItemHeight(row);
+        // get distances to top and bottom of item
+        float top = getRowOffset(row_idx);
+        float bottom = getRowOffset(row_idx + 1);
 
         // account for current scrollbar value
         float currPos = vertScrollbar->getScrollPosition();
@@ -2630,23 +2853,7 @@ bool MultiColumnList::getAutoSizeColumnUsesHeader() const
 *************************************************************************/
 bool MultiColumnList::ListRow::operator<(const ListRow& rhs) const
 {
-	ListboxItem* a = d_items[d_sortColumn];
-	ListboxItem* b = rhs.d_items[d_sortColumn];
-
-	// handle cases with empty slots
-	if (!b)
-	{
-		return false;
-	}
-	else if (!a)
-	{
-		return true;
-	}
-	else
-	{
-		return *a < *b;
-	}
-
+	return itemSortsBefore(d_items[d_sortColumn], rhs.d_items[d_sortColumn]);
 }
 
 
@@ -2655,23 +2862,7 @@ bool MultiColumnList::ListRow::operator<(const ListRow& rhs) const
 *************************************************************************/
 bool MultiColumnList::ListRow::operator>(const ListRow& rhs) const
 {
-	ListboxItem* a = d_items[d_sortColumn];
-	ListboxItem* b = rhs.d_items[d_sortColumn];
-
-	// handle cases with empty slots
-	if (!a)
-	{
-		return false;
-	}
-	else if (!b)
-	{
-		return true;
-	}
-	else
-	{
-		return *a > *b;
-	}
-
+	return itemSortsAfter(d_items[d_sortColumn], rhs.d_items[d_sortColumn]);
 }
 
 /*************************************************************************
@@ -2682,15 +2873,41 @@ void MultiColumnList::resortList()
     // re-sort list according to direction
     ListHeaderSegment::SortDirection dir = getSortDirection();
 
-    if (dir == ListHeaderSegment::Descending)
+    // no (or invalid) direction, so do not sort.
+    if ((dir != ListHeaderSegment::Descending &&
+         dir != ListHeaderSegment::Ascending) ||
+        getRowCount() < 2)
+            return;
+
+    const uint sort_col = getSortColumn();
+
+    // extract the sort slot of each row once.
+    std::vector<RowSortEntry> entries(getRowCount());
+    for (uint i = 0; i < getRowCount(); ++i)
     {
-        std::sort(d_grid.begin(), d_grid.end(), pred_descend);
+        RowSortEntry& entry = entries[i];
+        entry.d_item = d_grid[i][sort_col];
+        entry.d_hasKey = entry.d_item && entry.d_item->hasSortKey();
+        entry.d_key = entry.d_hasKey ? entry.d_item->getSortKey() : 0.0;
+        entry.d_row = i;
     }
-    else if (dir == ListHeaderSegment::Ascending)
+
+    std::stable_sort(entries.begin(), entries.end(),
+        dir == ListHeaderSegment::Descending ? &rowEntryGreater : &rowEntryLess);
+
+    // move the rows into their sorted positions; swapping the item vectors
+    // avoids copying them.
+    ListItemGrid sorted(getRowCount());
+    for (uint i = 0; i < getRowCount(); ++i)
     {
-        std::sort(d_grid.begin(), d_grid.end());
+        ListRow& src = d_grid[entries[i].d_row];
+        sorted[i].d_items.swap(src.d_items);
+        sorted[i].d_sortColumn = src.d_sortColumn;
+        sorted[i].d_rowID = src.d_rowID;
     }
-    // else no (or invalid) direction, so do not sort.
+
+    d_grid.swap(sorted);
+    invalidateGridCaches();
 }
 
 
@@ -36,10 +36,44 @@
 #include "CEGUI/WindowManager.h"
 #include "CEGUI/Clipboard.h"
 #include "CEGUI/UndoHandler.h"
+#include <algorithm>
 
 // Start of CEGUI namespace section
 namespace CEGUI
 {
+namespace
+{
+//----------------------------------------------------------------------------//
+// tokens longer than this are measured piecewise when broken across lines.
+const size_t LONG_TOKEN_LENGTH = 64;
+
+//----------------------------------------------------------------------------//
+/*
+    Return the number of code points of the token of \a length code points at
+    \a start_idx in \a text that fit within \a width, or \a length if the token
+    might fit entirely.  Only as much of the token as needed is measured.
+*/
+size_t getTokenFitLength(const Font& font, const String& text,
+                         size_t start_idx, size_t length, float width,
+                         String& scratch)
+{
+    for (size_t len = LONG_TOKEN_LENGTH; len < length; len *= 2)
+    {
+        scratch.assign(text, start_idx, len);
+        const size_t fit = font.getCharAtPixel(scratch, width);
+
+        // the offset after the last code point may depend on what follows it,
+        // so only a break before that is certain.
+        if (fit + 1 < len)
+            return fit;
+    }
+
+    return length;
+}
+
+//----------------------------------------------------------------------------//
+}
+
 const String MultiLineEditbox::EventNamespace("MultiLineEditbox");
 const String MultiLineEditbox::WidgetTypeName("CEGUI/MultiLineEditbox");
 
@@ -110,7 +144,13 @@ MultiLineEditbox::MultiLineEditbox(const String& type, const String& name) :
 	d_forceVertScroll(false),
 	d_forceHorzScroll(false),
 	d_selectionBrush(0),
-	d_lastRenderWidth(0.0)
+	d_lastRenderWidth(0.0),
+    d_textChangePending(false),
+    d_changeStartIdx(0),
+    d_changeOldLength(0),
+    d_changeNewLength(0),
+    d_lineShiftStart(0),
+    d_lineShiftDelta(0)
 {
 	addMultiLineEditboxProperties();
     // create undo handler
@@ -301,9 +341,8 @@ void MultiLineEditbox::setMaxTextLength(size_t max_len)
 		// trim string
         if (getText().length() > d_maxTextLen)
 		{
-            String newText = getText();
-            newText.resize(d_maxTextLen);
-            setText(newText);
+            replaceTextRange(d_maxTextLen, getText().length() - d_maxTextLen,
+                             String());
             d_undoHandler->clearUndoHistory();
 
 			onTextChanged(args);
@@ -330,10 +369,10 @@ void MultiLineEditbox::ensureCaretIsVisible(void)
 	{
 		Rectf textArea(getTextRenderArea());
 
-		size_t caretLineIdx = d_caretPos - d_lines[caretLine].d_startIdx;
+		size_t caretLineIdx = d_caretPos - getLineStartIdx(caretLine);
 
 		float ypos = caretLine * fnt->getLineSpacing();
-        float xpos = fnt->getTextAdvance(getText().substr(d_lines[caretLine].d_startIdx, caretLineIdx));
+        float xpos = fnt->getTextAdvance(getText().substr(getLineStartIdx(caretLine), caretLineIdx));
 
 		// adjust position for scroll bars
 		xpos -= horzScrollbar->getScrollPosition();
@@ -450,136 +489,359 @@ void MultiLineEditbox::formatText(void)
 //----------------------------------------------------------------------------//
 void MultiLineEditbox::formatText(const bool update_scrollbars)
 {
-	d_widestExtent = 0.0f;
-
-	String paraText;
-
 	const Font* fnt = getFont();
 
 	if (fnt)
 	{
 		float areaWidth = getTextRenderArea().getWidth();
-        String::size_type   currPos = 0;
-        String::size_type   paraLen;
-        LineInfo    line;
 
-        // now we will check if our width changed, if not we'll just update text from last cursor
-        if (areaWidth != d_lastRenderWidth || !d_undoHandler->canUndo())
+        // if only the text has changed since the last pass, just re-wrap the
+        // paragraphs that were touched; otherwise format everything.
+        if (!d_textChangePending || areaWidth != d_lastRenderWidth ||
+            !formatChangedText(areaWidth))
         {
             d_lines.clear();
+            d_lineShiftDelta = 0;
+            formatTextRange(0, getText().length(), areaWidth, d_lines);
+
+            d_widestExtent = 0.0f;
+            for (size_t i = 0; i < d_lines.size(); ++i)
+                d_widestExtent = ceguimax(d_widestExtent, d_lines[i].d_extent);
+        }
+
+		d_lastRenderWidth = areaWidth;
+	}
+    // lines can not be formatted without a font
+    else
+    {
+        d_lines.clear();
+        d_lineShiftDelta = 0;
+        d_widestExtent = 0.0f;
+    }
+
+    d_textChangePending = false;
+
+    if (update_scrollbars)
+        configureScrollbars();
+
+    invalidate();
+}
+
+//----------------------------------------------------------------------------//
+void MultiLineEditbox::formatTextRange(size_t start_idx, size_t end_idx,
+                                       float area_width, LineList& lines) const
+{
+    const Font* fnt = getFont();
+    const String& text = getText();
+
+    // scratch strings reused for every paragraph and token.
+	String paraText;
+    String tokenText;
+
+    String::size_type   currPos = start_idx;
+    String::size_type   paraLen;
+    LineInfo    line;
+
+    while (currPos < end_idx)
+    {
+        if ((paraLen = text.find_first_of(d_lineBreakChars, currPos)) == String::npos)
+        {
+            paraLen = text.length() - currPos;
+        }
+        else
+        {
+            ++paraLen -= currPos;
+        }
+
+        paraText.assign(text, currPos, paraLen);
+
+        if (!d_wordWrap || (area_width <= 0.0f))
+        {
+            // no word wrapping, so we are just one long line.
+            line.d_startIdx = currPos;
+            line.d_length	= paraLen;
+            line.d_extent	= fnt->getTextExtent(paraText);
+            lines.push_back(line);
         }
+        // must word-wrap the paragraph text
         else
         {
-            // ok there's no need to update whole text
-            size_t lastuUndoPos = d_undoHandler->getLastAction().d_startIdx;
-            // ok now delete all formatting data before lastuUndoPos
-            int countToRemove = getLineNumberFromIndex(lastuUndoPos) - 1;
-            if (countToRemove >= 0)
+            String::size_type lineIndex = 0;
+
+            // while there is text in the string
+            while (lineIndex < paraLen)
             {
-                d_lines.erase(d_lines.begin() + countToRemove, d_lines.end());
-                if (d_lines.size() > 0)
-                    currPos = d_lines.back().d_startIdx + d_lines.back().d_length;
+                String::size_type  lineLen = 0;
+                float lineExtent = 0.0f;
+
+                // loop while we have not reached the end of the paragraph string
+                while (lineLen < (paraLen - lineIndex))
+                {
+                    // get cp / char count of next token
+                    size_t nextTokenSize = getNextTokenLength(paraText, lineIndex + lineLen);
+
+                    // a long token that does not fit on a line of its own is
+                    // broken without measuring all of it, else wrapping it
+                    // would be quadratic in its length.
+                    if (lineLen == 0 && nextTokenSize > LONG_TOKEN_LENGTH)
+                    {
+                        const size_t fitLength = getTokenFitLength(*fnt,
+                            paraText, lineIndex, nextTokenSize, area_width,
+                            tokenText);
+
+                        if (fitLength < nextTokenSize)
+                        {
+                            lineLen = fitLength;
+                            break;
+                        }
+                    }
+
+                    // get pixel width of the token
+                    tokenText.assign(paraText, lineIndex + lineLen, nextTokenSize);
+                    float tokenExtent  = fnt->getTextExtent(tokenText);
+
+                    // would adding this token would overflow the available width
+                    if ((lineExtent + tokenExtent) > area_width)
+                    {
+                        // Was this the first token?
+                        if (lineLen == 0)
+                        {
+                            // get point at which to break the token
+                            tokenText.assign(paraText, lineIndex, nextTokenSize);
+                            lineLen = fnt->getCharAtPixel(tokenText, area_width);
+                        }
+
+                        // text wraps, exit loop early with line info up until wrap point
+                        break;
+                    }
+
+                    // add this token to current line
+                    lineLen    += nextTokenSize;
+                    lineExtent += tokenExtent;
+                }
+
+                // set up line info and add to collection
+                line.d_startIdx = currPos + lineIndex;
+                line.d_length	= lineLen;
+                line.d_extent	= lineExtent;
+                lines.push_back(line);
+
+                // update position in string
+                lineIndex += lineLen;
             }
-            else
-                d_lines.clear();
+
         }
 
-        while (currPos < getText().length())
-		{
-           if ((paraLen = getText().find_first_of(d_lineBreakChars, currPos)) == String::npos)
-			{
-               paraLen = getText().length() - currPos;
-			}
-			else
-			{
-				++paraLen -= currPos;
-			}
+        // skip to next 'paragraph' in text
+        currPos += paraLen;
+    }
+}
 
-            paraText = getText().substr(currPos, paraLen);
+//----------------------------------------------------------------------------//
+bool MultiLineEditbox::formatChangedText(float area_width)
+{
+    const String& text = getText();
+    const size_t oldTextLength =
+        text.length() - d_changeNewLength + d_changeOldLength;
 
-			if (!d_wordWrap || (areaWidth <= 0.0f))
-			{
-				// no word wrapping, so we are just one long line.
-				line.d_startIdx = currPos;
-				line.d_length	= paraLen;
-				line.d_extent	= fnt->getTextExtent(paraText);
-				d_lines.push_back(line);
-
-				// update widest, if needed.
-				if (line.d_extent > d_widestExtent)
-				{
-					d_widestExtent = line.d_extent;
-				}
+    // the lines must exactly cover the text as it was before the change.
+    if (d_lines.empty() ||
+        getLineStartIdx(d_lines.size() - 1) + d_lines.back().d_length !=
+            oldTextLength)
+        return false;
 
-			}
-			// must word-wrap the paragraph text
-			else
-			{
-				String::size_type lineIndex = 0;
-
-				// while there is text in the string
-				while (lineIndex < paraLen)
-				{
-					String::size_type  lineLen = 0;
-					float lineExtent = 0.0f;
-
-					// loop while we have not reached the end of the paragraph string
-					while (lineLen < (paraLen - lineIndex))
-					{
-						// get cp / char count of next token
-						size_t nextTokenSize = getNextTokenLength(paraText, lineIndex + lineLen);
-
-						// get pixel width of the token
-						float tokenExtent  = fnt->getTextExtent(paraText.substr(lineIndex + lineLen, nextTokenSize));
-
-						// would adding this token would overflow the available width
-						if ((lineExtent + tokenExtent) > areaWidth)
-						{
-							// Was this the first token?
-							if (lineLen == 0)
-							{
-								// get point at which to break the token
-								lineLen = fnt->getCharAtPixel(paraText.substr(lineIndex, nextTokenSize), areaWidth);
-							}
-
-							// text wraps, exit loop early with line info up until wrap point
-							break;
-						}
-
-						// add this token to current line
-						lineLen    += nextTokenSize;
-						lineExtent += tokenExtent;
-					}
-
-					// set up line info and add to collection
-					line.d_startIdx = currPos + lineIndex;
-					line.d_length	= lineLen;
-					line.d_extent	= lineExtent;
-					d_lines.push_back(line);
-
-					// update widest, if needed.
-					if (lineExtent > d_widestExtent)
-					{
-						d_widestExtent = lineExtent;
-					}
-
-					// update position in string
-					lineIndex += lineLen;
-				}
+    // text before the change is untouched, so re-formatting starts at the
+    // beginning of the paragraph that contains the change.
+    size_t paraStart = 0;
+    if (d_changeStartIdx > 0)
+    {
+        const size_t pos =
+            text.find_last_of(d_lineBreakChars, d_changeStartIdx - 1);
 
-			}
+        if (pos != String::npos)
+            paraStart = pos + 1;
+    }
 
-			// skip to next 'paragraph' in text
-			currPos += paraLen;
-		}
-		
-		d_lastRenderWidth = areaWidth;
-	}
+    // and ends with the paragraph containing the end of the change; text
+    // after that is unchanged, but has moved.
+    const size_t changeEnd = d_changeStartIdx + d_changeNewLength;
+    size_t paraEnd = text.find_first_of(d_lineBreakChars, changeEnd);
+    paraEnd = (paraEnd == String::npos) ? text.length() : paraEnd + 1;
 
-    if (update_scrollbars)
-        configureScrollbars();
+    const size_t oldParaEnd = paraEnd - d_changeNewLength + d_changeOldLength;
 
-	invalidate();
+    // locate the lines formatted from the old paragraphs.
+    const size_t first = getFirstLineFromIdx(paraStart);
+
+    if (first == d_lines.size() ? paraStart != oldTextLength :
+                                  getLineStartIdx(first) != paraStart)
+        return false;
+
+    size_t last = first;
+    while (last < d_lines.size() && getLineStartIdx(last) < oldParaEnd)
+        ++last;
+
+    bool widestRemoved = false;
+    for (size_t i = first; i < last; ++i)
+        widestRemoved |= (d_lines[i].d_extent >= d_widestExtent);
+
+    LineList newLines;
+    formatTextRange(paraStart, paraEnd, area_width, newLines);
+
+    // the lines that follow have moved by delta.  Rather than updating them
+    // all, the move is merged with the pending one, which only needs the
+    // lines between the two edits to be updated.
+    const size_t delta = d_changeNewLength - d_changeOldLength;
+    if (d_lineShiftDelta != 0 && d_lineShiftStart > last)
+    {
+        for (size_t i = last; i < d_lineShiftStart; ++i)
+            d_lines[i].d_startIdx += delta;
+
+        d_lineShiftStart += newLines.size() - (last - first);
+    }
+    else
+    {
+        if (d_lineShiftDelta != 0)
+        {
+            for (size_t i = d_lineShiftStart; i < first; ++i)
+                d_lines[i].d_startIdx += d_lineShiftDelta;
+        }
+
+        d_lineShiftStart = first + newLines.size();
+    }
+    d_lineShiftDelta += delta;
+
+    // splice in the new lines.
+    if (newLines.size() == last - first)
+    {
+        std::copy(newLines.begin(), newLines.end(), d_lines.begin() + first);
+    }
+    else
+    {
+        d_lines.erase(d_lines.begin() + first, d_lines.begin() + last);
+        d_lines.insert(d_lines.begin() + first, newLines.begin(), newLines.end());
+    }
+
+    float newWidest = 0.0f;
+    for (size_t i = 0; i < newLines.size(); ++i)
+        newWidest = ceguimax(newWidest, newLines[i].d_extent);
+
+    // all lines only need to be checked when the widest got narrower.
+    if (widestRemoved && newWidest < d_widestExtent)
+    {
+        d_widestExtent = 0.0f;
+        for (size_t i = 0; i < d_lines.size(); ++i)
+            d_widestExtent = ceguimax(d_widestExtent, d_lines[i].d_extent);
+    }
+    else
+    {
+        d_widestExtent = ceguimax(d_widestExtent, newWidest);
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void MultiLineEditbox::replaceTextRange(size_t start_idx, size_t length,
+                                        const String& text)
+{
+    // grow geometrically, so that repeated appends are not quadratic.
+    const size_t newLength = d_textLogical.length() - length + text.length();
+    if (newLength > d_textLogical.capacity())
+        d_textLogical.reserve(ceguimax(newLength, d_textLogical.capacity() * 2));
+
+    d_textLogical.replace(start_idx, length, text);
+    d_renderedStringValid = false;
+    d_bidiDataValid = false;
+
+    // merge with any change that has not been formatted yet
+    if (d_textChangePending)
+    {
+        const size_t changeStart = ceguimin(start_idx, d_changeStartIdx);
+        const size_t changeEnd = ceguimax(start_idx + length,
+                                          d_changeStartIdx + d_changeNewLength);
+
+        d_changeOldLength = changeEnd - changeStart -
+                            d_changeNewLength + d_changeOldLength;
+        d_changeNewLength = changeEnd - changeStart - length + text.length();
+        d_changeStartIdx = changeStart;
+    }
+    else
+    {
+        d_changeStartIdx = start_idx;
+        d_changeOldLength = length;
+        d_changeNewLength = text.length();
+        d_textChangePending = true;
+    }
+}
+
+//----------------------------------------------------------------------------//
+size_t MultiLineEditbox::getLineStartIdx(size_t line) const
+{
+    return line < d_lineShiftStart ? d_lines[line].d_startIdx :
+                                     d_lines[line].d_startIdx + d_lineShiftDelta;
+}
+
+//----------------------------------------------------------------------------//
+size_t MultiLineEditbox::getFirstLineFromIdx(size_t index) const
+{
+    size_t first = 0;
+    size_t count = d_lines.size();
+
+    while (count > 0)
+    {
+        const size_t step = count / 2;
+
+        if (getLineStartIdx(first + step) < index)
+        {
+            first += step + 1;
+            count -= step + 1;
+        }
+        else
+        {
+            count = step;
+        }
+    }
+
+    return first;
+}
+
+//----------------------------------------------------------------------------//
+void MultiLineEditbox::applyLineStartShift() const
+{
+    if (d_lineShiftDelta == 0)
+        return;
+
+    for (size_t i = d_lineShiftStart; i < d_lines.size(); ++i)
+        d_lines[i].d_startIdx += d_lineShiftDelta;
+
+    d_lineShiftDelta = 0;
+}
+
+//----------------------------------------------------------------------------//
+const MultiLineEditbox::LineList& MultiLineEditbox::getFormattedLines(void) const
+{
+    applyLineStartShift();
+    return d_lines;
+}
+
+//----------------------------------------------------------------------------//
+void MultiLineEditbox::insertText(const String& text,
+                                  const String::size_type position)
+{
+    replaceTextRange(position, 0, text);
+
+    WindowEventArgs args(this);
+    onTextChanged(args);
+}
+
+//----------------------------------------------------------------------------//
+void MultiLineEditbox::appendText(const String& text)
+{
+    replaceTextRange(getText().length(), 0, text);
+
+    WindowEventArgs args(this);
+    onTextChanged(args);
 }
 
 
@@ -636,7 +898,7 @@ size_t MultiLineEditbox::getTextIndexFromPosition(const Vector2f& pt) const
 		lineNumber = d_lines.size() - 1;
 	}
 
-    String lineText(getText().substr(d_lines[lineNumber].d_startIdx, d_lines[lineNumber].d_length));
+    String lineText(getText().substr(getLineStartIdx(lineNumber), d_lines[lineNumber].d_length));
 
 	size_t lineIdx = getFont()->getCharAtPixel(lineText, wndPt.d_x);
 
@@ -645,7 +907,7 @@ size_t MultiLineEditbox::getTextIndexFromPosition(const Vector2f& pt) const
 		lineIdx = lineText.length() - 1;
 	}
 
-	return d_lines[lineNumber].d_startIdx + lineIdx;
+	return getLineStartIdx(lineNumber) + lineIdx;
 }
 
 
@@ -667,19 +929,14 @@ size_t MultiLineEditbox::getLineNumberFromIndex(size_t index) const
 	}
 	else
 	{
-		size_t indexCount = 0;
-		size_t caretLine = 0;
-
-		for (; caretLine < lineCount; ++caretLine)
-		{
-			indexCount += d_lines[caretLine].d_length;
-
-			if (index < indexCount)
-			{
-				return caretLine;
-			}
+        // the line is the last one starting at or before index.
+        const size_t line = getFirstLineFromIdx(index + 1);
 
-		}
+        if (line != 0 &&
+            index < getLineStartIdx(line - 1) + d_lines[line - 1].d_length)
+        {
+            return line - 1;
+        }
 
 	}
 
@@ -716,14 +973,12 @@ void MultiLineEditbox::eraseSelectedText(bool modify_text)
 		// erase the selected characters (if required)
 		if (modify_text)
 		{
-            String newText = getText();
             UndoHandler::UndoAction undo;
             undo.d_type = UndoHandler::UAT_DELETE;
             undo.d_startIdx = getSelectionStartIndex();
-            undo.d_text = newText.substr(getSelectionStartIndex(), getSelectionLength());
+            undo.d_text = getText().substr(getSelectionStartIndex(), getSelectionLength());
             d_undoHandler->addUndoHistory(undo);
-            newText.erase(getSelectionStartIndex(), getSelectionLength());
-            setText(newText);
+            replaceTextRange(getSelectionStartIndex(), getSelectionLength(), String());
 
 			// trigger notification that text has changed.
 			WindowEventArgs args(this);
@@ -782,14 +1037,12 @@ bool MultiLineEditbox::performPaste(Clipboard& clipboard)
     // if there is room
     if (getText().length() - clipboardText.length() < d_maxTextLen)
     {
-        String newText = getText();
         UndoHandler::UndoAction undo;
         undo.d_type = UndoHandler::UAT_INSERT;
         undo.d_startIdx = getCaretIndex();
         undo.d_text = clipboardText;
         d_undoHandler->addUndoHistory(undo);
-        newText.insert(getCaretIndex(), clipboardText);
-        setText(newText);
+        replaceTextRange(getCaretIndex(), 0, clipboardText);
 
         d_caretPos += clipboardText.length();
 
@@ -821,15 +1074,13 @@ void MultiLineEditbox::handleBackspace(void)
 		}
 		else if (d_caretPos > 0)
 		{
-            String newText = getText();
             UndoHandler::UndoAction undo;
             undo.d_type = UndoHandler::UAT_DELETE;
             undo.d_startIdx = d_caretPos - 1;
-            undo.d_text = newText.substr(d_caretPos - 1, 1);
+            undo.d_text = getText().substr(d_caretPos - 1, 1);
             d_undoHandler->addUndoHistory(undo);
-            newText.erase(d_caretPos - 1, 1);
             setCaretIndex(d_caretPos - 1);
-            setText(newText);
+            replaceTextRange(d_caretPos, 1, String());
 
 			WindowEventArgs args(this);
 			onTextChanged(args);
@@ -852,16 +1103,12 @@ void MultiLineEditbox::handleDelete(void)
 		}
         else if (getCaretIndex() < getText().length() - 1)
 		{
-            String newText = getText();
             UndoHandler::UndoAction undo;
             undo.d_type = UndoHandler::UAT_DELETE;
             undo.d_startIdx = d_caretPos;
-            undo.d_text = newText.substr(d_caretPos, 1);
+            undo.d_text = getText().substr(d_caretPos, 1);
             d_undoHandler->addUndoHistory(undo);
-            newText.erase(d_caretPos, 1);
-            setText(newText);
-
-			ensureCaretIsVisible();
+            replaceTextRange(d_caretPos, 1, String());
 
 			WindowEventArgs args(this);
 			onTextChanged(args);
@@ -1013,7 +1260,7 @@ void MultiLineEditbox::handleLineHome(uint sysKeys)
 
 	if (line < d_lines.size())
 	{
-		size_t lineStartIdx = d_lines[line].d_startIdx;
+		size_t lineStartIdx = getLineStartIdx(line);
 
 		if (d_caretPos > lineStartIdx)
 		{
@@ -1043,7 +1290,7 @@ void MultiLineEditbox::handleLineEnd(uint sysKeys)
 
 	if (line < d_lines.size())
 	{
-		size_t lineEndIdx = d_lines[line].d_startIdx + d_lines[line].d_length - 1;
+		size_t lineEndIdx = getLineStartIdx(line) + d_lines[line].d_length - 1;
 
 		if (d_caretPos < lineEndIdx)
 		{
@@ -1073,13 +1320,13 @@ void MultiLineEditbox::handleLineUp(uint sysKeys)
 
 	if (caretLine > 0)
 	{
-        float caretPixelOffset = getFont()->getTextAdvance(getText().substr(d_lines[caretLine].d_startIdx, d_caretPos - d_lines[caretLine].d_startIdx));
+        float caretPixelOffset = getFont()->getTextAdvance(getText().substr(getLineStartIdx(caretLine), d_caretPos - getLineStartIdx(caretLine)));
 
 		--caretLine;
 
-        size_t newLineIndex = getFont()->getCharAtPixel(getText().substr(d_lines[caretLine].d_startIdx, d_lines[caretLine].d_length), caretPixelOffset);
+        size_t newLineIndex = getFont()->getCharAtPixel(getText().substr(getLineStartIdx(caretLine), d_lines[caretLine].d_length), caretPixelOffset);
 
-		setCaretIndex(d_lines[caretLine].d_startIdx + newLineIndex);
+		setCaretIndex(getLineStartIdx(caretLine) + newLineIndex);
 	}
 
 	if (sysKeys & Shift)
@@ -1103,13 +1350,13 @@ void MultiLineEditbox::handleLineDown(uint sysKeys)
 
 	if ((d_lines.size() > 1) && (caretLine < (d_lines.size() - 1)))
 	{
-        float caretPixelOffset = getFont()->getTextAdvance(getText().substr(d_lines[caretLine].d_startIdx, d_caretPos - d_lines[caretLine].d_startIdx));
+        float caretPixelOffset = getFont()->getTextAdvance(getText().substr(getLineStartIdx(caretLine), d_caretPos - getLineStartIdx(caretLine)));
 
 		++caretLine;
 
-        size_t newLineIndex = getFont()->getCharAtPixel(getText().substr(d_lines[caretLine].d_startIdx, d_lines[caretLine].d_length), caretPixelOffset);
+        size_t newLineIndex = getFont()->getCharAtPixel(getText().substr(getLineStartIdx(caretLine), d_lines[caretLine].d_length), caretPixelOffset);
 
-		setCaretIndex(d_lines[caretLine].d_startIdx + newLineIndex);
+		setCaretIndex(getLineStartIdx(caretLine) + newLineIndex);
 	}
 
 	if (sysKeys & Shift)
@@ -1137,14 +1384,12 @@ void MultiLineEditbox::handleNewLine(uint /*sysKeys*/)
 		// if there is room
        if (getText().length() - 1 < d_maxTextLen)
 		{
-            String newText = getText();
             UndoHandler::UndoAction undo;
             undo.d_type = UndoHandler::UAT_INSERT;
             undo.d_startIdx = getCaretIndex();
             undo.d_text = "\x0a";
             d_undoHandler->addUndoHistory(undo);
-            newText.insert(getCaretIndex(), 1, 0x0a);
-            setText(newText);
+            replaceTextRange(getCaretIndex(), 0, undo.d_text);
 
 			d_caretPos++;
 
@@ -1169,7 +1414,7 @@ void MultiLineEditbox::handlePageUp(uint sysKeys)
     {
         newline = caretLine - nbLine;
     }
-    setCaretIndex(d_lines[newline].d_startIdx);
+    setCaretIndex(getLineStartIdx(newline));
     if (sysKeys & Shift)
     {
         setSelection(d_caretPos, d_selectionEnd);
@@ -1194,7 +1439,7 @@ void MultiLineEditbox::handlePageDown(uint sysKeys)
     {
         newline = std::min(newline,d_lines.size() - 1);
     }
-    setCaretIndex(d_lines[newline].d_startIdx + d_lines[newline].d_length - 1);
+    setCaretIndex(getLineStartIdx(newline) + d_lines[newline].d_length - 1);
     if (sysKeys & Shift)
     {
         setSelection(d_selectionStart, d_caretPos);
@@ -1283,7 +1528,7 @@ void MultiLineEditbox::onMouseTripleClicked(MouseEventArgs& e)
 	if (e.button == LeftButton)
 	{
 		size_t caretLine = getLineNumberFromIndex(d_caretPos);
-		size_t lineStart = d_lines[caretLine].d_startIdx;
+		size_t lineStart = getLineStartIdx(caretLine);
 
 		// find end of last paragraph
         String::size_type paraStart = getText().find_last_of(d_lineBreakChars, lineStart);
@@ -1301,9 +1546,7 @@ void MultiLineEditbox::onMouseTripleClicked(MouseEventArgs& e)
 		// erroneous situation and select up to end at end of text.
 		if (paraEnd == String::npos)
 		{
-            String newText = getText();
-            newText.append(1, '\n');
-            setText(newText);
+            appendText("\n");
 
             paraEnd = getText().length() - 1;
 		}
@@ -1373,14 +1616,12 @@ void MultiLineEditbox::onCharacter(KeyEventArgs& e)
 		// if there is room
        if (getText().length() - 1 < d_maxTextLen)
 		{
-            String newText = getText();
             UndoHandler::UndoAction undo;
             undo.d_type = UndoHandler::UAT_INSERT;
             undo.d_startIdx = getCaretIndex();
             undo.d_text = e.codepoint;
             d_undoHandler->addUndoHistory(undo);
-            newText.insert(getCaretIndex(), 1, e.codepoint);
-            setText(newText);
+            replaceTextRange(getCaretIndex(), 0, undo.d_text);
 
 			d_caretPos++;
 
@@ -1517,22 +1758,25 @@ void MultiLineEditbox::onKeyDown(KeyEventArgs& e)
 *************************************************************************/
 void MultiLineEditbox::onTextChanged(WindowEventArgs& e)
 {
+    // only changes made via replaceTextRange can be formatted incrementally,
+    // anything else (i.e. setText) has replaced the text wholesale.
+    const bool changeTracked = d_textChangePending;
+
     // ensure last character is a new line
     if ((getText().length() == 0) || (getText()[getText().length() - 1] != '\n'))
-    {
-        String newText = getText();
-        newText.append(1, '\n');
-        setText(newText);
-    }
+        replaceTextRange(getText().length(), 0, "\n");
 
+    d_textChangePending = changeTracked;
+
+    // layout new text.  This is done before handlers are notified, so that
+    // any further change they make is formatted against up to date lines.
+    formatText(true);
 
     // base class processing
     Window::onTextChanged(e);
 
     // clear selection
     clearSelection();
-    // layout new text
-    formatText(true);
     // layout child windows (scrollbars) since text layout may have changed
     performChildWindowLayout();
     // ensure caret is still within the text
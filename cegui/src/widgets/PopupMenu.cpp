@@ -121,6 +121,7 @@ void PopupMenu::openPopupMenu(bool notify)
 		d_fadingOut=false;
 		setAlpha(0.0f);
 		d_fadeElapsed = 0;
+		notifyUpdateRequirementChanged();
 	}
 	// should not fade!
 	else
@@ -179,6 +180,7 @@ void PopupMenu::closePopupMenu(bool notify)
 	    d_fadingOut = true;
 	    setAlpha(d_origAlpha);
 	    d_fadeElapsed = 0;
+	    notifyUpdateRequirementChanged();
 	}
 	// should not fade!
 	else
@@ -233,6 +235,14 @@ void PopupMenu::updateSelf(float elapsed)
 	}
 }
 
+/*************************************************************************
+    Return whether the popup menu needs updates to process fading.
+*************************************************************************/
+bool PopupMenu::isUpdateRequired() const
+{
+    return d_fading || MenuBase::isUpdateRequired();
+}
+
 
 /*************************************************************************
 	Sets up sizes and positions for attached ItemEntry children.
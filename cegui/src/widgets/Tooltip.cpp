@@ -306,6 +306,12 @@ namespace CEGUI
         }
     }
 
+    bool Tooltip::isUpdateRequired() const
+    {
+        // the hover and display timers run in every state.
+        return true;
+    }
+
     void Tooltip::addTooltipProperties(void)
     {
         const String& propertyOrigin = WidgetTypeName;
@@ -321,6 +327,15 @@ namespace CEGUI
         );
     }
 
+    void Tooltip::prepareForRecycling(void)
+    {
+        Window::prepareForRecycling();
+
+        d_active = false;
+        d_elapsed = 0;
+        d_target = 0;
+    }
+
     void Tooltip::onHidden(WindowEventArgs& e)
     {
         Window::onHidden(e);
@@ -74,10 +74,12 @@ Timer::Timer(const CEGUI::String& type, const CEGUI::String& name) :
 void Timer::start()
 {
     d_started = true;
+    notifyUpdateRequirementChanged();
 }
 void Timer::stop()
 {
     d_started = false;
+    notifyUpdateRequirementChanged();
 }
 bool Timer::isStarted() const
 {
@@ -86,6 +88,7 @@ bool Timer::isStarted() const
 void Timer::setDelay(float delay)
 {
     d_delay = delay;
+    notifyUpdateRequirementChanged();
 }
 
 float Timer::getDelay() const
@@ -107,6 +110,11 @@ void Timer::updateSelf(float elapsed)
     }
 }
 
+bool Timer::isUpdateRequired() const
+{
+    return (d_delay > 0 && d_started) || Window::isUpdateRequired();
+}
+
 void Timer::addTimerProperties(void)
 {
     addProperty(&d_delayProperty);
@@ -120,6 +120,7 @@ public:
 
 protected:
     virtual void updateSelf(float elapsed);
+    virtual bool isUpdateRequired() const;
     
 private:
     static TimerProperties::Delay d_delayProperty;
@@ -30,8 +30,35 @@
 #include "CEGUI/AnimationInstance.h"
 #include "CEGUI/AnimationManager.h"
 #include "CEGUI/Affector.h"
+#include "CEGUI/KeyFrame.h"
+#include "CEGUI/TplInterpolators.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/Window.h"
 
 #include <boost/test/unit_test.hpp>
+#include <boost/timer.hpp>
+
+/*
+ * Linear float interpolator that scales the key values it parses, so tests
+ * can tell which interpolator produced a cached parsed value.
+ */
+class ScalingInterpolator : public CEGUI::TplLinearInterpolator<float>
+{
+public:
+    ScalingInterpolator(float scale) :
+        CEGUI::TplLinearInterpolator<float>("ScaledFloat"),
+        d_scale(scale)
+    {}
+
+    CEGUI::InterpolatorValue* createValue(const CEGUI::String& value) const
+    {
+        return CEGUI_NEW_AO CEGUI::TplInterpolatorValue<float>(
+            CEGUI::PropertyHelper<float>::fromString(value) * d_scale);
+    }
+
+private:
+    float d_scale;
+};
 
 struct SampleAnimationSetupFixture
 {
@@ -180,4 +207,129 @@ BOOST_AUTO_TEST_CASE(ZeroDurationReplayModes)
     }
 }
 
+BOOST_AUTO_TEST_CASE(KeyFrameInterpolation)
+{
+    CEGUI::Window* window = CEGUI::WindowManager::getSingleton().createWindow("DefaultWindow");
+
+    CEGUI::Animation* anim = CEGUI::AnimationManager::getSingleton().createAnimation();
+    anim->setDuration(2.0f);
+    anim->setReplayMode(CEGUI::Animation::RM_Once);
+    CEGUI::Affector* affector = anim->createAffector("Alpha", "float");
+    affector->createKeyFrame(0.0f, "0");
+    affector->createKeyFrame(1.0f, "1");
+    CEGUI::KeyFrame* last = affector->createKeyFrame(2.0f, "0.5");
+
+    CEGUI::AnimationInstance* instance = CEGUI::AnimationManager::getSingleton().instantiateAnimation(anim);
+    instance->setTarget(window);
+    instance->start(false);
+
+    instance->step(0.5f);
+    BOOST_CHECK_CLOSE(window->getAlpha(), 0.5f, 0.0001f);
+    instance->step(0.5f);
+    BOOST_CHECK_CLOSE(window->getAlpha(), 1.0f, 0.0001f);
+    instance->step(0.5f);
+    BOOST_CHECK_CLOSE(window->getAlpha(), 0.75f, 0.0001f);
+
+    // changed key values must not be served from the parsed value cache
+    last->setValue("0");
+    instance->step(0.0f);
+    BOOST_CHECK_CLOSE(window->getAlpha(), 0.5f, 0.0001f);
+
+    // relative application is based on the value saved on start
+    affector->setApplicationMethod(CEGUI::Affector::AM_Relative);
+    affector->getKeyFrameAtIdx(1)->setValue("0.5");
+    window->setAlpha(0.25f);
+    instance->start(false);
+    instance->step(1.0f);
+    BOOST_CHECK_CLOSE(window->getAlpha(), 0.75f, 0.0001f);
+
+    CEGUI::AnimationManager::getSingleton().destroyAnimationInstance(instance);
+    CEGUI::AnimationManager::getSingleton().destroyAnimation(anim);
+    CEGUI::WindowManager::getSingleton().destroyWindow(window);
+}
+
+BOOST_AUTO_TEST_CASE(ReplacedInterpolator)
+{
+    CEGUI::Window* window = CEGUI::WindowManager::getSingleton().createWindow("DefaultWindow");
+
+    CEGUI::Animation* anim = CEGUI::AnimationManager::getSingleton().createAnimation();
+    anim->setDuration(1.0f);
+    CEGUI::Affector* affector = anim->createAffector();
+    affector->setTargetProperty("Alpha");
+    affector->createKeyFrame(0.0f, "0");
+    affector->createKeyFrame(1.0f, "1");
+
+    CEGUI::AnimationInstance* instance = CEGUI::AnimationManager::getSingleton().instantiateAnimation(anim);
+    instance->setTarget(window);
+
+    ScalingInterpolator* interpolator = new ScalingInterpolator(1.0f);
+    affector->setInterpolator(interpolator);
+    instance->start(false);
+    instance->step(0.5f);
+    BOOST_CHECK_CLOSE(window->getAlpha(), 0.5f, 0.0001f);
+
+    // a replacement interpolator may well be allocated at the same address;
+    // values parsed by the old one must not be used with it.
+    const CEGUI::uint old_serial = interpolator->getSerial();
+    delete interpolator;
+    interpolator = new ScalingInterpolator(0.5f);
+    BOOST_CHECK(interpolator->getSerial() != old_serial);
+
+    affector->setInterpolator(interpolator);
+    instance->step(0.0f);
+    BOOST_CHECK_CLOSE(window->getAlpha(), 0.25f, 0.0001f);
+
+    CEGUI::AnimationManager::getSingleton().destroyAnimationInstance(instance);
+    CEGUI::AnimationManager::getSingleton().destroyAnimation(anim);
+    CEGUI::WindowManager::getSingleton().destroyWindow(window);
+    delete interpolator;
+}
+
+BOOST_AUTO_TEST_CASE(StepPerformance)
+{
+    const int instanceCount = 300;
+    const int stepCount = 100;
+
+    CEGUI::Animation* anim = CEGUI::AnimationManager::getSingleton().createAnimation();
+    anim->setDuration(1.0f);
+    anim->setReplayMode(CEGUI::Animation::RM_Loop);
+    {
+        CEGUI::Affector* affector = anim->createAffector("Alpha", "float");
+        for (int i = 0; i <= 10; ++i)
+            affector->createKeyFrame(i * 0.1f, i % 2 ? "1" : "0.5");
+    }
+    {
+        CEGUI::Affector* affector = anim->createAffector("Position", "UVector2");
+        affector->createKeyFrame(0.0f, "{{0,0},{0,0}}");
+        affector->createKeyFrame(0.5f, "{{0.5,10},{0.5,10}}");
+        affector->createKeyFrame(1.0f, "{{0,0},{0,0}}");
+    }
+
+    std::vector<CEGUI::Window*> windows;
+    std::vector<CEGUI::AnimationInstance*> instances;
+    for (int i = 0; i < instanceCount; ++i)
+    {
+        windows.push_back(CEGUI::WindowManager::getSingleton().createWindow("DefaultWindow"));
+        instances.push_back(CEGUI::AnimationManager::getSingleton().instantiateAnimation(anim));
+        instances.back()->setTarget(windows.back());
+        instances.back()->start(false);
+    }
+
+    boost::timer timer;
+    for (int step = 0; step < stepCount; ++step)
+        for (int i = 0; i < instanceCount; ++i)
+            instances[i]->step(0.013f);
+
+    BOOST_TEST_MESSAGE("Time taken, " << stepCount << " steps of " <<
+                       instanceCount << " animation instances: " <<
+                       timer.elapsed());
+
+    for (int i = 0; i < instanceCount; ++i)
+    {
+        CEGUI::AnimationManager::getSingleton().destroyAnimationInstance(instances[i]);
+        CEGUI::WindowManager::getSingleton().destroyWindow(windows[i]);
+    }
+    CEGUI::AnimationManager::getSingleton().destroyAnimation(anim);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,143 @@
+/***********************************************************************
+ *    filename:   ColourPickerConversions.cpp
+ *    created:    Sun Oct 18 2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2013 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/CommonDialogs/ColourPicker/Conversions.h"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/timer.hpp>
+
+#include <vector>
+
+namespace
+{
+const size_t ImageSize = 256;
+
+void makeLabColours(std::vector<CEGUI::Lab_Colour>& colours)
+{
+    colours.resize(ImageSize * ImageSize);
+    for (size_t y = 0; y < ImageSize; ++y)
+        for (size_t x = 0; x < ImageSize; ++x)
+            colours[y * ImageSize + x] =
+                CEGUI::Lab_Colour(100.0f * y / (ImageSize - 1),
+                                  -128.0f + 255.0f * x / (ImageSize - 1),
+                                  127.0f - 255.0f * y / (ImageSize - 1));
+}
+
+void makeHSVColours(std::vector<CEGUI::HSV_Colour>& colours)
+{
+    colours.resize(ImageSize * ImageSize);
+    for (size_t y = 0; y < ImageSize; ++y)
+        for (size_t x = 0; x < ImageSize; ++x)
+            colours[y * ImageSize + x] =
+                CEGUI::HSV_Colour(static_cast<float>(x) / (ImageSize - 1),
+                                  static_cast<float>(y) / (ImageSize - 1),
+                                  1.0f - static_cast<float>(x) / (ImageSize - 1));
+}
+
+bool sameColour(const CEGUI::RGB_Colour& c1, const CEGUI::RGB_Colour& c2)
+{
+    return c1.r == c2.r && c1.g == c2.g && c1.b == c2.b;
+}
+}
+
+BOOST_AUTO_TEST_SUITE(ColourPickerConversions)
+
+BOOST_AUTO_TEST_CASE(HSVToRGB)
+{
+    using CEGUI::ColourPickerConversions;
+
+    BOOST_CHECK(sameColour(ColourPickerConversions::toRGB(CEGUI::HSV_Colour(0.0f, 1.0f, 1.0f)),
+                           CEGUI::RGB_Colour(255, 0, 0)));
+    BOOST_CHECK(sameColour(ColourPickerConversions::toRGB(CEGUI::HSV_Colour(0.5f, 1.0f, 1.0f)),
+                           CEGUI::RGB_Colour(0, 255, 255)));
+    BOOST_CHECK(sameColour(ColourPickerConversions::toRGB(CEGUI::HSV_Colour(0.25f, 0.0f, 0.5f)),
+                           CEGUI::RGB_Colour(127, 127, 127)));
+}
+
+BOOST_AUTO_TEST_CASE(BulkMatchesSingle)
+{
+    using CEGUI::ColourPickerConversions;
+
+    std::vector<CEGUI::Lab_Colour> labColours;
+    makeLabColours(labColours);
+    std::vector<CEGUI::RGB_Colour> result(labColours.size());
+    ColourPickerConversions::toRGB(&labColours[0], &result[0], labColours.size());
+
+    size_t mismatches = 0;
+    for (size_t i = 0; i < labColours.size(); ++i)
+        if (!sameColour(result[i], ColourPickerConversions::toRGB(labColours[i])))
+            ++mismatches;
+    BOOST_CHECK_EQUAL(mismatches, 0u);
+
+    std::vector<CEGUI::HSV_Colour> hsvColours;
+    makeHSVColours(hsvColours);
+    ColourPickerConversions::toRGB(&hsvColours[0], &result[0], hsvColours.size());
+
+    mismatches = 0;
+    for (size_t i = 0; i < hsvColours.size(); ++i)
+        if (!sameColour(result[i], ColourPickerConversions::toRGB(hsvColours[i])))
+            ++mismatches;
+    BOOST_CHECK_EQUAL(mismatches, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(Performance)
+{
+    using CEGUI::ColourPickerConversions;
+
+    std::vector<CEGUI::Lab_Colour> labColours;
+    makeLabColours(labColours);
+    std::vector<CEGUI::HSV_Colour> hsvColours;
+    makeHSVColours(hsvColours);
+    std::vector<CEGUI::RGB_Colour> result(labColours.size());
+
+    const int iterations = 20;
+    const double mpixels = iterations * labColours.size() / 1000000.0;
+
+    boost::timer timer;
+    for (int n = 0; n < iterations; ++n)
+        for (size_t i = 0; i < labColours.size(); ++i)
+            result[i] = ColourPickerConversions::toRGB(labColours[i]);
+    BOOST_TEST_MESSAGE("Lab to RGB, single colours: " << mpixels / timer.elapsed() << " Mpixels/s");
+
+    timer.restart();
+    for (int n = 0; n < iterations; ++n)
+        ColourPickerConversions::toRGB(&labColours[0], &result[0], labColours.size());
+    BOOST_TEST_MESSAGE("Lab to RGB, bulk: " << mpixels / timer.elapsed() << " Mpixels/s");
+
+    timer.restart();
+    for (int n = 0; n < iterations; ++n)
+        for (size_t i = 0; i < hsvColours.size(); ++i)
+            result[i] = ColourPickerConversions::toRGB(hsvColours[i]);
+    BOOST_TEST_MESSAGE("HSV to RGB, single colours: " << mpixels / timer.elapsed() << " Mpixels/s");
+
+    timer.restart();
+    for (int n = 0; n < iterations; ++n)
+        ColourPickerConversions::toRGB(&hsvColours[0], &result[0], hsvColours.size());
+    BOOST_TEST_MESSAGE("HSV to RGB, bulk: " << mpixels / timer.elapsed() << " Mpixels/s");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,289 @@
+/***********************************************************************
+ *    filename:   DecodedImageCache.cpp
+ *    created:    Sun Oct 18 2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2013 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/ModuleConfig.h"
+
+#ifdef CEGUI_BUILD_RENDERER_SOFTWARE
+
+#include "CEGUI/DecodedImageCache.h"
+#include "CEGUI/DefaultResourceProvider.h"
+#include "CEGUI/System.h"
+#include "CEGUI/RendererModules/Software/Renderer.h"
+#include "CEGUI/RendererModules/Software/Texture.h"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/timer.hpp>
+
+#include <cstdio>
+#include <vector>
+
+#if defined(__WIN32__) || defined(_WIN32)
+#   include <direct.h>
+#else
+#   include <stdlib.h>
+#   include <unistd.h>
+#endif
+
+namespace
+{
+//! return the RGBA pixels held by \a texture.
+std::vector<CEGUI::uint8> getPixels(CEGUI::Texture& texture)
+{
+    const CEGUI::Sizef size(texture.getOriginalDataSize());
+    std::vector<CEGUI::uint8> pixels(
+        static_cast<size_t>(size.d_width * size.d_height * 4));
+
+    if (!pixels.empty())
+        texture.blitToMemory(&pixels[0]);
+
+    return pixels;
+}
+
+struct DecodedImageCacheFixture
+{
+    DecodedImageCacheFixture() :
+        d_renderer(CEGUI::SoftwareRenderer::create(CEGUI::Sizef(64, 64))),
+        d_cache(CEGUI::System::getSingleton().getDecodedImageCache())
+    {
+#if defined(__WIN32__) || defined(_WIN32)
+        d_directory = "DecodedImageCacheTest";
+        _mkdir(d_directory.c_str());
+#else
+        char directory[] = "/tmp/DecodedImageCacheTest.XXXXXX";
+        if (mkdtemp(directory))
+            d_directory = directory;
+#endif
+        BOOST_REQUIRE(!d_directory.empty());
+
+        getResourceProvider().setResourceGroupDirectory("decoded_image_cache",
+                                                        d_directory);
+        d_cache.setCacheDirectory(d_directory);
+        d_cache.resetStatistics();
+    }
+
+    ~DecodedImageCacheFixture()
+    {
+        d_cache.setCacheDirectory("");
+        d_cache.setPremultipliedAlpha(false);
+        d_cache.resetStatistics();
+
+        std::vector<CEGUI::String> files;
+        getResourceProvider().getResourceGroupFileNames(files, "*",
+                                                        "decoded_image_cache");
+        for (size_t i = 0; i < files.size(); ++i)
+            std::remove((d_directory + "/" + files[i]).c_str());
+
+        getResourceProvider().clearResourceGroupDirectory("decoded_image_cache");
+#if defined(__WIN32__) || defined(_WIN32)
+        _rmdir(d_directory.c_str());
+#else
+        rmdir(d_directory.c_str());
+#endif
+
+        CEGUI::SoftwareRenderer::destroy(d_renderer);
+    }
+
+    static CEGUI::DefaultResourceProvider& getResourceProvider()
+    {
+        return *static_cast<CEGUI::DefaultResourceProvider*>(
+            CEGUI::System::getSingleton().getResourceProvider());
+    }
+
+    //! return the number of files in the cache directory.
+    size_t getCacheFileCount() const
+    {
+        std::vector<CEGUI::String> files;
+        return getResourceProvider().getResourceGroupFileNames(
+            files, "*" + CEGUI::DecodedImageCache::FILE_EXTENSION,
+            "decoded_image_cache");
+    }
+
+    CEGUI::SoftwareRenderer& d_renderer;
+    CEGUI::DecodedImageCache& d_cache;
+    CEGUI::String d_directory;
+};
+
+}
+
+BOOST_FIXTURE_TEST_SUITE(DecodedImageCache, DecodedImageCacheFixture)
+
+BOOST_AUTO_TEST_CASE(Disabled)
+{
+    d_cache.setCacheDirectory("");
+    BOOST_CHECK(!d_cache.isEnabled());
+
+    CEGUI::Texture& texture = d_renderer.createTexture("disabled");
+    texture.loadFromFile("TaharezLook.png", "imagesets");
+    BOOST_CHECK(texture.getOriginalDataSize() != CEGUI::Sizef(0, 0));
+
+    BOOST_CHECK_EQUAL(d_cache.getHitCount(), 0u);
+    BOOST_CHECK_EQUAL(d_cache.getMissCount(), 0u);
+    BOOST_CHECK_EQUAL(getCacheFileCount(), 0u);
+
+    d_renderer.destroyTexture(texture);
+}
+
+BOOST_AUTO_TEST_CASE(RoundTrip)
+{
+    BOOST_CHECK(d_cache.isEnabled());
+
+    // cold: decoded by the codec and stored.
+    CEGUI::Texture& cold = d_renderer.createTexture("cold");
+    cold.loadFromFile("TaharezLook.png", "imagesets");
+    BOOST_CHECK_EQUAL(d_cache.getHitCount(), 0u);
+    BOOST_CHECK_EQUAL(d_cache.getMissCount(), 1u);
+    BOOST_CHECK_EQUAL(getCacheFileCount(), 1u);
+
+    // warm: loaded from the cache file.
+    CEGUI::Texture& warm = d_renderer.createTexture("warm");
+    warm.loadFromFile("TaharezLook.png", "imagesets");
+    BOOST_CHECK_EQUAL(d_cache.getHitCount(), 1u);
+    BOOST_CHECK_EQUAL(d_cache.getMissCount(), 1u);
+
+    BOOST_CHECK_EQUAL(warm.getOriginalDataSize(), cold.getOriginalDataSize());
+    BOOST_CHECK(getPixels(warm) == getPixels(cold));
+
+    // a different image must not be served from that file.
+    CEGUI::Texture& other = d_renderer.createTexture("other");
+    other.loadFromFile("logo.png", "imagesets");
+    BOOST_CHECK_EQUAL(d_cache.getHitCount(), 1u);
+    BOOST_CHECK_EQUAL(d_cache.getMissCount(), 2u);
+    BOOST_CHECK_EQUAL(getCacheFileCount(), 2u);
+
+    d_renderer.destroyTexture(cold);
+    d_renderer.destroyTexture(warm);
+    d_renderer.destroyTexture(other);
+}
+
+BOOST_AUTO_TEST_CASE(InvalidFile)
+{
+    CEGUI::RawDataContainer data;
+    getResourceProvider().loadRawDataContainer("logo.png", data, "imagesets");
+    const CEGUI::String filename(d_cache.getCacheFilename(data));
+    getResourceProvider().unloadRawDataContainer(data);
+
+    CEGUI::Texture& expected = d_renderer.createTexture("expected");
+    expected.loadFromFile("logo.png", "imagesets");
+
+    // a truncated cache file is a miss, and gets replaced.
+    FILE* file = std::fopen(filename.c_str(), "wb");
+    BOOST_REQUIRE(file);
+    std::fputs("CGDI", file);
+    std::fclose(file);
+
+    d_cache.resetStatistics();
+    CEGUI::Texture& texture = d_renderer.createTexture("texture");
+    texture.loadFromFile("logo.png", "imagesets");
+    BOOST_CHECK_EQUAL(d_cache.getMissCount(), 1u);
+    BOOST_CHECK(getPixels(texture) == getPixels(expected));
+
+    texture.loadFromFile("logo.png", "imagesets");
+    BOOST_CHECK_EQUAL(d_cache.getHitCount(), 1u);
+    BOOST_CHECK(getPixels(texture) == getPixels(expected));
+
+    d_renderer.destroyTexture(expected);
+    d_renderer.destroyTexture(texture);
+}
+
+BOOST_AUTO_TEST_CASE(PremultipliedAlpha)
+{
+    CEGUI::Texture& straight = d_renderer.createTexture("straight");
+    straight.loadFromFile("TaharezLook.png", "imagesets");
+
+    d_cache.setPremultipliedAlpha(true);
+    d_cache.resetStatistics();
+
+    // the straight alpha file does not match the setting.
+    CEGUI::Texture& cold = d_renderer.createTexture("cold");
+    cold.loadFromFile("TaharezLook.png", "imagesets");
+    BOOST_CHECK_EQUAL(d_cache.getMissCount(), 1u);
+
+    CEGUI::Texture& warm = d_renderer.createTexture("warm");
+    warm.loadFromFile("TaharezLook.png", "imagesets");
+    BOOST_CHECK_EQUAL(d_cache.getHitCount(), 1u);
+
+    const std::vector<CEGUI::uint8> expected(getPixels(straight));
+    const std::vector<CEGUI::uint8> premultiplied(getPixels(warm));
+    BOOST_REQUIRE_EQUAL(premultiplied.size(), expected.size());
+    BOOST_CHECK(getPixels(cold) == premultiplied);
+
+    bool all_match = true;
+    for (size_t i = 0; i < expected.size(); i += 4)
+    {
+        const unsigned int a = expected[i + 3];
+        for (size_t c = 0; c < 3; ++c)
+            if (premultiplied[i + c] != (expected[i + c] * a + 127) / 255)
+                all_match = false;
+
+        if (premultiplied[i + 3] != a)
+            all_match = false;
+    }
+    BOOST_CHECK(all_match);
+
+    d_renderer.destroyTexture(straight);
+    d_renderer.destroyTexture(cold);
+    d_renderer.destroyTexture(warm);
+}
+
+BOOST_AUTO_TEST_CASE(Performance)
+{
+    std::vector<CEGUI::String> files;
+    getResourceProvider().getResourceGroupFileNames(files, "*.png", "imagesets");
+    BOOST_REQUIRE(!files.empty());
+
+    CEGUI::Texture& texture = d_renderer.createTexture("perf");
+
+    d_cache.setCacheDirectory("");
+    boost::timer timer;
+    for (size_t i = 0; i < files.size(); ++i)
+        texture.loadFromFile(files[i], "imagesets");
+    const double uncached = timer.elapsed();
+
+    d_cache.setCacheDirectory(d_directory);
+    timer.restart();
+    for (size_t i = 0; i < files.size(); ++i)
+        texture.loadFromFile(files[i], "imagesets");
+    const double cold = timer.elapsed();
+
+    timer.restart();
+    for (size_t i = 0; i < files.size(); ++i)
+        texture.loadFromFile(files[i], "imagesets");
+    const double warm = timer.elapsed();
+
+    BOOST_CHECK_EQUAL(d_cache.getMissCount(), files.size());
+    BOOST_CHECK_EQUAL(d_cache.getHitCount(), files.size());
+
+    BOOST_TEST_MESSAGE("DecodedImageCache: " << files.size()
+        << " imagesets PNGs; no cache " << uncached << "s, cold "
+        << cold << "s, warm " << warm << "s");
+
+    d_renderer.destroyTexture(texture);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
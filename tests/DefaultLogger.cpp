@@ -0,0 +1,142 @@
+/***********************************************************************
+ *    filename:   DefaultLogger.cpp
+ *    created:    18/10/2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2013 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/DefaultLogger.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/Window.h"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/timer.hpp>
+
+#include <fstream>
+#include <cstdio>
+
+/*
+ * Works on the DefaultLogger created by the test bootstrap, restoring its
+ * settings afterwards.
+ */
+struct DefaultLoggerFixture
+{
+    DefaultLoggerFixture() :
+        d_logger(dynamic_cast<CEGUI::DefaultLogger*>(CEGUI::Logger::getSingletonPtr())),
+        d_level(CEGUI::Logger::getSingleton().getLoggingLevel())
+    {
+    }
+
+    ~DefaultLoggerFixture()
+    {
+        CEGUI::Logger::getSingleton().setLoggingLevel(d_level);
+
+        if (d_logger)
+            d_logger->setWriteBufferSize(0);
+    }
+
+    static std::streamoff fileSize(const char* filename)
+    {
+        std::ifstream file(filename, std::ios_base::in | std::ios_base::ate);
+        return file.tellg();
+    }
+
+    CEGUI::DefaultLogger* d_logger;
+    CEGUI::LoggingLevel d_level;
+};
+
+BOOST_FIXTURE_TEST_SUITE(DefaultLogger, DefaultLoggerFixture)
+
+BOOST_AUTO_TEST_CASE(LevelFiltering)
+{
+    BOOST_REQUIRE(d_logger);
+
+    d_logger->setLoggingLevel(CEGUI::Warnings);
+    BOOST_CHECK(d_logger->isEventLogged(CEGUI::Errors));
+    BOOST_CHECK(d_logger->isEventLogged(CEGUI::Warnings));
+    BOOST_CHECK(!d_logger->isEventLogged(CEGUI::Standard));
+    BOOST_CHECK(!d_logger->isEventLogged(CEGUI::Insane));
+
+    // the message expression must not be evaluated for discarded events
+    int evaluated = 0;
+    CEGUI_LOGEVENT((++evaluated, "discarded"), CEGUI::Informative);
+    BOOST_CHECK_EQUAL(evaluated, 0);
+    CEGUI_LOGEVENT((++evaluated, "kept"), CEGUI::Errors);
+    BOOST_CHECK_EQUAL(evaluated, 1);
+
+    // other loggers are passed every event unless they say otherwise
+    BOOST_CHECK(d_logger->CEGUI::Logger::isEventLogged(CEGUI::Insane));
+}
+
+BOOST_AUTO_TEST_CASE(BatchedWrites)
+{
+    BOOST_REQUIRE(d_logger);
+
+    const char* const filename = "DefaultLoggerTest.log";
+    d_logger->setLogFilename(filename);
+    d_logger->setLoggingLevel(CEGUI::Standard);
+    d_logger->setWriteBufferSize(4096);
+    BOOST_CHECK_EQUAL(d_logger->getWriteBufferSize(), 4096u);
+
+    d_logger->logEvent("buffered event");
+    BOOST_CHECK_EQUAL(fileSize(filename), 0);
+
+    d_logger->flush();
+    const std::streamoff flushedSize = fileSize(filename);
+    BOOST_CHECK(flushedSize > 0);
+
+    // errors are never held back
+    d_logger->logEvent("error event", CEGUI::Errors);
+    BOOST_CHECK(fileSize(filename) > flushedSize);
+
+    d_logger->setLogFilename("CEGUI.log", true);
+    std::remove(filename);
+}
+
+BOOST_AUTO_TEST_CASE(Performance)
+{
+    BOOST_REQUIRE(d_logger);
+
+    CEGUI::WindowManager& wmgr = CEGUI::WindowManager::getSingleton();
+    const CEGUI::LoggingLevel levels[] = {CEGUI::Informative, CEGUI::Informative, CEGUI::Errors};
+    const size_t bufferSizes[] = {0, 64 * 1024, 0};
+    const char* const names[] = {"informative", "informative, batched", "errors"};
+
+    for (int i = 0; i < 3; ++i)
+    {
+        d_logger->setLoggingLevel(levels[i]);
+        d_logger->setWriteBufferSize(bufferSizes[i]);
+
+        boost::timer timer;
+        CEGUI::Window* root = wmgr.createWindow("DefaultWindow");
+        for (int w = 0; w < 2000; ++w)
+            root->addChild(wmgr.createWindow("DefaultWindow"));
+        wmgr.destroyWindow(root);
+        wmgr.cleanDeadPool();
+
+        BOOST_TEST_MESSAGE("Time taken to create and destroy 2000 windows, logging " <<
+                           names[i] << ": " << timer.elapsed());
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
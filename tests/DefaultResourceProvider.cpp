@@ -0,0 +1,290 @@
+/***********************************************************************
+ *    filename:   DefaultResourceProvider.cpp
+ *    created:    Sun Oct 18 2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2013 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/DefaultResourceProvider.h"
+#include "CEGUI/System.h"
+#include "CEGUI/XMLHandler.h"
+#include "CEGUI/XMLParser.h"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/timer.hpp>
+
+#include <cstring>
+#include <vector>
+
+#if defined(__linux__)
+#   include <stdio.h>
+#   include <unistd.h>
+#endif
+
+namespace
+{
+//! handler that just counts the elements it is fed.
+class ElementCounter : public CEGUI::XMLHandler
+{
+public:
+    ElementCounter() : d_count(0) {}
+
+    const CEGUI::String& getDefaultResourceGroup() const
+    { static const CEGUI::String group("looknfeels"); return group; }
+
+    void elementStart(const CEGUI::String&, const CEGUI::XMLAttributes&)
+    { ++d_count; }
+
+    size_t d_count;
+};
+
+CEGUI::DefaultResourceProvider& getSystemResourceProvider()
+{
+    return *static_cast<CEGUI::DefaultResourceProvider*>(
+        CEGUI::System::getSingleton().getResourceProvider());
+}
+
+unsigned int checksum(const CEGUI::RawDataContainer& data)
+{
+    unsigned int sum = 0;
+    for (size_t i = 0; i < data.getSize(); ++i)
+        sum = sum * 31 + data.getDataPtr()[i];
+
+    return sum;
+}
+
+#if defined(__linux__)
+//! return the process' private (non file backed) resident memory in KiB.
+long getPrivateResidentKiB()
+{
+    long size = 0, resident = 0, shared = 0;
+    FILE* statm = fopen("/proc/self/statm", "r");
+    if (statm)
+    {
+        if (fscanf(statm, "%ld %ld %ld", &size, &resident, &shared) != 3)
+            resident = shared = 0;
+
+        fclose(statm);
+    }
+
+    return (resident - shared) * (sysconf(_SC_PAGESIZE) / 1024);
+}
+#endif
+}
+
+BOOST_AUTO_TEST_SUITE(DefaultResourceProvider)
+
+BOOST_AUTO_TEST_CASE(MemoryMapping)
+{
+    CEGUI::DefaultResourceProvider rp;
+    rp.setResourceGroupDirectory("looknfeels",
+        getSystemResourceProvider().getResourceGroupDirectory("looknfeels"));
+
+    BOOST_CHECK(!rp.isMemoryMappingEnabled());
+
+    CEGUI::RawDataContainer read;
+    rp.loadRawDataContainer("TaharezLook.looknfeel", read, "looknfeels");
+    BOOST_CHECK_EQUAL(rp.getMappedFileCount(), 0u);
+
+    rp.setMemoryMappingEnabled(true);
+    BOOST_CHECK(rp.isMemoryMappingEnabled());
+
+    CEGUI::RawDataContainer mapped;
+    rp.loadRawDataContainer("TaharezLook.looknfeel", mapped, "looknfeels");
+    BOOST_CHECK_EQUAL(rp.getMappedFileCount(), 1u);
+
+    BOOST_REQUIRE_EQUAL(mapped.getSize(), read.getSize());
+    BOOST_CHECK(std::memcmp(mapped.getDataPtr(), read.getDataPtr(),
+                            read.getSize()) == 0);
+
+    // writes must stay private to the container
+    const CEGUI::uint8 first = mapped.getDataPtr()[0];
+    mapped.getDataPtr()[0] = first + 1;
+    CEGUI::RawDataContainer again;
+    rp.loadRawDataContainer("TaharezLook.looknfeel", again, "looknfeels");
+    BOOST_CHECK_EQUAL(again.getDataPtr()[0], first);
+
+    // mapped data must be released regardless of the current setting
+    rp.setMemoryMappingEnabled(false);
+    rp.unloadRawDataContainer(mapped);
+    BOOST_CHECK(mapped.getDataPtr() == 0);
+    BOOST_CHECK_EQUAL(mapped.getSize(), 0u);
+    BOOST_CHECK_EQUAL(rp.getMappedFileCount(), 1u);
+
+    rp.unloadRawDataContainer(again);
+    rp.unloadRawDataContainer(read);
+    BOOST_CHECK_EQUAL(rp.getMappedFileCount(), 0u);
+
+    BOOST_CHECK_THROW(rp.loadRawDataContainer("NoSuchFile.looknfeel", read,
+                                              "looknfeels"),
+                      CEGUI::FileIOException);
+
+    rp.setMemoryMappingEnabled(true);
+    BOOST_CHECK_THROW(rp.loadRawDataContainer("NoSuchFile.looknfeel", read,
+                                              "looknfeels"),
+                      CEGUI::FileIOException);
+    BOOST_CHECK_EQUAL(rp.getMappedFileCount(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(MappedDataOwnership)
+{
+    CEGUI::RawDataContainer outlived;
+
+    {
+        CEGUI::DefaultResourceProvider rp;
+        rp.setResourceGroupDirectory("looknfeels",
+            getSystemResourceProvider().getResourceGroupDirectory("looknfeels"));
+        rp.setMemoryMappingEnabled(true);
+
+        // a container that is never passed to unloadRawDataContainer, as
+        // when an exception is thrown between load and unload.
+        {
+            CEGUI::RawDataContainer dropped;
+            rp.loadRawDataContainer("TaharezLook.looknfeel", dropped,
+                                    "looknfeels");
+            BOOST_CHECK(dropped.getDeleter() != 0);
+            BOOST_CHECK_EQUAL(CEGUI::DefaultResourceProvider::getMappedFileCount(), 1u);
+        }
+        BOOST_CHECK_EQUAL(CEGUI::DefaultResourceProvider::getMappedFileCount(), 0u);
+
+        rp.loadRawDataContainer("TaharezLook.looknfeel", outlived, "looknfeels");
+    }
+
+    // the mapping belongs to the container, not the provider.
+    BOOST_CHECK_EQUAL(CEGUI::DefaultResourceProvider::getMappedFileCount(), 1u);
+    BOOST_CHECK(outlived.getSize() > 0);
+    BOOST_CHECK_EQUAL(outlived.getDataPtr()[0], '<');
+
+    outlived.release();
+    BOOST_CHECK(outlived.getDataPtr() == 0);
+    BOOST_CHECK(outlived.getDeleter() == 0);
+    BOOST_CHECK_EQUAL(CEGUI::DefaultResourceProvider::getMappedFileCount(), 0u);
+
+    // a heap buffer set afterwards must not be unmapped.
+    outlived.setData(CEGUI_NEW_ARRAY_PT(CEGUI::uint8, 4, CEGUI::RawDataContainer));
+    outlived.setSize(4);
+    BOOST_CHECK(outlived.getDeleter() == 0);
+}
+
+BOOST_AUTO_TEST_CASE(Prefetch)
+{
+    CEGUI::DefaultResourceProvider& rp = getSystemResourceProvider();
+
+    // prefetching is only a hint and must never report errors
+    BOOST_CHECK_NO_THROW(rp.prefetchRawData("NoSuchFile.looknfeel",
+                                            "looknfeels"));
+    BOOST_CHECK_NO_THROW(rp.prefetchRawData("TaharezLook.looknfeel",
+                                            "looknfeels"));
+
+    CEGUI::RawDataContainer data;
+    rp.loadRawDataContainer("TaharezLook.looknfeel", data, "looknfeels");
+    BOOST_CHECK(data.getSize() > 0);
+    rp.unloadRawDataContainer(data);
+}
+
+BOOST_AUTO_TEST_CASE(Performance)
+{
+    CEGUI::DefaultResourceProvider& rp = getSystemResourceProvider();
+    const bool was_enabled = rp.isMemoryMappingEnabled();
+
+    const char* const files[] =
+    {
+        "TaharezLook.looknfeel", "WindowsLook.looknfeel",
+        "Vanilla.looknfeel", "OgreTray.looknfeel"
+    };
+    const size_t file_count = sizeof(files) / sizeof(files[0]);
+    const int iterations = 100;
+
+    double load_time[2], parse_time[2];
+    long private_kib[2];
+    unsigned int sums[2] = {0, 0};
+    size_t elements[2] = {0, 0};
+
+    for (int mode = 0; mode < 2; ++mode)
+    {
+        rp.setMemoryMappingEnabled(mode == 1);
+
+        // raw loading of the files, touching every byte
+        boost::timer load_timer;
+        for (int i = 0; i < iterations; ++i)
+        {
+            for (size_t f = 0; f < file_count; ++f)
+            {
+                CEGUI::RawDataContainer data;
+                rp.loadRawDataContainer(files[f], data, "looknfeels");
+                sums[mode] += checksum(data);
+                rp.unloadRawDataContainer(data);
+            }
+        }
+        load_time[mode] = load_timer.elapsed();
+
+        // parsing, as done when loading a scheme at startup
+        boost::timer parse_timer;
+        for (int i = 0; i < iterations / 10; ++i)
+        {
+            for (size_t f = 0; f < file_count; ++f)
+            {
+                ElementCounter handler;
+                CEGUI::System::getSingleton().getXMLParser()->parseXMLFile(
+                    handler, files[f], "", "looknfeels");
+                elements[mode] += handler.d_count;
+            }
+        }
+        parse_time[mode] = parse_timer.elapsed();
+
+        // private memory held while all files are loaded at once
+#if defined(__linux__)
+        const long before_kib = getPrivateResidentKiB();
+#endif
+        std::vector<CEGUI::RawDataContainer> held(file_count);
+        for (size_t f = 0; f < file_count; ++f)
+        {
+            rp.loadRawDataContainer(files[f], held[f], "looknfeels");
+            checksum(held[f]);
+        }
+#if defined(__linux__)
+        private_kib[mode] = getPrivateResidentKiB() - before_kib;
+#else
+        private_kib[mode] = 0;
+#endif
+        for (size_t f = 0; f < file_count; ++f)
+            rp.unloadRawDataContainer(held[f]);
+    }
+
+    rp.setMemoryMappingEnabled(was_enabled);
+
+    BOOST_CHECK_EQUAL(sums[0], sums[1]);
+    BOOST_CHECK_EQUAL(elements[0], elements[1]);
+
+    BOOST_TEST_MESSAGE("Raw loads (" << iterations * file_count << "): "
+        "read " << load_time[0] << "s, mapped " << load_time[1] << "s");
+    BOOST_TEST_MESSAGE("XML parses (" << iterations / 10 * file_count << "): "
+        "read " << parse_time[0] << "s, mapped " << parse_time[1] << "s");
+#if defined(__linux__)
+    BOOST_TEST_MESSAGE("Private resident growth holding " << file_count <<
+        " files: read " << private_kib[0] << "KiB, mapped " <<
+        private_kib[1] << "KiB");
+#endif
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -27,12 +27,14 @@
  ***************************************************************************/
 
 #include "CEGUI/EventSet.h"
+#include "CEGUI/EventID.h"
 #include "CEGUI/GlobalEventSet.h"
 #include "CEGUI/EventArgs.h"
 #include "CEGUI/Exceptions.h"
 
 #include <boost/test/unit_test.hpp>
 #include <boost/timer.hpp>
+#include <sstream>
 
 BOOST_AUTO_TEST_SUITE(EventSet)
 
@@ -135,7 +137,59 @@ BOOST_AUTO_TEST_CASE(Subscribing)
         connection->disconnect();
     }
 }
-/*
+BOOST_AUTO_TEST_CASE(FiringByEventID)
+{
+    CEGUI::EventSet set;
+    CEGUI::GlobalEventSet& ges = CEGUI::GlobalEventSet::getSingleton();
+
+    const CEGUI::String eventNamespace("EventSetTest");
+    const CEGUI::String eventName("FiredByID");
+    const CEGUI::EventID id(eventName, eventNamespace);
+
+    BOOST_CHECK(id == CEGUI::EventID(eventName, eventNamespace));
+    BOOST_CHECK_EQUAL(id.getGlobalName(), eventNamespace + "/" + eventName);
+
+    TestEventArgs args;
+    g_GlobalEventValue = 0;
+
+    // no subscribers anywhere
+    args.d_targetValue = 1;
+    set.fireEvent(id, args);
+    BOOST_CHECK_EQUAL(g_GlobalEventValue, 0);
+    BOOST_CHECK(!ges.isEventPresent(id));
+
+    // local subscriber
+    CEGUI::Event::Connection local = set.subscribeEvent(eventName, &freeFunctionSubscriber);
+    set.fireEvent(id, args);
+    BOOST_CHECK_EQUAL(g_GlobalEventValue, 1);
+    local->disconnect();
+
+    // global subscriber, fired by id and by name
+    ges.subscribeEvent(id.getGlobalName(), &freeFunctionSubscriber);
+    BOOST_CHECK(ges.isEventPresent(id));
+    args.d_targetValue = 2;
+    set.fireEvent(id, args);
+    BOOST_CHECK_EQUAL(g_GlobalEventValue, 2);
+    args.d_targetValue = 3;
+    set.fireEvent(eventName, args, eventNamespace);
+    BOOST_CHECK_EQUAL(g_GlobalEventValue, 3);
+
+    // global subscriber removed again
+    ges.removeEvent(id.getGlobalName());
+    BOOST_CHECK(!ges.isEventPresent(id));
+    args.d_targetValue = 4;
+    set.fireEvent(id, args);
+    set.fireEvent(eventName, args, eventNamespace);
+    BOOST_CHECK_EQUAL(g_GlobalEventValue, 3);
+}
+
+static bool countingSubscriber(const CEGUI::EventArgs&)
+{
+    ++g_GlobalEventValue;
+
+    return true;
+}
+
 BOOST_AUTO_TEST_CASE(Performance)
 {
     CEGUI::EventSet set;
@@ -192,6 +246,36 @@ BOOST_AUTO_TEST_CASE(Performance)
         
         BOOST_TEST_MESSAGE("Time taken, 1000000x event lookup (10000 events): " << timer.elapsed());
     }
+
+    // now measure firing a namespaced event with 0, 1 and 100 subscribers,
+    // both by name and by interned id.
+    const CEGUI::String eventNamespace("EventSetTest");
+    const CEGUI::String firedName("FiredEvent");
+    const CEGUI::EventID firedID(firedName, eventNamespace);
+    const unsigned int subscriberCounts[] = {0, 1, 100};
+    unsigned int subscribed = 0;
+
+    for (unsigned int c = 0; c < 3; ++c)
+    {
+        for (; subscribed < subscriberCounts[c]; ++subscribed)
+            set.subscribeEvent(firedName, &countingSubscriber);
+
+        boost::timer timer;
+        for (unsigned int i = 0; i < 100000; ++i)
+        {
+            set.fireEvent(firedName, args, eventNamespace);
+        }
+        const double byName = timer.elapsed();
+
+        timer.restart();
+        for (unsigned int i = 0; i < 100000; ++i)
+        {
+            set.fireEvent(firedID, args);
+        }
+
+        BOOST_TEST_MESSAGE("Time taken, 100000x namespaced event fire (" <<
+                           subscribed << " subscribers): " << byName <<
+                           " (by EventID: " << timer.elapsed() << ")");
+    }
 }
-*/
 BOOST_AUTO_TEST_SUITE_END()
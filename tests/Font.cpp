@@ -0,0 +1,534 @@
+/***********************************************************************
+ *    filename:   Font.cpp
+ *    created:    18/10/2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2013 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/FontManager.h"
+#include "CEGUI/Font.h"
+#include "CEGUI/GlyphAtlas.h"
+#include "CEGUI/BasicImage.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/Vertex.h"
+#include "CEGUI/ColourRect.h"
+#include "CEGUI/Event.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/widgets/Listbox.h"
+#include "CEGUI/widgets/ListboxTextItem.h"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/timer.hpp>
+
+#include <vector>
+
+/*
+ * GeometryBuffer that just records what it is given, so we can compare the
+ * geometry generated by different code paths.
+ */
+class RecordingGeometryBuffer : public CEGUI::GeometryBuffer
+{
+public:
+    RecordingGeometryBuffer() : d_activeTexture(0), d_appendCount(0) {}
+
+    void draw() const {}
+    void setTranslation(const CEGUI::Vector3f&) {}
+    void setRotation(const CEGUI::Quaternion&) {}
+    void setPivot(const CEGUI::Vector3f&) {}
+    void setClippingRegion(const CEGUI::Rectf&) {}
+    void appendVertex(const CEGUI::Vertex& vertex) { appendGeometry(&vertex, 1); }
+    void appendGeometry(const CEGUI::Vertex* const vbuff, CEGUI::uint vertex_count)
+    {
+        ++d_appendCount;
+        for (CEGUI::uint i = 0; i < vertex_count; ++i)
+        {
+            d_vertices.push_back(vbuff[i]);
+            d_textures.push_back(d_activeTexture);
+        }
+    }
+    void setActiveTexture(CEGUI::Texture* texture) { d_activeTexture = texture; }
+    void reset() { d_vertices.clear(); d_textures.clear(); d_appendCount = 0; }
+    CEGUI::Texture* getActiveTexture() const { return d_activeTexture; }
+    CEGUI::uint getVertexCount() const { return d_vertices.size(); }
+    CEGUI::uint getBatchCount() const { return 1; }
+    void setRenderEffect(CEGUI::RenderEffect*) {}
+    CEGUI::RenderEffect* getRenderEffect() { return 0; }
+    void setClippingActive(const bool) {}
+    bool isClippingActive() const { return true; }
+
+    CEGUI::Texture* d_activeTexture;
+    std::vector<CEGUI::Vertex> d_vertices;
+    std::vector<CEGUI::Texture*> d_textures;
+    unsigned int d_appendCount;
+};
+
+/*
+ * Renders text glyph by glyph via Image::render, without using the layout
+ * cache or glyph runs.  Serves as a reference for the geometry and as a
+ * performance baseline.
+ */
+static float drawTextPerGlyph(const CEGUI::Font& font,
+                              CEGUI::GeometryBuffer& buffer,
+                              const CEGUI::String& text,
+                              const CEGUI::Vector2f& position,
+                              const CEGUI::Rectf* clip_rect,
+                              const CEGUI::ColourRect& colours)
+{
+    const float base_y = position.d_y + font.getBaseline();
+    CEGUI::Vector2f glyph_pos(position);
+    float pen = 0.0f;
+    const CEGUI::FontGlyph* prev_glyph = 0;
+
+    for (size_t c = 0; c < text.length(); ++c)
+    {
+        if (const CEGUI::FontGlyph* glyph = font.getGlyphData(text[c]))
+        {
+            if (prev_glyph)
+                pen += font.getKerning(text[c - 1], text[c]);
+
+            const CEGUI::Image* const img = glyph->getImage();
+            glyph_pos.d_x = position.d_x + pen;
+            glyph_pos.d_y = base_y;
+            img->render(buffer, glyph_pos, glyph->getSize(1.0f, 1.0f),
+                        clip_rect, colours);
+            pen += glyph->getAdvance();
+            prev_glyph = glyph;
+        }
+    }
+
+    return position.d_x + pen;
+}
+
+struct FontFixture
+{
+    FontFixture() :
+        d_font(CEGUI::FontManager::getSingleton().get("DejaVuSans-12")),
+        d_text("The quick brown fox jumps over the lazy dog 0123456789 !?")
+    {
+        // the font is auto scaled, so use its native resolution to get a
+        // realistic size.
+        CEGUI::System::getSingleton().notifyDisplaySizeChanged(CEGUI::Sizef(1280, 720));
+    }
+
+    CEGUI::Font& d_font;
+    CEGUI::String d_text;
+};
+
+BOOST_FIXTURE_TEST_SUITE(Font, FontFixture)
+
+BOOST_AUTO_TEST_CASE(DrawTextGeometry)
+{
+    const CEGUI::ColourRect colours(CEGUI::Colour(1.0f, 0.5f, 0.25f, 1.0f));
+    const CEGUI::Vector2f position(10.0f, 20.0f);
+
+    // unclipped, partially clipped at each edge and totally clipped
+    const CEGUI::Rectf clips[] =
+    {
+        CEGUI::Rectf(0, 0, 800, 600),
+        CEGUI::Rectf(40, 0, 800, 600),
+        CEGUI::Rectf(0, 0, 120.5f, 600),
+        CEGUI::Rectf(0, 25, 800, 600),
+        CEGUI::Rectf(0, 0, 800, 30),
+        CEGUI::Rectf(500, 500, 600, 600)
+    };
+
+    for (size_t i = 0; i < sizeof(clips) / sizeof(clips[0]); ++i)
+    {
+        RecordingGeometryBuffer reference;
+        RecordingGeometryBuffer batched;
+
+        const float ref_x = drawTextPerGlyph(d_font, reference, d_text,
+                                             position, &clips[i], colours);
+        const float x = d_font.drawText(batched, d_text, position, &clips[i],
+                                        colours);
+
+        BOOST_CHECK_EQUAL(x, ref_x);
+        BOOST_REQUIRE_EQUAL(batched.d_vertices.size(), reference.d_vertices.size());
+        BOOST_CHECK(batched.d_appendCount <= reference.d_appendCount);
+
+        for (size_t v = 0; v < reference.d_vertices.size(); ++v)
+        {
+            BOOST_CHECK_EQUAL(batched.d_vertices[v].position, reference.d_vertices[v].position);
+            BOOST_CHECK_EQUAL(batched.d_vertices[v].tex_coords, reference.d_vertices[v].tex_coords);
+            BOOST_CHECK(batched.d_vertices[v].colour_val == reference.d_vertices[v].colour_val);
+            BOOST_CHECK_EQUAL(batched.d_textures[v], reference.d_textures[v]);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Kerning)
+{
+    // DejaVuSans has a kerning table which pulls 'A' and 'V' together
+    BOOST_CHECK(d_font.getKerning('A', 'V') < 0.0f);
+    BOOST_CHECK_EQUAL(d_font.getKerning('A', 'V', 2.0f), d_font.getKerning('A', 'V') * 2.0f);
+
+    BOOST_CHECK(d_font.getTextAdvance("AV") <
+                d_font.getTextAdvance("A") + d_font.getTextAdvance("V"));
+}
+
+BOOST_AUTO_TEST_CASE(TextLayoutCache)
+{
+    d_font.invalidateTextLayoutCache();
+    d_font.resetTextLayoutCacheStatistics();
+
+    const float extent = d_font.getTextExtent(d_text);
+    BOOST_CHECK_EQUAL(d_font.getTextLayoutCacheMisses(), 1u);
+    BOOST_CHECK_EQUAL(d_font.getTextLayoutCacheHits(), 0u);
+
+    // measuring the same text again must come from the cache
+    BOOST_CHECK_EQUAL(d_font.getTextExtent(d_text), extent);
+    d_font.getTextAdvance(d_text);
+    d_font.getCharAtPixel(d_text, 50.0f);
+    BOOST_CHECK_EQUAL(d_font.getTextLayoutCacheMisses(), 1u);
+    BOOST_CHECK_EQUAL(d_font.getTextLayoutCacheHits(), 3u);
+
+    // different scale is a different layout
+    BOOST_CHECK_CLOSE(d_font.getTextAdvance(d_text, 2.0f), d_font.getTextAdvance(d_text) * 2.0f, 0.001f);
+    BOOST_CHECK_EQUAL(d_font.getTextLayoutCacheMisses(), 2u);
+
+    // the cache is bounded by the memory used, not the number of layouts
+    BOOST_CHECK(d_font.getTextLayoutCacheUsage() > 0);
+    BOOST_CHECK(d_font.getTextLayoutCacheUsage() <= d_font.getTextLayoutCacheSize());
+
+    // least recently used layouts are evicted once the cache is full
+    const size_t old_size = d_font.getTextLayoutCacheSize();
+    d_font.invalidateTextLayoutCache();
+    d_font.getTextExtent("one");
+    const size_t entry_size = d_font.getTextLayoutCacheUsage();
+    d_font.setTextLayoutCacheSize(entry_size * 2);
+    d_font.resetTextLayoutCacheStatistics();
+    d_font.getTextExtent("one");
+    d_font.getTextExtent("two");
+    d_font.getTextExtent("one");
+    d_font.getTextExtent("six");
+    d_font.getTextExtent("one");
+    BOOST_CHECK_EQUAL(d_font.getTextLayoutCacheHits(), 2u);
+    d_font.getTextExtent("two");
+    BOOST_CHECK_EQUAL(d_font.getTextLayoutCacheMisses(), 4u);
+    BOOST_CHECK_EQUAL(d_font.getTextLayoutCacheUsage(), entry_size * 2);
+
+    // text too long to fit is laid out, but not cached
+    const CEGUI::String long_text(100, 'x');
+    BOOST_CHECK(d_font.getTextExtent(long_text) > 0.0f);
+    d_font.getTextExtent("one");
+    BOOST_CHECK_EQUAL(d_font.getTextLayoutCacheHits(), 3u);
+
+    // disabled cache still gives the same results
+    d_font.setTextLayoutCacheSize(0);
+    BOOST_CHECK_EQUAL(d_font.getTextExtent(d_text), extent);
+    BOOST_CHECK_EQUAL(d_font.getCharAtPixel(d_text, 0.0f), 0u);
+    BOOST_CHECK_EQUAL(d_font.getCharAtPixel(d_text, extent + 10.0f), d_text.length());
+
+    d_font.setTextLayoutCacheSize(old_size);
+}
+
+BOOST_AUTO_TEST_CASE(GlyphLookup)
+{
+    for (CEGUI::utf32 cp = 0; cp < 0x3000; ++cp)
+    {
+        const CEGUI::FontGlyph* glyph = d_font.getGlyphData(cp);
+
+        BOOST_CHECK_EQUAL(glyph != 0, d_font.isCodepointAvailable(cp));
+        BOOST_CHECK_EQUAL(glyph, d_font.getGlyphData(cp));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(GlyphAtlas)
+{
+    // Latin, Greek and Cyrillic glyphs come from different glyph pages
+    CEGUI::String text("Atlas packing test ");
+    for (CEGUI::utf32 cp = 0x3b1; cp <= 0x3c9; ++cp)
+        text += cp;
+    for (CEGUI::utf32 cp = 0x430; cp <= 0x44f; ++cp)
+        text += cp;
+
+    const CEGUI::Texture* texture = 0;
+    for (size_t i = 0; i < text.length(); ++i)
+    {
+        const CEGUI::FontGlyph* glyph = d_font.getGlyphData(text[i]);
+        BOOST_REQUIRE(glyph && glyph->getBasicImage());
+
+        if (!texture)
+            texture = glyph->getBasicImage()->getTexture();
+
+        BOOST_CHECK_EQUAL(glyph->getBasicImage()->getTexture(), texture);
+    }
+
+    BOOST_REQUIRE(CEGUI::GlyphAtlas::isAtlasPresent("DejaVuSans-12_auto_glyph_atlas"));
+    CEGUI::GlyphAtlas& atlas =
+        CEGUI::GlyphAtlas::acquire("DejaVuSans-12_auto_glyph_atlas");
+
+    BOOST_CHECK_EQUAL(atlas.getTextureCount(), 1u);
+    BOOST_CHECK_EQUAL(&atlas.getTexture(0), texture);
+    BOOST_CHECK(atlas.getImageCount() > 0);
+    BOOST_CHECK(atlas.getOccupancy() > 0.0f);
+    BOOST_CHECK(atlas.getOccupancy() <= 1.0f);
+    BOOST_TEST_MESSAGE("Glyph atlas occupancy: " << atlas.getOccupancy() <<
+                       ", images: " << atlas.getImageCount() <<
+                       ", textures: " << atlas.getTextureCount());
+
+    CEGUI::GlyphAtlas::release(atlas);
+}
+
+BOOST_AUTO_TEST_CASE(SharedGlyphAtlas)
+{
+    CEGUI::FontManager& mgr = CEGUI::FontManager::getSingleton();
+    CEGUI::Font& font1 = mgr.createFreeTypeFont("AtlasTest-10", 10, true, "DejaVuSans.ttf");
+    CEGUI::Font& font2 = mgr.createFreeTypeFont("AtlasTest-14", 14, true, "DejaVuSans.ttf");
+
+    font1.setProperty("GlyphAtlas", "SharedTestAtlas");
+    font2.setProperty("GlyphAtlas", "SharedTestAtlas");
+
+    const CEGUI::BasicImage* img1 = font1.getGlyphData('A')->getBasicImage();
+    const CEGUI::BasicImage* img2 = font2.getGlyphData('A')->getBasicImage();
+
+    BOOST_CHECK_EQUAL(img1->getTexture(), img2->getTexture());
+    BOOST_CHECK_EQUAL(img1->getArea().getIntersection(img2->getArea()).getWidth(), 0.0f);
+
+    CEGUI::GlyphAtlas& atlas = CEGUI::GlyphAtlas::acquire("SharedTestAtlas");
+    BOOST_CHECK_EQUAL(atlas.getReferenceCount(), 3u);
+    BOOST_CHECK_EQUAL(atlas.getTextureCount(), 1u);
+
+    // the space of a font's glyphs is reused when it is resized.
+    const size_t usedArea = atlas.getUsedArea();
+    for (int i = 0; i < 20; ++i)
+    {
+        font1.setProperty("PointSize", i % 2 ? "10" : "12");
+        font1.getGlyphData('A')->getImage();
+    }
+    font1.setProperty("PointSize", "10");
+    font1.getGlyphData('A')->getImage();
+    BOOST_CHECK_EQUAL(atlas.getUsedArea(), usedArea);
+    BOOST_CHECK_EQUAL(atlas.getTextureCount(), 1u);
+    CEGUI::GlyphAtlas::release(atlas);
+
+    mgr.destroy(font1);
+    BOOST_CHECK(CEGUI::GlyphAtlas::isAtlasPresent("SharedTestAtlas"));
+    mgr.destroy(font2);
+    BOOST_CHECK(!CEGUI::GlyphAtlas::isAtlasPresent("SharedTestAtlas"));
+}
+
+static int s_glyphsRasterisedCount = 0;
+
+static bool onGlyphsRasterised(const CEGUI::EventArgs&)
+{
+    ++s_glyphsRasterisedCount;
+    return true;
+}
+
+//! counts the times a window is invalidated.
+struct InvalidationCounter
+{
+    InvalidationCounter() : d_count(0) {}
+
+    bool handler(const CEGUI::EventArgs&)
+    {
+        ++d_count;
+        return true;
+    }
+
+    int d_count;
+};
+
+BOOST_AUTO_TEST_CASE(DeferredRasterisation)
+{
+    CEGUI::FontManager& mgr = CEGUI::FontManager::getSingleton();
+    CEGUI::Font& font = mgr.createFreeTypeFont("DeferredTest-12", 12, true, "DejaVuSans.ttf");
+    font.subscribeEvent(CEGUI::Font::EventGlyphsRasterised,
+                        CEGUI::Event::Subscriber(&onGlyphsRasterised));
+    s_glyphsRasterisedCount = 0;
+
+    font.setDeferredRasterisationEnabled(true);
+
+    // the page is queued and the glyph drawn as a placeholder for now
+    const CEGUI::FontGlyph* glyph = font.getGlyphData('A');
+    BOOST_REQUIRE(glyph);
+    BOOST_CHECK(!glyph->getImage());
+    BOOST_CHECK_EQUAL(font.getDeferredGlyphPageCount(), 1u);
+
+    RecordingGeometryBuffer buffer;
+    const float advance = font.getTextAdvance("AAA");
+    BOOST_CHECK_EQUAL(font.drawText(buffer, "AAA", CEGUI::Vector2f(0, 0), 0,
+                                    CEGUI::ColourRect(0xFFFFFFFF)), advance);
+    BOOST_CHECK(buffer.d_vertices.empty());
+
+    // only windows using the font are redrawn when its glyphs arrive
+    CEGUI::WindowManager& wmgr = CEGUI::WindowManager::getSingleton();
+    CEGUI::Window* using_font = wmgr.createWindow("DefaultWindow");
+    using_font->setFont(&font);
+    CEGUI::Window* other_font = wmgr.createWindow("DefaultWindow");
+    other_font->setFont("DejaVuSans-12");
+
+    // as are those with list items or markup using the font
+    CEGUI::Listbox* item_font =
+        static_cast<CEGUI::Listbox*>(wmgr.createWindow("TaharezLook/Listbox"));
+    item_font->setFont("DejaVuSans-12");
+    CEGUI::ListboxTextItem* item = new CEGUI::ListboxTextItem("AAA");
+    item->setFont(&font);
+    item_font->addItem(item);
+    CEGUI::Window* markup_font = wmgr.createWindow("DefaultWindow");
+    markup_font->setFont("DejaVuSans-12");
+    markup_font->setText("[font='DeferredTest-12']AAA");
+
+    InvalidationCounter using_font_count;
+    InvalidationCounter other_font_count;
+    InvalidationCounter item_font_count;
+    InvalidationCounter markup_font_count;
+    using_font->subscribeEvent(CEGUI::Window::EventInvalidated,
+        CEGUI::Event::Subscriber(&InvalidationCounter::handler, &using_font_count));
+    other_font->subscribeEvent(CEGUI::Window::EventInvalidated,
+        CEGUI::Event::Subscriber(&InvalidationCounter::handler, &other_font_count));
+    item_font->subscribeEvent(CEGUI::Window::EventInvalidated,
+        CEGUI::Event::Subscriber(&InvalidationCounter::handler, &item_font_count));
+    markup_font->subscribeEvent(CEGUI::Window::EventInvalidated,
+        CEGUI::Event::Subscriber(&InvalidationCounter::handler, &markup_font_count));
+
+    // the time pulse rasterises the queued page, given enough budget
+    const float budget = mgr.getDeferredRasterisationBudget();
+    mgr.setDeferredRasterisationBudget(60.0f);
+    CEGUI::System::getSingleton().injectTimePulse(0.0f);
+    mgr.setDeferredRasterisationBudget(budget);
+    BOOST_CHECK(glyph->getImage());
+    BOOST_CHECK_EQUAL(font.getDeferredGlyphPageCount(), 0u);
+    BOOST_CHECK_EQUAL(s_glyphsRasterisedCount, 1);
+    BOOST_CHECK_EQUAL(using_font_count.d_count, 1);
+    BOOST_CHECK_EQUAL(other_font_count.d_count, 0);
+    BOOST_CHECK_EQUAL(item_font_count.d_count, 1);
+    BOOST_CHECK_EQUAL(markup_font_count.d_count, 1);
+
+    wmgr.destroyWindow(using_font);
+    wmgr.destroyWindow(other_font);
+    wmgr.destroyWindow(item_font);
+    wmgr.destroyWindow(markup_font);
+
+    font.drawText(buffer, "AAA", CEGUI::Vector2f(0, 0), 0, CEGUI::ColourRect(0xFFFFFFFF));
+    BOOST_CHECK_EQUAL(buffer.d_vertices.size(), 18u);
+
+    // pre-warming rasterises immediately, including queued pages
+    BOOST_CHECK(!font.getGlyphData(0x3b1)->getImage());
+    font.prewarmGlyphs(0x380, 0x4ff);
+    BOOST_CHECK(font.getGlyphData(0x3b1)->getImage());
+    BOOST_CHECK(font.getGlyphData(0x430)->getImage());
+    BOOST_CHECK_EQUAL(font.getDeferredGlyphPageCount(), 0u);
+    BOOST_CHECK_EQUAL(s_glyphsRasterisedCount, 2);
+
+    // without any budget, a single glyph is rasterised per call
+    BOOST_CHECK(!font.getGlyphData(0x5d0)->getImage());
+    BOOST_CHECK(font.rasteriseDeferredGlyphs(0.0f));
+    BOOST_CHECK(!font.getGlyphData(0x5d0)->getImage());
+    BOOST_CHECK_EQUAL(font.getDeferredGlyphPageCount(), 1u);
+    BOOST_CHECK_EQUAL(s_glyphsRasterisedCount, 3);
+
+    // disabling deferred rasterisation flushes the queue
+    font.setDeferredRasterisationEnabled(false);
+    BOOST_CHECK(font.getGlyphData(0x5d0)->getImage());
+    BOOST_CHECK_EQUAL(font.getDeferredGlyphPageCount(), 0u);
+    BOOST_CHECK_EQUAL(s_glyphsRasterisedCount, 4);
+
+    mgr.destroy(font);
+}
+
+BOOST_AUTO_TEST_CASE(GlyphLookupPerformance)
+{
+    const unsigned int iterations = 20000;
+    // Latin, Latin-1 supplement and Cyrillic ranges
+    const CEGUI::utf32 ranges[][2] = { {0x20, 0x7F}, {0xA0, 0x100}, {0x400, 0x480} };
+    const size_t rangeCount = sizeof(ranges) / sizeof(ranges[0]);
+
+    size_t lookups = 0;
+    size_t found = 0;
+
+    boost::timer timer;
+    for (unsigned int i = 0; i < iterations; ++i)
+    {
+        for (size_t r = 0; r < rangeCount; ++r)
+        {
+            for (CEGUI::utf32 cp = ranges[r][0]; cp < ranges[r][1]; ++cp)
+            {
+                if (d_font.getGlyphData(cp))
+                    ++found;
+                ++lookups;
+            }
+        }
+    }
+    const double elapsed = timer.elapsed();
+
+    BOOST_CHECK(found > 0);
+    BOOST_TEST_MESSAGE("Time taken, " << lookups << " glyph lookups: " << elapsed);
+    if (elapsed > 0.0)
+        BOOST_TEST_MESSAGE("Glyph lookups per second: " << lookups / elapsed);
+}
+
+BOOST_AUTO_TEST_CASE(DrawTextPerformance)
+{
+    CEGUI::Renderer& renderer = *CEGUI::System::getSingleton().getRenderer();
+    CEGUI::GeometryBuffer& buffer = renderer.createGeometryBuffer();
+
+    const CEGUI::ColourRect colours(CEGUI::Colour(1.0f, 1.0f, 1.0f, 1.0f));
+    const CEGUI::Rectf clip(0, 0, 800, 600);
+    const unsigned int lineCount = 2000;
+    const double charCount = static_cast<double>(d_text.length()) * lineCount;
+
+    // make sure all glyphs are rasterised before we start timing
+    d_font.drawText(buffer, d_text, CEGUI::Vector2f(0, 0), &clip, colours);
+    buffer.reset();
+
+    {
+        boost::timer timer;
+        for (unsigned int i = 0; i < lineCount; ++i)
+        {
+            drawTextPerGlyph(d_font, buffer, d_text,
+                CEGUI::Vector2f(0.0f, static_cast<float>(i % 50) * 12.0f),
+                &clip, colours);
+        }
+        const double elapsed = timer.elapsed();
+        buffer.reset();
+
+        BOOST_TEST_MESSAGE("Time taken, " << lineCount << "x per glyph Image::render: " << elapsed);
+        if (elapsed > 0.0)
+            BOOST_TEST_MESSAGE("Characters per second (per glyph): " << charCount / elapsed);
+    }
+
+    {
+        boost::timer timer;
+        for (unsigned int i = 0; i < lineCount; ++i)
+        {
+            d_font.drawText(buffer, d_text,
+                CEGUI::Vector2f(0.0f, static_cast<float>(i % 50) * 12.0f),
+                &clip, colours);
+        }
+        const double elapsed = timer.elapsed();
+        buffer.reset();
+
+        BOOST_TEST_MESSAGE("Time taken, " << lineCount << "x Font::drawText: " << elapsed);
+        if (elapsed > 0.0)
+            BOOST_TEST_MESSAGE("Characters per second (glyph runs): " << charCount / elapsed);
+    }
+
+    renderer.destroyGeometryBuffer(buffer);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,380 @@
+/***********************************************************************
+ *    filename:   GUIContext.cpp
+ *    created:    18/10/2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2013 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/System.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/RenderingSurface.h"
+#include "CEGUI/TextureTargetPool.h"
+#include "CEGUI/GlobalEventSet.h"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/timer.hpp>
+
+#include <vector>
+
+/*
+ * Brings up a root window holding a 10x10 grid of panels, each of which can
+ * be filled with a grid of items, to give hierarchies of various sizes.
+ */
+struct GUIContextFixture
+{
+    GUIContextFixture() :
+        d_context(CEGUI::System::getSingleton().getDefaultGUIContext())
+    {
+        CEGUI::System::getSingleton().notifyDisplaySizeChanged(CEGUI::Sizef(800, 600));
+
+        d_root = CEGUI::WindowManager::getSingleton().createWindow("DefaultWindow");
+        d_root->setSize(CEGUI::USize(CEGUI::UDim(1, 0), CEGUI::UDim(1, 0)));
+        d_context.setRootWindow(d_root);
+    }
+
+    ~GUIContextFixture()
+    {
+        d_context.setHitTestIndexEnabled(false);
+        d_context.setPartialRedrawEnabled(false);
+        d_context.setAutoCachingThreshold(0);
+        d_context.setIdleUpdateSkippingEnabled(false);
+        d_context.setRootWindow(0);
+        CEGUI::WindowManager::getSingleton().destroyWindow(d_root);
+    }
+
+    //! create 100 panels with \a items_per_side squared items in each.
+    void createWindows(int items_per_side)
+    {
+        CEGUI::WindowManager& wmgr = CEGUI::WindowManager::getSingleton();
+
+        for (int panel = 0; panel < 100; ++panel)
+        {
+            CEGUI::Window* const p = wmgr.createWindow("DefaultWindow");
+            p->setPosition(CEGUI::UVector2(CEGUI::UDim((panel % 10) * 0.1f, 0),
+                                           CEGUI::UDim((panel / 10) * 0.1f, 0)));
+            p->setSize(CEGUI::USize(CEGUI::UDim(0.1f, -4), CEGUI::UDim(0.1f, -4)));
+            d_root->addChild(p);
+
+            const float item_size = 1.0f / items_per_side;
+            for (int item = 0; item < items_per_side * items_per_side; ++item)
+            {
+                CEGUI::Window* const i = wmgr.createWindow("DefaultWindow");
+                i->setPosition(CEGUI::UVector2(
+                    CEGUI::UDim((item % items_per_side) * item_size, 0),
+                    CEGUI::UDim((item / items_per_side) * item_size, 0)));
+                i->setSize(CEGUI::USize(CEGUI::UDim(item_size, -1),
+                                        CEGUI::UDim(item_size, -1)));
+                p->addChild(i);
+            }
+        }
+    }
+
+    //! return the windows containing the mouse for a sweep of positions.
+    std::vector<CEGUI::Window*> sweep()
+    {
+        std::vector<CEGUI::Window*> result;
+
+        for (float y = 1.5f; y < 600.0f; y += 13.0f)
+            for (float x = 0.5f; x < 800.0f; x += 17.0f)
+            {
+                d_context.injectMousePosition(x, y);
+                result.push_back(d_context.getWindowContainingMouse());
+            }
+
+        return result;
+    }
+
+    //! inject mouse moves covering the display, returning the time taken.
+    double timeMouseMoves(int move_count)
+    {
+        boost::timer timer;
+
+        for (int i = 0; i < move_count; ++i)
+        {
+            d_context.injectMousePosition(static_cast<float>((i * 37) % 800),
+                                          static_cast<float>((i * 23) % 600));
+            d_context.getWindowContainingMouse();
+        }
+
+        return timer.elapsed();
+    }
+
+    CEGUI::GUIContext& d_context;
+    CEGUI::Window* d_root;
+};
+
+static int updatedEventCount = 0;
+
+static bool countUpdatedEvent(const CEGUI::EventArgs&)
+{
+    ++updatedEventCount;
+    return true;
+}
+
+BOOST_FIXTURE_TEST_SUITE(GUIContext, GUIContextFixture)
+
+BOOST_AUTO_TEST_CASE(HitTestIndex)
+{
+    createWindows(3);
+
+    const std::vector<CEGUI::Window*> reference = sweep();
+    d_context.setHitTestIndexEnabled(true);
+    BOOST_CHECK(reference == sweep());
+
+    // changes to the hierarchy must invalidate the bounds
+    CEGUI::Window* const panel = d_root->getChildAtIdx(11);
+    panel->setPosition(CEGUI::UVector2(CEGUI::UDim(0.55f, 0), CEGUI::UDim(0.55f, 0)));
+    d_root->getChildAtIdx(5)->setSize(CEGUI::USize(CEGUI::UDim(0.3f, 0), CEGUI::UDim(0.3f, 0)));
+    d_root->getChildAtIdx(40)->getChildAtIdx(0)->setClippedByParent(false);
+    d_root->getChildAtIdx(40)->getChildAtIdx(0)->setSize(
+        CEGUI::USize(CEGUI::UDim(3, 0), CEGUI::UDim(3, 0)));
+    d_root->getChildAtIdx(70)->addChild(
+        CEGUI::WindowManager::getSingleton().createWindow("DefaultWindow"));
+    CEGUI::WindowManager::getSingleton().destroyWindow(d_root->getChildAtIdx(90));
+
+    const std::vector<CEGUI::Window*> indexed = sweep();
+    d_context.setHitTestIndexEnabled(false);
+    BOOST_CHECK(indexed == sweep());
+}
+
+BOOST_AUTO_TEST_CASE(PartialRedraw)
+{
+    createWindows(2);
+    d_root->setUsingAutoRenderingSurface(true);
+    d_context.setPartialRedrawEnabled(true);
+
+    const CEGUI::RenderingSurface& surface = *d_root->getRenderingSurface();
+    const float fullArea = 800.0f * 600.0f;
+
+    d_context.draw();
+    BOOST_CHECK_CLOSE(d_context.getLastRedrawnArea(), fullArea, 0.01f);
+    d_context.draw();
+    BOOST_CHECK_EQUAL(d_context.getLastRedrawnArea(), 0.0f);
+
+    // invalidating windows only redraws the area they cover
+    CEGUI::Window* const panel = d_root->getChildAtIdx(0);
+    panel->getChildAtIdx(0)->invalidate();
+    panel->getChildAtIdx(3)->invalidate();
+    BOOST_CHECK(surface.isPartiallyInvalidated());
+    const CEGUI::Rectf damage(
+        panel->getChildAtIdx(0)->getOuterRectClipper().getPosition(),
+        panel->getChildAtIdx(3)->getOuterRectClipper().d_max);
+    BOOST_CHECK(surface.getInvalidatedArea() == damage);
+
+    d_context.draw();
+    BOOST_CHECK(!surface.isPartiallyInvalidated());
+    BOOST_CHECK_CLOSE(d_context.getLastRedrawnArea(),
+                      damage.getWidth() * damage.getHeight(), 0.01f);
+
+    // changes to the area windows cover redraw the whole surface
+    panel->hide();
+    BOOST_CHECK(!surface.isPartiallyInvalidated());
+    d_context.draw();
+    BOOST_CHECK_CLOSE(d_context.getLastRedrawnArea(), fullArea, 0.01f);
+
+    d_context.setPartialRedrawEnabled(false);
+    d_root->getChildAtIdx(1)->invalidate();
+    d_context.draw();
+    BOOST_CHECK_CLOSE(d_context.getLastRedrawnArea(), fullArea, 0.01f);
+}
+
+BOOST_AUTO_TEST_CASE(AutomaticCaching)
+{
+    createWindows(2);
+
+    CEGUI::TextureTargetPool& pool =
+        CEGUI::System::getSingleton().getTextureTargetPool();
+    const size_t bytes_in_use = pool.getTextureBytesInUse();
+
+    d_context.setAutoCachingThreshold(2);
+
+    // one panel changes before every redraw, the others stay as they are.
+    CEGUI::Window* const busy = d_root->getChildAtIdx(0);
+    for (int i = 0; i < 3; ++i)
+    {
+        busy->invalidate();
+        d_context.draw();
+    }
+
+    BOOST_CHECK(!busy->isAutoCached());
+    BOOST_CHECK(busy->getRenderingSurface() == 0);
+    for (size_t i = 1; i < d_root->getChildCount(); ++i)
+    {
+        BOOST_CHECK(d_root->getChildAtIdx(i)->isAutoCached());
+        BOOST_CHECK(d_root->getChildAtIdx(i)->isUsingAutoRenderingSurface());
+    }
+    BOOST_CHECK(pool.getTextureBytesInUse() > bytes_in_use);
+
+    // cached panels are now drawn from their textures.
+    const CEGUI::uint64 hits = pool.getCacheHitCount();
+    const CEGUI::uint64 misses = pool.getCacheMissCount();
+    busy->invalidate();
+    d_context.draw();
+    BOOST_CHECK_EQUAL(pool.getCacheHitCount() - hits, 99u);
+    BOOST_CHECK_EQUAL(pool.getCacheMissCount(), misses);
+
+    // a cached panel that keeps changing is released again...
+    CEGUI::Window* const changing = d_root->getChildAtIdx(1);
+    for (int i = 0; i < 2; ++i)
+    {
+        changing->getChildAtIdx(0)->invalidate();
+        d_context.draw();
+    }
+    BOOST_CHECK(!changing->isAutoCached());
+    BOOST_CHECK(changing->getRenderingSurface() == 0);
+
+    // ...as is one that is hidden.
+    CEGUI::Window* const hidden = d_root->getChildAtIdx(2);
+    hidden->hide();
+    d_context.draw();
+    BOOST_CHECK(!hidden->isAutoCached());
+    BOOST_CHECK(hidden->getRenderingSurface() == 0);
+
+    // surfaces the client asked for are left alone.
+    CEGUI::Window* const manual = d_root->getChildAtIdx(3);
+    manual->setUsingAutoRenderingSurface(true);
+    BOOST_CHECK(!manual->isAutoCached());
+    for (int i = 0; i < 3; ++i)
+    {
+        manual->getChildAtIdx(0)->invalidate();
+        d_context.draw();
+    }
+    BOOST_CHECK(manual->isUsingAutoRenderingSurface());
+}
+
+BOOST_AUTO_TEST_CASE(UpdateSkipsIdleSubtrees)
+{
+    createWindows(2);
+
+    BOOST_CHECK(!d_root->isSubtreeUpdateRequired());
+
+    // without opting in, every window is updated.
+    BOOST_CHECK(!d_context.isIdleUpdateSkippingEnabled());
+    CEGUI::GlobalEventSet& ges = CEGUI::GlobalEventSet::getSingleton();
+    const CEGUI::String globalUpdated(CEGUI::Window::EventNamespace + "/" +
+                                      CEGUI::Window::EventUpdated);
+    CEGUI::Event::Connection global =
+        ges.subscribeEvent(globalUpdated, &countUpdatedEvent);
+    updatedEventCount = 0;
+    d_context.injectTimePulse(0.01f);
+    const int windowCount = updatedEventCount;
+    BOOST_CHECK_EQUAL(windowCount, 1 + static_cast<int>(d_root->getChildCount()) * 5);
+
+    // ...as they are with skipping enabled, while subscribed globally.
+    d_context.setIdleUpdateSkippingEnabled(true);
+    updatedEventCount = 0;
+    d_context.injectTimePulse(0.01f);
+    BOOST_CHECK_EQUAL(updatedEventCount, windowCount);
+
+    global->disconnect();
+    updatedEventCount = 0;
+    d_context.injectTimePulse(0.01f);
+    BOOST_CHECK_EQUAL(updatedEventCount, 0);
+
+    CEGUI::Window* const item = d_root->getChildAtIdx(42)->getChildAtIdx(1);
+    CEGUI::Event::Connection local =
+        item->subscribeEvent(CEGUI::Window::EventUpdated, &countUpdatedEvent);
+
+    BOOST_CHECK(d_root->isSubtreeUpdateRequired());
+    BOOST_CHECK(d_root->getChildAtIdx(42)->isSubtreeUpdateRequired());
+    BOOST_CHECK(!d_root->getChildAtIdx(41)->isSubtreeUpdateRequired());
+
+    for (int i = 0; i < 10; ++i)
+        d_context.injectTimePulse(0.01f);
+
+    BOOST_CHECK_EQUAL(updatedEventCount, 10);
+
+    // moving the window moves the update requirement with it
+    d_root->getChildAtIdx(7)->addChild(item);
+    BOOST_CHECK(!d_root->getChildAtIdx(42)->isSubtreeUpdateRequired());
+    BOOST_CHECK(d_root->getChildAtIdx(7)->isSubtreeUpdateRequired());
+
+    d_context.injectTimePulse(0.01f);
+    BOOST_CHECK_EQUAL(updatedEventCount, 11);
+
+    // once the subscription goes away, the window becomes idle again.
+    local->disconnect();
+    d_context.injectTimePulse(0.01f);
+    BOOST_CHECK(!d_root->isSubtreeUpdateRequired());
+}
+
+BOOST_AUTO_TEST_CASE(UpdatePerformance)
+{
+    const int pulseCount = 100;
+    // 100 panels holding 100 items each, all idle.
+    createWindows(10);
+    d_context.setIdleUpdateSkippingEnabled(true);
+
+    boost::timer timer;
+    for (int i = 0; i < pulseCount; ++i)
+        d_context.injectTimePulse(0.01f);
+    const double idle = timer.elapsed();
+
+    // a global subscription to the update event forces every window to be
+    // visited, which is what each time pulse used to cost.
+    CEGUI::GlobalEventSet& ges = CEGUI::GlobalEventSet::getSingleton();
+    const CEGUI::String globalUpdated(CEGUI::Window::EventNamespace + "/" +
+                                      CEGUI::Window::EventUpdated);
+    ges.subscribeEvent(globalUpdated, &countUpdatedEvent);
+
+    timer.restart();
+    for (int i = 0; i < pulseCount; ++i)
+        d_context.injectTimePulse(0.01f);
+    const double all = timer.elapsed();
+
+    ges.removeEvent(globalUpdated);
+
+    BOOST_TEST_MESSAGE("Time taken, " << pulseCount << " time pulses over " <<
+                       d_root->getChildCount() * 101 << " idle windows: " <<
+                       idle << " (updating every window: " << all << ")");
+}
+
+BOOST_AUTO_TEST_CASE(MouseMovePerformance)
+{
+    const int moveCount = 1000;
+    // give roughly 500, 1000 and 5000 windows
+    const int itemsPerSide[] = {2, 3, 7};
+
+    for (int i = 0; i < 3; ++i)
+    {
+        createWindows(itemsPerSide[i]);
+        const size_t windowCount =
+            100 * (itemsPerSide[i] * itemsPerSide[i] + 1);
+
+        d_context.setHitTestIndexEnabled(false);
+        const double plain = timeMouseMoves(moveCount);
+        d_context.setHitTestIndexEnabled(true);
+        const double indexed = timeMouseMoves(moveCount);
+
+        BOOST_TEST_MESSAGE("Time taken, " << moveCount << " mouse moves over " <<
+                           windowCount << " windows: " << plain <<
+                           " (hit test index: " << indexed << ")");
+
+        while (d_root->getChildCount())
+            CEGUI::WindowManager::getSingleton().destroyWindow(d_root->getChildAtIdx(0));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,166 @@
+/***********************************************************************
+ *    filename:   GeometryBuffer.cpp
+ *    created:    18/10/2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2013 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/System.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/Vertex.h"
+#include "CEGUI/Texture.h"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/timer.hpp>
+
+/*
+ * Creates a GeometryBuffer using whichever renderer the test instance was
+ * brought up with, so the benchmarks here measure that renderer's buffer
+ * implementation.
+ */
+struct GeometryBufferFixture
+{
+    GeometryBufferFixture() :
+        d_renderer(*CEGUI::System::getSingleton().getRenderer()),
+        d_buffer(d_renderer.createGeometryBuffer())
+    {
+        d_buffer.setClippingRegion(CEGUI::Rectf(0, 0, 800, 600));
+    }
+
+    ~GeometryBufferFixture()
+    {
+        d_renderer.destroyGeometryBuffer(d_buffer);
+    }
+
+    //! append one quad (two triangles) at the given position
+    void appendQuad(float x, float y)
+    {
+        CEGUI::Vertex vbuffer[6];
+
+        vbuffer[0].position = CEGUI::Vector3f(x, y, 0.0f);
+        vbuffer[0].tex_coords = CEGUI::Vector2f(0.0f, 0.0f);
+        vbuffer[1].position = CEGUI::Vector3f(x, y + 8.0f, 0.0f);
+        vbuffer[1].tex_coords = CEGUI::Vector2f(0.0f, 1.0f);
+        vbuffer[2].position = CEGUI::Vector3f(x + 8.0f, y + 8.0f, 0.0f);
+        vbuffer[2].tex_coords = CEGUI::Vector2f(1.0f, 1.0f);
+        vbuffer[3].position = CEGUI::Vector3f(x + 8.0f, y, 0.0f);
+        vbuffer[3].tex_coords = CEGUI::Vector2f(1.0f, 0.0f);
+        vbuffer[4] = vbuffer[0];
+        vbuffer[5] = vbuffer[2];
+
+        for (unsigned int i = 0; i < 6; ++i)
+            vbuffer[i].colour_val = CEGUI::Colour(1.0f, 1.0f, 1.0f, 1.0f);
+
+        d_buffer.appendGeometry(vbuffer, 6);
+    }
+
+    CEGUI::Renderer& d_renderer;
+    CEGUI::GeometryBuffer& d_buffer;
+};
+
+BOOST_FIXTURE_TEST_SUITE(GeometryBuffer, GeometryBufferFixture)
+
+BOOST_AUTO_TEST_CASE(AppendAndReset)
+{
+    for (unsigned int i = 0; i < 100; ++i)
+        appendQuad(static_cast<float>(i % 10) * 8.0f,
+                   static_cast<float>(i / 10) * 8.0f);
+
+    BOOST_CHECK_EQUAL(d_buffer.getVertexCount(), 600u);
+    BOOST_CHECK_EQUAL(d_buffer.getBatchCount(), 1u);
+
+    d_buffer.draw();
+    d_buffer.reset();
+
+    BOOST_CHECK_EQUAL(d_buffer.getVertexCount(), 0u);
+
+    // appending after a draw/reset cycle must start from scratch
+    appendQuad(0.0f, 0.0f);
+    d_buffer.draw();
+    BOOST_CHECK_EQUAL(d_buffer.getVertexCount(), 6u);
+}
+
+BOOST_AUTO_TEST_CASE(AppendBetweenDraws)
+{
+    // the pattern that renderers uploading vertex data lazily, and only in
+    // part, have to get right: appends between draws, growth of the buffer,
+    // and a reset followed by fewer vertices than before.
+    CEGUI::Texture& texture =
+        d_renderer.createTexture("GeometryBufferTest", CEGUI::Sizef(8, 8));
+
+    appendQuad(0.0f, 0.0f);
+    d_buffer.draw();
+
+    for (unsigned int i = 0; i < 50; ++i)
+        appendQuad(static_cast<float>(i) * 8.0f, 8.0f);
+    d_buffer.draw();
+    BOOST_CHECK_EQUAL(d_buffer.getVertexCount(), 306u);
+    BOOST_CHECK_EQUAL(d_buffer.getBatchCount(), 1u);
+
+    d_buffer.setActiveTexture(&texture);
+    appendQuad(0.0f, 16.0f);
+    d_buffer.draw();
+    BOOST_CHECK_EQUAL(d_buffer.getVertexCount(), 312u);
+
+    d_buffer.reset();
+    appendQuad(0.0f, 0.0f);
+    appendQuad(8.0f, 0.0f);
+    d_buffer.draw();
+    BOOST_CHECK_EQUAL(d_buffer.getVertexCount(), 12u);
+    BOOST_CHECK_EQUAL(d_buffer.getBatchCount(), 1u);
+
+    d_buffer.reset();
+    d_renderer.destroyTexture(texture);
+}
+
+BOOST_AUTO_TEST_CASE(BuildingPerformance)
+{
+    // measure building a buffer quad by quad, the way text rendering does,
+    // and drawing it once per rebuild.
+    const unsigned int quadCount = 10000;
+    const unsigned int rebuildCount = 10;
+
+    boost::timer timer;
+    for (unsigned int rebuild = 0; rebuild < rebuildCount; ++rebuild)
+    {
+        d_buffer.reset();
+
+        for (unsigned int i = 0; i < quadCount; ++i)
+            appendQuad(static_cast<float>(i % 100) * 8.0f,
+                       static_cast<float>(i / 100) * 6.0f);
+
+        d_buffer.draw();
+    }
+    const double elapsed = timer.elapsed();
+
+    BOOST_CHECK_EQUAL(d_buffer.getVertexCount(), quadCount * 6);
+
+    BOOST_TEST_MESSAGE("Time taken, " << rebuildCount << "x building buffer of "
+        << quadCount << " quads: " << elapsed);
+    if (elapsed > 0.0)
+        BOOST_TEST_MESSAGE("Vertices per second: "
+            << (quadCount * 6.0 * rebuildCount) / elapsed);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,235 @@
+/***********************************************************************
+ *    filename:   GlyphAtlas.cpp
+ *    created:    18/10/2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2013 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/GlyphAtlas.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/Texture.h"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/timer.hpp>
+
+#include <vector>
+
+/*
+ * Provides a private atlas and a pixel buffer large enough for any of the
+ * images added by these tests.
+ */
+struct GlyphAtlasFixture
+{
+    GlyphAtlasFixture() :
+        d_atlas(CEGUI::GlyphAtlas::acquire("GlyphAtlasTest")),
+        d_pixels(64 * 64, 0xFFFFFFFF),
+        d_seed(12345)
+    {}
+
+    ~GlyphAtlasFixture()
+    {
+        CEGUI::GlyphAtlas::release(d_atlas);
+    }
+
+    //! simple LCG so results are repeatable across platforms
+    CEGUI::uint random(CEGUI::uint range)
+    {
+        d_seed = d_seed * 1103515245 + 12345;
+        return (d_seed >> 16) % range;
+    }
+
+    struct Placement
+    {
+        CEGUI::Texture* d_texture;
+        CEGUI::Rectf d_area;
+    };
+
+    //! add \a count random sized images (4 - 35 pixels each way)
+    void addImages(size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            Placement p;
+            BOOST_REQUIRE(d_atlas.addImage(&d_pixels[0], 4 + random(32), 4 + random(32),
+                                           p.d_texture, p.d_area));
+            d_placements.push_back(p);
+        }
+        d_atlas.flush();
+    }
+
+    CEGUI::GlyphAtlas& d_atlas;
+    std::vector<CEGUI::argb_t> d_pixels;
+    std::vector<Placement> d_placements;
+    CEGUI::uint d_seed;
+};
+
+BOOST_FIXTURE_TEST_SUITE(GlyphAtlas, GlyphAtlasFixture)
+
+BOOST_AUTO_TEST_CASE(Sharing)
+{
+    BOOST_CHECK(CEGUI::GlyphAtlas::isAtlasPresent("GlyphAtlasTest"));
+    BOOST_CHECK_EQUAL(&CEGUI::GlyphAtlas::acquire("GlyphAtlasTest"), &d_atlas);
+    BOOST_CHECK_EQUAL(d_atlas.getReferenceCount(), 2u);
+    CEGUI::GlyphAtlas::release(d_atlas);
+    BOOST_CHECK_EQUAL(d_atlas.getReferenceCount(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(EmptyAndOversizedImages)
+{
+    CEGUI::Texture* texture = 0;
+    CEGUI::Rectf area(1, 1, 2, 2);
+
+    BOOST_CHECK(d_atlas.addImage(0, 0, 0, texture, area));
+    BOOST_CHECK(texture != 0);
+    BOOST_CHECK_EQUAL(area.getWidth(), 0.0f);
+    BOOST_CHECK_EQUAL(d_atlas.getImageCount(), 0u);
+
+    const CEGUI::uint max_size =
+        CEGUI::System::getSingleton().getRenderer()->getMaxTextureSize();
+    BOOST_CHECK(!d_atlas.addImage(0, max_size, 1, texture, area));
+    BOOST_CHECK_EQUAL(area.getWidth(), 0.0f);
+    BOOST_CHECK_EQUAL(d_atlas.getImageCount(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(Packing)
+{
+    addImages(2000);
+
+    BOOST_CHECK_EQUAL(d_atlas.getImageCount(), 2000u);
+    BOOST_CHECK(d_atlas.getTextureCount() > 1u);
+
+    // textures are never resized; each one added is larger than the last.
+    for (size_t i = 1; i < d_atlas.getTextureCount(); ++i)
+        BOOST_CHECK(d_atlas.getTexture(i).getSize().d_width >=
+                    d_atlas.getTexture(i - 1).getSize().d_width);
+
+    size_t overlaps = 0;
+    for (size_t i = 0; i < d_placements.size(); ++i)
+    {
+        const CEGUI::Rectf& a = d_placements[i].d_area;
+        const CEGUI::Sizef& tex_size = d_placements[i].d_texture->getSize();
+
+        BOOST_CHECK(a.left() >= 0.0f && a.top() >= 0.0f);
+        BOOST_CHECK(a.right() <= tex_size.d_width && a.bottom() <= tex_size.d_height);
+
+        for (size_t j = i + 1; j < d_placements.size(); ++j)
+            if (d_placements[j].d_texture == d_placements[i].d_texture &&
+                a.getIntersection(d_placements[j].d_area).getWidth() != 0.0f)
+                    ++overlaps;
+    }
+    BOOST_CHECK_EQUAL(overlaps, 0u);
+
+    BOOST_CHECK(d_atlas.getOccupancy() > 0.0f && d_atlas.getOccupancy() <= 1.0f);
+    BOOST_TEST_MESSAGE("Atlas occupancy, 2000 images: " << d_atlas.getOccupancy());
+}
+
+BOOST_AUTO_TEST_CASE(TexturesAreNotResized)
+{
+    addImages(10);
+    const CEGUI::Texture* const texture = &d_atlas.getTexture(0);
+    const CEGUI::Sizef size(texture->getSize());
+
+    addImages(2000);
+
+    BOOST_CHECK_EQUAL(&d_atlas.getTexture(0), texture);
+    BOOST_CHECK(d_atlas.getTexture(0).getSize() == size);
+    for (size_t i = 0; i < 10; ++i)
+        BOOST_CHECK_EQUAL(d_placements[i].d_texture, texture);
+}
+
+BOOST_AUTO_TEST_CASE(FreedSpaceIsReused)
+{
+    addImages(2000);
+    const size_t textureCount = d_atlas.getTextureCount();
+    const size_t usedArea = d_atlas.getUsedArea();
+
+    // free every other image, then add as many again of the same sizes.
+    std::vector<Placement> kept;
+    for (size_t i = 0; i < d_placements.size(); ++i)
+    {
+        if (i % 2)
+            kept.push_back(d_placements[i]);
+        else
+            d_atlas.freeImage(*d_placements[i].d_texture, d_placements[i].d_area);
+    }
+    BOOST_CHECK_EQUAL(d_atlas.getImageCount(), 1000u);
+    BOOST_CHECK(d_atlas.getUsedArea() < usedArea);
+
+    d_seed = 12345;
+    d_placements.clear();
+    for (size_t i = 0; i < 2000; ++i)
+    {
+        const CEGUI::uint width = 4 + random(32);
+        const CEGUI::uint height = 4 + random(32);
+
+        Placement p;
+        if (i % 2 == 0)
+            BOOST_REQUIRE(d_atlas.addImage(&d_pixels[0], width, height,
+                                           p.d_texture, p.d_area));
+        d_placements.push_back(p);
+    }
+    d_atlas.flush();
+
+    BOOST_CHECK_EQUAL(d_atlas.getImageCount(), 2000u);
+    BOOST_CHECK_EQUAL(d_atlas.getUsedArea(), usedArea);
+    BOOST_CHECK_EQUAL(d_atlas.getTextureCount(), textureCount);
+
+    size_t overlaps = 0;
+    for (size_t i = 0; i < d_placements.size(); i += 2)
+        for (size_t j = 0; j < kept.size(); ++j)
+            if (kept[j].d_texture == d_placements[i].d_texture &&
+                kept[j].d_area.getIntersection(d_placements[i].d_area).getWidth() != 0.0f)
+                    ++overlaps;
+    BOOST_CHECK_EQUAL(overlaps, 0u);
+
+    // once all images are freed the textures are packed afresh.
+    for (size_t i = 0; i < d_placements.size(); i += 2)
+        d_atlas.freeImage(*d_placements[i].d_texture, d_placements[i].d_area);
+    for (size_t i = 0; i < kept.size(); ++i)
+        d_atlas.freeImage(*kept[i].d_texture, kept[i].d_area);
+
+    BOOST_CHECK_EQUAL(d_atlas.getImageCount(), 0u);
+    BOOST_CHECK_EQUAL(d_atlas.getUsedArea(), 0u);
+
+    d_placements.clear();
+    addImages(2000);
+    BOOST_CHECK_EQUAL(d_atlas.getTextureCount(), textureCount);
+}
+
+BOOST_AUTO_TEST_CASE(PackingPerformance)
+{
+    const size_t imageCount = 10000;
+
+    boost::timer timer;
+    addImages(imageCount);
+    const double elapsed = timer.elapsed();
+
+    BOOST_TEST_MESSAGE("Time taken, " << imageCount << " atlas images: " << elapsed);
+    if (elapsed > 0.0)
+        BOOST_TEST_MESSAGE("Atlas images per second: " << imageCount / elapsed);
+    BOOST_TEST_MESSAGE("Atlas occupancy: " << d_atlas.getOccupancy() <<
+                       ", textures: " << d_atlas.getTextureCount());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
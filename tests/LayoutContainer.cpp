@@ -0,0 +1,245 @@
+/***********************************************************************
+ *    filename:   LayoutContainer.cpp
+ *    created:    Sun Oct 18 2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2013 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/System.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/widgets/GridLayoutContainer.h"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/timer.hpp>
+
+#include <vector>
+
+namespace
+{
+struct EventCounter
+{
+    explicit EventCounter(int* count) : d_count(count) {}
+
+    bool operator()(const CEGUI::EventArgs&)
+    {
+        ++*d_count;
+        return true;
+    }
+
+    int* d_count;
+};
+
+const size_t GRID_SIZE = 40;
+const float SLOT_SIZE = 32.0f;
+
+/*
+ * Attaches a root window to the default GUIContext, so that layouts are
+ * performed within a live window hierarchy.
+ */
+struct LayoutContainerFixture
+{
+    LayoutContainerFixture() :
+        d_context(CEGUI::System::getSingleton().getDefaultGUIContext())
+    {
+        CEGUI::WindowManager& wmgr = CEGUI::WindowManager::getSingleton();
+        d_root = wmgr.createWindow("DefaultWindow");
+        d_root->setSize(CEGUI::USize(CEGUI::UDim(1, 0), CEGUI::UDim(1, 0)));
+        d_context.setRootWindow(d_root);
+    }
+
+    ~LayoutContainerFixture()
+    {
+        d_context.setRootWindow(0);
+        CEGUI::WindowManager::getSingleton().destroyWindow(d_root);
+    }
+
+    //! create a grid of GRID_SIZE x GRID_SIZE item slots, each with an icon
+    //! and a label.
+    CEGUI::GridLayoutContainer* createGrid()
+    {
+        CEGUI::WindowManager& wmgr = CEGUI::WindowManager::getSingleton();
+
+        CEGUI::GridLayoutContainer* grid =
+            static_cast<CEGUI::GridLayoutContainer*>(
+                wmgr.createWindow("GridLayoutContainer"));
+        d_root->addChild(grid);
+        grid->setGridDimensions(GRID_SIZE, GRID_SIZE);
+
+        for (size_t i = 0; i < GRID_SIZE * GRID_SIZE; ++i)
+        {
+            CEGUI::Window* slot = wmgr.createWindow("DefaultWindow");
+            slot->setSize(CEGUI::USize(cegui_absdim(SLOT_SIZE),
+                                       cegui_absdim(SLOT_SIZE)));
+            slot->addChild(wmgr.createWindow("DefaultWindow"));
+            slot->addChild(wmgr.createWindow("DefaultWindow"));
+            grid->addChild(slot);
+        }
+
+        return grid;
+    }
+
+    CEGUI::GUIContext& d_context;
+    CEGUI::Window* d_root;
+};
+}
+
+BOOST_FIXTURE_TEST_SUITE(LayoutContainer, LayoutContainerFixture)
+
+BOOST_AUTO_TEST_CASE(AreaUpdateTransaction)
+{
+    CEGUI::WindowManager& wmgr = CEGUI::WindowManager::getSingleton();
+    CEGUI::Window* parent = wmgr.createWindow("DefaultWindow");
+    CEGUI::Window* child = wmgr.createWindow("DefaultWindow");
+    parent->addChild(child);
+
+    int moved = 0;
+    int sized = 0;
+    child->subscribeEvent(CEGUI::Element::EventMoved, EventCounter(&moved));
+    child->subscribeEvent(CEGUI::Element::EventSized, EventCounter(&sized));
+
+    parent->beginAreaUpdate();
+    BOOST_CHECK(child->isAreaUpdateDeferred());
+
+    child->setPosition(CEGUI::UVector2(cegui_absdim(10), cegui_absdim(20)));
+    child->setPosition(CEGUI::UVector2(cegui_absdim(30), cegui_absdim(40)));
+    child->setSize(CEGUI::USize(cegui_absdim(50), cegui_absdim(60)));
+
+    // nested transactions only flush when the outermost one ends.
+    child->beginAreaUpdate();
+    child->setPosition(CEGUI::UVector2(cegui_absdim(35), cegui_absdim(45)));
+    child->endAreaUpdate();
+
+    BOOST_CHECK_EQUAL(moved, 0);
+    BOOST_CHECK_EQUAL(sized, 0);
+    BOOST_CHECK_EQUAL(child->getPixelSize(), CEGUI::Sizef(50, 60));
+
+    parent->endAreaUpdate();
+    BOOST_CHECK(!child->isAreaUpdateDeferred());
+    BOOST_CHECK_EQUAL(moved, 1);
+    BOOST_CHECK_EQUAL(sized, 1);
+    BOOST_CHECK_EQUAL(child->getUnclippedOuterRect().get(),
+                      CEGUI::Rectf(35, 45, 85, 105));
+
+    BOOST_CHECK_THROW(parent->endAreaUpdate(), CEGUI::InvalidRequestException);
+
+    // outside of a transaction events are immediate.
+    child->setPosition(CEGUI::UVector2(cegui_absdim(0), cegui_absdim(0)));
+    BOOST_CHECK_EQUAL(moved, 2);
+
+    // attaching to and detaching from a hierarchy with an open transaction
+    // updates the deferred state of the whole subtree.
+    CEGUI::Window* grandChild = wmgr.createWindow("DefaultWindow");
+    child->addChild(grandChild);
+    parent->removeChild(child);
+    parent->beginAreaUpdate();
+    parent->addChild(child);
+    BOOST_CHECK(grandChild->isAreaUpdateDeferred());
+    child->setPosition(CEGUI::UVector2(cegui_absdim(5), cegui_absdim(5)));
+    BOOST_CHECK_EQUAL(moved, 2);
+    parent->removeChild(child);
+    BOOST_CHECK(!grandChild->isAreaUpdateDeferred());
+    BOOST_CHECK_EQUAL(moved, 3);
+    parent->endAreaUpdate();
+    parent->addChild(child);
+
+    wmgr.destroyWindow(parent);
+}
+
+BOOST_AUTO_TEST_CASE(GridLayout)
+{
+    CEGUI::GridLayoutContainer* grid = createGrid();
+
+    std::vector<int> moved(GRID_SIZE * GRID_SIZE, 0);
+    for (size_t i = 0; i < moved.size(); ++i)
+        grid->getChildAtIdx(i)->subscribeEvent(CEGUI::Element::EventMoved,
+                                               EventCounter(&moved[i]));
+
+    grid->layoutIfNecessary();
+
+    BOOST_CHECK_EQUAL(grid->getPixelSize(),
+                      CEGUI::Sizef(GRID_SIZE * SLOT_SIZE, GRID_SIZE * SLOT_SIZE));
+
+    size_t misplaced = 0;
+    size_t wrong_event_count = 0;
+    for (size_t y = 0; y < GRID_SIZE; ++y)
+    {
+        for (size_t x = 0; x < GRID_SIZE; ++x)
+        {
+            const size_t idx = x + y * GRID_SIZE;
+            const CEGUI::Rectf expected(x * SLOT_SIZE, y * SLOT_SIZE,
+                                        (x + 1) * SLOT_SIZE, (y + 1) * SLOT_SIZE);
+            if (grid->getChildAtIdx(idx)->getUnclippedOuterRect().get() != expected)
+                ++misplaced;
+
+            // every slot but the first moves, and is notified exactly once.
+            if (moved[idx] != (idx == 0 ? 0 : 1))
+                ++wrong_event_count;
+        }
+    }
+
+    BOOST_CHECK_EQUAL(misplaced, 0u);
+    BOOST_CHECK_EQUAL(wrong_event_count, 0u);
+
+    CEGUI::WindowManager::getSingleton().destroyWindow(grid);
+}
+
+BOOST_AUTO_TEST_CASE(Performance)
+{
+    CEGUI::WindowManager& wmgr = CEGUI::WindowManager::getSingleton();
+    const int iterations = 10;
+
+    // LayoutContainer::layout applies each child's area immediately, which
+    // is how layouts were performed before area update transactions.
+    double immediate = 0;
+    for (int i = 0; i < iterations; ++i)
+    {
+        CEGUI::GridLayoutContainer* grid = createGrid();
+        boost::timer timer;
+        grid->layout();
+        immediate += timer.elapsed();
+
+        wmgr.destroyWindow(grid);
+        wmgr.cleanDeadPool();
+    }
+
+    double batched = 0;
+    for (int i = 0; i < iterations; ++i)
+    {
+        CEGUI::GridLayoutContainer* grid = createGrid();
+        boost::timer timer;
+        grid->layoutIfNecessary();
+        batched += timer.elapsed();
+
+        BOOST_CHECK(!grid->needsLayouting());
+        wmgr.destroyWindow(grid);
+        wmgr.cleanDeadPool();
+    }
+
+    BOOST_TEST_MESSAGE("40x40 grid layout: immediate " <<
+        immediate * 1000.0 / iterations << "ms, batched " <<
+        batched * 1000.0 / iterations << "ms");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
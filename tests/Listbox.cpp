@@ -0,0 +1,221 @@
+/***********************************************************************
+ *    filename:   Listbox.cpp
+ *    created:    18/10/2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2013 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/widgets/Listbox.h"
+#include "CEGUI/widgets/ListboxTextItem.h"
+#include "CEGUI/widgets/Scrollbar.h"
+#include "CEGUI/FontManager.h"
+#include "CEGUI/Font.h"
+#include "CEGUI/System.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/WindowManager.h"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/timer.hpp>
+
+#include <sstream>
+
+/*
+ * ListboxItem whose size is set directly, as a custom item type might be.
+ */
+class SizedItem : public CEGUI::ListboxItem
+{
+public:
+    SizedItem(float height) :
+        CEGUI::ListboxItem("", 0, 0, false, false),
+        d_size(50.0f, height)
+    {}
+
+    CEGUI::Sizef getPixelSize() const { return d_size; }
+
+    void draw(CEGUI::GeometryBuffer&, const CEGUI::Rectf&, float,
+              const CEGUI::Rectf*) const
+    {}
+
+    CEGUI::Sizef d_size;
+};
+
+/*
+ * Brings up a TaharezLook Listbox attached to the default GUIContext, so that
+ * it can be rendered.
+ */
+struct ListboxFixture
+{
+    ListboxFixture() :
+        d_context(CEGUI::System::getSingleton().getDefaultGUIContext())
+    {
+        CEGUI::System::getSingleton().notifyDisplaySizeChanged(CEGUI::Sizef(800, 600));
+
+        CEGUI::WindowManager& wmgr = CEGUI::WindowManager::getSingleton();
+        d_root = wmgr.createWindow("DefaultWindow");
+        d_root->setSize(CEGUI::USize(CEGUI::UDim(1, 0), CEGUI::UDim(1, 0)));
+        d_context.setRootWindow(d_root);
+
+        d_listbox = static_cast<CEGUI::Listbox*>(wmgr.createWindow("TaharezLook/Listbox"));
+        d_listbox->setSize(CEGUI::USize(CEGUI::UDim(0, 200), CEGUI::UDim(0, 300)));
+        d_listbox->setFont("DejaVuSans-12");
+        d_root->addChild(d_listbox);
+    }
+
+    ~ListboxFixture()
+    {
+        d_context.setRootWindow(0);
+        CEGUI::WindowManager::getSingleton().destroyWindow(d_root);
+    }
+
+    void addItems(size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            std::stringstream s;
+            s << "Server " << i;
+            d_listbox->addItem(new CEGUI::ListboxTextItem(s.str()));
+        }
+    }
+
+    CEGUI::GUIContext& d_context;
+    CEGUI::Window* d_root;
+    CEGUI::Listbox* d_listbox;
+};
+
+BOOST_FIXTURE_TEST_SUITE(Listbox, ListboxFixture)
+
+BOOST_AUTO_TEST_CASE(ItemExtents)
+{
+    addItems(10);
+
+    const float itemHeight = d_listbox->getListboxItemFromIndex(0)->getPixelSize().d_height;
+    BOOST_REQUIRE(itemHeight > 0);
+    BOOST_CHECK_CLOSE(d_listbox->getTotalItemsHeight(), itemHeight * 10, 0.001f);
+
+    BOOST_CHECK_EQUAL(d_listbox->getItemIndexAtOffset(0.0f), 0u);
+    BOOST_CHECK_EQUAL(d_listbox->getItemIndexAtOffset(itemHeight * 2.5f), 2u);
+    BOOST_CHECK_EQUAL(d_listbox->getItemIndexAtOffset(itemHeight * 3.0f), 3u);
+    BOOST_CHECK_EQUAL(d_listbox->getItemIndexAtOffset(itemHeight * 10.0f), 10u);
+    BOOST_CHECK_CLOSE(d_listbox->getItemOffset(4), itemHeight * 4, 0.001f);
+
+    // changing the text of an item must be reflected in the cached extents
+    CEGUI::ListboxItem* item = d_listbox->getListboxItemFromIndex(4);
+    const float oldWidest = d_listbox->getWidestItemWidth();
+    item->setText("Two\nlines, and quite a bit wider than the others");
+    BOOST_CHECK_CLOSE(d_listbox->getTotalItemsHeight(), itemHeight * 11, 0.001f);
+    BOOST_CHECK(d_listbox->getWidestItemWidth() > oldWidest);
+    BOOST_CHECK_EQUAL(d_listbox->getItemIndexAtOffset(itemHeight * 5.5f), 4u);
+    BOOST_CHECK_EQUAL(d_listbox->getItemIndexAtOffset(itemHeight * 6.5f), 5u);
+
+    // and so must removing it
+    d_listbox->removeItem(item);
+    BOOST_CHECK_CLOSE(d_listbox->getTotalItemsHeight(), itemHeight * 9, 0.001f);
+    BOOST_CHECK_CLOSE(d_listbox->getWidestItemWidth(), oldWidest, 0.001f);
+
+    d_listbox->resetList();
+    BOOST_CHECK_EQUAL(d_listbox->getTotalItemsHeight(), 0.0f);
+}
+
+BOOST_AUTO_TEST_CASE(CustomItemSize)
+{
+    SizedItem items[3] = {SizedItem(10.0f), SizedItem(10.0f), SizedItem(10.0f)};
+    for (size_t i = 0; i < 3; ++i)
+        d_listbox->addItem(&items[i]);
+
+    BOOST_CHECK_CLOSE(d_listbox->getTotalItemsHeight(), 30.0f, 0.001f);
+
+    // the cached extents are only refreshed once the change is reported
+    items[1].d_size = CEGUI::Sizef(80.0f, 25.0f);
+    items[1].notifySizeChanged();
+    BOOST_CHECK_CLOSE(d_listbox->getTotalItemsHeight(), 45.0f, 0.001f);
+    BOOST_CHECK_CLOSE(d_listbox->getWidestItemWidth(), 80.0f, 0.001f);
+    BOOST_CHECK_CLOSE(d_listbox->getItemOffset(2), 35.0f, 0.001f);
+
+    // as they are by handleUpdatedItemData
+    items[0].d_size.d_height = 5.0f;
+    d_listbox->handleUpdatedItemData();
+    BOOST_CHECK_CLOSE(d_listbox->getTotalItemsHeight(), 40.0f, 0.001f);
+
+    d_listbox->resetList();
+}
+
+BOOST_AUTO_TEST_CASE(FontRenderSizeChange)
+{
+    CEGUI::FontManager& mgr = CEGUI::FontManager::getSingleton();
+    CEGUI::Font& font = mgr.createFreeTypeFont("ListboxTest-10", 10, true, "DejaVuSans.ttf");
+
+    // items using the font of the list are measured again when it changes
+    d_listbox->setFont(&font);
+    addItems(10);
+    const float height = d_listbox->getTotalItemsHeight();
+    font.setProperty("PointSize", "20");
+    BOOST_CHECK(d_listbox->getTotalItemsHeight() > height * 1.5f);
+
+    d_listbox->resetList();
+    d_listbox->setFont("DejaVuSans-12");
+    mgr.destroy(font);
+}
+
+BOOST_AUTO_TEST_CASE(ItemAtPoint)
+{
+    addItems(100);
+
+    const float itemHeight = d_listbox->getListboxItemFromIndex(0)->getPixelSize().d_height;
+    d_listbox->getVertScrollbar()->setScrollPosition(itemHeight * 50);
+
+    const CEGUI::Rectf area(d_listbox->getListRenderArea());
+    const CEGUI::Vector2f pt(d_listbox->getUnclippedOuterRect().get().getPosition() +
+        CEGUI::Vector2f(area.left() + 5.0f, area.left() + itemHeight * 2.5f));
+
+    BOOST_CHECK_EQUAL(d_listbox->getItemAtPoint(pt), d_listbox->getListboxItemFromIndex(52));
+}
+
+BOOST_AUTO_TEST_CASE(Performance)
+{
+    const size_t itemCounts[] = {1000, 10000, 100000};
+
+    for (int c = 0; c < 3; ++c)
+    {
+        d_listbox->resetList();
+
+        boost::timer timer;
+        addItems(itemCounts[c]);
+        const double adding = timer.elapsed();
+
+        const float total = d_listbox->getTotalItemsHeight();
+        timer.restart();
+        for (int i = 0; i < 100; ++i)
+        {
+            d_listbox->getVertScrollbar()->setScrollPosition(total * i / 100);
+            d_listbox->invalidate();
+            d_listbox->render();
+        }
+        const double rendering = timer.elapsed();
+
+        BOOST_TEST_MESSAGE("Time taken, listbox with " << itemCounts[c] <<
+                           " items: adding: " << adding <<
+                           ", 100 scrolled renders: " << rendering);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,351 @@
+/***********************************************************************
+ *    filename:   MultiColumnList.cpp
+ *    created:    18/10/2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2013 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/widgets/MultiColumnList.h"
+#include "CEGUI/widgets/ListboxTextItem.h"
+#include "CEGUI/widgets/Scrollbar.h"
+#include "CEGUI/System.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/WindowManager.h"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/timer.hpp>
+
+#include <sstream>
+
+/*
+ * ListboxItem whose size is set directly, as a custom item type might be.
+ */
+class SizedItem : public CEGUI::ListboxItem
+{
+public:
+    SizedItem(float height) :
+        CEGUI::ListboxItem("", 0, 0, false, false),
+        d_size(50.0f, height)
+    {}
+
+    CEGUI::Sizef getPixelSize() const { return d_size; }
+
+    void draw(CEGUI::GeometryBuffer&, const CEGUI::Rectf&, float,
+              const CEGUI::Rectf*) const
+    {}
+
+    CEGUI::Sizef d_size;
+};
+
+/*
+ * Brings up a TaharezLook MultiColumnList with eight columns, attached to the
+ * default GUIContext so that it can be rendered.
+ */
+struct MultiColumnListFixture
+{
+    MultiColumnListFixture() :
+        d_context(CEGUI::System::getSingleton().getDefaultGUIContext())
+    {
+        CEGUI::System::getSingleton().notifyDisplaySizeChanged(CEGUI::Sizef(800, 600));
+
+        CEGUI::WindowManager& wmgr = CEGUI::WindowManager::getSingleton();
+        d_root = wmgr.createWindow("DefaultWindow");
+        d_root->setSize(CEGUI::USize(CEGUI::UDim(1, 0), CEGUI::UDim(1, 0)));
+        d_context.setRootWindow(d_root);
+
+        d_list = static_cast<CEGUI::MultiColumnList*>(wmgr.createWindow("TaharezLook/MultiColumnList"));
+        d_list->setSize(CEGUI::USize(CEGUI::UDim(0, 600), CEGUI::UDim(0, 300)));
+        d_list->setFont("DejaVuSans-12");
+        d_root->addChild(d_list);
+
+        for (CEGUI::uint i = 0; i < ColumnCount; ++i)
+        {
+            std::stringstream s;
+            s << "Column " << i;
+            d_list->addColumn(s.str(), i, CEGUI::UDim(0, 70));
+        }
+
+        d_list->setSortDirection(CEGUI::ListHeaderSegment::None);
+    }
+
+    ~MultiColumnListFixture()
+    {
+        d_context.setRootWindow(0);
+        CEGUI::WindowManager::getSingleton().destroyWindow(d_root);
+    }
+
+    //! add rows whose first column is keyed by (row * 7919) % count.
+    void addRows(CEGUI::uint count)
+    {
+        for (CEGUI::uint r = 0; r < count; ++r)
+        {
+            const CEGUI::uint value = (r * 7919) % count;
+
+            std::stringstream s;
+            s << value;
+            CEGUI::ListboxTextItem* item = new CEGUI::ListboxTextItem(s.str());
+            item->setSortKey(value);
+            const CEGUI::uint row = d_list->addRow(item, 0, r);
+
+            for (CEGUI::uint c = 1; c < ColumnCount; ++c)
+            {
+                std::stringstream t;
+                t << "Item " << r << ", " << c;
+                d_list->setItem(new CEGUI::ListboxTextItem(t.str()), c, row);
+            }
+        }
+    }
+
+    static const CEGUI::uint ColumnCount = 8;
+
+    CEGUI::GUIContext& d_context;
+    CEGUI::Window* d_root;
+    CEGUI::MultiColumnList* d_list;
+};
+
+const CEGUI::uint MultiColumnListFixture::ColumnCount;
+
+BOOST_FIXTURE_TEST_SUITE(MultiColumnList, MultiColumnListFixture)
+
+BOOST_AUTO_TEST_CASE(SortKeys)
+{
+    const char* texts[] = {"9", "100", "10", "25"};
+    const double keys[] = {9, 100, 10, 25};
+
+    for (CEGUI::uint i = 0; i < 4; ++i)
+    {
+        CEGUI::ListboxTextItem* item = new CEGUI::ListboxTextItem(texts[i]);
+        item->setSortKey(keys[i]);
+        d_list->addRow(item, 0, i);
+    }
+
+    // keyed items sort numerically rather than by text
+    d_list->setSortColumn(0);
+    d_list->setSortDirection(CEGUI::ListHeaderSegment::Ascending);
+    BOOST_CHECK_EQUAL(d_list->getRowID(0), 0u);
+    BOOST_CHECK_EQUAL(d_list->getRowID(1), 2u);
+    BOOST_CHECK_EQUAL(d_list->getRowID(2), 3u);
+    BOOST_CHECK_EQUAL(d_list->getRowID(3), 1u);
+
+    d_list->setSortDirection(CEGUI::ListHeaderSegment::Descending);
+    BOOST_CHECK_EQUAL(d_list->getRowID(0), 1u);
+    BOOST_CHECK_EQUAL(d_list->getRowID(3), 0u);
+
+    // sorted insertion honours the keys too
+    CEGUI::ListboxTextItem* item = new CEGUI::ListboxTextItem("50");
+    item->setSortKey(50);
+    BOOST_CHECK_EQUAL(d_list->addRow(item, 0, 4), 1u);
+
+    // without keys, the item text is compared
+    for (CEGUI::uint i = 0; i < d_list->getRowCount(); ++i)
+        d_list->getItemAtGridReference(CEGUI::MCLGridRef(i, 0))->clearSortKey();
+    d_list->handleUpdatedItemData();
+    BOOST_CHECK_EQUAL(d_list->getItemAtGridReference(CEGUI::MCLGridRef(0, 0))->getText(), "9");
+    BOOST_CHECK_EQUAL(d_list->getItemAtGridReference(CEGUI::MCLGridRef(4, 0))->getText(), "10");
+}
+
+BOOST_AUTO_TEST_CASE(MixedSortKeys)
+{
+    const char* texts[] = {"b", "30", "a", "20", "c", "10"};
+
+    for (CEGUI::uint i = 0; i < 6; ++i)
+    {
+        CEGUI::ListboxTextItem* item = new CEGUI::ListboxTextItem(texts[i]);
+        if (i % 2)
+            item->setSortKey(CEGUI::PropertyHelper<double>::fromString(texts[i]));
+        d_list->addRow(item, 0, i);
+    }
+
+    // keyed items come first, in key order, then the others by text
+    d_list->setSortColumn(0);
+    d_list->setSortDirection(CEGUI::ListHeaderSegment::Ascending);
+    const char* ascending[] = {"10", "20", "30", "a", "b", "c"};
+    for (CEGUI::uint i = 0; i < 6; ++i)
+        BOOST_CHECK_EQUAL(d_list->getItemAtGridReference(CEGUI::MCLGridRef(i, 0))->getText(), ascending[i]);
+
+    d_list->setSortDirection(CEGUI::ListHeaderSegment::Descending);
+    for (CEGUI::uint i = 0; i < 6; ++i)
+        BOOST_CHECK_EQUAL(d_list->getItemAtGridReference(CEGUI::MCLGridRef(i, 0))->getText(), ascending[5 - i]);
+
+    // sorted insertion agrees with the sort
+    CEGUI::ListboxTextItem* item = new CEGUI::ListboxTextItem("15");
+    item->setSortKey(15);
+    BOOST_CHECK_EQUAL(d_list->addRow(item, 0, 6), 5u);
+}
+
+BOOST_AUTO_TEST_CASE(StableSort)
+{
+    // column 0 has two distinct values, column 1 gives the order within them.
+    for (CEGUI::uint i = 0; i < 6; ++i)
+    {
+        std::stringstream s;
+        s << (5 - i);
+        const CEGUI::uint row = d_list->addRow(new CEGUI::ListboxTextItem(i % 2 ? "b" : "a"), 0, i);
+        d_list->setItem(new CEGUI::ListboxTextItem(s.str()), 1, row);
+    }
+
+    d_list->setSortColumn(1);
+    d_list->setSortDirection(CEGUI::ListHeaderSegment::Ascending);
+    d_list->setSortColumn(0);
+
+    const CEGUI::uint expected[] = {4, 2, 0, 5, 3, 1};
+    for (CEGUI::uint i = 0; i < 6; ++i)
+        BOOST_CHECK_EQUAL(d_list->getRowID(i), expected[i]);
+}
+
+BOOST_AUTO_TEST_CASE(ItemRowIndex)
+{
+    addRows(20);
+
+    CEGUI::ListboxItem* item = d_list->getItemAtGridReference(CEGUI::MCLGridRef(12, 3));
+    BOOST_CHECK_EQUAL(d_list->getItemRowIndex(item), 12u);
+    BOOST_CHECK_EQUAL(d_list->getItemColumnIndex(item), 3u);
+    BOOST_CHECK(d_list->isListboxItemInList(item));
+
+    d_list->removeRow(5);
+    BOOST_CHECK_EQUAL(d_list->getItemRowIndex(item), 11u);
+
+    d_list->insertRow(0, 100);
+    BOOST_CHECK_EQUAL(d_list->getItemRowIndex(item), 12u);
+
+    CEGUI::ListboxTextItem replacement("replacement", 0, 0, false, false);
+    d_list->setItem(&replacement, 3, 12);
+    BOOST_CHECK(!d_list->isListboxItemInList(item));
+    BOOST_CHECK(d_list->getItemGridReference(&replacement) == CEGUI::MCLGridRef(12, 3));
+
+    d_list->setSortColumn(0);
+    d_list->setSortDirection(CEGUI::ListHeaderSegment::Ascending);
+    for (CEGUI::uint i = 0; i < d_list->getRowCount(); ++i)
+    {
+        const CEGUI::ListboxItem* const cell = d_list->getItemAtGridReference(CEGUI::MCLGridRef(i, 7));
+        if (cell)
+            BOOST_CHECK_EQUAL(d_list->getItemRowIndex(cell), i);
+    }
+
+    d_list->setItem(0, 3, d_list->getItemRowIndex(&replacement));
+    BOOST_CHECK(!d_list->isListboxItemInList(&replacement));
+
+    // an item placed in more than one cell stays indexed by its first row
+    CEGUI::ListboxTextItem shared("shared", 0, 0, false, false);
+    d_list->setItem(&shared, 4, 7);
+    d_list->setItem(&shared, 4, 2);
+    BOOST_CHECK_EQUAL(d_list->getItemRowIndex(&shared), 2u);
+
+    // replacing one of its cells must not drop it from the index
+    d_list->setItem(0, 4, 2);
+    BOOST_CHECK(d_list->isListboxItemInList(&shared));
+    BOOST_CHECK_EQUAL(d_list->getItemRowIndex(&shared), 7u);
+
+    d_list->setItem(0, 4, 7);
+    BOOST_CHECK(!d_list->isListboxItemInList(&shared));
+}
+
+BOOST_AUTO_TEST_CASE(CustomItemSize)
+{
+    SizedItem items[2] = {SizedItem(10.0f), SizedItem(10.0f)};
+    d_list->addRow(&items[0], 0);
+    d_list->addRow(&items[1], 0);
+    BOOST_CHECK_CLOSE(d_list->getTotalRowsHeight(), 20.0f, 0.001f);
+
+    items[0].d_size.d_height = 30.0f;
+    items[0].notifySizeChanged();
+    BOOST_CHECK_CLOSE(d_list->getTotalRowsHeight(), 40.0f, 0.001f);
+    BOOST_CHECK_CLOSE(d_list->getRowOffset(1), 30.0f, 0.001f);
+
+    d_list->resetList();
+}
+
+BOOST_AUTO_TEST_CASE(RowExtents)
+{
+    addRows(100);
+
+    const float rowHeight = d_list->getHighestRowItemHeight(0);
+    BOOST_REQUIRE(rowHeight > 0);
+    BOOST_CHECK_CLOSE(d_list->getTotalRowsHeight(), rowHeight * 100, 0.001f);
+    BOOST_CHECK_CLOSE(d_list->getRowOffset(40), rowHeight * 40, 0.001f);
+    BOOST_CHECK_EQUAL(d_list->getRowIndexAtOffset(rowHeight * 40.5f), 40u);
+    BOOST_CHECK_EQUAL(d_list->getRowIndexAtOffset(rowHeight * 100), 100u);
+
+    // a taller item must be reflected in the cached extents
+    d_list->getItemAtGridReference(CEGUI::MCLGridRef(40, 2))->setText("Two\nlines");
+    BOOST_CHECK_CLOSE(d_list->getTotalRowsHeight(), rowHeight * 101, 0.001f);
+    BOOST_CHECK_EQUAL(d_list->getRowIndexAtOffset(rowHeight * 41.5f), 40u);
+    BOOST_CHECK_EQUAL(d_list->getRowIndexAtOffset(rowHeight * 42.5f), 41u);
+
+    // and rows are scrolled into view using the same extents
+    d_list->ensureRowIsVisible(60);
+    const float listHeight = d_list->getListRenderArea().getHeight();
+    BOOST_CHECK_CLOSE(d_list->getVertScrollbar()->getScrollPosition(),
+                      rowHeight * 62 - listHeight, 0.001f);
+}
+
+BOOST_AUTO_TEST_CASE(Performance)
+{
+    const CEGUI::uint rowCounts[] = {1000, 10000, 100000};
+
+    for (int c = 0; c < 3; ++c)
+    {
+        d_list->setSortDirection(CEGUI::ListHeaderSegment::None);
+        d_list->resetList();
+
+        boost::timer timer;
+        addRows(rowCounts[c]);
+        const double adding = timer.elapsed();
+
+        timer.restart();
+        d_list->setSortColumn(0);
+        d_list->setSortDirection(CEGUI::ListHeaderSegment::Ascending);
+        const double keyedSort = timer.elapsed();
+
+        timer.restart();
+        d_list->setSortColumn(1);
+        const double textSort = timer.elapsed();
+
+        timer.restart();
+        for (CEGUI::uint i = 0; i < 1000; ++i)
+        {
+            const CEGUI::MCLGridRef ref((i * 7919) % rowCounts[c], i % ColumnCount);
+            d_list->getItemGridReference(d_list->getItemAtGridReference(ref));
+        }
+        const double lookups = timer.elapsed();
+
+        const float total = d_list->getTotalRowsHeight();
+        timer.restart();
+        for (int i = 0; i < 100; ++i)
+        {
+            d_list->getVertScrollbar()->setScrollPosition(total * i / 100);
+            d_list->invalidate();
+            d_list->render();
+        }
+        const double rendering = timer.elapsed();
+
+        BOOST_TEST_MESSAGE("Time taken, list with " << rowCounts[c] << " rows of " <<
+                           ColumnCount << " columns: adding: " << adding <<
+                           ", keyed sort: " << keyedSort <<
+                           ", text sort: " << textSort <<
+                           ", 1000 item lookups: " << lookups <<
+                           ", 100 scrolled renders: " << rendering);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
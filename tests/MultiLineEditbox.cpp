@@ -0,0 +1,174 @@
+/***********************************************************************
+ *    filename:   MultiLineEditbox.cpp
+ *    created:    18/10/2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2013 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/widgets/MultiLineEditbox.h"
+#include "CEGUI/System.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/WindowManager.h"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/timer.hpp>
+
+#include <sstream>
+
+/*
+ * Brings up a TaharezLook MultiLineEditbox attached to the default GUIContext,
+ * so that it has a font and a text area to format into.
+ */
+struct MultiLineEditboxFixture
+{
+    MultiLineEditboxFixture() :
+        d_context(CEGUI::System::getSingleton().getDefaultGUIContext())
+    {
+        CEGUI::System::getSingleton().notifyDisplaySizeChanged(CEGUI::Sizef(800, 600));
+
+        CEGUI::WindowManager& wmgr = CEGUI::WindowManager::getSingleton();
+        d_root = wmgr.createWindow("DefaultWindow");
+        d_root->setSize(CEGUI::USize(CEGUI::UDim(1, 0), CEGUI::UDim(1, 0)));
+        d_context.setRootWindow(d_root);
+
+        d_editbox = static_cast<CEGUI::MultiLineEditbox*>(wmgr.createWindow("TaharezLook/MultiLineEditbox"));
+        d_editbox->setSize(CEGUI::USize(CEGUI::UDim(0, 300), CEGUI::UDim(0, 200)));
+        d_editbox->setFont("DejaVuSans-12");
+        d_root->addChild(d_editbox);
+    }
+
+    ~MultiLineEditboxFixture()
+    {
+        d_context.setRootWindow(0);
+        CEGUI::WindowManager::getSingleton().destroyWindow(d_root);
+    }
+
+    //! check the current lines are what a full formatting pass produces.
+    void checkLinesMatchFullFormat()
+    {
+        const CEGUI::MultiLineEditbox::LineList lines(d_editbox->getFormattedLines());
+        d_editbox->formatText(false);
+        const CEGUI::MultiLineEditbox::LineList& expected = d_editbox->getFormattedLines();
+
+        BOOST_REQUIRE_EQUAL(lines.size(), expected.size());
+        for (size_t i = 0; i < lines.size(); ++i)
+        {
+            BOOST_CHECK_EQUAL(lines[i].d_startIdx, expected[i].d_startIdx);
+            BOOST_CHECK_EQUAL(lines[i].d_length, expected[i].d_length);
+            BOOST_CHECK_EQUAL(lines[i].d_extent, expected[i].d_extent);
+        }
+    }
+
+    CEGUI::GUIContext& d_context;
+    CEGUI::Window* d_root;
+    CEGUI::MultiLineEditbox* d_editbox;
+};
+
+BOOST_FIXTURE_TEST_SUITE(MultiLineEditbox, MultiLineEditboxFixture)
+
+BOOST_AUTO_TEST_CASE(IncrementalFormatting)
+{
+    d_editbox->setText("First paragraph, which is long enough that it needs to be "
+                       "wrapped across a few lines of the edit box.\nSecond.\n");
+    checkLinesMatchFullFormat();
+
+    d_editbox->appendText("Appended line\n");
+    BOOST_CHECK_EQUAL(d_editbox->getText().substr(d_editbox->getText().length() - 14),
+                      "Appended line\n");
+    checkLinesMatchFullFormat();
+
+    // appended text without a line break still gets the terminating one
+    d_editbox->appendText("no break");
+    BOOST_CHECK_EQUAL(d_editbox->getText()[d_editbox->getText().length() - 1], '\n');
+    checkLinesMatchFullFormat();
+
+    // splitting a wrapped paragraph
+    d_editbox->insertText(" words\nand a break ", 30);
+    checkLinesMatchFullFormat();
+
+    // typing, deleting and joining paragraphs through the keyboard
+    d_editbox->activate();
+    d_editbox->setCaretIndex(12);
+    d_context.injectChar('x');
+    d_context.injectChar('y');
+    d_context.injectKeyDown(CEGUI::Key::Return);
+    checkLinesMatchFullFormat();
+    d_context.injectKeyDown(CEGUI::Key::Backspace);
+    d_context.injectKeyDown(CEGUI::Key::Backspace);
+    checkLinesMatchFullFormat();
+
+    d_editbox->setCaretIndex(d_editbox->getText().find('\n'));
+    d_context.injectKeyDown(CEGUI::Key::Delete);
+    checkLinesMatchFullFormat();
+
+    d_editbox->setSelection(5, 40);
+    d_context.injectChar('z');
+    checkLinesMatchFullFormat();
+
+    // edits before, after and between earlier ones whose line moves have not
+    // been handed out yet.
+    d_editbox->setText("One\nTwo\nThree\nFour\nFive\nSix\n");
+    d_editbox->insertText("ab", 10);
+    d_editbox->insertText("cd\nef", 2);
+    d_editbox->insertText("gh", 27);
+    d_editbox->insertText("ij", 19);
+    BOOST_CHECK_EQUAL(d_editbox->getLineNumberFromIndex(21), 3u);
+    checkLinesMatchFullFormat();
+
+    // a token too long for a line is broken across several.
+    d_editbox->appendText(CEGUI::String(500, 'w') + " end\n");
+    checkLinesMatchFullFormat();
+
+    BOOST_CHECK_EQUAL(d_editbox->getLineNumberFromIndex(0), 0u);
+    const CEGUI::MultiLineEditbox::LineList& lines = d_editbox->getFormattedLines();
+    BOOST_CHECK_EQUAL(d_editbox->getLineNumberFromIndex(lines[2].d_startIdx), 2u);
+    BOOST_CHECK_EQUAL(d_editbox->getLineNumberFromIndex(lines[2].d_startIdx - 1), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(Performance)
+{
+    boost::timer timer;
+    for (int i = 0; i < 100000; ++i)
+    {
+        std::stringstream s;
+        s << "Log line " << i << ": the quick brown fox jumps over the lazy dog\n";
+        d_editbox->appendText(s.str());
+    }
+    const double appending = timer.elapsed();
+
+    BOOST_CHECK(d_editbox->getFormattedLines().size() >= 100000);
+
+    timer.restart();
+    d_editbox->activate();
+    d_editbox->setCaretIndex(d_editbox->getText().length() / 2);
+    for (int i = 0; i < 1000; ++i)
+        d_context.injectChar('a' + i % 26);
+    const double typing = timer.elapsed();
+
+    checkLinesMatchFullFormat();
+
+    BOOST_TEST_MESSAGE("Time taken, multi-line editbox: appending 100000 lines: " <<
+                       appending << ", typing 1000 characters mid text: " << typing);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -29,6 +29,45 @@
 #include "CEGUI/PropertyHelper.h"
 
 #include <boost/test/unit_test.hpp>
+#include <boost/timer.hpp>
+
+#include <clocale>
+#include <cstdio>
+#include <limits>
+
+#ifdef _MSC_VER
+#define snprintf _snprintf
+#endif
+
+namespace
+{
+// time 'count' calls of toString and fromString for the given value.
+template<typename T>
+void timeConversions(const T& value, int count,
+                     double& to_string, double& from_string)
+{
+    const CEGUI::String str(CEGUI::PropertyHelper<T>::toString(value));
+
+    boost::timer timer;
+    for (int i = 0; i < count; ++i)
+        CEGUI::PropertyHelper<T>::toString(value);
+    to_string = timer.elapsed();
+
+    timer.restart();
+    for (int i = 0; i < count; ++i)
+        CEGUI::PropertyHelper<T>::fromString(str);
+    from_string = timer.elapsed();
+}
+
+void reportConversions(const char* name, double to_string, double from_string,
+                       double printf_to_string, double scanf_from_string)
+{
+    BOOST_TEST_MESSAGE(name << ": toString " << to_string * 1000.0 <<
+        "ms (snprintf " << printf_to_string * 1000.0 << "ms), fromString " <<
+        from_string * 1000.0 << "ms (sscanf " << scanf_from_string * 1000.0 <<
+        "ms)");
+}
+}
 
 BOOST_AUTO_TEST_SUITE(PropertyHelper)
 
@@ -83,4 +122,240 @@ BOOST_AUTO_TEST_CASE(Double)
     BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<double>::fromString("-123.1"), -123.1);
 }
 
+BOOST_AUTO_TEST_CASE(Unsigned)
+{
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<CEGUI::uint>::toString(4294967295u), "4294967295");
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<CEGUI::uint64>::toString(18446744073709551615ull), "18446744073709551615");
+
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<CEGUI::uint>::fromString(" 4294967295"), 4294967295u);
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<CEGUI::uint64>::fromString("18446744073709551615"), 18446744073709551615ull);
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<CEGUI::uint>::fromString("nonsense"), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(RealFormatting)
+{
+    // the shortest string that reads back as the same value is used...
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<float>::toString(0.1f), "0.1");
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<float>::toString(1.2345678f), "1.2345678");
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<double>::toString(0.1), "0.1");
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<double>::toString(1.0 / 3.0), "0.3333333333333333");
+
+    // ...in the layout "%g" would use for that many digits.
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<float>::toString(1e6f), "1e+06");
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<float>::toString(1234567.0f), "1234567");
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<float>::toString(0.0001f), "0.0001");
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<float>::toString(0.00001f), "1e-05");
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<float>::toString(-2.5e-7f), "-2.5e-07");
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<double>::toString(1e100), "1e+100");
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<double>::toString(
+        std::numeric_limits<double>::infinity()), "inf");
+}
+
+BOOST_AUTO_TEST_CASE(RealRoundTrip)
+{
+    const float floats[] =
+    {
+        0.1f, 1e-7f, 3.4e38f, 1.17549435e-38f, 16777216.0f, 0.3f, 123.456f,
+        -987654.3f, 1.0f / 3.0f, 2.0f / 3.0f, 1e-45f
+    };
+    for (size_t i = 0; i < sizeof(floats) / sizeof(floats[0]); ++i)
+    {
+        const CEGUI::String str(CEGUI::PropertyHelper<float>::toString(floats[i]));
+        BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<float>::fromString(str), floats[i]);
+    }
+
+    const double doubles[] =
+    {
+        0.1, 1e-7, 1.7976931348623157e308, 2.2250738585072014e-308,
+        16777217.0, 9007199254740993.0, 1.0 / 3.0, 123456.789e-200, 5e-324
+    };
+    for (size_t i = 0; i < sizeof(doubles) / sizeof(doubles[0]); ++i)
+    {
+        const CEGUI::String str(CEGUI::PropertyHelper<double>::toString(doubles[i]));
+        BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<double>::fromString(str), doubles[i]);
+    }
+
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<double>::fromString(
+        "3.14159265358979323846264338327950288419716939937510582097494459"), 3.14159265358979323846);
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<float>::fromString("1E+2"), 100.0f);
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<float>::fromString(".5e"), 0.5f);
+}
+
+BOOST_AUTO_TEST_CASE(Composite)
+{
+    const CEGUI::URect rect(CEGUI::UDim(0.25f, 10), CEGUI::UDim(0, -5.5f),
+                            CEGUI::UDim(1, 0), CEGUI::UDim(0.1f, 1e6f));
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<CEGUI::URect>::toString(rect),
+                      "{{0.25,10},{0,-5.5},{1,0},{0.1,1e+06}}");
+    BOOST_CHECK(CEGUI::PropertyHelper<CEGUI::URect>::fromString(
+                " { {0.25 ,10},{ 0,-5.5 } , {1,0},{0.1,1e+06} }") == rect);
+
+    BOOST_CHECK(CEGUI::PropertyHelper<CEGUI::UDim>::fromString("{0.5,2}") ==
+                CEGUI::UDim(0.5f, 2));
+    // fields after a mismatch keep their defaults, as they did with sscanf.
+    BOOST_CHECK(CEGUI::PropertyHelper<CEGUI::Sizef>::fromString("w:1.5 x:2") ==
+                CEGUI::Sizef(1.5f, 0));
+
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<CEGUI::Sizef>::toString(CEGUI::Sizef(1.5f, 2)),
+                      "w:1.5 h:2");
+    BOOST_CHECK(CEGUI::PropertyHelper<CEGUI::Rectf>::fromString("l:1 t:2 r:3 b:4") ==
+                CEGUI::Rectf(1, 2, 3, 4));
+
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<CEGUI::Colour>::toString(CEGUI::Colour(0xFF00A0c0)),
+                      "FF00A0C0");
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<CEGUI::Colour>::fromString(" 7f00a0C0").getARGB(),
+                      0x7F00A0C0u);
+
+    const CEGUI::ColourRect colours(CEGUI::Colour(0xFF000001), CEGUI::Colour(0xFF000002),
+                                    CEGUI::Colour(0xFF000003), CEGUI::Colour(0xFF000004));
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<CEGUI::ColourRect>::toString(colours),
+                      "tl:FF000001 tr:FF000002 bl:FF000003 br:FF000004");
+    const CEGUI::ColourRect parsed(
+        CEGUI::PropertyHelper<CEGUI::ColourRect>::fromString(
+            "tl:FF000001 tr:FF000002 bl:FF000003 br:FF000004"));
+    BOOST_CHECK_EQUAL(parsed.d_bottom_right.getARGB(), 0xFF000004u);
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<CEGUI::ColourRect>::fromString(
+        "80FFFFFF").d_top_right.getARGB(), 0x80FFFFFFu);
+}
+
+// conversions that must give the same results whatever the C locale is
+static void checkLocaleIndependentConversions()
+{
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<float>::toString(123.1f), "123.1");
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<float>::fromString("123.1"), 123.1f);
+    BOOST_CHECK_EQUAL(CEGUI::PropertyHelper<double>::fromString(
+        "0.12345678901234567890123"), 0.12345678901234567890123);
+
+    const CEGUI::USize size(CEGUI::UDim(0.5f, -1.25f), CEGUI::UDim(1e-3f, 2.5f));
+    BOOST_CHECK(CEGUI::PropertyHelper<CEGUI::USize>::fromString(
+        CEGUI::PropertyHelper<CEGUI::USize>::toString(size)) == size);
+
+    const CEGUI::Sizef sizef(0.75f, 1024.5f);
+    BOOST_CHECK(CEGUI::PropertyHelper<CEGUI::Sizef>::fromString(
+        CEGUI::PropertyHelper<CEGUI::Sizef>::toString(sizef)) == sizef);
+}
+
+BOOST_AUTO_TEST_CASE(LocaleIndependence)
+{
+    checkLocaleIndependentConversions();
+
+    const char* locales[] = { "de_DE.UTF-8", "de_DE", "fr_FR.UTF-8", "German" };
+    const char* found = 0;
+    for (size_t i = 0; i < sizeof(locales) / sizeof(locales[0]) && !found; ++i)
+        found = std::setlocale(LC_NUMERIC, locales[i]) ? locales[i] : 0;
+
+    if (!found)
+    {
+        BOOST_TEST_MESSAGE("no locale with a ',' decimal separator is available, "
+                           "conversions only checked under the C locale");
+        return;
+    }
+
+    BOOST_TEST_MESSAGE("checking conversions under the " << found << " locale");
+    checkLocaleIndependentConversions();
+
+    std::setlocale(LC_NUMERIC, "C");
+}
+
+BOOST_AUTO_TEST_CASE(Performance)
+{
+    const int count = 100000;
+    double to_string, from_string;
+    char buff[128];
+
+    // float
+    timeConversions(123.456f, count, to_string, from_string);
+    {
+        const CEGUI::String str("123.456");
+        float val;
+
+        boost::timer timer;
+        for (int i = 0; i < count; ++i)
+        {
+            snprintf(buff, sizeof(buff), "%g", 123.456f);
+            CEGUI::String result(buff);
+        }
+        const double printf_time = timer.elapsed();
+
+        timer.restart();
+        for (int i = 0; i < count; ++i)
+            sscanf(str.c_str(), " %g", &val);
+
+        reportConversions("float", to_string, from_string, printf_time, timer.elapsed());
+    }
+
+    // int
+    timeConversions(-1234567, count, to_string, from_string);
+    {
+        const CEGUI::String str("-1234567");
+        int val;
+
+        boost::timer timer;
+        for (int i = 0; i < count; ++i)
+        {
+            snprintf(buff, sizeof(buff), "%d", -1234567);
+            CEGUI::String result(buff);
+        }
+        const double printf_time = timer.elapsed();
+
+        timer.restart();
+        for (int i = 0; i < count; ++i)
+            sscanf(str.c_str(), " %d", &val);
+
+        reportConversions("int", to_string, from_string, printf_time, timer.elapsed());
+    }
+
+    // URect
+    const CEGUI::URect rect(CEGUI::UDim(0.25f, 10), CEGUI::UDim(0, 5.5f),
+                            CEGUI::UDim(1, -10), CEGUI::UDim(0.75f, 0));
+    timeConversions(rect, count, to_string, from_string);
+    {
+        const CEGUI::String str("{{0.25,10},{0,5.5},{1,-10},{0.75,0}}");
+        CEGUI::URect val;
+
+        boost::timer timer;
+        for (int i = 0; i < count; ++i)
+        {
+            snprintf(buff, sizeof(buff), "{{%g,%g},{%g,%g},{%g,%g},{%g,%g}}",
+                     0.25f, 10.0f, 0.0f, 5.5f, 1.0f, -10.0f, 0.75f, 0.0f);
+            CEGUI::String result(buff);
+        }
+        const double printf_time = timer.elapsed();
+
+        timer.restart();
+        for (int i = 0; i < count; ++i)
+            sscanf(str.c_str(), " { { %g , %g } , { %g , %g } , { %g , %g } , { %g , %g } }",
+                   &val.d_min.d_x.d_scale, &val.d_min.d_x.d_offset,
+                   &val.d_min.d_y.d_scale, &val.d_min.d_y.d_offset,
+                   &val.d_max.d_x.d_scale, &val.d_max.d_x.d_offset,
+                   &val.d_max.d_y.d_scale, &val.d_max.d_y.d_offset);
+
+        reportConversions("URect", to_string, from_string, printf_time, timer.elapsed());
+    }
+
+    // ColourRect
+    const CEGUI::ColourRect colours(CEGUI::Colour(0xFF102030), CEGUI::Colour(0xFF405060),
+                                    CEGUI::Colour(0xFF708090), CEGUI::Colour(0xFFA0B0C0));
+    timeConversions(colours, count, to_string, from_string);
+    {
+        const CEGUI::String str("tl:FF102030 tr:FF405060 bl:FF708090 br:FFA0B0C0");
+        unsigned int tl, tr, bl, br;
+
+        boost::timer timer;
+        for (int i = 0; i < count; ++i)
+        {
+            snprintf(buff, sizeof(buff), "tl:%.8X tr:%.8X bl:%.8X br:%.8X",
+                     0xFF102030, 0xFF405060, 0xFF708090, 0xFFA0B0C0);
+            CEGUI::String result(buff);
+        }
+        const double printf_time = timer.elapsed();
+
+        timer.restart();
+        for (int i = 0; i < count; ++i)
+            sscanf(str.c_str(), "tl:%8X tr:%8X bl:%8X br:%8X", &tl, &tr, &bl, &br);
+
+        reportConversions("ColourRect", to_string, from_string, printf_time, timer.elapsed());
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
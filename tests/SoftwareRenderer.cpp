@@ -0,0 +1,370 @@
+/***********************************************************************
+ *    filename:   SoftwareRenderer.cpp
+ *    created:    Sun Oct 18 2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2013 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/ModuleConfig.h"
+
+#ifdef CEGUI_BUILD_RENDERER_SOFTWARE
+
+#include "CEGUI/RendererModules/Software/Renderer.h"
+#include "CEGUI/RendererModules/Software/Texture.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/RenderTarget.h"
+#include "CEGUI/TextureTarget.h"
+#include "CEGUI/Vertex.h"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/timer.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+namespace
+{
+//! build the two triangles of a quad covering \a area.
+void appendQuad(CEGUI::GeometryBuffer& buffer, const CEGUI::Rectf& area,
+                const CEGUI::Colour& colour,
+                const CEGUI::Rectf& uv = CEGUI::Rectf(0, 0, 1, 1))
+{
+    CEGUI::Vertex v[6];
+    v[0].position = CEGUI::Vector3f(area.left(), area.top(), 0);
+    v[0].tex_coords = CEGUI::Vector2f(uv.left(), uv.top());
+    v[1].position = CEGUI::Vector3f(area.left(), area.bottom(), 0);
+    v[1].tex_coords = CEGUI::Vector2f(uv.left(), uv.bottom());
+    v[2].position = CEGUI::Vector3f(area.right(), area.bottom(), 0);
+    v[2].tex_coords = CEGUI::Vector2f(uv.right(), uv.bottom());
+    v[3].position = CEGUI::Vector3f(area.right(), area.top(), 0);
+    v[3].tex_coords = CEGUI::Vector2f(uv.right(), uv.top());
+    v[4] = v[0];
+    v[5] = v[2];
+
+    for (int i = 0; i < 6; ++i)
+        v[i].colour_val = colour;
+
+    buffer.appendGeometry(v, 6);
+}
+
+//! count the pixels of \a texture within \a area that have the value \a colour.
+size_t countPixels(const CEGUI::SoftwareTexture& texture,
+                   const CEGUI::Rectf& area, CEGUI::argb_t colour)
+{
+    size_t count = 0;
+    const CEGUI::argb_t* pixels = texture.getPixelData();
+    for (int y = static_cast<int>(area.top()); y < area.bottom(); ++y)
+        for (int x = static_cast<int>(area.left()); x < area.right(); ++x)
+            if (pixels[y * texture.getPixelWidth() + x] == colour)
+                ++count;
+
+    return count;
+}
+
+struct SoftwareRendererFixture
+{
+    SoftwareRendererFixture() :
+        d_renderer(CEGUI::SoftwareRenderer::create(CEGUI::Sizef(64, 64)))
+    {
+        d_renderer.beginRendering();
+        d_renderer.getDefaultRenderTarget().activate();
+    }
+
+    ~SoftwareRendererFixture()
+    {
+        d_renderer.endRendering();
+        CEGUI::SoftwareRenderer::destroy(d_renderer);
+    }
+
+    CEGUI::SoftwareTexture& display()
+    {
+        return d_renderer.getDisplayTexture();
+    }
+
+    CEGUI::SoftwareRenderer& d_renderer;
+};
+
+}
+
+BOOST_FIXTURE_TEST_SUITE(SoftwareRenderer, SoftwareRendererFixture)
+
+BOOST_AUTO_TEST_CASE(SolidQuad)
+{
+    CEGUI::GeometryBuffer& buffer = d_renderer.createGeometryBuffer();
+    buffer.setClippingActive(false);
+    appendQuad(buffer, CEGUI::Rectf(8, 8, 24, 20), CEGUI::Colour(0xFFFF0000));
+    buffer.draw();
+
+    BOOST_CHECK_EQUAL(countPixels(display(), CEGUI::Rectf(0, 0, 64, 64),
+                                  0xFFFF0000), 16u * 12u);
+    BOOST_CHECK_EQUAL(countPixels(display(), CEGUI::Rectf(8, 8, 24, 20),
+                                  0xFFFF0000), 16u * 12u);
+    BOOST_CHECK_EQUAL(d_renderer.getRasterisedTriangleCount(), 2u);
+    BOOST_CHECK_EQUAL(d_renderer.getFilledPixelCount(), 16u * 12u);
+
+    // a translucent quad must not be blended twice along the shared diagonal.
+    buffer.reset();
+    display().fill(CEGUI::Rectf(0, 0, 64, 64), 0);
+    appendQuad(buffer, CEGUI::Rectf(8.3f, 8.7f, 23.6f, 19.2f),
+               CEGUI::Colour(0x80FFFFFF));
+    buffer.draw();
+
+    const CEGUI::argb_t reference =
+        display().getPixelData()[10 * 64 + 20];
+    BOOST_CHECK(reference != 0);
+    BOOST_CHECK_EQUAL(countPixels(display(), CEGUI::Rectf(0, 0, 64, 64),
+                                  reference), 16u * 10u);
+
+    d_renderer.destroyGeometryBuffer(buffer);
+}
+
+BOOST_AUTO_TEST_CASE(Clipping)
+{
+    CEGUI::GeometryBuffer& buffer = d_renderer.createGeometryBuffer();
+    buffer.setClippingRegion(CEGUI::Rectf(10, 10, 20, 15));
+    appendQuad(buffer, CEGUI::Rectf(0, 0, 64, 64), CEGUI::Colour(0xFF00FF00));
+    buffer.draw();
+
+    BOOST_CHECK_EQUAL(countPixels(display(), CEGUI::Rectf(0, 0, 64, 64),
+                                  0xFF00FF00), 10u * 5u);
+    BOOST_CHECK_EQUAL(countPixels(display(), CEGUI::Rectf(10, 10, 20, 15),
+                                  0xFF00FF00), 10u * 5u);
+
+    d_renderer.destroyGeometryBuffer(buffer);
+}
+
+BOOST_AUTO_TEST_CASE(AlphaBlending)
+{
+    display().fill(CEGUI::Rectf(0, 0, 64, 64), 0xFFFFFFFF);
+
+    CEGUI::GeometryBuffer& buffer = d_renderer.createGeometryBuffer();
+    buffer.setClippingActive(false);
+    appendQuad(buffer, CEGUI::Rectf(0, 0, 32, 32),
+               CEGUI::Colour(1.0f, 0.0f, 0.0f, 0.5f));
+    buffer.draw();
+
+    // 0.5 alpha is 128 after conversion, so white keeps 127 of its 255.
+    BOOST_CHECK_EQUAL(display().getPixelData()[5 * 64 + 5], 0xFFFF7F7Fu);
+    BOOST_CHECK_EQUAL(display().getPixelData()[40 * 64 + 40], 0xFFFFFFFFu);
+
+    // premultiplied blending adds the source to the attenuated destination.
+    buffer.reset();
+    buffer.setBlendMode(CEGUI::BM_RTT_PREMULTIPLIED);
+    appendQuad(buffer, CEGUI::Rectf(32, 32, 64, 64),
+               CEGUI::Colour(0.0f, 0.0f, 0.5f, 0.5f));
+    buffer.draw();
+
+    BOOST_CHECK_EQUAL(display().getPixelData()[40 * 64 + 40], 0xFF7F7FFFu);
+
+    d_renderer.destroyGeometryBuffer(buffer);
+}
+
+BOOST_AUTO_TEST_CASE(TexturedQuad)
+{
+    std::vector<CEGUI::argb_t> source(16 * 16);
+    for (size_t i = 0; i < source.size(); ++i)
+        source[i] = 0xFF000000 | static_cast<CEGUI::argb_t>(i * 0x010203);
+
+    // loadFromMemory takes RGBA bytes, so build them from the ARGB values.
+    std::vector<CEGUI::uint8> rgba(source.size() * 4);
+    for (size_t i = 0; i < source.size(); ++i)
+    {
+        rgba[i * 4] = static_cast<CEGUI::uint8>(source[i] >> 16);
+        rgba[i * 4 + 1] = static_cast<CEGUI::uint8>(source[i] >> 8);
+        rgba[i * 4 + 2] = static_cast<CEGUI::uint8>(source[i]);
+        rgba[i * 4 + 3] = static_cast<CEGUI::uint8>(source[i] >> 24);
+    }
+
+    CEGUI::Texture& texture = d_renderer.createTexture("tex",
+        CEGUI::Sizef(16, 16));
+    texture.loadFromMemory(&rgba[0], CEGUI::Sizef(16, 16),
+                           CEGUI::Texture::PF_RGBA);
+
+    CEGUI::GeometryBuffer& buffer = d_renderer.createGeometryBuffer();
+    buffer.setClippingActive(false);
+    buffer.setActiveTexture(&texture);
+    appendQuad(buffer, CEGUI::Rectf(4, 4, 20, 20), CEGUI::Colour(0xFFFFFFFF));
+    buffer.draw();
+
+    const CEGUI::argb_t* pixels = display().getPixelData();
+    size_t mismatches = 0;
+    for (int y = 0; y < 16; ++y)
+        for (int x = 0; x < 16; ++x)
+            if (pixels[(y + 4) * 64 + x + 4] != source[y * 16 + x])
+                ++mismatches;
+
+    BOOST_CHECK_EQUAL(mismatches, 0u);
+
+    // magnified drawing samples with filtering but stays within the source.
+    buffer.reset();
+    buffer.setActiveTexture(&texture);
+    appendQuad(buffer, CEGUI::Rectf(24, 24, 56, 56), CEGUI::Colour(0xFFFFFFFF));
+    buffer.draw();
+
+    BOOST_CHECK_EQUAL(pixels[24 * 64 + 24], source[0]);
+    BOOST_CHECK_EQUAL(pixels[55 * 64 + 55], source[255]);
+
+    d_renderer.destroyGeometryBuffer(buffer);
+    d_renderer.destroyTexture(texture);
+}
+
+BOOST_AUTO_TEST_CASE(TextureTargetRendering)
+{
+    CEGUI::TextureTarget* target = d_renderer.createTextureTarget();
+    target->declareRenderSize(CEGUI::Sizef(32, 32));
+    target->clear();
+
+    CEGUI::GeometryBuffer& buffer = d_renderer.createGeometryBuffer();
+    buffer.setClippingActive(false);
+    appendQuad(buffer, CEGUI::Rectf(0, 0, 16, 16), CEGUI::Colour(0xFF0000FF));
+
+    target->activate();
+    target->draw(buffer);
+    target->deactivate();
+
+    const CEGUI::SoftwareTexture& texture =
+        static_cast<CEGUI::SoftwareTexture&>(target->getTexture());
+    BOOST_CHECK_EQUAL(countPixels(texture, CEGUI::Rectf(0, 0, 32, 32),
+                                  0xFF0000FF), 16u * 16u);
+    BOOST_CHECK_EQUAL(countPixels(display(), CEGUI::Rectf(0, 0, 64, 64), 0),
+                      64u * 64u);
+
+    d_renderer.destroyGeometryBuffer(buffer);
+    d_renderer.destroyTextureTarget(target);
+}
+
+BOOST_AUTO_TEST_CASE(MemoryRoundTrip)
+{
+    CEGUI::Texture& texture = d_renderer.createTexture("round_trip");
+
+    std::vector<CEGUI::uint8> rgba(8 * 4 * 4);
+    for (size_t i = 0; i < rgba.size(); ++i)
+        rgba[i] = static_cast<CEGUI::uint8>(i * 7);
+
+    texture.loadFromMemory(&rgba[0], CEGUI::Sizef(8, 4),
+                           CEGUI::Texture::PF_RGBA);
+    BOOST_CHECK_EQUAL(texture.getSize(), CEGUI::Sizef(8, 4));
+
+    std::vector<CEGUI::uint8> out(rgba.size());
+    texture.blitToMemory(&out[0]);
+    BOOST_CHECK(out == rgba);
+
+    std::vector<CEGUI::uint16> rgb565(8 * 4);
+    for (size_t i = 0; i < rgb565.size(); ++i)
+        rgb565[i] = static_cast<CEGUI::uint16>(i * 2113);
+
+    texture.loadFromMemory(&rgb565[0], CEGUI::Sizef(8, 4),
+                           CEGUI::Texture::PF_RGB_565);
+    std::vector<CEGUI::uint16> out565(rgb565.size());
+    texture.blitToMemory(&out565[0]);
+    BOOST_CHECK(out565 == rgb565);
+
+    BOOST_CHECK(!texture.isPixelFormatSupported(CEGUI::Texture::PF_PVRTC2));
+    BOOST_CHECK_THROW(texture.loadFromMemory(&rgba[0], CEGUI::Sizef(8, 4),
+                                             CEGUI::Texture::PF_PVRTC2),
+                      CEGUI::InvalidRequestException);
+
+    d_renderer.destroyTexture(texture);
+}
+
+BOOST_AUTO_TEST_CASE(SaveToPNG)
+{
+    display().fill(CEGUI::Rectf(0, 0, 32, 64), 0xFF336699);
+
+    const char* const filename = "SoftwareRendererTest.png";
+    d_renderer.saveDisplayToPNG(filename);
+
+    std::ifstream file(filename, std::ios::in | std::ios::binary);
+    BOOST_REQUIRE(file);
+
+    char signature[8];
+    file.read(signature, 8);
+    BOOST_CHECK(std::string(signature + 1, 3) == "PNG");
+
+    // 64 rows of filter byte plus pixels, stored uncompressed.
+    file.seekg(0, std::ios::end);
+    BOOST_CHECK(static_cast<size_t>(file.tellg()) > 64u * (1 + 64 * 4));
+
+    file.close();
+    std::remove(filename);
+}
+
+BOOST_AUTO_TEST_CASE(Performance)
+{
+    d_renderer.setDisplaySize(CEGUI::Sizef(1280, 720));
+
+    std::vector<CEGUI::uint8> rgba(64 * 64 * 4);
+    for (size_t i = 0; i < rgba.size(); ++i)
+        rgba[i] = static_cast<CEGUI::uint8>(i % 4 == 3 ? 200 : i);
+
+    CEGUI::Texture& texture = d_renderer.createTexture("perf");
+    texture.loadFromMemory(&rgba[0], CEGUI::Sizef(64, 64),
+                           CEGUI::Texture::PF_RGBA);
+
+    // a window-like scene: an opaque backdrop, translucent panels with a 1:1
+    // textured frame and scaled textured content.
+    CEGUI::GeometryBuffer& buffer = d_renderer.createGeometryBuffer();
+    buffer.setClippingRegion(CEGUI::Rectf(0, 0, 1280, 720));
+    appendQuad(buffer, CEGUI::Rectf(0, 0, 1280, 720), CEGUI::Colour(0xFF202020));
+    buffer.setActiveTexture(&texture);
+    for (int i = 0; i < 40; ++i)
+    {
+        const float x = static_cast<float>((i * 97) % 1000);
+        const float y = static_cast<float>((i * 53) % 500);
+        appendQuad(buffer, CEGUI::Rectf(x, y, x + 64, y + 64),
+                   CEGUI::Colour(0xFFFFFFFF));
+        appendQuad(buffer, CEGUI::Rectf(x + 10, y + 70, x + 250, y + 200),
+                   CEGUI::Colour(0xC0FFFFFF));
+    }
+
+    const int frames = 50;
+    boost::timer timer;
+    size_t pixels = 0;
+    float overdraw = 0;
+    for (int frame = 0; frame < frames; ++frame)
+    {
+        d_renderer.beginRendering();
+        d_renderer.getDefaultRenderTarget().activate();
+        buffer.draw();
+        d_renderer.endRendering();
+
+        pixels += d_renderer.getFilledPixelCount();
+        overdraw = d_renderer.getOverdraw();
+    }
+    const double elapsed = timer.elapsed();
+
+    BOOST_CHECK(pixels > 0);
+    BOOST_TEST_MESSAGE("1280x720 software frame: " <<
+        elapsed * 1000.0 / frames << "ms, " <<
+        pixels / (elapsed > 0 ? elapsed : 1) / 1e6 << " Mpix/s, overdraw " <<
+        overdraw);
+
+    d_renderer.destroyGeometryBuffer(buffer);
+    d_renderer.destroyTexture(texture);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
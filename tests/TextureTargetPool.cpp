@@ -0,0 +1,170 @@
+/***********************************************************************
+ *    filename:   TextureTargetPool.cpp
+ *    created:    Sun Oct 18 2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2013 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/System.h"
+#include "CEGUI/TextureTarget.h"
+#include "CEGUI/TextureTargetPool.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/RenderingWindow.h"
+
+#include <boost/test/unit_test.hpp>
+
+/*
+ * Gives each test an empty pool, and restores the default budget afterwards.
+ */
+struct TextureTargetPoolFixture
+{
+    TextureTargetPoolFixture() :
+        d_pool(CEGUI::System::getSingleton().getTextureTargetPool())
+    {
+        d_pool.destroyIdleTargets();
+    }
+
+    ~TextureTargetPoolFixture()
+    {
+        d_pool.setIdleBudget(CEGUI::TextureTargetPool::DEFAULT_IDLE_BUDGET);
+        d_pool.destroyIdleTargets();
+    }
+
+    CEGUI::TextureTargetPool& d_pool;
+};
+
+BOOST_FIXTURE_TEST_SUITE(TextureTargetPool, TextureTargetPoolFixture)
+
+BOOST_AUTO_TEST_CASE(AcquireAndRelease)
+{
+    const size_t bytes_in_use = d_pool.getTextureBytesInUse();
+
+    CEGUI::TextureTarget* const target = d_pool.acquire(CEGUI::Sizef(100, 50));
+    BOOST_REQUIRE(target);
+    BOOST_CHECK(d_pool.isAcquired(*target));
+    BOOST_CHECK(target->getArea().getSize() == CEGUI::Sizef(128, 64));
+    BOOST_CHECK_EQUAL(d_pool.getTextureBytesInUse() - bytes_in_use, 128u * 64u * 4u);
+
+    d_pool.release(target);
+    BOOST_CHECK(!d_pool.isAcquired(*target));
+    BOOST_CHECK_EQUAL(d_pool.getTextureBytesInUse(), bytes_in_use);
+    BOOST_CHECK_EQUAL(d_pool.getIdleTargetCount(), 1u);
+    BOOST_CHECK_EQUAL(d_pool.getIdleTextureBytes(), 128u * 64u * 4u);
+
+    // a similar size reuses the idle target...
+    CEGUI::TextureTarget* const reused = d_pool.acquire(CEGUI::Sizef(120, 60));
+    BOOST_CHECK_EQUAL(reused, target);
+    BOOST_CHECK_EQUAL(d_pool.getIdleTargetCount(), 0u);
+
+    // ...but a much smaller one does not tie up a large texture.
+    d_pool.release(reused);
+    d_pool.destroyIdleTargets();
+    CEGUI::TextureTarget* const large = d_pool.acquire(CEGUI::Sizef(600, 600));
+    d_pool.release(large);
+    CEGUI::TextureTarget* const small = d_pool.acquire(CEGUI::Sizef(10, 10));
+    BOOST_CHECK(small != large);
+    BOOST_CHECK(small->getArea().getSize() == CEGUI::Sizef(64, 64));
+    BOOST_CHECK_EQUAL(d_pool.getIdleTargetCount(), 1u);
+
+    d_pool.release(small);
+}
+
+BOOST_AUTO_TEST_CASE(Resize)
+{
+    CEGUI::TextureTarget* const target = d_pool.acquire(CEGUI::Sizef(100, 100));
+
+    // sizes within the current capacity keep the texture as it is.
+    BOOST_CHECK_EQUAL(d_pool.resize(target, CEGUI::Sizef(120, 70)), target);
+    BOOST_CHECK(target->getArea().getSize() == CEGUI::Sizef(128, 128));
+
+    // without an idle target to use, the target itself is resized.
+    BOOST_CHECK_EQUAL(d_pool.resize(target, CEGUI::Sizef(300, 200)), target);
+    BOOST_CHECK(target->getArea().getSize() == CEGUI::Sizef(320, 256));
+    BOOST_CHECK(d_pool.getTextureBytesInUse() >= 320u * 256u * 4u);
+
+    // with one available, targets are swapped.
+    CEGUI::TextureTarget* const other = d_pool.acquire(CEGUI::Sizef(64, 64));
+    d_pool.release(other);
+    CEGUI::TextureTarget* const swapped = d_pool.resize(target, CEGUI::Sizef(60, 50));
+    BOOST_CHECK_EQUAL(swapped, other);
+    BOOST_CHECK(d_pool.isAcquired(*other));
+    BOOST_CHECK(!d_pool.isAcquired(*target));
+    BOOST_CHECK_EQUAL(d_pool.getIdleTargetCount(), 1u);
+
+    d_pool.release(swapped);
+}
+
+BOOST_AUTO_TEST_CASE(IdleBudget)
+{
+    CEGUI::TextureTarget* const a = d_pool.acquire(CEGUI::Sizef(64, 64));
+    CEGUI::TextureTarget* const b = d_pool.acquire(CEGUI::Sizef(64, 64));
+
+    // only what fits the budget is kept, oldest targets are destroyed first.
+    d_pool.setIdleBudget(64 * 64 * 4);
+    d_pool.release(a);
+    d_pool.release(b);
+    BOOST_CHECK_EQUAL(d_pool.getIdleTargetCount(), 1u);
+    BOOST_CHECK_EQUAL(d_pool.acquire(CEGUI::Sizef(64, 64)), b);
+
+    d_pool.setIdleBudget(0);
+    d_pool.release(b);
+    BOOST_CHECK_EQUAL(d_pool.getIdleTargetCount(), 0u);
+    BOOST_CHECK_EQUAL(d_pool.getIdleTextureBytes(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(AutoRenderingSurface)
+{
+    CEGUI::WindowManager& wmgr = CEGUI::WindowManager::getSingleton();
+    CEGUI::Window* const root = wmgr.createWindow("DefaultWindow");
+    root->setSize(CEGUI::USize(CEGUI::UDim(0, 800), CEGUI::UDim(0, 600)));
+    CEGUI::Window* const wnd = wmgr.createWindow("DefaultWindow");
+    wnd->setSize(CEGUI::USize(CEGUI::UDim(0, 100), CEGUI::UDim(0, 100)));
+    root->addChild(wnd);
+
+    const size_t acquired = d_pool.getAcquiredTargetCount();
+    wnd->setUsingAutoRenderingSurface(true);
+    BOOST_CHECK_EQUAL(d_pool.getAcquiredTargetCount(), acquired + 1);
+
+    CEGUI::RenderingWindow& surface =
+        static_cast<CEGUI::RenderingWindow&>(*wnd->getRenderingSurface());
+    CEGUI::TextureTarget* const target = &surface.getTextureTarget();
+    BOOST_CHECK(d_pool.isAcquired(*target));
+
+    // small size changes keep the texture, larger ones are handled by the pool
+    wnd->setSize(CEGUI::USize(CEGUI::UDim(0, 110), CEGUI::UDim(0, 120)));
+    BOOST_CHECK_EQUAL(&surface.getTextureTarget(), target);
+    BOOST_CHECK(surface.getSize() == CEGUI::Sizef(110, 120));
+    wnd->setSize(CEGUI::USize(CEGUI::UDim(0, 400), CEGUI::UDim(0, 300)));
+    BOOST_CHECK(surface.getTextureTarget().getArea().getSize() ==
+                CEGUI::Sizef(448, 320));
+    BOOST_CHECK(d_pool.isAcquired(surface.getTextureTarget()));
+
+    wnd->setUsingAutoRenderingSurface(false);
+    BOOST_CHECK_EQUAL(d_pool.getAcquiredTargetCount(), acquired);
+    BOOST_CHECK_EQUAL(d_pool.getIdleTargetCount(), 1u);
+
+    wmgr.destroyWindow(root);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
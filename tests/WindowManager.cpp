@@ -0,0 +1,328 @@
+/***********************************************************************
+ *    filename:   WindowManager.cpp
+ *    created:    Sun Oct 18 2026
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2013 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/WindowFactoryManager.h"
+#include "CEGUI/Window.h"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/timer.hpp>
+
+#include <vector>
+
+namespace
+{
+struct EventCounter
+{
+    explicit EventCounter(int* count) : d_count(count) {}
+
+    bool operator()(const CEGUI::EventArgs&)
+    {
+        ++*d_count;
+        return true;
+    }
+
+    int* d_count;
+};
+}
+
+BOOST_AUTO_TEST_SUITE(WindowManager)
+
+BOOST_AUTO_TEST_CASE(Registry)
+{
+    CEGUI::WindowManager& wmgr = CEGUI::WindowManager::getSingleton();
+
+    std::vector<CEGUI::Window*> windows;
+    for (int i = 0; i < 500; ++i)
+        windows.push_back(wmgr.createWindow("DefaultWindow"));
+
+    for (size_t i = 0; i < windows.size(); ++i)
+        BOOST_CHECK(wmgr.isAlive(windows[i]));
+
+    // destroy every third window and check the rest remain registered
+    for (size_t i = 0; i < windows.size(); i += 3)
+        wmgr.destroyWindow(windows[i]);
+
+    for (size_t i = 0; i < windows.size(); ++i)
+        BOOST_CHECK_EQUAL(wmgr.isAlive(windows[i]), i % 3 != 0);
+
+    size_t registered = 0;
+    CEGUI::WindowManager::WindowIterator it = wmgr.getIterator();
+    for (; !it.isAtEnd(); ++it)
+        for (size_t i = 1; i < windows.size(); ++i)
+            if (i % 3 != 0 && *it == windows[i])
+                ++registered;
+    BOOST_CHECK_EQUAL(registered, windows.size() - (windows.size() + 2) / 3);
+
+    for (size_t i = 1; i < windows.size(); ++i)
+        if (i % 3 != 0)
+            wmgr.destroyWindow(windows[i]);
+
+    for (size_t i = 0; i < windows.size(); ++i)
+        BOOST_CHECK(!wmgr.isAlive(windows[i]));
+
+    wmgr.cleanDeadPool();
+}
+
+BOOST_AUTO_TEST_CASE(SubtreeDestruction)
+{
+    CEGUI::WindowManager& wmgr = CEGUI::WindowManager::getSingleton();
+
+    CEGUI::Window* root = wmgr.createWindow("DefaultWindow");
+    CEGUI::Window* child = wmgr.createWindow("DefaultWindow");
+    CEGUI::Window* grandChild = wmgr.createWindow("DefaultWindow");
+    CEGUI::Window* kept = wmgr.createWindow("DefaultWindow");
+    root->addChild(child);
+    child->addChild(grandChild);
+    child->addChild(kept);
+    kept->setDestroyedByParent(false);
+
+    wmgr.destroyWindow(root);
+    BOOST_CHECK(!wmgr.isAlive(root));
+    BOOST_CHECK(!wmgr.isAlive(child));
+    BOOST_CHECK(!wmgr.isAlive(grandChild));
+    BOOST_CHECK(wmgr.isAlive(kept));
+    BOOST_CHECK(kept->getParent() == 0);
+
+    wmgr.destroyWindow(kept);
+    wmgr.cleanDeadPool();
+}
+
+BOOST_AUTO_TEST_CASE(WindowPooling)
+{
+    CEGUI::WindowManager& wmgr = CEGUI::WindowManager::getSingleton();
+    const CEGUI::String type("TaharezLook/FrameWindow");
+
+    wmgr.setWindowPoolLimit(type, 2);
+    BOOST_CHECK_EQUAL(wmgr.getWindowPoolLimit(type), 2u);
+    wmgr.resetWindowPoolStatistics();
+
+    CEGUI::Window* window = wmgr.createWindow(type);
+    BOOST_CHECK_EQUAL(wmgr.getWindowPoolMissCount(), 1u);
+    const size_t autoChildCount = window->getChildCount();
+    const CEGUI::String initialText(window->getText());
+
+    int clicks = 0;
+    window->subscribeEvent(CEGUI::Window::EventMouseClick, EventCounter(&clicks));
+    window->setText("Changed");
+    window->setUserString("Key", "Value");
+    window->setID(42);
+    CEGUI::Window* child = wmgr.createWindow("DefaultWindow");
+    window->addChild(child);
+
+    wmgr.destroyWindow(window);
+    BOOST_CHECK(!wmgr.isAlive(window));
+    BOOST_CHECK(!wmgr.isAlive(child));
+    BOOST_CHECK_EQUAL(wmgr.getPooledWindowCount(type), 1u);
+
+    CEGUI::Window* reused = wmgr.createWindow(type, "Reused");
+    BOOST_REQUIRE(reused == window);
+    BOOST_CHECK_EQUAL(wmgr.getWindowPoolHitCount(), 1u);
+    BOOST_CHECK_EQUAL(wmgr.getPooledWindowCount(type), 0u);
+    BOOST_CHECK(wmgr.isAlive(reused));
+    BOOST_CHECK_EQUAL(reused->getName(), "Reused");
+    BOOST_CHECK_EQUAL(reused->getText(), initialText);
+    BOOST_CHECK_EQUAL(reused->getID(), 0u);
+    BOOST_CHECK(!reused->isUserStringDefined("Key"));
+    BOOST_CHECK_EQUAL(reused->getChildCount(), autoChildCount);
+
+    CEGUI::MouseEventArgs args(reused);
+    reused->fireEvent(CEGUI::Window::EventMouseClick, args, CEGUI::Window::EventNamespace);
+    BOOST_CHECK_EQUAL(clicks, 0);
+
+    // the pool never holds more than its limit
+    std::vector<CEGUI::Window*> windows(1, reused);
+    for (int i = 0; i < 3; ++i)
+        windows.push_back(wmgr.createWindow(type));
+    for (size_t i = 0; i < windows.size(); ++i)
+        wmgr.destroyWindow(windows[i]);
+    BOOST_CHECK_EQUAL(wmgr.getPooledWindowCount(type), 2u);
+
+    wmgr.setWindowPoolLimit(type, 0);
+    BOOST_CHECK_EQUAL(wmgr.getPooledWindowCount(type), 0u);
+    BOOST_CHECK_EQUAL(wmgr.getWindowPoolLimit(type), 0u);
+    wmgr.cleanDeadPool();
+}
+
+BOOST_AUTO_TEST_CASE(WindowPoolingTypeRemoval)
+{
+    CEGUI::WindowManager& wmgr = CEGUI::WindowManager::getSingleton();
+    CEGUI::WindowFactoryManager& wfmgr = CEGUI::WindowFactoryManager::getSingleton();
+    const CEGUI::WindowFactoryManager::FalagardWindowMapping& button =
+        wfmgr.getFalagardMappingForType("TaharezLook/Button");
+    const CEGUI::String type("PoolTest/Button");
+    wfmgr.addFalagardWindowMapping(type, button.d_baseType, button.d_lookName,
+                                   button.d_rendererType);
+
+    wmgr.setWindowPoolLimit(type, 1);
+    CEGUI::Window* window = wmgr.createWindow(type);
+
+    // connections that went away must not pile up, nor must pruning them
+    // lose track of live ones.
+    int clicks = 0;
+    for (int i = 0; i < 100; ++i)
+        window->subscribeEvent(CEGUI::Window::EventMouseClick,
+                               EventCounter(&clicks))->disconnect();
+    window->subscribeEvent(CEGUI::Window::EventMouseClick, EventCounter(&clicks));
+
+    wmgr.destroyWindow(window);
+    BOOST_REQUIRE_EQUAL(wmgr.getPooledWindowCount(type), 1u);
+
+    window = wmgr.createWindow(type);
+    CEGUI::MouseEventArgs args(window);
+    window->fireEvent(CEGUI::Window::EventMouseClick, args, CEGUI::Window::EventNamespace);
+    BOOST_CHECK_EQUAL(clicks, 0);
+    wmgr.destroyWindow(window);
+    BOOST_REQUIRE_EQUAL(wmgr.getPooledWindowCount(type), 1u);
+
+    // parked windows are destroyed while their mapping still exists.
+    wfmgr.removeFalagardWindowMapping(type);
+    BOOST_CHECK_EQUAL(wmgr.getPooledWindowCount(type), 0u);
+    BOOST_CHECK_NO_THROW(wmgr.cleanDeadPool());
+
+    wmgr.setWindowPoolLimit(type, 0);
+}
+
+BOOST_AUTO_TEST_CASE(Performance)
+{
+    CEGUI::WindowManager& wmgr = CEGUI::WindowManager::getSingleton();
+    const CEGUI::LoggingLevel level = CEGUI::Logger::getSingleton().getLoggingLevel();
+    CEGUI::Logger::getSingleton().setLoggingLevel(CEGUI::Errors);
+
+    // a flat layout and a layout of 100 panels holding 100 windows each
+    const char* const names[] = {"flat", "nested"};
+    for (int layout = 0; layout < 2; ++layout)
+    {
+        boost::timer timer;
+        CEGUI::Window* root = wmgr.createWindow("DefaultWindow");
+        for (int i = 0; i < 100; ++i)
+        {
+            CEGUI::Window* panel = root;
+            if (layout == 1)
+            {
+                panel = wmgr.createWindow("DefaultWindow");
+                root->addChild(panel);
+            }
+
+            for (int j = 0; j < 100; ++j)
+                panel->addChild(wmgr.createWindow("DefaultWindow"));
+        }
+        const double created = timer.elapsed();
+
+        wmgr.destroyWindow(root);
+        wmgr.cleanDeadPool();
+
+        BOOST_TEST_MESSAGE("Time taken to create 10000 windows (" << names[layout] <<
+                           "): " << created << ", to destroy them: " <<
+                           timer.elapsed() - created);
+    }
+
+    // repeatedly create and destroy batches of a widget with child widgets
+    const CEGUI::String type("TaharezLook/FrameWindow");
+    for (int pooled = 0; pooled < 2; ++pooled)
+    {
+        wmgr.setWindowPoolLimit(type, pooled ? 50 : 0);
+        wmgr.resetWindowPoolStatistics();
+
+        boost::timer timer;
+        std::vector<CEGUI::Window*> windows;
+        for (int batch = 0; batch < 40; ++batch)
+        {
+            for (int i = 0; i < 50; ++i)
+                windows.push_back(wmgr.createWindow(type));
+            for (size_t i = 0; i < windows.size(); ++i)
+                wmgr.destroyWindow(windows[i]);
+            windows.clear();
+            wmgr.cleanDeadPool();
+        }
+
+        BOOST_TEST_MESSAGE("Time taken to create and destroy 2000 frame windows" <<
+                           (pooled ? " (pooled, " : " (") <<
+                           wmgr.getWindowPoolHitCount() << " hits, " <<
+                           wmgr.getWindowPoolMissCount() << " misses): " <<
+                           timer.elapsed());
+    }
+    wmgr.setWindowPoolLimit(type, 0);
+    wmgr.cleanDeadPool();
+
+    CEGUI::Logger::getSingleton().setLoggingLevel(level);
+}
+
+BOOST_AUTO_TEST_CASE(PooledCreationIsNotSlower)
+{
+    CEGUI::WindowManager& wmgr = CEGUI::WindowManager::getSingleton();
+    const CEGUI::LoggingLevel level = CEGUI::Logger::getSingleton().getLoggingLevel();
+    CEGUI::Logger::getSingleton().setLoggingLevel(CEGUI::Errors);
+
+    // a button has no child windows, so has little to gain from pooling, but
+    // is rich in properties defined by its look that need resetting.
+    const CEGUI::String type("TaharezLook/Button");
+    const CEGUI::String colourProperty("NormalTextColour");
+    double elapsed[2];
+    for (int pooled = 0; pooled < 2; ++pooled)
+    {
+        wmgr.setWindowPoolLimit(type, pooled ? 50 : 0);
+
+        boost::timer timer;
+        std::vector<CEGUI::Window*> windows;
+        for (int batch = 0; batch < 100; ++batch)
+        {
+            for (int i = 0; i < 50; ++i)
+            {
+                CEGUI::Window* window = wmgr.createWindow(type);
+                window->setText("Button");
+                window->setProperty(colourProperty, "FF00FF00");
+                windows.push_back(window);
+            }
+            for (size_t i = 0; i < windows.size(); ++i)
+                wmgr.destroyWindow(windows[i]);
+            windows.clear();
+            wmgr.cleanDeadPool();
+        }
+        elapsed[pooled] = timer.elapsed();
+    }
+
+    BOOST_TEST_MESSAGE("Time taken to create and destroy 5000 buttons: " <<
+                       elapsed[0] << ", pooled: " << elapsed[1]);
+    BOOST_CHECK_LE(elapsed[1], elapsed[0]);
+
+    // values of properties defined by the look are reset too
+    CEGUI::Window* window = wmgr.createWindow(type);
+    const CEGUI::String initialColour(window->getProperty(colourProperty));
+    BOOST_CHECK_NE(initialColour, "FF00FF00");
+    window->setProperty(colourProperty, "FF00FF00");
+    wmgr.destroyWindow(window);
+    BOOST_REQUIRE(wmgr.createWindow(type) == window);
+    BOOST_CHECK_EQUAL(window->getProperty(colourProperty), initialColour);
+    wmgr.destroyWindow(window);
+
+    wmgr.setWindowPoolLimit(type, 0);
+    wmgr.cleanDeadPool();
+    CEGUI::Logger::getSingleton().setLoggingLevel(level);
+}
+
+BOOST_AUTO_TEST_SUITE_END()